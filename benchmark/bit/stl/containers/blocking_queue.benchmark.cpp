@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures the wakeup latency of blocking_queue consumers
+ *
+ * A producer pushes timestamps at a fixed interval, so that the consumer is
+ * usually waiting when each one arrives. The consumer records the delay
+ * between the push and its return from the pop, and the percentiles of
+ * those delays are reported for each consumption strategy.
+ *****************************************************************************/
+
+#include <bit/stl/containers/blocking_queue.hpp>
+
+#include <algorithm> // std::sort
+#include <chrono>    // std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto samples  = std::size_t{10000};
+  constexpr auto interval = std::chrono::microseconds(50);
+
+  //---------------------------------------------------------------------------
+
+  void report( const char* name, std::vector<double> latencies )
+  {
+    std::sort( latencies.begin(), latencies.end() );
+
+    const auto percentile = [&]( double p ) {
+      return latencies[ static_cast<std::size_t>(p * (latencies.size() - 1)) ];
+    };
+
+    std::printf( "%-24s p50 %8.0f ns  p90 %8.0f ns  p99 %8.0f ns  p99.9 %8.0f ns\n",
+                 name,
+                 percentile(0.5),
+                 percentile(0.9),
+                 percentile(0.99),
+                 percentile(0.999) );
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Consume>
+  std::vector<double> measure( Consume consume )
+  {
+    bit::stl::blocking_queue<clock_type::time_point> queue(1024);
+    auto latencies = std::vector<double>{};
+    latencies.reserve( samples );
+
+    auto producer = std::thread([&]{
+      auto next = clock_type::now();
+      for( auto i = std::size_t{0}; i < samples; ++i ) {
+        next += interval;
+        std::this_thread::sleep_until( next );
+        queue.push_wait( clock_type::now() );
+      }
+    });
+
+    while( latencies.size() < samples ) {
+      consume( queue, latencies );
+    }
+    producer.join();
+
+    return latencies;
+  }
+
+  //---------------------------------------------------------------------------
+
+  void record( std::vector<double>& latencies, clock_type::time_point pushed )
+  {
+    const auto delay = clock_type::now() - pushed;
+    latencies.push_back(
+      static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count())
+    );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  using queue_type = bit::stl::blocking_queue<clock_type::time_point>;
+
+  report( "pop_wait", measure([]( queue_type& queue, std::vector<double>& out ){
+    record( out, queue.pop_wait() );
+  }));
+
+  report( "pop_up_to(32)", measure([]( queue_type& queue, std::vector<double>& out ){
+    clock_type::time_point batch[32];
+    const auto end = queue.pop_up_to( 32, batch );
+    for( auto it = batch; it != end; ++it ) {
+      record( out, *it );
+    }
+  }));
+
+  report( "try_pop (spinning)", measure([]( queue_type& queue, std::vector<double>& out ){
+    auto value = clock_type::time_point{};
+    while( !queue.try_pop(value) ) {}
+    record( out, value );
+  }));
+}
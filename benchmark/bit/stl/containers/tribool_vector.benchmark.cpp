@@ -0,0 +1,106 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures Kleene conjunction and counting over a million values,
+ *        packed in a tribool_vector against a std::vector<tribool>
+ *****************************************************************************/
+
+#include <bit/stl/containers/tribool_vector.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <random>  // std::mt19937
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto values     = std::size_t{1} << 20;
+  constexpr auto iterations = std::size_t{200};
+
+  //---------------------------------------------------------------------------
+
+  bit::stl::tribool random_tribool( std::mt19937& engine )
+  {
+    switch( engine() % 3 ) {
+    case 0:  return false;
+    case 1:  return true;
+    default: return bit::stl::indeterminate;
+    }
+  }
+
+  // The strong Kleene conjunction, as tribool_vector computes it
+  bit::stl::tribool kleene_and( bit::stl::tribool lhs, bit::stl::tribool rhs )
+  {
+    if( lhs == false || rhs == false ) return false;
+    if( lhs == true && rhs == true ) return true;
+    return bit::stl::indeterminate;
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Fn>
+  void report( const char* name, Fn fn )
+  {
+    const auto start = clock_type::now();
+    const auto result = fn();
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-28s %8.3f ns/value (checksum %zu)\n",
+                 name,
+                 static_cast<double>(ns) / (iterations * values),
+                 result );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto engine = std::mt19937{42};
+
+  auto unpacked_lhs = std::vector<bit::stl::tribool>{};
+  auto unpacked_rhs = std::vector<bit::stl::tribool>{};
+  auto packed_lhs   = bit::stl::tribool_vector{};
+  auto packed_rhs   = bit::stl::tribool_vector{};
+
+  for( auto i = std::size_t{0}; i < values; ++i ) {
+    const auto lhs = random_tribool( engine );
+    const auto rhs = random_tribool( engine );
+
+    unpacked_lhs.push_back( lhs );
+    unpacked_rhs.push_back( rhs );
+    packed_lhs.push_back( lhs );
+    packed_rhs.push_back( rhs );
+  }
+
+  report( "vector<tribool> and+count", [&]{
+    auto result = std::size_t{0};
+    auto out = std::vector<bit::stl::tribool>( values );
+    for( auto n = std::size_t{0}; n < iterations; ++n ) {
+      for( auto i = std::size_t{0}; i < values; ++i ) {
+        out[i] = kleene_and( unpacked_lhs[i], unpacked_rhs[i] );
+      }
+      for( auto v : out ) {
+        result += (v == true) ? 1u : 0u;
+      }
+    }
+    return result;
+  });
+
+  report( "tribool_vector and+count", [&]{
+    auto result = std::size_t{0};
+    auto out = bit::stl::tribool_vector{};
+    for( auto n = std::size_t{0}; n < iterations; ++n ) {
+      out = packed_lhs;
+      out &= packed_rhs;
+      result += out.count_true();
+    }
+    return result;
+  });
+
+  std::printf( "\nstorage: vector<tribool> %zu bytes, tribool_vector %zu bytes\n",
+               values * sizeof(bit::stl::tribool),
+               2 * (values / 8) );
+}
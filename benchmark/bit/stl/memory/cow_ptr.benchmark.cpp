@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares passing a read-mostly configuration object by value as a
+ *        deep copy against passing it as a cow_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/cow_ptr.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <map>     // std::map
+#include <string>  // std::string
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto iterations = std::size_t{200000};
+
+  using configuration = std::map<std::string,std::string>;
+
+  configuration make_configuration()
+  {
+    auto config = configuration{};
+    for( auto i = 0; i < 32; ++i ) {
+      config.emplace( "setting.key." + std::to_string(i),
+                      "a value long enough to allocate " + std::to_string(i) );
+    }
+    return config;
+  }
+
+  //---------------------------------------------------------------------------
+
+  std::size_t handle( configuration config )
+  {
+    return config.size();
+  }
+
+  std::size_t handle( bit::stl::cow_ptr<configuration> config )
+  {
+    return config.cget()->size();
+  }
+
+  template<typename Configuration>
+  void report( const char* name, const Configuration& config )
+  {
+    auto total = std::size_t{0};
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      total += handle( config );
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-24s %10.2f ns/call (checksum %zu)\n",
+                 name,
+                 static_cast<double>(ns) / iterations,
+                 total );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  const auto config = make_configuration();
+  const auto shared = bit::stl::make_cow<configuration>( config );
+
+  report( "deep copy", config );
+  report( "cow_ptr", shared );
+}
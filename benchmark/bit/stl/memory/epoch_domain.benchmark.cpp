@@ -0,0 +1,88 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the read-side cost of pinning an epoch_domain against
+ *        the alternatives a reader of a shared structure would otherwise
+ *        use, and measures retire throughput
+ *****************************************************************************/
+
+#include <bit/stl/memory/epoch_domain.hpp>
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <memory>  // std::shared_ptr, std::atomic_load
+#include <mutex>   // std::mutex
+#include <thread>  // std::thread
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto iterations = std::size_t{10000000};
+
+  struct node
+  {
+    int value = 0;
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Fn>
+  void report( const char* name, const char* unit, Fn&& fn )
+  {
+    auto sum = 0;
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      sum += fn();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-36s %6.2f ns/%s (%d)\n",
+                 name,
+                 static_cast<double>(ns) / iterations,
+                 unit,
+                 sum & 1 );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  // Some standard libraries use non-atomic shared_ptr counts until a second
+  // thread is started; start one so the comparison reflects real programs
+  std::thread([]{}).join();
+
+  bit::stl::epoch_domain domain;
+  bit::stl::epoch_domain::participant participant{domain};
+
+  auto value = node{};
+  std::atomic<node*> raw{&value};
+  auto shared = std::make_shared<node>();
+  std::mutex mutex;
+
+  report( "epoch_domain pin + load", "read", [&]{
+    auto guard = participant.pin();
+    return raw.load( std::memory_order_acquire )->value;
+  });
+
+  report( "std::mutex lock + load", "read", [&]{
+    std::lock_guard<std::mutex> lock(mutex);
+    return raw.load( std::memory_order_relaxed )->value;
+  });
+
+  report( "std::atomic_load( shared_ptr )", "read", [&]{
+    return std::atomic_load( &shared )->value;
+  });
+
+  report( "epoch_domain retire", "retire", [&]{
+    participant.retire( new node{} );
+    return 0;
+  });
+
+  while( participant.pending() != 0 ) {
+    participant.collect();
+  }
+}
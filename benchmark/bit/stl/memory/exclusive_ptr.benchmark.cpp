@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares creation and destruction of exclusive_ptr against
+ *        std::unique_ptr
+ *
+ * Each variant creates a batch of pointers, then destroys the whole batch,
+ * so that creation and destruction are both measured without the optimizer
+ * eliding either.
+ *****************************************************************************/
+
+#include <bit/stl/memory/exclusive_ptr.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <memory>  // std::unique_ptr, std::make_unique
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto rounds = std::size_t{200};
+  constexpr auto batch  = std::size_t{10000};
+
+  struct widget
+  {
+    explicit widget( int value ) : values{value, value, value, value}{}
+
+    int values[4];
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Pointer, typename Make>
+  void report( const char* name, Make make )
+  {
+    auto pointers = std::vector<Pointer>{};
+    pointers.reserve( batch );
+
+    const auto start = clock_type::now();
+    for( auto r = std::size_t{0}; r < rounds; ++r ) {
+      for( auto i = std::size_t{0}; i < batch; ++i ) {
+        pointers.push_back( make( static_cast<int>(i) ) );
+      }
+      pointers.clear();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-40s %8.2f ns/create+destroy\n",
+                 name,
+                 static_cast<double>(ns) / (rounds * batch) );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  using unique_type    = std::unique_ptr<widget>;
+  using exclusive_type = bit::stl::exclusive_ptr<widget>;
+
+  report<unique_type>( "std::make_unique", []( int i ){
+    return std::make_unique<widget>(i);
+  });
+
+  report<exclusive_type>( "make_exclusive", []( int i ){
+    return bit::stl::make_exclusive<widget>(i);
+  });
+
+  report<exclusive_type>( "exclusive_ptr( new T )", []( int i ){
+    return exclusive_type( new widget(i) );
+  });
+
+  report<exclusive_type>( "exclusive_ptr( new T, deleter )", []( int i ){
+    return exclusive_type( new widget(i), []( widget* p ){ delete p; } );
+  });
+}
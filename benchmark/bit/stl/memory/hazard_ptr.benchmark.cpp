@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares read-mostly access to a shared pointer protected by a
+ *        hazard_ptr against the same access guarded by a mutex
+ *****************************************************************************/
+
+#include <bit/stl/memory/hazard_ptr.hpp>
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <mutex>   // std::mutex
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto iterations  = std::size_t{10000000};
+  constexpr auto write_every = std::size_t{100};
+
+  struct node
+  {
+    explicit node( int value = 0 ) : value(value){}
+
+    int value;
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Read, typename Write>
+  void report( const char* name, Read&& read, Write&& write )
+  {
+    auto sum = 0;
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      if( i % write_every == 0 ) {
+        write( static_cast<int>(i) );
+      } else {
+        sum += read();
+      }
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-36s %6.2f ns/op (%d)\n",
+                 name,
+                 static_cast<double>(ns) / iterations,
+                 sum & 1 );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "1 write per %zu operations\n", write_every );
+
+  {
+    bit::stl::hazard_domain domain;
+    bit::stl::hazard_ptr<node> hazard{domain};
+    std::atomic<node*> shared{new node{}};
+
+    report( "hazard_ptr protect + load", [&]{
+      const auto value = hazard.protect( shared )->value;
+      hazard.reset();
+      return value;
+    }, [&]( int value ){
+      domain.retire( shared.exchange( new node{value} ) );
+    });
+
+    delete shared.load();
+  }
+
+  {
+    std::mutex mutex;
+    node* shared = new node{};
+
+    report( "std::mutex lock + load", [&]{
+      std::lock_guard<std::mutex> lock(mutex);
+      return shared->value;
+    }, [&]( int value ){
+      auto* const replacement = new node{value};
+      node* old;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        old = shared;
+        shared = replacement;
+      }
+      delete old;
+    });
+
+    delete shared;
+  }
+}
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares random reads from a large table allocated with
+ *        std::allocator against the same table from huge_page_allocator
+ *****************************************************************************/
+
+#include <bit/stl/memory/huge_page_allocator.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::printf
+#include <memory>  // std::allocator
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto table_size = std::size_t{1} << 25; // 256 MiB of uint64_t
+  constexpr auto lookups    = std::size_t{20000000};
+
+  //---------------------------------------------------------------------------
+
+  template<typename Allocator>
+  void report( const char* name )
+  {
+    auto table = std::vector<std::uint64_t,Allocator>(table_size);
+    for( auto i = std::size_t{0}; i < table_size; ++i ) {
+      table[i] = i;
+    }
+
+    auto sum   = std::uint64_t{0};
+    auto state = std::uint64_t{0x9e3779b97f4a7c15};
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < lookups; ++i ) {
+      state = state * 6364136223846793005u + 1442695040888963407u;
+      sum  += table[(state >> 17) & (table_size - 1)];
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-36s %6.2f ns/lookup (%d)\n",
+                 name,
+                 static_cast<double>(ns) / lookups,
+                 static_cast<int>(sum & 1) );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  report<std::allocator<std::uint64_t>>( "std::allocator" );
+  report<bit::stl::huge_page_allocator<std::uint64_t>>( "huge_page_allocator" );
+}
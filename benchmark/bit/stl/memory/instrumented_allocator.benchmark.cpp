@@ -0,0 +1,73 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures the overhead that instrumented_allocator adds to
+ *        allocations through std::allocator, on one thread and with
+ *        several threads sharing a tracker
+ *****************************************************************************/
+
+#include <bit/stl/memory/instrumented_allocator.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <memory>  // std::allocator
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto iterations = std::size_t{5000000};
+
+  //---------------------------------------------------------------------------
+
+  template<typename Allocator>
+  void allocate_loop( Allocator allocator, std::size_t count )
+  {
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      auto* p = allocator.allocate(1 + (i & 7));
+      allocator.deallocate(p, 1 + (i & 7));
+    }
+  }
+
+  template<typename Allocator>
+  void report( const char* name, const Allocator& allocator, std::size_t threads )
+  {
+    auto workers = std::vector<std::thread>{};
+
+    const auto start = clock_type::now();
+    for( auto t = std::size_t{0}; t < threads; ++t ) {
+      workers.emplace_back( allocate_loop<Allocator>, allocator, iterations / threads );
+    }
+    for( auto& worker : workers ) {
+      worker.join();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-36s %zu thread(s) %6.2f ns/allocate+deallocate\n",
+                 name,
+                 threads,
+                 static_cast<double>(ns) / iterations );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  using instrumented = bit::stl::instrumented_allocator<std::allocator<int>>;
+
+  bit::stl::allocation_tracker tracker{"benchmark"};
+
+  for( auto threads : {std::size_t{1}, std::size_t{4}} ) {
+    report( "std::allocator", std::allocator<int>{}, threads );
+    report( "instrumented_allocator", instrumented{tracker}, threads );
+  }
+
+  const auto stats = tracker.snapshot();
+  std::printf( "tracked %zu allocations, %zu bytes, peak %zu bytes\n",
+               stats.allocations,
+               stats.bytes_allocated,
+               stats.peak_bytes );
+}
@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the cost of copying and releasing shared pointers on a
+ *        single thread for std::shared_ptr and each intrusive_ptr count
+ *        policy
+ *****************************************************************************/
+
+#include <bit/stl/memory/intrusive_ptr.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <memory>  // std::shared_ptr
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto rounds = std::size_t{2000};
+  constexpr auto copies = std::size_t{1000};
+
+  template<typename CountPolicy>
+  struct node : bit::stl::intrusive_ref_counter<node<CountPolicy>,CountPolicy>
+  {
+    int value = 0;
+  };
+
+  struct plain_node
+  {
+    int value = 0;
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Pointer>
+  void report( const char* name, const Pointer& original )
+  {
+    auto pointers = std::vector<Pointer>{};
+    pointers.reserve( copies );
+
+    const auto start = clock_type::now();
+    for( auto r = std::size_t{0}; r < rounds; ++r ) {
+      for( auto i = std::size_t{0}; i < copies; ++i ) {
+        pointers.push_back( original );
+      }
+      pointers.clear();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-36s %6.2f ns/copy+release\n",
+                 name,
+                 static_cast<double>(ns) / (rounds * copies) );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  using bit::stl::intrusive_ptr;
+  using bit::stl::nonatomic_count_policy;
+  using bit::stl::atomic_count_policy;
+  using bit::stl::biased_count_policy;
+
+  // Some standard libraries use non-atomic shared_ptr counts until a second
+  // thread is started; start one so the comparison reflects real programs
+  std::thread([]{}).join();
+
+  report( "std::shared_ptr", std::make_shared<plain_node>() );
+  report( "intrusive_ptr<nonatomic_count_policy>",
+          bit::stl::make_intrusive<node<nonatomic_count_policy>>() );
+  report( "intrusive_ptr<atomic_count_policy>",
+          bit::stl::make_intrusive<node<atomic_count_policy>>() );
+  report( "intrusive_ptr<biased_count_policy>",
+          bit::stl::make_intrusive<node<biased_count_policy>>() );
+}
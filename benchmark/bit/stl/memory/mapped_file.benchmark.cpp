@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares counting the lines of a large file read into a buffer
+ *        with read() against the same file viewed through mapped_file
+ *****************************************************************************/
+
+#include <bit/stl/memory/mapped_file.hpp>
+
+#include <algorithm> // std::count
+#include <chrono>    // std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf, std::remove
+#include <cstdlib>   // mkstemp
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include <fcntl.h>    // ::open
+#include <sys/stat.h> // ::fstat
+#include <unistd.h>   // ::read, ::write, ::close
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto file_size = std::size_t{1} << 28; // 256 MiB
+  constexpr auto passes    = 4;
+
+  //---------------------------------------------------------------------------
+
+  std::size_t count_with_read( const char* path )
+  {
+    const auto fd = ::open( path, O_RDONLY );
+
+    struct ::stat status;
+    ::fstat( fd, &status );
+    auto buffer = std::vector<char>( static_cast<std::size_t>(status.st_size) );
+
+    auto offset = std::size_t{0};
+    for( auto n = ::read( fd, buffer.data(), buffer.size() ); n > 0;
+         n = ::read( fd, buffer.data() + offset, buffer.size() - offset ) ) {
+      offset += static_cast<std::size_t>(n);
+    }
+    ::close( fd );
+
+    return static_cast<std::size_t>(std::count( buffer.begin(), buffer.begin() + offset, '\n' ));
+  }
+
+  std::size_t count_with_mapping( const char* path )
+  {
+    const auto file = bit::stl::mapped_file{ path, bit::stl::map_mode::read_only, true };
+    file.advise( bit::stl::map_advice::sequential );
+
+    const auto chars = file.chars();
+    return static_cast<std::size_t>(std::count( chars.begin(), chars.end(), '\n' ));
+  }
+
+  template<typename Fn>
+  void report( const char* name, const char* path, Fn fn )
+  {
+    auto lines = std::size_t{0};
+
+    const auto start = clock_type::now();
+    for( auto i = 0; i < passes; ++i ) {
+      lines += fn( path );
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+
+    std::printf( "%-12s %8.2f ms/pass (%zu lines)\n",
+                 name,
+                 static_cast<double>(ms) / passes,
+                 lines / passes );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto path = std::string{"/tmp/bit_stl_mapped_file_benchmark_XXXXXX"};
+  const auto fd = ::mkstemp( &path[0] );
+
+  auto line = std::string(79,'x') + '\n';
+  auto chunk = std::string{};
+  while( chunk.size() < (1u << 20) ) {
+    chunk += line;
+  }
+  for( auto written = std::size_t{0}; written < file_size; written += chunk.size() ) {
+    (void) ::write( fd, chunk.data(), chunk.size() );
+  }
+  ::close( fd );
+
+  report( "read()", path.c_str(), count_with_read );
+  report( "mapped_file", path.c_str(), count_with_mapping );
+
+  std::remove( path.c_str() );
+}
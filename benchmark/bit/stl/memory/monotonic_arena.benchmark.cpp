@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares allocation-heavy request handling using the default
+ *        allocator against a per-request monotonic_arena
+ *
+ * Each simulated request parses a set of headers into a vector of strings
+ * and an ordered map, then discards everything once handled.
+ *****************************************************************************/
+
+#include <bit/stl/memory/monotonic_arena.hpp>
+
+#include <chrono>     // std::chrono::steady_clock
+#include <cstddef>    // std::size_t
+#include <cstdio>     // std::printf
+#include <functional> // std::less
+#include <map>        // std::map
+#include <memory>     // std::allocator
+#include <string>     // std::basic_string
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto requests = std::size_t{20000};
+  constexpr auto headers  = std::size_t{32};
+
+  volatile std::size_t sink = 0;
+
+  //---------------------------------------------------------------------------
+
+  template<template<typename> class Allocator, typename...Args>
+  void handle_request( std::size_t id, Args&...args )
+  {
+    using string_type = std::basic_string<char,std::char_traits<char>,Allocator<char>>;
+    using vector_type = std::vector<string_type,Allocator<string_type>>;
+    using map_type    = std::map<string_type,string_type,std::less<string_type>,
+                                 Allocator<std::pair<const string_type,string_type>>>;
+
+    auto lines  = vector_type( Allocator<string_type>(args...) );
+    auto fields = map_type( Allocator<std::pair<const string_type,string_type>>(args...) );
+
+    for( auto i = std::size_t{0}; i < headers; ++i ) {
+      auto key   = string_type( "X-Request-Header-Field-", Allocator<char>(args...) );
+      auto value = string_type( "a value that does not fit in a small buffer ",
+                                Allocator<char>(args...) );
+      key.push_back( static_cast<char>('a' + (i % 26)) );
+      key.push_back( static_cast<char>('a' + (id % 26)) );
+
+      lines.push_back( key );
+      fields.emplace( std::move(key), std::move(value) );
+    }
+
+    sink = sink + lines.size() + fields.size();
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Fn>
+  void report( const char* name, Fn&& fn )
+  {
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < requests; ++i ) {
+      fn(i);
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-28s %10.0f ns/request\n",
+                 name,
+                 static_cast<double>(ns) / requests );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  report( "std::allocator", []( std::size_t id ){
+    handle_request<std::allocator>( id );
+  });
+
+  report( "monotonic_arena (heap)", []( std::size_t id ){
+    bit::stl::monotonic_arena arena(16384);
+    handle_request<bit::stl::arena_allocator>( id, arena );
+  });
+
+  report( "monotonic_arena (stack)", []( std::size_t id ){
+    alignas(std::max_align_t) char buffer[16384];
+    bit::stl::monotonic_arena arena(buffer, sizeof(buffer));
+    handle_request<bit::stl::arena_allocator>( id, arena );
+  });
+}
@@ -0,0 +1,121 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares multi-threaded allocation of small objects through
+ *        pool_allocator against the global allocator
+ *
+ * Each thread repeatedly allocates a batch of control-block sized objects
+ * and frees them. In the cross-thread variant, every thread instead frees
+ * the batch allocated by its neighbour in the previous round.
+ *****************************************************************************/
+
+#include <bit/stl/memory/pool_allocator.hpp>
+
+#include <chrono>             // std::chrono::steady_clock
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <cstdio>             // std::printf
+#include <memory>             // std::allocator, std::allocator_traits
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto thread_count = std::size_t{4};
+  constexpr auto rounds       = std::size_t{2000};
+  constexpr auto batch        = std::size_t{256};
+
+  /// An object the size of a typical control block
+  struct node
+  {
+    void* pointers[4];
+  };
+
+  //---------------------------------------------------------------------------
+
+  /// A reusable barrier, since rounds must not overlap
+  class barrier
+  {
+  public:
+
+    explicit barrier( std::size_t count ) : m_count(count), m_waiting(0), m_phase(0){}
+
+    void wait()
+    {
+      auto lock  = std::unique_lock<std::mutex>(m_mutex);
+      const auto phase = m_phase;
+      if( ++m_waiting == m_count ) {
+        m_waiting = 0;
+        ++m_phase;
+        m_cv.notify_all();
+        return;
+      }
+      m_cv.wait( lock, [&]{ return phase != m_phase; } );
+    }
+
+  private:
+
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    std::size_t             m_count;
+    std::size_t             m_waiting;
+    std::size_t             m_phase;
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Allocator>
+  double run( bool cross_thread )
+  {
+    using traits_type = std::allocator_traits<Allocator>;
+
+    auto slots   = std::vector<std::vector<node*>>( thread_count,
+                                                    std::vector<node*>(batch) );
+    barrier sync(thread_count);
+    auto threads = std::vector<std::thread>{};
+
+    const auto start = clock_type::now();
+    for( auto t = std::size_t{0}; t < thread_count; ++t ) {
+      threads.emplace_back([&,t]{
+        auto allocator = Allocator{};
+        for( auto r = std::size_t{0}; r < rounds; ++r ) {
+          for( auto& p : slots[t] ) {
+            p = traits_type::allocate( allocator, 1 );
+          }
+          if( cross_thread ) sync.wait();
+
+          auto& victim = slots[cross_thread ? (t + 1) % thread_count : t];
+          for( auto* p : victim ) {
+            traits_type::deallocate( allocator, p, 1 );
+          }
+          if( cross_thread ) sync.wait();
+        }
+      });
+    }
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    return static_cast<double>(ns) / (thread_count * rounds * batch);
+  }
+
+  //---------------------------------------------------------------------------
+
+  void report( const char* name, double ns )
+  {
+    std::printf( "%-36s %8.2f ns/alloc+free\n", name, ns );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  report( "std::allocator (thread-local)", run<std::allocator<node>>( false ) );
+  report( "pool_allocator (thread-local)", run<bit::stl::pool_allocator<node>>( false ) );
+  report( "std::allocator (cross-thread)", run<std::allocator<node>>( true ) );
+  report( "pool_allocator (cross-thread)", run<bit::stl::pool_allocator<node>>( true ) );
+}
@@ -0,0 +1,74 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares copying small polymorphic values stored inline against
+ *        storing them on the heap
+ *
+ * The heap variant uses a small_clone_ptr whose buffer only fits a pointer,
+ * which forces every object through the allocator.
+ *****************************************************************************/
+
+#include <bit/stl/memory/small_clone_ptr.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto rounds = std::size_t{200};
+  constexpr auto count  = std::size_t{10000};
+
+  struct shape
+  {
+    virtual ~shape() = default;
+    virtual double area() const noexcept = 0;
+  };
+
+  struct rectangle final : shape
+  {
+    rectangle( double w, double h ) noexcept : width(w), height(h){}
+
+    double area() const noexcept override { return width * height; }
+
+    double width;
+    double height;
+    double origin[2] = {};
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Pointer>
+  void report( const char* name )
+  {
+    auto source = std::vector<Pointer>{};
+    source.reserve( count );
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      source.emplace_back( bit::stl::in_place_type<rectangle>,
+                           static_cast<double>(i), 2.0 );
+    }
+
+    auto total = 0.0;
+    const auto start = clock_type::now();
+    for( auto r = std::size_t{0}; r < rounds; ++r ) {
+      auto copy = source;
+      total += copy[r % count]->area();
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-32s %8.2f ns/copy (checksum %.0f)\n",
+                 name,
+                 static_cast<double>(ns) / (rounds * count),
+                 total );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  report<bit::stl::small_clone_ptr<shape>>( "small_clone_ptr (inline)" );
+  report<bit::stl::small_clone_ptr<shape,sizeof(void*)>>( "small_clone_ptr (heap)" );
+}
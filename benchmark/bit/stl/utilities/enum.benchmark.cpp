@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures from_string of an enum registered with
+ *        BIT_REGISTER_ENUM, against the hand-written comparison chain that
+ *        registration replaces
+ *****************************************************************************/
+
+#include <bit/stl/utilities/enum.hpp>
+#include <bit/stl/utilities/compiler_traits.hpp> // BIT_NO_INLINE
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf
+#include <cstring> // std::strlen
+#include <random>  // std::mt19937
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto lookups    = std::size_t{1} << 16;
+  constexpr auto iterations = std::size_t{100};
+
+  enum class http_header
+  {
+    accept, accept_charset, accept_encoding, accept_language, age, allow,
+    authorization, cache_control, connection, content_encoding,
+    content_language, content_length, content_location, content_range,
+    content_type, cookie, date, etag, expect, expires, from, host, if_match,
+    if_modified_since, if_none_match, if_range, if_unmodified_since,
+    last_modified, location, max_forwards, origin, pragma,
+    proxy_authenticate, proxy_authorization, range, referer, retry_after,
+    server, set_cookie, te, trailer, transfer_encoding, upgrade, user_agent,
+    vary, via, warning, www_authenticate
+  };
+
+} // anonymous namespace
+
+BIT_REGISTER_ENUM(http_header,
+  accept, accept_charset, accept_encoding, accept_language, age, allow,
+  authorization, cache_control, connection, content_encoding,
+  content_language, content_length, content_location, content_range,
+  content_type, cookie, date, etag, expect, expires, from, host, if_match,
+  if_modified_since, if_none_match, if_range, if_unmodified_since,
+  last_modified, location, max_forwards, origin, pragma,
+  proxy_authenticate, proxy_authorization, range, referer, retry_after,
+  server, set_cookie, te, trailer, transfer_encoding, upgrade, user_agent,
+  vary, via, warning, www_authenticate
+);
+
+namespace {
+
+  //---------------------------------------------------------------------------
+  // Hand-written conversions
+  //---------------------------------------------------------------------------
+
+  /// Compares each name in turn, as a hand-written from_string does
+  BIT_NO_INLINE http_header chain_from_string( bit::stl::string_view s )
+  {
+    for( auto e : bit::stl::make_enum_range<http_header>() ) {
+      const auto* name = bit::stl::enum_traits<http_header>::to_string( e );
+      if( s.size() == std::strlen(name) && s.compare( name ) == 0 ) {
+        return e;
+      }
+    }
+    throw bit::stl::bad_enum_cast("bad_enum_cast");
+  }
+
+  BIT_NO_INLINE http_header registered_from_string( bit::stl::string_view s )
+  {
+    return bit::stl::enum_traits<http_header>::from_string( s );
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Parser>
+  void report( const char* name,
+               const std::vector<std::string>& inputs,
+               Parser parser )
+  {
+    auto checksum = std::size_t{0};
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      for( const auto& input : inputs ) {
+        checksum += static_cast<std::size_t>(parser( input ));
+      }
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-12s %8.3f ns/lookup (checksum %zu)\n",
+                 name,
+                 static_cast<double>(ns) / (iterations * inputs.size()),
+                 checksum );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  const auto first = bit::stl::enum_traits<http_header>::begin();
+  const auto count = static_cast<std::size_t>(bit::stl::enum_traits<http_header>::end() - first);
+
+  auto engine = std::mt19937{42};
+  auto inputs = std::vector<std::string>{};
+
+  for( auto i = std::size_t{0}; i < lookups; ++i ) {
+    inputs.push_back( bit::stl::enum_cast<std::string>( first[engine() % count] ) );
+  }
+
+  report( "chain", inputs, []( const std::string& s ){
+    return chain_from_string( s );
+  } );
+  report( "registered", inputs, []( const std::string& s ){
+    return registered_from_string( s );
+  } );
+}
@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures a 10-step parse chain written with expected's monadic
+ *        operations and with BIT_EXPECTED_TRY, against the hand-unrolled
+ *        version
+ *
+ * Each parser is kept out of line, so their code size can be compared with
+ * \code
+ * nm -C --print-size --size-sort bit_stl_benchmark_expected | grep parse_
+ * \endcode
+ *
+ * The chained steps take and return the state by value, so each step moves
+ * the state into its own result; the hand-unrolled parser mutates a single
+ * state in place. The difference between the two is the cost of that style,
+ * since the monadic operations themselves add no copies.
+ *****************************************************************************/
+
+#include <bit/stl/utilities/expected.hpp>
+#include <bit/stl/utilities/compiler_traits.hpp> // BIT_NO_INLINE
+
+#include <chrono>       // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <cstdio>       // std::printf
+#include <random>       // std::mt19937
+#include <string>       // std::string
+#include <system_error> // std::errc
+#include <vector>       // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto fields     = std::size_t{10};
+  constexpr auto records    = std::size_t{1} << 16;
+  constexpr auto iterations = std::size_t{100};
+
+  //---------------------------------------------------------------------------
+
+  /// The state threaded through each step of the parse
+  struct parse_state
+  {
+    const char*   cursor;
+    const char*   end;
+    std::uint32_t values[fields];
+  };
+
+  using parse_result = bit::stl::expected<parse_state>;
+
+  /// Parses the comma-terminated field \p index, advancing the cursor
+  ///
+  /// \return \c true on success
+  bool parse_field( parse_state& state, std::size_t index )
+  {
+    auto value = std::uint32_t{0};
+    auto digits = 0;
+
+    while( state.cursor != state.end && *state.cursor != ',' ) {
+      const auto c = *state.cursor++;
+      if( c < '0' || c > '9' ) {
+        return false;
+      }
+      value = value * 10 + static_cast<std::uint32_t>(c - '0');
+      ++digits;
+    }
+    if( digits == 0 || state.cursor == state.end ) {
+      return false;
+    }
+    ++state.cursor;
+    state.values[index] = value;
+
+    return true;
+  }
+
+  template<std::size_t Index>
+  parse_result step( parse_state&& state )
+  {
+    if( !parse_field( state, Index ) ) {
+      return bit::stl::make_unexpected<std::error_condition>( std::errc::invalid_argument );
+    }
+    return std::move(state);
+  }
+
+  //---------------------------------------------------------------------------
+  // Parsers
+  //---------------------------------------------------------------------------
+
+  BIT_NO_INLINE parse_result parse_unrolled( const char* first, const char* last )
+  {
+    const auto error = []{
+      return bit::stl::make_unexpected<std::error_condition>( std::errc::invalid_argument );
+    };
+
+    auto state = parse_state{ first, last, {} };
+
+    if( !parse_field( state, 0 ) ) return error();
+    if( !parse_field( state, 1 ) ) return error();
+    if( !parse_field( state, 2 ) ) return error();
+    if( !parse_field( state, 3 ) ) return error();
+    if( !parse_field( state, 4 ) ) return error();
+    if( !parse_field( state, 5 ) ) return error();
+    if( !parse_field( state, 6 ) ) return error();
+    if( !parse_field( state, 7 ) ) return error();
+    if( !parse_field( state, 8 ) ) return error();
+    if( !parse_field( state, 9 ) ) return error();
+
+    return state;
+  }
+
+  BIT_NO_INLINE parse_result parse_monadic( const char* first, const char* last )
+  {
+    return parse_result( bit::stl::in_place, parse_state{ first, last, {} } )
+      .and_then( step<0> )
+      .and_then( step<1> )
+      .and_then( step<2> )
+      .and_then( step<3> )
+      .and_then( step<4> )
+      .and_then( step<5> )
+      .and_then( step<6> )
+      .and_then( step<7> )
+      .and_then( step<8> )
+      .and_then( step<9> );
+  }
+
+  BIT_NO_INLINE parse_result parse_try( const char* first, const char* last )
+  {
+    BIT_EXPECTED_TRY( s0, step<0>( parse_state{ first, last, {} } ) );
+    BIT_EXPECTED_TRY( s1, step<1>( std::move(s0) ) );
+    BIT_EXPECTED_TRY( s2, step<2>( std::move(s1) ) );
+    BIT_EXPECTED_TRY( s3, step<3>( std::move(s2) ) );
+    BIT_EXPECTED_TRY( s4, step<4>( std::move(s3) ) );
+    BIT_EXPECTED_TRY( s5, step<5>( std::move(s4) ) );
+    BIT_EXPECTED_TRY( s6, step<6>( std::move(s5) ) );
+    BIT_EXPECTED_TRY( s7, step<7>( std::move(s6) ) );
+    BIT_EXPECTED_TRY( s8, step<8>( std::move(s7) ) );
+    return step<9>( std::move(s8) );
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Parser>
+  void report( const char* name,
+               const std::vector<std::string>& inputs,
+               Parser parser )
+  {
+    auto checksum = std::size_t{0};
+
+    const auto start = clock_type::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      for( const auto& input : inputs ) {
+        const auto result = parser( input.data(), input.data() + input.size() );
+        checksum += result ? result->values[fields - 1] : 1;
+      }
+    }
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-10s %8.3f ns/record (checksum %zu)\n",
+                 name,
+                 static_cast<double>(ns) / (iterations * inputs.size()),
+                 checksum );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto engine = std::mt19937{42};
+  auto inputs = std::vector<std::string>{};
+
+  // One record in sixteen is malformed at a random field, so both the
+  // success and the early-return paths are exercised
+  for( auto i = std::size_t{0}; i < records; ++i ) {
+    const auto bad_field = (engine() % 16 == 0) ? engine() % fields : fields;
+
+    auto record = std::string{};
+    for( auto f = std::size_t{0}; f < fields; ++f ) {
+      record += (f == bad_field) ? std::string{"x"} : std::to_string( engine() % 100000 );
+      record += ',';
+    }
+    inputs.push_back( std::move(record) );
+  }
+
+  report( "unrolled", inputs, parse_unrolled );
+  report( "monadic", inputs, parse_monadic );
+  report( "try", inputs, parse_try );
+}
@@ -0,0 +1,166 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures the cost of visit on variants of 2, 8 and 32
+ *        alternatives, against the recursive if-chain dispatch that the
+ *        variant comparisons use
+ *****************************************************************************/
+
+#include <bit/stl/utilities/variant.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <cstdio>  // std::printf
+#include <random>  // std::mt19937
+#include <utility> // std::index_sequence
+#include <vector>  // std::vector
+
+namespace {
+
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr auto iterations = std::size_t{20000000};
+  constexpr auto samples    = std::size_t{4096};
+
+  //---------------------------------------------------------------------------
+
+  template<std::size_t I>
+  struct alternative
+  {
+    std::uint32_t value;
+  };
+
+  template<typename Sequence>
+  struct make_variant;
+
+  template<std::size_t...Is>
+  struct make_variant<std::index_sequence<Is...>>
+  {
+    using type = bit::stl::variant<alternative<Is>...>;
+
+    template<std::size_t I>
+    static type make( std::uint32_t v )
+    {
+      return type{ alternative<I>{v} };
+    }
+
+    static std::vector<type> random( std::size_t count )
+    {
+      auto engine = std::mt19937{42};
+      auto result = std::vector<type>{};
+      for( auto i = std::size_t{0}; i < count; ++i ) {
+        result.push_back( make_at( engine() % sizeof...(Is), static_cast<std::uint32_t>(i) ) );
+      }
+      return result;
+    }
+
+    // Long runs of the same alternative, so that dispatch is predictable
+    static std::vector<type> sorted( std::size_t count )
+    {
+      auto result = std::vector<type>{};
+      for( auto i = std::size_t{0}; i < count; ++i ) {
+        result.push_back( make_at( (i * sizeof...(Is)) / count, static_cast<std::uint32_t>(i) ) );
+      }
+      return result;
+    }
+
+    static type make_at( std::size_t index, std::uint32_t v )
+    {
+      using factory = type(*)( std::uint32_t );
+
+      static constexpr factory factories[] = { &make<Is>... };
+
+      return factories[index]( v );
+    }
+  };
+
+  template<std::size_t N>
+  using variant_t = typename make_variant<std::make_index_sequence<N>>::type;
+
+  //---------------------------------------------------------------------------
+
+  // Each alternative does distinct work, so that neither dispatch can be
+  // folded into arithmetic on the index
+  struct visitor
+  {
+    template<std::size_t I>
+    std::uint32_t operator()( const alternative<I>& a ) const noexcept
+    {
+      return (a.value >> (I % 7)) ^ static_cast<std::uint32_t>(I * 0x9e3779b9u);
+    }
+  };
+
+  // The pre-visit dispatch strategy: compare the index against every
+  // alternative in turn
+  template<typename Variant>
+  std::uint32_t if_chain( const Variant&, bit::stl::in_place_index_t<std::size_t(-1)> )
+  {
+    return 0;
+  }
+
+  template<typename Variant, std::size_t I>
+  std::uint32_t if_chain( const Variant& v, bit::stl::in_place_index_t<I> )
+  {
+    if( v.index() == I ) {
+      return visitor{}( *bit::stl::get_if<I>( &v ) );
+    }
+    return if_chain( v, bit::stl::in_place_index<I-1> );
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Fn>
+  void report( const char* name, const char* input, std::size_t alternatives, Fn fn )
+  {
+    const auto start = clock_type::now();
+    const auto result = fn();
+    const auto elapsed = clock_type::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    std::printf( "%-10s %-7s %2zu alternatives %6.2f ns/visit (checksum %u)\n",
+                 name,
+                 input,
+                 alternatives,
+                 static_cast<double>(ns) / iterations,
+                 static_cast<unsigned>(result) );
+  }
+
+  template<std::size_t N, typename Variant>
+  void run( const char* input, const std::vector<Variant>& variants )
+  {
+    report( "visit", input, N, [&]{
+      auto sum = std::uint32_t{0};
+      for( auto i = std::size_t{0}; i < iterations; ++i ) {
+        sum += bit::stl::visit( visitor{}, variants[i % samples] );
+      }
+      return sum;
+    });
+
+    report( "if-chain", input, N, [&]{
+      auto sum = std::uint32_t{0};
+      for( auto i = std::size_t{0}; i < iterations; ++i ) {
+        sum += if_chain( variants[i % samples], bit::stl::in_place_index<N-1> );
+      }
+      return sum;
+    });
+  }
+
+  template<std::size_t N>
+  void run()
+  {
+    using factory = make_variant<std::make_index_sequence<N>>;
+
+    run<N>( "random", factory::random( samples ) );
+    run<N>( "sorted", factory::sorted( samples ) );
+
+    std::printf( "sizeof(variant<%zu x uint32_t>) = %zu\n\n", N, sizeof(variant_t<N>) );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  run<2>();
+  run<8>();
+  run<32>();
+}
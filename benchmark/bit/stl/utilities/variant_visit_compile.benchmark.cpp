@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * \file
+ * \brief Compile-time benchmark for visit; build the 2, 8 and 32
+ *        alternative targets and compare their compile times
+ *
+ * Each target instantiates single-variant visitation and two-variant
+ * visitation, the latter of which generates N*N table entries.
+ *****************************************************************************/
+
+#include <bit/stl/utilities/variant.hpp>
+
+#include <cstddef> // std::size_t
+#include <utility> // std::index_sequence
+
+#ifndef BIT_STL_BENCHMARK_ALTERNATIVES
+# define BIT_STL_BENCHMARK_ALTERNATIVES 32
+#endif
+
+namespace {
+
+  template<std::size_t I>
+  struct alternative
+  {
+    std::size_t value;
+  };
+
+  template<typename Sequence>
+  struct make_variant;
+
+  template<std::size_t...Is>
+  struct make_variant<std::index_sequence<Is...>>
+  {
+    using type = bit::stl::variant<alternative<Is>...>;
+  };
+
+  using variant_type = make_variant<std::make_index_sequence<BIT_STL_BENCHMARK_ALTERNATIVES>>::type;
+
+  struct visitor
+  {
+    template<std::size_t I>
+    std::size_t operator()( const alternative<I>& a ) const noexcept
+    {
+      return a.value + I;
+    }
+
+    template<std::size_t I, std::size_t J>
+    std::size_t operator()( const alternative<I>& a, const alternative<J>& b ) const noexcept
+    {
+      return a.value * I + b.value * J;
+    }
+  };
+
+} // anonymous namespace
+
+int main( int argc, char** )
+{
+  const auto v = variant_type{ alternative<0>{ static_cast<std::size_t>(argc) } };
+
+  return static_cast<int>( bit::stl::visit( visitor{}, v ) +
+                           bit::stl::visit( visitor{}, v, v ) );
+}
@@ -0,0 +1,261 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a bounded queue with blocking and batching
+ *        operations for passing values between threads
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_BLOCKING_QUEUE_HPP
+#define BIT_STL_CONTAINERS_BLOCKING_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "circular_queue.hpp"
+
+#include "../utilities/assert.hpp"      // BIT_ASSERT
+#include "../utilities/atomic_wait.hpp" // atomic_wait, atomic_notify_one
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <memory>      // std::allocator
+#include <mutex>       // std::mutex, std::unique_lock
+#include <utility>     // std::forward, std::move
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A bounded queue that may be shared between any number of
+    ///        producer and consumer threads
+    ///
+    /// Values are stored in a circular_queue guarded by a mutex. Threads
+    /// that find the queue full or empty wait through \c atomic_wait, which
+    /// spins briefly before parking, rather than spinning or sleeping
+    /// indefinitely. Waiting threads are only notified when some thread is
+    /// actually waiting, so an uncontended queue never enters the kernel.
+    ///
+    /// The batch operations (\c pop_up_to and the range \c push_wait)
+    /// transfer as many values as possible under one lock and notify once
+    /// per batch, rather than once per value.
+    ///
+    /// \tparam T the underlying type
+    /// \tparam Allocator the allocator type
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, typename Allocator=std::allocator<T>>
+    class blocking_queue
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type     = T;
+      using size_type      = std::size_t;
+      using allocator_type = Allocator;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a blocking_queue able to hold \p capacity values
+      ///
+      /// \param capacity the maximum number of queued values
+      /// \param alloc the allocator
+      explicit blocking_queue( size_type capacity,
+                               const Allocator& alloc = Allocator() );
+
+      // Deleted copy construction
+      blocking_queue( const blocking_queue& ) = delete;
+
+      // Deleted move construction
+      blocking_queue( blocking_queue&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      blocking_queue& operator=( const blocking_queue& ) = delete;
+
+      // Deleted move assignment
+      blocking_queue& operator=( blocking_queue&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Producers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a value at the back of the queue, if there is
+      ///        space
+      ///
+      /// \param args the arguments to forward to T's constructor
+      /// \return \c true if the value was constructed
+      template<typename...Args>
+      bool try_emplace( Args&&...args );
+
+      /// \brief Pushes \p value to the back of the queue, if there is space
+      ///
+      /// \param value the value to push
+      /// \return \c true if the value was pushed
+      bool try_push( const value_type& value );
+      bool try_push( value_type&& value );
+
+      /// \brief Constructs a value at the back of the queue, waiting for
+      ///        space if the queue is full
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template<typename...Args>
+      void emplace_wait( Args&&...args );
+
+      /// \brief Pushes \p value to the back of the queue, waiting for space
+      ///        if the queue is full
+      ///
+      /// \param value the value to push
+      void push_wait( const value_type& value );
+      void push_wait( value_type&& value );
+
+      /// \brief Pushes each value in the range [\p first, \p last), waiting
+      ///        for space whenever the queue is full
+      ///
+      /// Values are pushed in batches of as many as fit, with consumers
+      /// notified once per batch
+      ///
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIt>
+      void push_wait( InputIt first, InputIt last );
+
+      //-----------------------------------------------------------------------
+      // Consumers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Moves the front value into \p out and pops it, if the queue
+      ///        is not empty
+      ///
+      /// \param out the value to assign to
+      /// \return \c true if a value was popped
+      bool try_pop( value_type& out );
+
+      /// \brief Pops the front value, waiting for one if the queue is empty
+      ///
+      /// \return the popped value
+      value_type pop_wait();
+
+      /// \brief Moves up to \p n values into \p out without waiting
+      ///
+      /// \param n the maximum number of values to pop
+      /// \param out the output iterator to write to
+      /// \return the output iterator past the last written value
+      template<typename OutputIt>
+      OutputIt try_pop_up_to( size_type n, OutputIt out );
+
+      /// \brief Moves up to \p n values into \p out, waiting until at least
+      ///        one value is available
+      ///
+      /// Producers are notified once for the whole batch
+      ///
+      /// \param n the maximum number of values to pop; must be non-zero
+      /// \param out the output iterator to write to
+      /// \return the output iterator past the last written value
+      template<typename OutputIt>
+      OutputIt pop_up_to( size_type n, OutputIt out );
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether the queue is empty
+      ///
+      /// \note With concurrent access this result is only a snapshot
+      ///
+      /// \return \c true if the queue is empty
+      bool empty() const;
+
+      /// \brief Returns the number of queued values
+      ///
+      /// \note With concurrent access this result is only a snapshot
+      ///
+      /// \return the number of values
+      size_type size() const;
+
+      /// \brief Returns the maximum number of queued values
+      ///
+      /// \return the capacity
+      size_type capacity() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using queue_type = circular_queue<T,Allocator>;
+      using lock_type  = std::unique_lock<std::mutex>;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      mutable std::mutex m_mutex;
+      queue_type         m_queue;
+
+      std::atomic<std::uint32_t> m_push_epoch;   ///< Bumped after each push
+      std::atomic<std::uint32_t> m_pop_epoch;    ///< Bumped after each pop
+      std::atomic<std::uint32_t> m_pop_waiters;  ///< Consumers waiting
+      std::atomic<std::uint32_t> m_push_waiters; ///< Producers waiting
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Locks \p lock once \p ready returns \c true under the lock,
+      ///        waiting on \p epoch in between attempts
+      template<typename Predicate>
+      void lock_when( lock_type& lock,
+                      std::atomic<std::uint32_t>& epoch,
+                      std::atomic<std::uint32_t>& waiters,
+                      Predicate ready );
+
+      /// \brief Bumps \p epoch and wakes waiters on it, if there are any
+      void notify( std::atomic<std::uint32_t>& epoch,
+                   std::atomic<std::uint32_t>& waiters,
+                   bool all ) noexcept;
+    };
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/blocking_queue.inl"
+
+#endif /* BIT_STL_CONTAINERS_BLOCKING_QUEUE_HPP */
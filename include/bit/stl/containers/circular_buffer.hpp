@@ -40,9 +40,12 @@
 #include "../utilities/uninitialized_storage.hpp" // destroy_at
 #include "../utilities/compiler_traits.hpp" // BIT_COMPILER_EXCEPTIONS_ENABLED
 
+#include "span.hpp"
+
 #include <iterator>    // std::bidirectional_iterator_tag, std::reverse_iterator
-#include <algorithm>   // std::equal, std::lexicographical_compare
+#include <algorithm>   // std::equal, std::lexicographical_compare, std::copy
 #include <cstddef>     // std::size_t
+#include <cstring>     // std::memcpy
 #include <type_traits> // std::add_pointer_t, etc
 
 namespace bit {
@@ -132,8 +135,37 @@ namespace bit {
       bool operator!=( const circular_buffer_iterator<C,T>& lhs,
                        const circular_buffer_iterator<C,T>& rhs ) noexcept;
 
+      template<typename T, typename Allocator> class circular_storage_type;
+
     } // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insertion policy for circular containers that evicts the
+    ///        oldest entry when inserting into a full container
+    ///
+    /// Pushing to the back of a full container destroys the \c front entry,
+    /// and pushing to the front destroys the \c back entry. Eviction is O(1)
+    /// and requires no reallocation, which makes this policy suitable for
+    /// keeping the last N entries of a stream (such as telemetry samples)
+    ///////////////////////////////////////////////////////////////////////////
+    struct circular_overwrite_policy{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insertion policy for circular containers that reallocates to
+    ///        twice the capacity when inserting into a full container
+    ///
+    /// The live entries are unwrapped into the start of the new storage,
+    /// using \c std::memcpy when the type is trivially copyable, or
+    /// otherwise moving (or copying, if moving may throw) each entry.
+    /// Insertion at either end is amortized O(1), and all entries remain in
+    /// at most two contiguous segments.
+    ///
+    /// Growth allocates through allocate_at_least, so an allocator that
+    /// reports extra usable space (such as feedback_allocator) has all of
+    /// it adopted as capacity.
+    ///////////////////////////////////////////////////////////////////////////
+    struct circular_growth_policy{};
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief This class is an implementation of a non-owning circular
     ///        buffer
@@ -284,6 +316,29 @@ namespace bit {
 
       //-----------------------------------------------------------------------
 
+      /// \brief Moves all entries, from front to back, into \p out and
+      ///        leaves this circular_buffer empty
+      ///
+      /// The live entries are transferred in at most two contiguous segments
+      ///
+      /// \param out the output iterator to write to
+      /// \return the output iterator past the last written entry
+      template<typename OutputIt>
+      OutputIt drain_into( OutputIt out );
+
+      /// \brief Copies the entries, from front to back, into \p out without
+      ///        modifying this circular_buffer
+      ///
+      /// At most \c out.size() entries are copied. The live entries are
+      /// copied in at most two contiguous segments, using \c std::memcpy when
+      /// \p T is trivially copyable.
+      ///
+      /// \param out the span to copy entries into
+      /// \return the number of entries copied
+      size_type snapshot( span<T> out ) const;
+
+      //-----------------------------------------------------------------------
+
       /// \brief Clears all entries from this circular_buffer
       void clear() noexcept;
 
@@ -421,6 +476,7 @@ namespace bit {
       std::size_t m_size; ///< The total entries in the circular_buffer
 
       template<typename,typename> friend class detail::circular_buffer_iterator;
+      template<typename,typename> friend class detail::circular_storage_type;
 
       //-----------------------------------------------------------------------
       // Private Member Functions
@@ -431,6 +487,25 @@ namespace bit {
       const T*& increment( const T*& iter ) const noexcept;
       T*& decrement( T*& iter ) noexcept;
       const T*& decrement( const T*& iter ) const noexcept;
+
+      /// \brief Gets the number of entries from \c m_begin before the
+      ///        storage wraps around
+      ///
+      /// \return the size of the first contiguous segment
+      size_type front_segment_size() const noexcept;
+
+      static void copy_segment( const T* first, size_type n, T* out, std::true_type );
+      static void copy_segment( const T* first, size_type n, T* out, std::false_type );
+
+      /// \brief Relocates all entries into the empty buffer \p other,
+      ///        leaving this buffer empty
+      ///
+      /// \note \p other must have a capacity of at least \c size()
+      ///
+      /// \param other the buffer to relocate to
+      void relocate_to( circular_buffer& other );
+      void relocate_to( circular_buffer& other, std::true_type );
+      void relocate_to( circular_buffer& other, std::false_type );
     };
 
     //-------------------------------------------------------------------------
@@ -51,12 +51,20 @@ namespace bit {
     ///////////////////////////////////////////////////////////////////////////
     /// \brief A circular buffer with a deque API
     ///
-    /// Memory is allocated up-front from the specified allocator
+    /// Memory is allocated up-front from the specified allocator. The
+    /// behaviour of inserting into a full deque is determined by \p Policy;
+    /// by default the oldest entry is evicted (see circular_overwrite_policy).
+    ///
+    /// With circular_growth_policy, the deque instead doubles its capacity
+    /// when full, acting as a contiguous alternative to \c std::deque
     ///
     /// \tparam T the underlying type
     /// \tparam Allocator the allocator type
+    /// \tparam Policy the insertion policy for when the deque is full
     ///////////////////////////////////////////////////////////////////////////
-    template<typename T, typename Allocator=std::allocator<T>>
+    template<typename T,
+             typename Allocator=std::allocator<T>,
+             typename Policy=circular_overwrite_policy>
     class circular_deque
     {
       //-----------------------------------------------------------------------
@@ -74,6 +82,7 @@ namespace bit {
       using difference_type = typename circular_buffer<T>::difference_type;
 
       using allocator_type = Allocator;
+      using policy_type    = Policy;
 
       using iterator = typename circular_buffer<T>::iterator;
       using const_iterator = typename circular_buffer<T>::const_iterator;
@@ -284,6 +293,28 @@ namespace bit {
 
       //-----------------------------------------------------------------------
 
+      /// \brief Moves all entries, from front to back, into \p out and
+      ///        leaves this circular_deque empty
+      ///
+      /// The live entries are transferred in at most two contiguous segments
+      ///
+      /// \param out the output iterator to write to
+      /// \return the output iterator past the last written entry
+      template<typename OutputIt>
+      OutputIt drain_into( OutputIt out );
+
+      /// \brief Copies the entries, from front to back, into \p out without
+      ///        modifying this circular_deque
+      ///
+      /// At most \c out.size() entries are copied, in at most two
+      /// \c std::memcpy calls when \p T is trivially copyable
+      ///
+      /// \param out the span to copy entries into
+      /// \return the number of entries copied
+      size_type snapshot( span<T> out ) const;
+
+      //-----------------------------------------------------------------------
+
       /// \brief Clears all entries from this circular_buffer
       void clear();
 
@@ -357,8 +388,23 @@ namespace bit {
 
       storage_type m_storage; ///< The underlying storage
 
-      void resize( std::true_type, size_type n );
-      void resize( std::false_type, size_type n );
+      //-----------------------------------------------------------------------
+      // Private Modifiers
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename...Args>
+      reference emplace_back_impl( circular_overwrite_policy, Args&&...args );
+      template<typename...Args>
+      reference emplace_back_impl( circular_growth_policy, Args&&...args );
+
+      template<typename...Args>
+      reference emplace_front_impl( circular_overwrite_policy, Args&&...args );
+      template<typename...Args>
+      reference emplace_front_impl( circular_growth_policy, Args&&...args );
+
+      /// \brief Gets the capacity to grow to when full
+      size_type grown_capacity() const noexcept;
     };
 
     //-------------------------------------------------------------------------
@@ -369,20 +415,20 @@ namespace bit {
     ///
     /// \param lhs the left deque
     /// \param rhs the right deque
-    template<typename T, typename Allocator>
-    void swap( circular_deque<T,Allocator>& lhs,
-               circular_deque<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    void swap( circular_deque<T,Allocator,Policy>& lhs,
+               circular_deque<T,Allocator,Policy>& rhs ) noexcept;
 
     //-------------------------------------------------------------------------
     // Equality
     //-------------------------------------------------------------------------
 
-    template<typename T, typename Allocator>
-    bool operator==( const circular_deque<T,Allocator>& lhs,
-                     const circular_deque<T,Allocator>& rhs ) noexcept;
-    template<typename T, typename Allocator>
-    bool operator!=( const circular_deque<T,Allocator>& lhs,
-                     const circular_deque<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    bool operator==( const circular_deque<T,Allocator,Policy>& lhs,
+                     const circular_deque<T,Allocator,Policy>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    bool operator!=( const circular_deque<T,Allocator,Policy>& lhs,
+                     const circular_deque<T,Allocator,Policy>& rhs ) noexcept;
 
   } // namespace stl
 } // namespace bit
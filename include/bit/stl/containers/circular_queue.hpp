@@ -51,12 +51,18 @@ namespace bit {
     ///////////////////////////////////////////////////////////////////////////
     /// \brief A circular buffer with a queue API
     ///
-    /// Memory is allocated up-front from the specified allocator
+    /// Memory is allocated up-front from the specified allocator. The
+    /// behaviour of pushing into a full queue is determined by \p Policy;
+    /// by default the oldest entry is evicted (see circular_overwrite_policy),
+    /// whereas circular_growth_policy doubles the capacity instead
     ///
     /// \tparam T the underlying type
     /// \tparam Allocator the allocator type
+    /// \tparam Policy the insertion policy for when the queue is full
     ///////////////////////////////////////////////////////////////////////////
-    template<typename T, typename Allocator=std::allocator<T>>
+    template<typename T,
+             typename Allocator=std::allocator<T>,
+             typename Policy=circular_overwrite_policy>
     class circular_queue
     {
       using traits_type = std::allocator_traits<Allocator>;
@@ -79,6 +85,7 @@ namespace bit {
       using difference_type = typename circular_buffer<T>::difference_type;
 
       using allocator_type = Allocator;
+      using policy_type    = Policy;
 
       using iterator = typename circular_buffer<T>::iterator;
       using const_iterator = typename circular_buffer<T>::const_iterator;
@@ -318,8 +325,15 @@ namespace bit {
 
       storage_type m_storage; ///< The underlying storage
 
-      void resize( std::true_type, size_type n );
-      void resize( std::false_type, size_type n );
+      //-----------------------------------------------------------------------
+      // Private Modifiers
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename...Args>
+      reference emplace_impl( circular_overwrite_policy, Args&&...args );
+      template<typename...Args>
+      reference emplace_impl( circular_growth_policy, Args&&...args );
     };
 
     //-------------------------------------------------------------------------
@@ -330,20 +344,20 @@ namespace bit {
     ///
     /// \param lhs the left deque
     /// \param rhs the right deque
-    template<typename T, typename Allocator>
-    void swap( circular_queue<T,Allocator>& lhs,
-               circular_queue<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    void swap( circular_queue<T,Allocator,Policy>& lhs,
+               circular_queue<T,Allocator,Policy>& rhs ) noexcept;
 
     //-------------------------------------------------------------------------
     // Equality
     //-------------------------------------------------------------------------
 
-    template<typename T, typename Allocator>
-    bool operator==( const circular_queue<T,Allocator>& lhs,
-                     const circular_queue<T,Allocator>& rhs ) noexcept;
-    template<typename T, typename Allocator>
-    bool operator!=( const circular_queue<T,Allocator>& lhs,
-                     const circular_queue<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    bool operator==( const circular_queue<T,Allocator,Policy>& lhs,
+                     const circular_queue<T,Allocator,Policy>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename Policy>
+    bool operator!=( const circular_queue<T,Allocator,Policy>& lhs,
+                     const circular_queue<T,Allocator,Policy>& rhs ) noexcept;
 
   } // namespace stl
 } // namespace bit
@@ -0,0 +1,268 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_BLOCKING_QUEUE_INL
+#define BIT_STL_CONTAINERS_DETAIL_BLOCKING_QUEUE_INL
+
+//============================================================================
+// blocking_queue
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bit::stl::blocking_queue<T,Allocator>
+  ::blocking_queue( size_type capacity, const Allocator& alloc )
+  : m_mutex(),
+    m_queue(capacity, alloc),
+    m_push_epoch(0),
+    m_pop_epoch(0),
+    m_pop_waiters(0),
+    m_push_waiters(0)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Producers
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+template<typename...Args>
+inline bool bit::stl::blocking_queue<T,Allocator>::try_emplace( Args&&...args )
+{
+  {
+    auto lock = lock_type(m_mutex);
+    if( m_queue.full() ) return false;
+
+    m_queue.emplace( std::forward<Args>(args)... );
+  }
+  notify( m_push_epoch, m_pop_waiters, false );
+
+  return true;
+}
+
+template<typename T, typename Allocator>
+inline bool bit::stl::blocking_queue<T,Allocator>
+  ::try_push( const value_type& value )
+{
+  return try_emplace( value );
+}
+
+template<typename T, typename Allocator>
+inline bool bit::stl::blocking_queue<T,Allocator>
+  ::try_push( value_type&& value )
+{
+  return try_emplace( std::move(value) );
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+template<typename...Args>
+inline void bit::stl::blocking_queue<T,Allocator>::emplace_wait( Args&&...args )
+{
+  {
+    auto lock = lock_type(m_mutex, std::defer_lock);
+    lock_when( lock, m_pop_epoch, m_push_waiters, [this]{
+      return !m_queue.full();
+    });
+
+    m_queue.emplace( std::forward<Args>(args)... );
+  }
+  notify( m_push_epoch, m_pop_waiters, false );
+}
+
+template<typename T, typename Allocator>
+inline void bit::stl::blocking_queue<T,Allocator>
+  ::push_wait( const value_type& value )
+{
+  emplace_wait( value );
+}
+
+template<typename T, typename Allocator>
+inline void bit::stl::blocking_queue<T,Allocator>
+  ::push_wait( value_type&& value )
+{
+  emplace_wait( std::move(value) );
+}
+
+template<typename T, typename Allocator>
+template<typename InputIt>
+inline void bit::stl::blocking_queue<T,Allocator>
+  ::push_wait( InputIt first, InputIt last )
+{
+  while( first != last ) {
+    {
+      auto lock = lock_type(m_mutex, std::defer_lock);
+      lock_when( lock, m_pop_epoch, m_push_waiters, [this]{
+        return !m_queue.full();
+      });
+
+      for( ; first != last && !m_queue.full(); ++first ) {
+        m_queue.emplace( *first );
+      }
+    }
+    notify( m_push_epoch, m_pop_waiters, true );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Consumers
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bool bit::stl::blocking_queue<T,Allocator>::try_pop( value_type& out )
+{
+  {
+    auto lock = lock_type(m_mutex);
+    if( m_queue.empty() ) return false;
+
+    out = std::move( m_queue.front() );
+    m_queue.pop();
+  }
+  notify( m_pop_epoch, m_push_waiters, false );
+
+  return true;
+}
+
+template<typename T, typename Allocator>
+inline typename bit::stl::blocking_queue<T,Allocator>::value_type
+  bit::stl::blocking_queue<T,Allocator>::pop_wait()
+{
+  auto lock = lock_type(m_mutex, std::defer_lock);
+  lock_when( lock, m_push_epoch, m_pop_waiters, [this]{
+    return !m_queue.empty();
+  });
+
+  auto result = std::move( m_queue.front() );
+  m_queue.pop();
+  lock.unlock();
+
+  notify( m_pop_epoch, m_push_waiters, false );
+
+  return result;
+}
+
+template<typename T, typename Allocator>
+template<typename OutputIt>
+inline OutputIt bit::stl::blocking_queue<T,Allocator>
+  ::try_pop_up_to( size_type n, OutputIt out )
+{
+  auto popped = size_type{0};
+  {
+    auto lock = lock_type(m_mutex);
+
+    for( ; popped < n && !m_queue.empty(); ++popped ) {
+      *out = std::move( m_queue.front() );
+      ++out;
+      m_queue.pop();
+    }
+  }
+  if( popped != 0 ) {
+    notify( m_pop_epoch, m_push_waiters, true );
+  }
+
+  return out;
+}
+
+template<typename T, typename Allocator>
+template<typename OutputIt>
+inline OutputIt bit::stl::blocking_queue<T,Allocator>
+  ::pop_up_to( size_type n, OutputIt out )
+{
+  BIT_ASSERT( n != 0, "blocking_queue::pop_up_to: cannot wait for 0 values" );
+
+  {
+    auto lock = lock_type(m_mutex, std::defer_lock);
+    lock_when( lock, m_push_epoch, m_pop_waiters, [this]{
+      return !m_queue.empty();
+    });
+
+    for( auto popped = size_type{0}; popped < n && !m_queue.empty(); ++popped ) {
+      *out = std::move( m_queue.front() );
+      ++out;
+      m_queue.pop();
+    }
+  }
+  notify( m_pop_epoch, m_push_waiters, true );
+
+  return out;
+}
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bool bit::stl::blocking_queue<T,Allocator>::empty()
+  const
+{
+  auto lock = lock_type(m_mutex);
+  return m_queue.empty();
+}
+
+template<typename T, typename Allocator>
+inline typename bit::stl::blocking_queue<T,Allocator>::size_type
+  bit::stl::blocking_queue<T,Allocator>::size()
+  const
+{
+  auto lock = lock_type(m_mutex);
+  return m_queue.size();
+}
+
+template<typename T, typename Allocator>
+inline typename bit::stl::blocking_queue<T,Allocator>::size_type
+  bit::stl::blocking_queue<T,Allocator>::capacity()
+  const noexcept
+{
+  return m_queue.capacity();
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+template<typename Predicate>
+inline void bit::stl::blocking_queue<T,Allocator>
+  ::lock_when( lock_type& lock,
+               std::atomic<std::uint32_t>& epoch,
+               std::atomic<std::uint32_t>& waiters,
+               Predicate ready )
+{
+  while( true ) {
+    // The epoch is read before checking, so any change made after the check
+    // is observed by the wait below
+    const auto observed = epoch.load();
+
+    lock.lock();
+    if( ready() ) return;
+    lock.unlock();
+
+    // Sequentially consistent with 'notify': either the notifier observes
+    // this waiter, or this wait observes the notifier's epoch
+    waiters.fetch_add(1);
+    atomic_wait( epoch, observed );
+    waiters.fetch_sub(1);
+  }
+}
+
+template<typename T, typename Allocator>
+inline void bit::stl::blocking_queue<T,Allocator>
+  ::notify( std::atomic<std::uint32_t>& epoch,
+            std::atomic<std::uint32_t>& waiters,
+            bool all )
+  noexcept
+{
+  epoch.fetch_add(1);
+
+  if( waiters.load() == 0 ) return;
+
+  if( all ) {
+    atomic_notify_all( epoch );
+  } else {
+    atomic_notify_one( epoch );
+  }
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_BLOCKING_QUEUE_INL */
@@ -159,6 +159,8 @@ inline bit::stl::circular_buffer<T>
   other.m_size     = 0;
   other.m_capacity = 0;
   other.m_buffer   = nullptr;
+  other.m_begin    = nullptr;
+  other.m_end      = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -285,20 +287,61 @@ inline void bit::stl::circular_buffer<T>::pop_front()
 template<typename T>
 inline void bit::stl::circular_buffer<T>::pop_back()
 {
-  destroy_at( m_end );
   decrement( m_end );
+  destroy_at( m_end );
   --m_size;
 }
 
 //----------------------------------------------------------------------
 
+template<typename T>
+template<typename OutputIt>
+inline OutputIt bit::stl::circular_buffer<T>::drain_into( OutputIt out )
+{
+  const auto first_size  = front_segment_size();
+  const auto second_size = m_size - first_size;
+
+  out = std::move( m_begin, m_begin + first_size, out );
+  out = std::move( m_buffer, m_buffer + second_size, out );
+
+  clear();
+
+  return out;
+}
+
+template<typename T>
+inline typename bit::stl::circular_buffer<T>::size_type
+  bit::stl::circular_buffer<T>::snapshot( span<T> out )
+  const
+{
+  const auto count       = std::min( m_size, static_cast<size_type>(out.size()) );
+  const auto first_size  = std::min( count, front_segment_size() );
+  const auto second_size = count - first_size;
+
+  using is_memcpyable = std::is_trivially_copyable<T>;
+
+  copy_segment( m_begin, first_size, out.data(), is_memcpyable{} );
+  copy_segment( m_buffer, second_size, out.data() + first_size, is_memcpyable{} );
+
+  return count;
+}
+
+//----------------------------------------------------------------------
+
 template<typename T>
 inline void bit::stl::circular_buffer<T>::clear()
   noexcept
 {
-  while( !empty() ) {
-    pop_back();
-  }
+  const auto first_size  = front_segment_size();
+  const auto second_size = m_size - first_size;
+
+  destroy( m_begin, m_begin + first_size );
+  destroy( m_buffer, m_buffer + second_size );
+
+  // Rewinding to the start keeps the next window in a single segment
+  m_begin = m_buffer;
+  m_end   = m_buffer;
+  m_size  = 0;
 }
 
 template<typename T>
@@ -567,6 +610,82 @@ inline const T*& bit::stl::circular_buffer<T>::decrement( const T*& iter )
   return --iter;
 }
 
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::stl::circular_buffer<T>::size_type
+  bit::stl::circular_buffer<T>::front_segment_size()
+  const noexcept
+{
+  const auto tail = static_cast<size_type>( (m_buffer + m_capacity) - m_begin );
+
+  return (m_size < tail) ? m_size : tail;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::circular_buffer<T>::copy_segment( const T* first,
+                                                        size_type n,
+                                                        T* out,
+                                                        std::true_type )
+{
+  if( n == 0 ) return;
+
+  std::memcpy( out, first, n * sizeof(T) );
+}
+
+template<typename T>
+inline void bit::stl::circular_buffer<T>::copy_segment( const T* first,
+                                                        size_type n,
+                                                        T* out,
+                                                        std::false_type )
+{
+  std::copy( first, first + n, out );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::circular_buffer<T>::relocate_to( circular_buffer& other )
+{
+  relocate_to( other, std::is_trivially_copyable<T>{} );
+}
+
+template<typename T>
+inline void bit::stl::circular_buffer<T>::relocate_to( circular_buffer& other,
+                                                       std::true_type )
+{
+  const auto first_size  = front_segment_size();
+  const auto second_size = m_size - first_size;
+
+  copy_segment( m_begin, first_size, other.m_buffer, std::true_type{} );
+  copy_segment( m_buffer, second_size, other.m_buffer + first_size, std::true_type{} );
+
+  other.m_size = m_size;
+  other.m_end  = other.m_buffer + m_size;
+  if( other.m_size == other.m_capacity ) {
+    other.m_end = other.m_buffer;
+  }
+
+  // Trivially copyable types are trivially destructible; nothing to destroy
+  m_begin = m_buffer;
+  m_end   = m_buffer;
+  m_size  = 0;
+}
+
+template<typename T>
+inline void bit::stl::circular_buffer<T>::relocate_to( circular_buffer& other,
+                                                       std::false_type )
+{
+  // Copies rather than moves if moving may throw, so that a failed
+  // relocation leaves this buffer untouched
+  for( auto& v : (*this) ) {
+    other.emplace_back( std::move_if_noexcept(v) );
+  }
+  clear();
+}
+
 //-----------------------------------------------------------------------------
 // Free-functions
 //-----------------------------------------------------------------------------
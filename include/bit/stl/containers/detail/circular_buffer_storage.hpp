@@ -36,8 +36,11 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "../circular_buffer.hpp"
+#include "../../memory/feedback_allocator.hpp" // allocate_at_least
 #include "../../utilities/compressed_pair.hpp"
 
+#include <memory>  // std::allocator_traits
 #include <tuple>
 #include <utility>
 
@@ -82,6 +85,22 @@ namespace bit {
           m_storage.first() = circular_buffer<T>( p, n );
         }
 
+        /// \brief Tag type to request storage for at least \c n entries,
+        ///        adopting any extra space the allocator reports
+        struct at_least_t{};
+
+        circular_storage_type( std::size_t n, const Allocator& alloc, at_least_t )
+          : m_storage( std::piecewise_construct,
+                     std::forward_as_tuple(),
+                     std::forward_as_tuple(alloc) )
+        {
+          if( n == 0 ) return;
+
+          const auto result = stl::allocate_at_least( m_storage.second(), n );
+
+          m_storage.first() = circular_buffer<T>( result.ptr, result.count );
+        }
+
         ~circular_storage_type()
         {
           using traits_type = std::allocator_traits<Allocator>;
@@ -110,6 +129,97 @@ namespace bit {
           return m_storage.second();
         }
 
+        /// \brief Reallocates the storage to hold \p n entries, relocating
+        ///        all existing entries to the start of the new storage
+        ///
+        /// \note \p n must be at least \c buffer().size()
+        ///
+        /// \param n the new capacity
+        void reallocate( std::size_t n )
+        {
+          auto storage = circular_storage_type{ n, get_allocator() };
+
+          buffer().relocate_to( storage.buffer() );
+
+          // The old buffer is released by the destruction of 'storage'
+          buffer().swap( storage.buffer() );
+        }
+
+        /// \brief Reallocates the storage to hold at least \p n entries,
+        ///        using all of the space the allocator provides
+        ///
+        /// This is used for growth, where any extra capacity reported by
+        /// the allocator defers the next reallocation
+        ///
+        /// \note \p n must be at least \c buffer().size()
+        ///
+        /// \param n the minimum new capacity
+        void grow( std::size_t n )
+        {
+          auto storage = circular_storage_type{ n, get_allocator(), at_least_t{} };
+
+          buffer().relocate_to( storage.buffer() );
+
+          // The old buffer is released by the destruction of 'storage'
+          buffer().swap( storage.buffer() );
+        }
+
+        /// \brief Grows the storage to hold at least \p n entries, and
+        ///        constructs a new entry at the back from \p args
+        ///
+        /// The new entry is constructed in the new storage before the
+        /// existing entries are relocated, so \p args may refer to one of
+        /// them
+        ///
+        /// \note \p n must be greater than \c buffer().size()
+        ///
+        /// \param n the minimum new capacity
+        /// \param args the arguments to construct the entry from
+        /// \return reference to the new entry
+        template<typename...Args>
+        T& grow_emplace_back( std::size_t n, Args&&...args )
+        {
+          auto storage = circular_storage_type{ n, get_allocator(), at_least_t{} };
+          auto& target = storage.buffer();
+          auto* const entry = target.m_buffer + buffer().size();
+
+          uninitialized_construct_at<T>( entry, std::forward<Args>(args)... );
+          relocate_around( target, entry );
+
+          // The relocated entries fill the start of the storage; the new
+          // entry follows them
+          ++target.m_size;
+          target.increment( target.m_end );
+
+          buffer().swap( target );
+
+          return (*entry);
+        }
+
+        /// \brief Grows the storage to hold at least \p n entries, and
+        ///        constructs a new entry at the front from \p args
+        ///
+        /// \copydetails grow_emplace_back
+        template<typename...Args>
+        T& grow_emplace_front( std::size_t n, Args&&...args )
+        {
+          auto storage = circular_storage_type{ n, get_allocator(), at_least_t{} };
+          auto& target = storage.buffer();
+          auto* const entry = target.m_buffer + (target.m_capacity - 1);
+
+          uninitialized_construct_at<T>( entry, std::forward<Args>(args)... );
+          relocate_around( target, entry );
+
+          // The relocated entries fill the start of the storage; the new
+          // entry is in the last slot, wrapping around to precede them
+          ++target.m_size;
+          target.m_begin = entry;
+
+          buffer().swap( target );
+
+          return (*entry);
+        }
+
         void swap( circular_storage_type& other )
         {
           using std::swap;
@@ -124,6 +234,29 @@ namespace bit {
 
         using storage_type = compressed_pair<circular_buffer<T>,Allocator>;
 
+        //---------------------------------------------------------------------
+        // Private Member Functions
+        //---------------------------------------------------------------------
+      private:
+
+        /// \brief Relocates all entries into the empty buffer \p target,
+        ///        destroying the already-constructed \p entry if that throws
+        void relocate_around( circular_buffer<T>& target, T* entry )
+        {
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+          try {
+#endif
+            buffer().relocate_to( target );
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+          } catch (...) {
+            destroy_at( entry );
+            throw;
+          }
+#else
+          (void) entry;
+#endif
+        }
+
         //---------------------------------------------------------------------
         // Private Members
         //---------------------------------------------------------------------
@@ -9,22 +9,22 @@
 // Constructors
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>::circular_deque()
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>::circular_deque()
   : circular_deque( Allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>::circular_deque( const Allocator& alloc )
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>::circular_deque( const Allocator& alloc )
   : circular_deque( 0, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( size_type count, const T& value, const Allocator& alloc )
   : circular_deque( count, alloc )
 {
@@ -33,16 +33,16 @@ bit::stl::circular_deque<T,Allocator>
   }
 }
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( size_type count, const Allocator& alloc )
   : m_storage( count, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( const circular_deque& other )
   : circular_deque( other.capacity(), other.get_allocator() )
 {
@@ -52,8 +52,8 @@ bit::stl::circular_deque<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( const circular_deque& other, const Allocator& alloc )
   : circular_deque( other.capacity(), alloc )
 {
@@ -63,16 +63,16 @@ bit::stl::circular_deque<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( circular_deque&& other )
   : circular_deque( std::move(other), other.get_allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>
   ::circular_deque( circular_deque&& other, const Allocator& alloc )
   : m_storage( std::move(other.m_storage), alloc )
 {
@@ -81,9 +81,9 @@ bit::stl::circular_deque<T,Allocator>
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bit::stl::circular_deque<T,Allocator>&
-  bit::stl::circular_deque<T,Allocator>::operator=( circular_deque other )
+template<typename T, typename Allocator, typename Policy>
+bit::stl::circular_deque<T,Allocator,Policy>&
+  bit::stl::circular_deque<T,Allocator,Policy>::operator=( circular_deque other )
 {
  swap(*this,other);
 
@@ -94,9 +94,9 @@ bit::stl::circular_deque<T,Allocator>&
 // Element Access
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::allocator_type
-  bit::stl::circular_deque<T,Allocator>::get_allocator()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::allocator_type
+  bit::stl::circular_deque<T,Allocator,Policy>::get_allocator()
   const
 {
   return m_storage.get_allocator();
@@ -104,17 +104,17 @@ typename bit::stl::circular_deque<T,Allocator>::allocator_type
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::reference
-  bit::stl::circular_deque<T,Allocator>::front()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>::front()
   noexcept
 {
   return m_storage.buffer().front();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reference
-  bit::stl::circular_deque<T,Allocator>::front()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reference
+  bit::stl::circular_deque<T,Allocator,Policy>::front()
   const noexcept
 {
   return m_storage.buffer().front();
@@ -122,17 +122,17 @@ typename bit::stl::circular_deque<T,Allocator>::const_reference
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::reference
-  bit::stl::circular_deque<T,Allocator>::back()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>::back()
   noexcept
 {
   return m_storage.buffer().back();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reference
-  bit::stl::circular_deque<T,Allocator>::back()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reference
+  bit::stl::circular_deque<T,Allocator,Policy>::back()
   const noexcept
 {
   return m_storage.buffer().back();
@@ -142,15 +142,15 @@ typename bit::stl::circular_deque<T,Allocator>::const_reference
 // Capacity
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bool bit::stl::circular_deque<T,Allocator>::empty()
+template<typename T, typename Allocator, typename Policy>
+bool bit::stl::circular_deque<T,Allocator,Policy>::empty()
   const noexcept
 {
   return m_storage.buffer().empty();
 }
 
-template<typename T, typename Allocator>
-bool bit::stl::circular_deque<T,Allocator>::full()
+template<typename T, typename Allocator, typename Policy>
+bool bit::stl::circular_deque<T,Allocator,Policy>::full()
   const noexcept
 {
   return m_storage.buffer().full();
@@ -158,25 +158,25 @@ bool bit::stl::circular_deque<T,Allocator>::full()
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::size_type
-  bit::stl::circular_deque<T,Allocator>::size()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::size_type
+  bit::stl::circular_deque<T,Allocator,Policy>::size()
   const noexcept
 {
   return m_storage.buffer().size();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::size_type
-  bit::stl::circular_deque<T,Allocator>::max_size()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::size_type
+  bit::stl::circular_deque<T,Allocator,Policy>::max_size()
   const noexcept
 {
   return m_storage.buffer().max_size();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::size_type
-  bit::stl::circular_deque<T,Allocator>::capacity()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::size_type
+  bit::stl::circular_deque<T,Allocator,Policy>::capacity()
   const noexcept
 {
   return m_storage.buffer().capacity();
@@ -186,82 +186,105 @@ typename bit::stl::circular_deque<T,Allocator>::size_type
 // Modifiers
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_deque<T,Allocator>::resize( size_type n )
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::circular_deque<T,Allocator,Policy>::resize( size_type n )
 {
-  if( m_storage.buffer().capacity() > n ) {
+  if( m_storage.buffer().capacity() >= n ) {
     return;
   }
 
-  resize( std::is_nothrow_move_constructible<T>{}, n );
+  m_storage.reallocate( n );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename...Args,typename>
-typename bit::stl::circular_deque<T,Allocator>::reference
-  bit::stl::circular_deque<T,Allocator>::emplace_back( Args&&...args )
+typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>::emplace_back( Args&&...args )
 {
-  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
+  return emplace_back_impl( Policy{}, std::forward<Args>(args)... );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename...Args,typename>
-typename bit::stl::circular_deque<T,Allocator>::reference
-  bit::stl::circular_deque<T,Allocator>::emplace_front( Args&&...args )
+typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>::emplace_front( Args&&...args )
 {
-  return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
+  return emplace_front_impl( Policy{}, std::forward<Args>(args)... );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U, typename>
-void bit::stl::circular_deque<T,Allocator>::push_back( const value_type& value )
+void bit::stl::circular_deque<T,Allocator,Policy>::push_back( const value_type& value )
 {
-  m_storage.buffer().push_back(value);
+  emplace_back_impl( Policy{}, value );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U, typename>
-void bit::stl::circular_deque<T,Allocator>::push_back( value_type&& value )
+void bit::stl::circular_deque<T,Allocator,Policy>::push_back( value_type&& value )
 {
-  m_storage.buffer().push_back( std::move(value) );
+  emplace_back_impl( Policy{}, std::move(value) );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U, typename>
-void bit::stl::circular_deque<T,Allocator>::push_front( const value_type& value )
+void bit::stl::circular_deque<T,Allocator,Policy>::push_front( const value_type& value )
 {
-  m_storage.buffer().push_front(value);
+  emplace_front_impl( Policy{}, value );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U, typename>
-void bit::stl::circular_deque<T,Allocator>::push_front( value_type&& value )
+void bit::stl::circular_deque<T,Allocator,Policy>::push_front( value_type&& value )
 {
-  m_storage.buffer().push_front( std::move(value) );
+  emplace_front_impl( Policy{}, std::move(value) );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-void bit::stl::circular_deque<T,Allocator>::pop_front()
+template<typename T, typename Allocator, typename Policy>
+void bit::stl::circular_deque<T,Allocator,Policy>::pop_front()
 {
   m_storage.buffer().pop_front();
 }
 
-template<typename T, typename Allocator>
-void bit::stl::circular_deque<T,Allocator>::pop_back()
+template<typename T, typename Allocator, typename Policy>
+void bit::stl::circular_deque<T,Allocator,Policy>::pop_back()
 {
   m_storage.buffer().pop_back();
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-void bit::stl::circular_deque<T,Allocator>::swap( circular_deque& other )
+template<typename T, typename Allocator, typename Policy>
+template<typename OutputIt>
+OutputIt bit::stl::circular_deque<T,Allocator,Policy>::drain_into( OutputIt out )
+{
+  return m_storage.buffer().drain_into( out );
+}
+
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::size_type
+  bit::stl::circular_deque<T,Allocator,Policy>::snapshot( span<T> out )
+  const
+{
+  return m_storage.buffer().snapshot( out );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename Policy>
+void bit::stl::circular_deque<T,Allocator,Policy>::clear()
+{
+  m_storage.buffer().clear();
+}
+
+template<typename T, typename Allocator, typename Policy>
+void bit::stl::circular_deque<T,Allocator,Policy>::swap( circular_deque& other )
   noexcept
 {
   m_storage.swap( other.m_storage );
@@ -271,25 +294,25 @@ void bit::stl::circular_deque<T,Allocator>::swap( circular_deque& other )
 // Iterators
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::iterator
-  bit::stl::circular_deque<T,Allocator>::begin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::begin()
   noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_iterator
-  bit::stl::circular_deque<T,Allocator>::begin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::begin()
   const noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_iterator
-  bit::stl::circular_deque<T,Allocator>::cbegin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::cbegin()
   const noexcept
 {
   return m_storage.buffer().cbegin();
@@ -298,25 +321,25 @@ typename bit::stl::circular_deque<T,Allocator>::const_iterator
 //-----------------------------------------------------------------------------
 
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::iterator
-  bit::stl::circular_deque<T,Allocator>::end()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::end()
   noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_iterator
-  bit::stl::circular_deque<T,Allocator>::end()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::end()
   const noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_iterator
-  bit::stl::circular_deque<T,Allocator>::cend()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::cend()
   const noexcept
 {
   return m_storage.buffer().cend();
@@ -324,25 +347,25 @@ typename bit::stl::circular_deque<T,Allocator>::const_iterator
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::rbegin()
   noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::rbegin()
   const noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::crbegin()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::crbegin()
   const noexcept
 {
   return m_storage.buffer().crbegin();
@@ -350,25 +373,25 @@ typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::rend()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::rend()
   noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::rend()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::rend()
   const noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_deque<T,Allocator>::crend()
+template<typename T, typename Allocator, typename Policy>
+typename bit::stl::circular_deque<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_deque<T,Allocator,Policy>::crend()
   const noexcept
 {
   return m_storage.buffer().crend();
@@ -378,41 +401,73 @@ typename bit::stl::circular_deque<T,Allocator>::const_reverse_iterator
 // Private Modifiers
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_deque<T,Allocator>::resize( std::true_type,
-                                                           size_type n )
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>
+  ::emplace_back_impl( circular_overwrite_policy, Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
+  // The underlying circular_buffer already evicts the oldest entry on
+  // insertion into a full buffer
+  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
+}
 
-  for( auto&& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( std::move(v) );
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>
+  ::emplace_back_impl( circular_growth_policy, Args&&...args )
+{
+  if( !full() ) {
+    return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
   }
 
-  // Swap the active storage
-  m_storage.buffer().swap( storage.buffer() );
+  // The new entry is constructed before the old ones are relocated, so
+  // 'args' may refer into this deque
+  return m_storage.grow_emplace_back( grown_capacity(),
+                                      std::forward<Args>(args)... );
 }
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_deque<T,Allocator>::resize( std::false_type,
-                                                           size_type n )
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>
+  ::emplace_front_impl( circular_overwrite_policy, Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
+  return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
+}
 
-  for( const auto& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( v );
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_deque<T,Allocator,Policy>::reference
+  bit::stl::circular_deque<T,Allocator,Policy>
+  ::emplace_front_impl( circular_growth_policy, Args&&...args )
+{
+  if( !full() ) {
+    return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
   }
 
-  // Swap the active storage
-  m_storage.buffer().swap( storage.buffer() );
+  return m_storage.grow_emplace_front( grown_capacity(),
+                                       std::forward<Args>(args)... );
+}
+
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_deque<T,Allocator,Policy>::size_type
+  bit::stl::circular_deque<T,Allocator,Policy>::grown_capacity()
+  const noexcept
+{
+  const auto n = capacity();
+
+  return (n == 0) ? 1 : (n * 2);
 }
 
 //-----------------------------------------------------------------------------
 // Utilities
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::swap( circular_deque<T,Allocator>& lhs,
-                            circular_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::swap( circular_deque<T,Allocator,Policy>& lhs,
+                            circular_deque<T,Allocator,Policy>& rhs )
   noexcept
 {
   lhs.swap(rhs);
@@ -422,17 +477,17 @@ inline void bit::stl::swap( circular_deque<T,Allocator>& lhs,
 // Equality
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bool bit::stl::operator==( const circular_deque<T,Allocator>& lhs,
-                                  const circular_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::operator==( const circular_deque<T,Allocator,Policy>& lhs,
+                                  const circular_deque<T,Allocator,Policy>& rhs )
   noexcept
 {
   return std::equal(lhs.begin(),lhs.end(),rhs.begin(),rhs.end());
 }
 
-template<typename T, typename Allocator>
-inline bool bit::stl::operator!=( const circular_deque<T,Allocator>& lhs,
-                                  const circular_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::operator!=( const circular_deque<T,Allocator,Policy>& lhs,
+                                  const circular_deque<T,Allocator,Policy>& rhs )
   noexcept
 {
   return !(lhs==rhs);
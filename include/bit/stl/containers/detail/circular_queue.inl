@@ -9,23 +9,23 @@
 // Constructors
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>::circular_queue()
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>::circular_queue()
   : circular_queue( Allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( const Allocator& alloc )
   : circular_queue( 0, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( size_type count, const T& value, const Allocator& alloc )
   : circular_queue( count, alloc )
 {
@@ -34,16 +34,16 @@ inline bit::stl::circular_queue<T,Allocator>
   }
 }
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( size_type count, const Allocator& alloc )
   : m_storage( count, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( const circular_queue& other )
   : circular_queue( other.capacity(), other.get_allocator() )
 {
@@ -53,8 +53,8 @@ inline bit::stl::circular_queue<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( const circular_queue& other, const Allocator& alloc )
   : circular_queue( other.capacity(), alloc )
 {
@@ -64,16 +64,16 @@ inline bit::stl::circular_queue<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( circular_queue&& other )
   : circular_queue( std::move(other), other.get_allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>
   ::circular_queue( circular_queue&& other, const Allocator& alloc )
   : m_storage( std::move(other.m_storage), alloc )
 {
@@ -82,9 +82,9 @@ inline bit::stl::circular_queue<T,Allocator>
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bit::stl::circular_queue<T,Allocator>&
-  bit::stl::circular_queue<T,Allocator>::operator=( circular_queue other )
+template<typename T, typename Allocator, typename Policy>
+inline bit::stl::circular_queue<T,Allocator,Policy>&
+  bit::stl::circular_queue<T,Allocator,Policy>::operator=( circular_queue other )
   noexcept
 {
   swap(*this,other);
@@ -96,9 +96,9 @@ inline bit::stl::circular_queue<T,Allocator>&
 // Element Access
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::allocator_type
-  bit::stl::circular_queue<T,Allocator>::get_allocator()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::allocator_type
+  bit::stl::circular_queue<T,Allocator,Policy>::get_allocator()
   const
 {
   return m_storage.get_allocator();
@@ -106,17 +106,17 @@ inline typename bit::stl::circular_queue<T,Allocator>::allocator_type
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::reference
-  bit::stl::circular_queue<T,Allocator>::front()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reference
+  bit::stl::circular_queue<T,Allocator,Policy>::front()
   noexcept
 {
   return m_storage.buffer().front();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reference
-  bit::stl::circular_queue<T,Allocator>::front()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reference
+  bit::stl::circular_queue<T,Allocator,Policy>::front()
   const noexcept
 {
   return m_storage.buffer().front();
@@ -124,17 +124,17 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_reference
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::reference
-  bit::stl::circular_queue<T,Allocator>::back()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reference
+  bit::stl::circular_queue<T,Allocator,Policy>::back()
   noexcept
 {
   return m_storage.buffer().back();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reference
-  bit::stl::circular_queue<T,Allocator>::back()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reference
+  bit::stl::circular_queue<T,Allocator,Policy>::back()
   const noexcept
 {
   return m_storage.buffer().back();
@@ -144,15 +144,15 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_reference
 // Capacity
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bool bit::stl::circular_queue<T,Allocator>::empty()
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::circular_queue<T,Allocator,Policy>::empty()
   const noexcept
 {
   return m_storage.buffer().empty();
 }
 
-template<typename T, typename Allocator>
-inline bool bit::stl::circular_queue<T,Allocator>::full()
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::circular_queue<T,Allocator,Policy>::full()
   const noexcept
 {
   return m_storage.buffer().full();
@@ -160,25 +160,25 @@ inline bool bit::stl::circular_queue<T,Allocator>::full()
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::size_type
-  bit::stl::circular_queue<T,Allocator>::size()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::size_type
+  bit::stl::circular_queue<T,Allocator,Policy>::size()
   const noexcept
 {
   return m_storage.buffer().size();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::size_type
-  bit::stl::circular_queue<T,Allocator>::max_size()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::size_type
+  bit::stl::circular_queue<T,Allocator,Policy>::max_size()
   const noexcept
 {
   return m_storage.buffer().max_size();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::size_type
-  bit::stl::circular_queue<T,Allocator>::capacity()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::size_type
+  bit::stl::circular_queue<T,Allocator,Policy>::capacity()
   const noexcept
 {
   return m_storage.buffer().capacity();
@@ -188,47 +188,47 @@ inline typename bit::stl::circular_queue<T,Allocator>::size_type
 // Modifiers
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_queue<T,Allocator>::resize( size_type n )
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::circular_queue<T,Allocator,Policy>::resize( size_type n )
 {
-  if( m_storage.buffer().capacity() > n ) {
+  if( m_storage.buffer().capacity() >= n ) {
     return;
   }
 
-  resize( std::is_nothrow_move_constructible<T>{}, n );
+  m_storage.reallocate( n );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U, typename>
-inline void bit::stl::circular_queue<T,Allocator>
+inline void bit::stl::circular_queue<T,Allocator,Policy>
   ::push( const value_type& value )
 {
-  m_storage.buffer().push_back(value);
+  emplace_impl( Policy{}, value );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename U,typename>
-inline void bit::stl::circular_queue<T,Allocator>::push( value_type&& value )
+inline void bit::stl::circular_queue<T,Allocator,Policy>::push( value_type&& value )
 {
-  m_storage.buffer().push_back( std::move(value) );
+  emplace_impl( Policy{}, std::move(value) );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename Policy>
 template<typename...Args, typename>
-inline typename bit::stl::circular_queue<T,Allocator>::reference
-  bit::stl::circular_queue<T,Allocator>::emplace( Args&&...args )
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reference
+  bit::stl::circular_queue<T,Allocator,Policy>::emplace( Args&&...args )
 {
-  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
+  return emplace_impl( Policy{}, std::forward<Args>(args)... );
 }
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_queue<T,Allocator>::pop()
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::circular_queue<T,Allocator,Policy>::pop()
 {
   m_storage.buffer().pop_front();
 }
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_queue<T,Allocator>::swap( circular_queue& other )
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::circular_queue<T,Allocator,Policy>::swap( circular_queue& other )
   noexcept
 {
   m_storage.swap(other.m_storage);
@@ -238,25 +238,25 @@ inline void bit::stl::circular_queue<T,Allocator>::swap( circular_queue& other )
 // Iterators
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::iterator
-  bit::stl::circular_queue<T,Allocator>::begin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::begin()
   noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
-  bit::stl::circular_queue<T,Allocator>::begin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::begin()
   const noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
-  bit::stl::circular_queue<T,Allocator>::cbegin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::cbegin()
   const noexcept
 {
   return m_storage.buffer().cbegin();
@@ -265,25 +265,25 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
 //----------------------------------------------------------------------------
 
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::iterator
-  bit::stl::circular_queue<T,Allocator>::end()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::end()
   noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
-  bit::stl::circular_queue<T,Allocator>::end()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::end()
   const noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
-  bit::stl::circular_queue<T,Allocator>::cend()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::cend()
   const noexcept
 {
   return m_storage.buffer().cend();
@@ -291,25 +291,25 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_iterator
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::rbegin()
   noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::rbegin()
   const noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::crbegin()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::crbegin()
   const noexcept
 {
   return m_storage.buffer().crbegin();
@@ -317,25 +317,25 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::rend()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::rend()
   noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::rend()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::rend()
   const noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
-  bit::stl::circular_queue<T,Allocator>::crend()
+template<typename T, typename Allocator, typename Policy>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::const_reverse_iterator
+  bit::stl::circular_queue<T,Allocator,Policy>::crend()
   const noexcept
 {
   return m_storage.buffer().crend();
@@ -345,41 +345,42 @@ inline typename bit::stl::circular_queue<T,Allocator>::const_reverse_iterator
 // Private Modifiers
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_queue<T,Allocator>::resize( std::true_type,
-                                                           size_type n )
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reference
+  bit::stl::circular_queue<T,Allocator,Policy>
+  ::emplace_impl( circular_overwrite_policy, Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
-
-  for( auto&& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( std::move(v) );
-  }
-
-  // Swap the active storage
-  m_storage.buffer().swap(storage.buffer());
+  // The underlying circular_buffer already evicts the oldest entry on
+  // insertion into a full buffer
+  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
 }
 
-template<typename T, typename Allocator>
-inline void bit::stl::circular_queue<T,Allocator>::resize( std::false_type,
-                                                           size_type n )
+template<typename T, typename Allocator, typename Policy>
+template<typename...Args>
+inline typename bit::stl::circular_queue<T,Allocator,Policy>::reference
+  bit::stl::circular_queue<T,Allocator,Policy>
+  ::emplace_impl( circular_growth_policy, Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
-
-  for( const auto& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( v );
+  if( !full() ) {
+    return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
   }
 
-  // Swap the active storage
-  m_storage.buffer().swap(storage.buffer());
+  // The new entry is constructed before the old ones are relocated, so
+  // 'args' may refer into this queue
+  const auto n = capacity();
+
+  return m_storage.grow_emplace_back( (n == 0) ? 1 : (n * 2),
+                                      std::forward<Args>(args)... );
 }
 
 //-----------------------------------------------------------------------------
 // Utilities
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::stl::swap( circular_queue<T,Allocator>& lhs,
-                            circular_queue<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline void bit::stl::swap( circular_queue<T,Allocator,Policy>& lhs,
+                            circular_queue<T,Allocator,Policy>& rhs )
   noexcept
 {
   lhs.swap(rhs);
@@ -389,17 +390,17 @@ inline void bit::stl::swap( circular_queue<T,Allocator>& lhs,
 // Equality
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bool bit::stl::operator==( const circular_queue<T,Allocator>& lhs,
-                                  const circular_queue<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::operator==( const circular_queue<T,Allocator,Policy>& lhs,
+                                  const circular_queue<T,Allocator,Policy>& rhs )
   noexcept
 {
   return std::equal(lhs.begin(),lhs.end(),rhs.begin(),rhs.end());
 }
 
-template<typename T, typename Allocator>
-inline bool bit::stl::operator!=( const circular_queue<T,Allocator>& lhs,
-                                  const circular_queue<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename Policy>
+inline bool bit::stl::operator!=( const circular_queue<T,Allocator,Policy>& lhs,
+                                  const circular_queue<T,Allocator,Policy>& rhs )
   noexcept
 {
   return !(lhs==rhs);
@@ -10,7 +10,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string()
   noexcept( std::is_nothrow_default_constructible<Allocator>::value )
   : m_string()
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -20,7 +20,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( const Allocator& alloc )
   noexcept( std::is_nothrow_copy_constructible<Allocator>::value )
   : m_string( alloc )
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -31,7 +31,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
                          CharT ch,
                          const Allocator& alloc )
   : m_string(count,ch,alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -43,7 +43,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
                          size_type count,
                          const Allocator& alloc )
   : m_string(other,pos,count,alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -54,7 +54,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
                          size_type count,
                          const Allocator& alloc )
   : m_string(s, count, alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -64,7 +64,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( const CharT* s,
                          const Allocator& alloc )
   : m_string(s,alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -75,7 +75,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( InputIt first, InputIt last,
                          const Allocator& alloc )
   : m_string(first,last)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -84,7 +84,7 @@ template<typename CharT, typename Traits, typename Allocator>
 inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( const basic_hashed_string& other )
   : m_string(other.m_string)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -94,7 +94,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( const basic_hashed_string& other,
                          const Allocator& alloc )
   : m_string(other.m_string, alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -104,7 +104,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( basic_hashed_string&& other )
   noexcept
   : m_string(std::move(other.m_string))
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -114,7 +114,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( basic_hashed_string&& other,
                          const Allocator& alloc )
   : m_string(std::move(other.m_string), alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -124,7 +124,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>
   ::basic_hashed_string( std::initializer_list<CharT> init,
                          const Allocator& alloc )
   : m_string(std::move(init), alloc)
-  , m_hash(hash_value(m_string))
+  , m_hash(static_cast<hash_type>(hash_value(m_string)))
 {
 
 }
@@ -136,7 +136,7 @@ inline bit::stl::basic_hashed_string<CharT,Traits,Allocator>&
   bit::stl::basic_hashed_string<CharT,Traits,Allocator>::operator=( string_view_type other )
 {
   m_string = static_cast<string_type>(other);
-  m_hash   = hash_value(m_string);
+  m_hash   = static_cast<hash_type>(hash_value(m_string));
 
   return (*this);
 }
@@ -0,0 +1,313 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_MESSAGE_RING_INL
+#define BIT_STL_CONTAINERS_DETAIL_MESSAGE_RING_INL
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// Identifies the start of a created message ring ("bitmring")
+      constexpr std::uint64_t message_ring_magic = 0x676e69726d746962ull;
+
+      /// Set in a record header once the record may be consumed
+      constexpr std::uint32_t message_committed_flag = 1u << 31;
+
+      /// Set in a record header for padding that skips the end of storage
+      constexpr std::uint32_t message_padding_flag = 1u << 30;
+
+      /// Masks the size stored in a record header
+      constexpr std::uint32_t message_size_mask = message_padding_flag - 1u;
+
+      /// The size of each record's header; also the record alignment
+      constexpr std::size_t message_header_size = 8;
+
+    } // namespace detail
+  } // namespace stl
+} // namespace bit
+
+//-----------------------------------------------------------------------------
+// Static Factories
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline constexpr typename bit::stl::basic_message_ring<MultiProducer>::size_type
+  bit::stl::basic_message_ring<MultiProducer>::required_size( size_type capacity )
+  noexcept
+{
+  return sizeof(basic_message_ring) + capacity;
+}
+
+template<bool MultiProducer>
+inline bit::stl::basic_message_ring<MultiProducer>*
+  bit::stl::basic_message_ring<MultiProducer>::create( void* region,
+                                                       size_type size )
+  noexcept
+{
+  BIT_ASSERT( reinterpret_cast<std::uintptr_t>(region) % alignof(basic_message_ring) == 0,
+              "basic_message_ring::create: region is insufficiently aligned" );
+  BIT_ASSERT( size >= required_size(2 * detail::message_header_size),
+              "basic_message_ring::create: region is too small" );
+
+  // Largest power of 2 not exceeding the remaining space, bounded so that
+  // any record size fits in a header
+  auto capacity = size_type{1};
+  while( capacity <= (size - sizeof(basic_message_ring)) / 2 &&
+         capacity <= detail::message_size_mask / 2 ) {
+    capacity *= 2;
+  }
+
+  auto* data = static_cast<byte*>(region) + sizeof(basic_message_ring);
+  std::memset( data, 0, capacity );
+
+  return ::new(region) basic_message_ring( capacity, data );
+}
+
+template<bool MultiProducer>
+inline bit::stl::basic_message_ring<MultiProducer>*
+  bit::stl::basic_message_ring<MultiProducer>::attach( void* region )
+  noexcept
+{
+  auto* ring = static_cast<basic_message_ring*>(region);
+
+  if( ring->m_magic.load( std::memory_order_acquire ) != detail::message_ring_magic ) {
+    return nullptr;
+  }
+  return ring;
+}
+
+//-----------------------------------------------------------------------------
+// Private Constructor
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline bit::stl::basic_message_ring<MultiProducer>
+  ::basic_message_ring( size_type capacity, byte* data )
+  noexcept
+  : m_magic(0),
+    m_capacity(capacity),
+    m_data(data),
+    m_head(0),
+    m_tail(0)
+{
+  m_magic.store( detail::message_ring_magic, std::memory_order_release );
+}
+
+//-----------------------------------------------------------------------------
+// Producer Modifiers
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline bit::stl::span<bit::stl::byte>
+  bit::stl::basic_message_ring<MultiProducer>::try_reserve( size_type n )
+  noexcept
+{
+  if( n > max_message_size() ) return {};
+
+  const auto record = static_cast<index_type>(record_size(n));
+
+  auto tail    = m_tail.load( std::memory_order_relaxed );
+  auto padding = index_type{0};
+
+  while( true ) {
+    // Acquiring the head also acquires the consumer's zeroing of the storage
+    const auto head       = m_head.load( std::memory_order_acquire );
+    const auto contiguous = m_capacity - (tail & (m_capacity - 1));
+
+    // Records never wrap; the remainder of storage is skipped instead
+    padding = (record > contiguous) ? contiguous : 0;
+
+    if( padding + record > m_capacity - (tail - head) ) return {};
+
+    if( try_claim( tail, tail + padding + record,
+                   std::integral_constant<bool,MultiProducer>{} ) ) {
+      break;
+    }
+  }
+
+  if( padding != 0 ) {
+    header_at(tail).store( detail::message_committed_flag |
+                           detail::message_padding_flag |
+                           static_cast<std::uint32_t>(padding),
+                           std::memory_order_release );
+  }
+
+  const auto position = tail + padding;
+  auto* const payload = m_data.get()
+                      + (position & (m_capacity - 1))
+                      + detail::message_header_size;
+
+  return { payload, static_cast<std::ptrdiff_t>(n) };
+}
+
+template<bool MultiProducer>
+inline void bit::stl::basic_message_ring<MultiProducer>
+  ::commit( span<byte> message )
+  noexcept
+{
+  BIT_ASSERT( message.data() != nullptr,
+              "basic_message_ring::commit: message was not reserved" );
+
+  auto* const header = reinterpret_cast<header_type*>(
+    message.data() - detail::message_header_size
+  );
+  header->store( detail::message_committed_flag |
+                 static_cast<std::uint32_t>(message.size()),
+                 std::memory_order_release );
+}
+
+template<bool MultiProducer>
+inline bool bit::stl::basic_message_ring<MultiProducer>
+  ::try_push( span<const byte> message )
+  noexcept
+{
+  auto reserved = try_reserve( static_cast<size_type>(message.size()) );
+
+  if( reserved.data() == nullptr ) return false;
+
+  std::memcpy( reserved.data(), message.data(), reserved.size() );
+  commit( reserved );
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// Consumer Modifiers
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline bit::stl::span<const bit::stl::byte>
+  bit::stl::basic_message_ring<MultiProducer>::try_peek()
+  noexcept
+{
+  auto head = m_head.load( std::memory_order_relaxed );
+
+  while( true ) {
+    auto& header = header_at(head);
+    const auto state = header.load( std::memory_order_acquire );
+
+    if( (state & detail::message_committed_flag) == 0 ) return {};
+
+    if( (state & detail::message_padding_flag) == 0 ) {
+      const auto* const payload = m_data.get()
+                                + (head & (m_capacity - 1))
+                                + detail::message_header_size;
+
+      return { payload,
+               static_cast<std::ptrdiff_t>(state & detail::message_size_mask) };
+    }
+
+    // Skip padding; only its header was ever written
+    header.store( 0, std::memory_order_relaxed );
+    head += (state & detail::message_size_mask);
+    m_head.store( head, std::memory_order_release );
+  }
+}
+
+template<bool MultiProducer>
+inline void bit::stl::basic_message_ring<MultiProducer>::pop()
+  noexcept
+{
+  const auto head  = m_head.load( std::memory_order_relaxed );
+  auto& header     = header_at(head);
+  const auto state = header.load( std::memory_order_relaxed );
+
+  BIT_ASSERT( (state & detail::message_committed_flag) != 0 &&
+              (state & detail::message_padding_flag) == 0,
+              "basic_message_ring::pop: no message was peeked" );
+
+  const auto size = static_cast<size_type>(state & detail::message_size_mask);
+
+  // Zero the payload so that no stale bytes are later read as a header
+  std::memset( reinterpret_cast<byte*>(&header) + detail::message_header_size,
+               0,
+               size );
+  header.store( 0, std::memory_order_relaxed );
+
+  m_head.store( head + record_size(size), std::memory_order_release );
+}
+
+template<bool MultiProducer>
+template<typename Fn>
+inline bool bit::stl::basic_message_ring<MultiProducer>::try_pop( Fn&& fn )
+{
+  const auto message = try_peek();
+
+  if( message.data() == nullptr ) return false;
+
+  std::forward<Fn>(fn)( message );
+  pop();
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline bool bit::stl::basic_message_ring<MultiProducer>::empty()
+  const noexcept
+{
+  return m_head.load( std::memory_order_acquire ) ==
+         m_tail.load( std::memory_order_acquire );
+}
+
+template<bool MultiProducer>
+inline typename bit::stl::basic_message_ring<MultiProducer>::size_type
+  bit::stl::basic_message_ring<MultiProducer>::capacity()
+  const noexcept
+{
+  return static_cast<size_type>(m_capacity);
+}
+
+template<bool MultiProducer>
+inline typename bit::stl::basic_message_ring<MultiProducer>::size_type
+  bit::stl::basic_message_ring<MultiProducer>::max_message_size()
+  const noexcept
+{
+  // Half the capacity guarantees a record always fits after any padding
+  return capacity() / 2 - detail::message_header_size;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<bool MultiProducer>
+inline typename bit::stl::basic_message_ring<MultiProducer>::header_type&
+  bit::stl::basic_message_ring<MultiProducer>::header_at( index_type position )
+  noexcept
+{
+  return *reinterpret_cast<header_type*>(
+    m_data.get() + (position & (m_capacity - 1))
+  );
+}
+
+template<bool MultiProducer>
+inline constexpr typename bit::stl::basic_message_ring<MultiProducer>::size_type
+  bit::stl::basic_message_ring<MultiProducer>::record_size( size_type n )
+  noexcept
+{
+  return (detail::message_header_size + n + (detail::message_header_size - 1))
+         & ~(detail::message_header_size - 1);
+}
+
+template<bool MultiProducer>
+inline bool bit::stl::basic_message_ring<MultiProducer>
+  ::try_claim( index_type& tail, index_type desired, std::true_type )
+  noexcept
+{
+  return m_tail.compare_exchange_weak( tail, desired,
+                                       std::memory_order_relaxed,
+                                       std::memory_order_relaxed );
+}
+
+template<bool MultiProducer>
+inline bool bit::stl::basic_message_ring<MultiProducer>
+  ::try_claim( index_type&, index_type desired, std::false_type )
+  noexcept
+{
+  m_tail.store( desired, std::memory_order_relaxed );
+  return true;
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_MESSAGE_RING_INL */
@@ -0,0 +1,205 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_OFFSET_HASH_MAP_INL
+#define BIT_STL_CONTAINERS_DETAIL_OFFSET_HASH_MAP_INL
+
+//=============================================================================
+// offset_hash_map<Key,T>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+inline bit::stl::offset_hash_map<Key,T>::offset_hash_map()
+  noexcept
+  : m_entries(),
+    m_slots(),
+    m_shift(64)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+template<typename InputIterator>
+inline void bit::stl::offset_hash_map<Key,T>::build( image_builder& builder,
+                                                     image_offset<offset_hash_map> self,
+                                                     InputIterator first,
+                                                     InputIterator last )
+{
+  const auto n = static_cast<std::size_t>(std::distance(first,last));
+  if( n == 0 ) {
+    return;
+  }
+  BIT_ASSERT( n < 0x80000000u, "offset_hash_map::build: too many entries" );
+
+  auto* map = builder.get( self );
+  const auto entries_offset = builder.offset_of( &map->m_entries );
+  const auto slots_offset   = builder.offset_of( &map->m_slots );
+
+  offset_vector<value_type>::build( builder, entries_offset, first, last );
+
+  // Size the table to the next power of two of at least twice the entries
+  auto shift = std::uint32_t{63};
+  while( (std::size_t{1} << (64 - shift)) < n * 2 ) {
+    --shift;
+  }
+
+  // The keys are hashed as they are stored in the image, so that lookups
+  // hash the same representation
+  auto slots = std::vector<std::uint32_t>( std::size_t{1} << (64 - shift), 0 );
+  const auto mask = slots.size() - 1;
+  const auto& entries = *builder.get( entries_offset );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    const auto& key = entries[i].first;
+
+    auto slot = home_slot( hash_value(key), shift );
+    while( slots[slot] != 0 ) {
+      BIT_ASSERT( !(entries[slots[slot] - 1].first == key),
+                  "offset_hash_map::build: keys must be unique" );
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = static_cast<std::uint32_t>(i + 1);
+  }
+
+  offset_vector<std::uint32_t>::build( builder, slots_offset, slots );
+
+  map = builder.get( self );
+  map->m_shift = shift;
+}
+
+template<typename Key, typename T>
+template<typename Range>
+inline auto bit::stl::offset_hash_map<Key,T>::build( image_builder& builder,
+                                                     image_offset<offset_hash_map> self,
+                                                     const Range& range )
+  -> decltype(std::begin(range), void())
+{
+  build( builder, self, std::begin(range), std::end(range) );
+}
+
+//-----------------------------------------------------------------------------
+// Lookup
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::const_iterator
+  bit::stl::offset_hash_map<Key,T>::find( const lookup_type& key )
+  const noexcept
+{
+  if( m_slots.empty() ) {
+    return end();
+  }
+
+  const auto* const slots   = m_slots.data();
+  const auto* const entries = m_entries.data();
+  const auto mask = m_slots.size() - 1;
+
+  // The table is at most half full, so the probe always reaches an empty
+  // slot
+  for( auto slot = home_slot( hash_value(key), m_shift ); slots[slot] != 0;
+       slot = (slot + 1) & mask ) {
+    const auto* const entry = entries + (slots[slot] - 1);
+    if( entry->first == key ) {
+      return entry;
+    }
+  }
+  return end();
+}
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::size_type
+  bit::stl::offset_hash_map<Key,T>::count( const lookup_type& key )
+  const noexcept
+{
+  return (find(key) == end()) ? 0 : 1;
+}
+
+template<typename Key, typename T>
+inline const typename bit::stl::offset_hash_map<Key,T>::mapped_type&
+  bit::stl::offset_hash_map<Key,T>::at( const lookup_type& key )
+  const
+{
+  const auto it = find(key);
+  if( it == end() ) {
+    throw std::out_of_range{"offset_hash_map::at: key not found"};
+  }
+  return it->second;
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+inline bool bit::stl::offset_hash_map<Key,T>::empty()
+  const noexcept
+{
+  return m_entries.empty();
+}
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::size_type
+  bit::stl::offset_hash_map<Key,T>::size()
+  const noexcept
+{
+  return m_entries.size();
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::const_iterator
+  bit::stl::offset_hash_map<Key,T>::begin()
+  const noexcept
+{
+  return m_entries.begin();
+}
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::const_iterator
+  bit::stl::offset_hash_map<Key,T>::cbegin()
+  const noexcept
+{
+  return begin();
+}
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::const_iterator
+  bit::stl::offset_hash_map<Key,T>::end()
+  const noexcept
+{
+  return m_entries.end();
+}
+
+template<typename Key, typename T>
+inline typename bit::stl::offset_hash_map<Key,T>::const_iterator
+  bit::stl::offset_hash_map<Key,T>::cend()
+  const noexcept
+{
+  return end();
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename T>
+inline std::size_t bit::stl::offset_hash_map<Key,T>::home_slot( hash_t hash,
+                                                                std::uint32_t shift )
+  noexcept
+{
+  // Fibonacci hashing spreads weak hashes (such as the identity hash of
+  // integers) across the whole table
+  const auto h = static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+
+  return static_cast<std::size_t>(h >> shift);
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_OFFSET_HASH_MAP_INL */
@@ -0,0 +1,236 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_OFFSET_STRING_INL
+#define BIT_STL_CONTAINERS_DETAIL_OFFSET_STRING_INL
+
+//=============================================================================
+// basic_offset_string<CharT,Traits>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::stl::basic_offset_string<CharT,Traits>::basic_offset_string()
+  noexcept
+  : m_data(nullptr),
+    m_size(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline void bit::stl::basic_offset_string<CharT,Traits>
+  ::build( image_builder& builder,
+           image_offset<basic_offset_string> self,
+           basic_string_view<CharT,Traits> str )
+{
+  // The allocation is value-initialized, which provides the terminator
+  const auto characters = builder.allocate<CharT>( str.size() + 1 );
+  auto* const p = builder.get( characters );
+
+  Traits::copy( p, str.data(), str.size() );
+
+  auto* const string = builder.get( self );
+  string->m_data = p;
+  string->m_size = str.size();
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_reference
+  bit::stl::basic_offset_string<CharT,Traits>::operator[]( size_type n )
+  const noexcept
+{
+  BIT_ASSERT( n < size(), "basic_offset_string::operator[]: index out of range" );
+
+  return data()[n];
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_pointer
+  bit::stl::basic_offset_string<CharT,Traits>::data()
+  const noexcept
+{
+  return m_data.get();
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_pointer
+  bit::stl::basic_offset_string<CharT,Traits>::c_str()
+  const noexcept
+{
+  // A string that was never built has no storage of its own
+  static constexpr CharT empty = CharT();
+
+  return m_data ? m_data.get() : &empty;
+}
+
+template<typename CharT, typename Traits>
+inline bit::stl::basic_string_view<CharT,Traits>
+  bit::stl::basic_offset_string<CharT,Traits>::view()
+  const noexcept
+{
+  return basic_string_view<CharT,Traits>{ c_str(), size() };
+}
+
+template<typename CharT, typename Traits>
+inline bit::stl::basic_offset_string<CharT,Traits>
+  ::operator basic_string_view<CharT,Traits>()
+  const noexcept
+{
+  return view();
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::basic_offset_string<CharT,Traits>::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::size_type
+  bit::stl::basic_offset_string<CharT,Traits>::size()
+  const noexcept
+{
+  return static_cast<size_type>(m_size);
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::size_type
+  bit::stl::basic_offset_string<CharT,Traits>::length()
+  const noexcept
+{
+  return size();
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_iterator
+  bit::stl::basic_offset_string<CharT,Traits>::begin()
+  const noexcept
+{
+  return c_str();
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_iterator
+  bit::stl::basic_offset_string<CharT,Traits>::cbegin()
+  const noexcept
+{
+  return begin();
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_iterator
+  bit::stl::basic_offset_string<CharT,Traits>::end()
+  const noexcept
+{
+  return begin() + size();
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::stl::basic_offset_string<CharT,Traits>::const_iterator
+  bit::stl::basic_offset_string<CharT,Traits>::cend()
+  const noexcept
+{
+  return end();
+}
+
+//=============================================================================
+// Utilities
+//=============================================================================
+
+template<typename CharT, typename Traits>
+inline bit::stl::hash_t
+  bit::stl::hash_value( const basic_offset_string<CharT,Traits>& str )
+  noexcept
+{
+  return hash_string_segment( str.c_str(), str.size() );
+}
+
+//=============================================================================
+// Comparisons
+//=============================================================================
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator==( const basic_offset_string<CharT,Traits>& lhs,
+                                  const basic_offset_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return lhs.view() == rhs.view();
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator==( const basic_offset_string<CharT,Traits>& lhs,
+                                  basic_string_view<CharT,Traits> rhs )
+  noexcept
+{
+  return lhs.view() == rhs;
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator==( basic_string_view<CharT,Traits> lhs,
+                                  const basic_offset_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return lhs == rhs.view();
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator==( const basic_offset_string<CharT,Traits>& lhs,
+                                  const CharT* rhs )
+  noexcept
+{
+  return lhs.view() == basic_string_view<CharT,Traits>{ rhs };
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                                  const basic_offset_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                                  basic_string_view<CharT,Traits> rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator!=( basic_string_view<CharT,Traits> lhs,
+                                  const basic_offset_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::stl::operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                                  const CharT* rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_OFFSET_STRING_INL */
@@ -0,0 +1,209 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_OFFSET_VECTOR_INL
+#define BIT_STL_CONTAINERS_DETAIL_OFFSET_VECTOR_INL
+
+//=============================================================================
+// offset_vector<T>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::offset_vector<T>::offset_vector()
+  noexcept
+  : m_data(nullptr),
+    m_size(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Building
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename InputIterator>
+inline void bit::stl::offset_vector<T>::build( image_builder& builder,
+                                               image_offset<offset_vector> self,
+                                               InputIterator first,
+                                               InputIterator last )
+{
+  const auto n = static_cast<std::size_t>(std::distance(first,last));
+  if( n == 0 ) {
+    return;
+  }
+
+  const auto elements = builder.allocate<T>( n );
+
+  {
+    auto* const vector = builder.get( self );
+    vector->m_data = builder.get( elements );
+    vector->m_size = n;
+  }
+
+  // Elements may build nested containers, which grows the image; only
+  // offsets are held across each assignment
+  for( auto i = std::size_t{0}; i < n; ++i, ++first ) {
+    builder.assign( elements[i], *first );
+  }
+}
+
+template<typename T>
+template<typename Range>
+inline auto bit::stl::offset_vector<T>::build( image_builder& builder,
+                                               image_offset<offset_vector> self,
+                                               const Range& range )
+  -> decltype(std::begin(range), void())
+{
+  build( builder, self, std::begin(range), std::end(range) );
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reference
+  bit::stl::offset_vector<T>::operator[]( size_type n )
+  const noexcept
+{
+  BIT_ASSERT( n < size(), "offset_vector::operator[]: index out of range" );
+
+  return data()[n];
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reference
+  bit::stl::offset_vector<T>::front()
+  const noexcept
+{
+  return (*this)[0];
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reference
+  bit::stl::offset_vector<T>::back()
+  const noexcept
+{
+  return (*this)[size() - 1];
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_pointer
+  bit::stl::offset_vector<T>::data()
+  const noexcept
+{
+  return m_data.get();
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::stl::offset_vector<T>::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::size_type
+  bit::stl::offset_vector<T>::size()
+  const noexcept
+{
+  return static_cast<size_type>(m_size);
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_iterator
+  bit::stl::offset_vector<T>::begin()
+  const noexcept
+{
+  return data();
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_iterator
+  bit::stl::offset_vector<T>::cbegin()
+  const noexcept
+{
+  return begin();
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_iterator
+  bit::stl::offset_vector<T>::end()
+  const noexcept
+{
+  return data() + size();
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_iterator
+  bit::stl::offset_vector<T>::cend()
+  const noexcept
+{
+  return end();
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reverse_iterator
+  bit::stl::offset_vector<T>::rbegin()
+  const noexcept
+{
+  return const_reverse_iterator{ end() };
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reverse_iterator
+  bit::stl::offset_vector<T>::crbegin()
+  const noexcept
+{
+  return rbegin();
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reverse_iterator
+  bit::stl::offset_vector<T>::rend()
+  const noexcept
+{
+  return const_reverse_iterator{ begin() };
+}
+
+template<typename T>
+inline typename bit::stl::offset_vector<T>::const_reverse_iterator
+  bit::stl::offset_vector<T>::crend()
+  const noexcept
+{
+  return rend();
+}
+
+//=============================================================================
+// Comparisons
+//=============================================================================
+
+template<typename T>
+inline bool bit::stl::operator==( const offset_vector<T>& lhs,
+                                  const offset_vector<T>& rhs )
+  noexcept
+{
+  return std::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
+}
+
+template<typename T>
+inline bool bit::stl::operator!=( const offset_vector<T>& lhs,
+                                  const offset_vector<T>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_OFFSET_VECTOR_INL */
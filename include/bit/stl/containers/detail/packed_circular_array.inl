@@ -0,0 +1,521 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_PACKED_CIRCULAR_ARRAY_INL
+#define BIT_STL_CONTAINERS_DETAIL_PACKED_CIRCULAR_ARRAY_INL
+
+//=============================================================================
+// packed_circular_array_iterator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename C, typename T>
+inline constexpr bit::stl::detail::packed_circular_array_iterator<C,T>
+  ::packed_circular_array_iterator( C& container, size_type offset )
+  noexcept
+  : m_container(&container),
+    m_offset(offset)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Iteration
+//-----------------------------------------------------------------------------
+
+template<typename C, typename T>
+inline constexpr bit::stl::detail::packed_circular_array_iterator<C,T>&
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator++()
+  noexcept
+{
+  ++m_offset;
+  return (*this);
+}
+
+template<typename C, typename T>
+inline constexpr bit::stl::detail::packed_circular_array_iterator<C,T>
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator++(int)
+  noexcept
+{
+  auto iter = (*this);
+  ++m_offset;
+  return iter;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename C, typename T>
+inline constexpr bit::stl::detail::packed_circular_array_iterator<C,T>&
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator--()
+  noexcept
+{
+  --m_offset;
+  return (*this);
+}
+
+template<typename C, typename T>
+inline constexpr bit::stl::detail::packed_circular_array_iterator<C,T>
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator--(int)
+  noexcept
+{
+  auto iter = (*this);
+  --m_offset;
+  return iter;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename C, typename T>
+inline constexpr typename bit::stl::detail::packed_circular_array_iterator<C,T>::reference
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator*()
+  const noexcept
+{
+  return (*m_container)[m_offset];
+}
+
+template<typename C, typename T>
+inline constexpr typename bit::stl::detail::packed_circular_array_iterator<C,T>::pointer
+  bit::stl::detail::packed_circular_array_iterator<C,T>::operator->()
+  const noexcept
+{
+  return &(*m_container)[m_offset];
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename C, typename T>
+inline constexpr bool
+  bit::stl::detail::operator==( const packed_circular_array_iterator<C,T>& lhs,
+                                const packed_circular_array_iterator<C,T>& rhs )
+  noexcept
+{
+  return lhs.m_container == rhs.m_container && lhs.m_offset == rhs.m_offset;
+}
+
+template<typename C, typename T>
+inline constexpr bool
+  bit::stl::detail::operator!=( const packed_circular_array_iterator<C,T>& lhs,
+                                const packed_circular_array_iterator<C,T>& rhs )
+  noexcept
+{
+  return !(lhs==rhs);
+}
+
+//=============================================================================
+// packed_circular_array
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr bit::stl::packed_circular_array<T,N>::packed_circular_array()
+  noexcept(std::is_nothrow_default_constructible<T>::value)
+  : m_data{},
+    m_begin(0),
+    m_size(0)
+{
+
+}
+
+template<typename T, std::size_t N>
+inline constexpr bit::stl::packed_circular_array<T,N>
+  ::packed_circular_array( std::initializer_list<T> ilist )
+  : packed_circular_array()
+{
+  for( const auto& v : ilist ) {
+    push_back( v );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+template<typename...Args, typename>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::reference
+  bit::stl::packed_circular_array<T,N>::emplace_back( Args&&...args )
+{
+  // When full, the slot past the back is the front entry
+  const auto index = to_index( m_size );
+
+  m_data[index] = T( std::forward<Args>(args)... );
+
+  if( full() ) {
+    m_begin = static_cast<index_type>( to_index(1) );
+  } else {
+    ++m_size;
+  }
+  return m_data[index];
+}
+
+template<typename T, std::size_t N>
+template<typename...Args, typename>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::reference
+  bit::stl::packed_circular_array<T,N>::emplace_front( Args&&...args )
+{
+  // When full, the slot before the front is the back entry
+  const auto index = static_cast<index_type>( (m_begin == 0) ? (N - 1) : (m_begin - 1) );
+
+  m_data[index] = T( std::forward<Args>(args)... );
+
+  m_begin = index;
+  if( !full() ) {
+    ++m_size;
+  }
+  return m_data[index];
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::push_back( const T& value )
+{
+  emplace_back( value );
+}
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::push_back( T&& value )
+{
+  emplace_back( std::move(value) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::push_front( const T& value )
+{
+  emplace_front( value );
+}
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::push_front( T&& value )
+{
+  emplace_front( std::move(value) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr void bit::stl::packed_circular_array<T,N>::pop_front()
+{
+  BIT_ASSERT( !empty(), "packed_circular_array::pop_front: array is empty" );
+
+  reset( m_data[m_begin], std::is_trivially_destructible<T>{} );
+  m_begin = static_cast<index_type>( to_index(1) );
+  --m_size;
+}
+
+template<typename T, std::size_t N>
+inline constexpr void bit::stl::packed_circular_array<T,N>::pop_back()
+{
+  BIT_ASSERT( !empty(), "packed_circular_array::pop_back: array is empty" );
+
+  reset( m_data[to_index(m_size - 1)], std::is_trivially_destructible<T>{} );
+  --m_size;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr void bit::stl::packed_circular_array<T,N>::clear()
+{
+  while( !empty() ) {
+    pop_back();
+  }
+  m_begin = 0;
+}
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::swap( packed_circular_array& other )
+{
+  auto temp = std::move(other);
+  other = std::move(*this);
+  (*this) = std::move(temp);
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr bool bit::stl::packed_circular_array<T,N>::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+template<typename T, std::size_t N>
+inline constexpr bool bit::stl::packed_circular_array<T,N>::full()
+  const noexcept
+{
+  return m_size == N;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::size_type
+  bit::stl::packed_circular_array<T,N>::size()
+  const noexcept
+{
+  return m_size;
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::size_type
+  bit::stl::packed_circular_array<T,N>::max_size()
+  const noexcept
+{
+  return N;
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::size_type
+  bit::stl::packed_circular_array<T,N>::capacity()
+  const noexcept
+{
+  return N;
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::reference
+  bit::stl::packed_circular_array<T,N>::operator[]( size_type n )
+  noexcept
+{
+  return m_data[to_index(n)];
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_reference
+  bit::stl::packed_circular_array<T,N>::operator[]( size_type n )
+  const noexcept
+{
+  return m_data[to_index(n)];
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::reference
+  bit::stl::packed_circular_array<T,N>::front()
+  noexcept
+{
+  return m_data[m_begin];
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_reference
+  bit::stl::packed_circular_array<T,N>::front()
+  const noexcept
+{
+  return m_data[m_begin];
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::reference
+  bit::stl::packed_circular_array<T,N>::back()
+  noexcept
+{
+  return m_data[to_index(m_size - 1)];
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_reference
+  bit::stl::packed_circular_array<T,N>::back()
+  const noexcept
+{
+  return m_data[to_index(m_size - 1)];
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::iterator
+  bit::stl::packed_circular_array<T,N>::begin()
+  noexcept
+{
+  return iterator{ (*this), 0 };
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_iterator
+  bit::stl::packed_circular_array<T,N>::begin()
+  const noexcept
+{
+  return const_iterator{ (*this), 0 };
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_iterator
+  bit::stl::packed_circular_array<T,N>::cbegin()
+  const noexcept
+{
+  return const_iterator{ (*this), 0 };
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::iterator
+  bit::stl::packed_circular_array<T,N>::end()
+  noexcept
+{
+  return iterator{ (*this), m_size };
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_iterator
+  bit::stl::packed_circular_array<T,N>::end()
+  const noexcept
+{
+  return const_iterator{ (*this), m_size };
+}
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::const_iterator
+  bit::stl::packed_circular_array<T,N>::cend()
+  const noexcept
+{
+  return const_iterator{ (*this), m_size };
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::reverse_iterator
+  bit::stl::packed_circular_array<T,N>::rbegin()
+  noexcept
+{
+  return reverse_iterator{ end() };
+}
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::const_reverse_iterator
+  bit::stl::packed_circular_array<T,N>::rbegin()
+  const noexcept
+{
+  return const_reverse_iterator{ end() };
+}
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::const_reverse_iterator
+  bit::stl::packed_circular_array<T,N>::crbegin()
+  const noexcept
+{
+  return const_reverse_iterator{ cend() };
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::reverse_iterator
+  bit::stl::packed_circular_array<T,N>::rend()
+  noexcept
+{
+  return reverse_iterator{ begin() };
+}
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::const_reverse_iterator
+  bit::stl::packed_circular_array<T,N>::rend()
+  const noexcept
+{
+  return const_reverse_iterator{ begin() };
+}
+
+template<typename T, std::size_t N>
+inline typename bit::stl::packed_circular_array<T,N>::const_reverse_iterator
+  bit::stl::packed_circular_array<T,N>::crend()
+  const noexcept
+{
+  return const_reverse_iterator{ cbegin() };
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr typename bit::stl::packed_circular_array<T,N>::size_type
+  bit::stl::packed_circular_array<T,N>::to_index( size_type n )
+  const noexcept
+{
+  // Both operands are at most N, so a single subtraction replaces a modulo
+  const auto index = static_cast<size_type>(m_begin) + n;
+
+  return (index >= N) ? (index - N) : index;
+}
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::reset( T&, std::true_type )
+  noexcept
+{
+  // Trivially destructible entries hold no resources to release
+}
+
+template<typename T, std::size_t N>
+inline constexpr void
+  bit::stl::packed_circular_array<T,N>::reset( T& entry, std::false_type )
+{
+  entry = T();
+}
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr void bit::stl::swap( packed_circular_array<T,N>& lhs,
+                                      packed_circular_array<T,N>& rhs )
+{
+  lhs.swap(rhs);
+}
+
+//-----------------------------------------------------------------------------
+// Equality
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline constexpr bool bit::stl::operator==( const packed_circular_array<T,N>& lhs,
+                                            const packed_circular_array<T,N>& rhs )
+{
+  if( lhs.size() != rhs.size() ) {
+    return false;
+  }
+  for( auto i = 0u; i < lhs.size(); ++i ) {
+    if( !(lhs[i] == rhs[i]) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T, std::size_t N>
+inline constexpr bool bit::stl::operator!=( const packed_circular_array<T,N>& lhs,
+                                            const packed_circular_array<T,N>& rhs )
+{
+  return !(lhs==rhs);
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_PACKED_CIRCULAR_ARRAY_INL */
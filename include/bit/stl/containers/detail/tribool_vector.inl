@@ -0,0 +1,395 @@
+#ifndef BIT_STL_CONTAINERS_DETAIL_TRIBOOL_VECTOR_INL
+#define BIT_STL_CONTAINERS_DETAIL_TRIBOOL_VECTOR_INL
+
+namespace bit { namespace stl { namespace detail {
+
+  inline std::size_t tribool_vector_popcount( std::uint64_t word )
+    noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>( __builtin_popcountll( word ) );
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<std::size_t>( (word * 0x0101010101010101ull) >> 56 );
+#endif
+  }
+
+} } } // namespace bit::stl::detail
+
+//=============================================================================
+// tribool_vector::reference
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::reference::reference( tribool_vector& vector,
+                                                       size_type index )
+  noexcept
+  : m_vector(&vector),
+    m_index(index)
+{
+
+}
+
+inline bit::stl::tribool_vector::reference&
+  bit::stl::tribool_vector::reference::operator=( tribool value )
+  noexcept
+{
+  m_vector->assign_range( m_index, m_index + 1, value );
+  return (*this);
+}
+
+inline bit::stl::tribool_vector::reference&
+  bit::stl::tribool_vector::reference::operator=( const reference& other )
+  noexcept
+{
+  return (*this) = static_cast<tribool>(other);
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::reference::operator tribool()
+  const noexcept
+{
+  return m_vector->get( m_index );
+}
+
+inline bit::stl::tribool bit::stl::tribool_vector::reference::operator!()
+  const noexcept
+{
+  return !static_cast<tribool>(*this);
+}
+
+//=============================================================================
+// tribool_vector
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::tribool_vector()
+  noexcept
+  : m_true(),
+    m_false(),
+    m_size(0)
+{
+
+}
+
+inline bit::stl::tribool_vector::tribool_vector( size_type count, tribool value )
+  : tribool_vector()
+{
+  resize( count, value );
+}
+
+inline bit::stl::tribool_vector::tribool_vector( std::initializer_list<tribool> ilist )
+  : tribool_vector()
+{
+  reserve( ilist.size() );
+  for( auto value : ilist ) {
+    push_back( value );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::size_type bit::stl::tribool_vector::size()
+  const noexcept
+{
+  return m_size;
+}
+
+inline bool bit::stl::tribool_vector::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+inline void bit::stl::tribool_vector::reserve( size_type count )
+{
+  m_true.reserve( words_for(count) );
+  m_false.reserve( words_for(count) );
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::reference
+  bit::stl::tribool_vector::operator[]( size_type index )
+  noexcept
+{
+  BIT_ASSERT( index < m_size, "tribool_vector::operator[]: index out of range" );
+
+  return reference{ *this, index };
+}
+
+inline bit::stl::tribool_vector::const_reference
+  bit::stl::tribool_vector::operator[]( size_type index )
+  const noexcept
+{
+  BIT_ASSERT( index < m_size, "tribool_vector::operator[]: index out of range" );
+
+  return get( index );
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::tribool_vector::push_back( tribool value )
+{
+  resize( m_size + 1, value );
+}
+
+inline void bit::stl::tribool_vector::pop_back()
+  noexcept
+{
+  BIT_ASSERT( m_size != 0, "tribool_vector::pop_back: vector is empty" );
+
+  // Shrinking never reallocates
+  resize( m_size - 1 );
+}
+
+inline void bit::stl::tribool_vector::resize( size_type count, tribool value )
+{
+  const auto words = words_for( count );
+
+  if( count < m_size ) {
+    // Clear the entries past the end, so that the planes only ever have bits
+    // set for live entries
+    assign_range( count, m_size, tribool{} );
+  }
+
+  m_true.resize( words, 0 );
+  m_false.resize( words, 0 );
+
+  if( count > m_size ) {
+    assign_range( m_size, count, value );
+  }
+  m_size = count;
+}
+
+inline void bit::stl::tribool_vector::clear()
+  noexcept
+{
+  m_true.clear();
+  m_false.clear();
+  m_size = 0;
+}
+
+inline void bit::stl::tribool_vector::fill( tribool value )
+  noexcept
+{
+  assign_range( 0, m_size, value );
+}
+
+inline void bit::stl::tribool_vector::swap( tribool_vector& other )
+  noexcept
+{
+  using std::swap;
+
+  swap( m_true, other.m_true );
+  swap( m_false, other.m_false );
+  swap( m_size, other.m_size );
+}
+
+//-----------------------------------------------------------------------------
+// Kleene Operations
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector&
+  bit::stl::tribool_vector::operator&=( const tribool_vector& other )
+  noexcept
+{
+  BIT_ASSERT( m_size == other.m_size, "tribool_vector::operator&=: sizes differ" );
+
+  const auto words = m_true.size();
+  auto* const t = m_true.data();
+  auto* const f = m_false.data();
+  const auto* const ot = other.m_true.data();
+  const auto* const of = other.m_false.data();
+
+  for( auto i = size_type{0}; i < words; ++i ) {
+    t[i] &= ot[i];
+    f[i] |= of[i];
+  }
+  return (*this);
+}
+
+inline bit::stl::tribool_vector&
+  bit::stl::tribool_vector::operator|=( const tribool_vector& other )
+  noexcept
+{
+  BIT_ASSERT( m_size == other.m_size, "tribool_vector::operator|=: sizes differ" );
+
+  const auto words = m_true.size();
+  auto* const t = m_true.data();
+  auto* const f = m_false.data();
+  const auto* const ot = other.m_true.data();
+  const auto* const of = other.m_false.data();
+
+  for( auto i = size_type{0}; i < words; ++i ) {
+    t[i] |= ot[i];
+    f[i] &= of[i];
+  }
+  return (*this);
+}
+
+inline void bit::stl::tribool_vector::flip()
+  noexcept
+{
+  m_true.swap( m_false );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::size_type bit::stl::tribool_vector::count_true()
+  const noexcept
+{
+  return count( m_true );
+}
+
+inline bit::stl::tribool_vector::size_type bit::stl::tribool_vector::count_false()
+  const noexcept
+{
+  return count( m_false );
+}
+
+inline bit::stl::tribool_vector::size_type bit::stl::tribool_vector::count_indeterminate()
+  const noexcept
+{
+  return m_size - count_true() - count_false();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::tribool_vector::size_type
+  bit::stl::tribool_vector::words_for( size_type count )
+  noexcept
+{
+  return (count + (bits_per_word - 1)) / bits_per_word;
+}
+
+inline bit::stl::tribool bit::stl::tribool_vector::get( size_type index )
+  const noexcept
+{
+  const auto word = index / bits_per_word;
+  const auto bit  = index % bits_per_word;
+
+  if( (m_true[word] >> bit) & 1u ) {
+    return tribool{true};
+  }
+  if( (m_false[word] >> bit) & 1u ) {
+    return tribool{false};
+  }
+  return tribool{};
+}
+
+inline void bit::stl::tribool_vector::assign_range( size_type first,
+                                                    size_type last,
+                                                    tribool value )
+  noexcept
+{
+  const auto t = (value == true)  ? ~word_type{0} : word_type{0};
+  const auto f = (value == false) ? ~word_type{0} : word_type{0};
+
+  while( first < last ) {
+    const auto word  = first / bits_per_word;
+    const auto begin = first % bits_per_word;
+    const auto end   = ((last - word * bits_per_word) < bits_per_word)
+                     ? (last - word * bits_per_word)
+                     : size_type{bits_per_word};
+
+    // The bits [begin,end) of this word
+    const auto high = (end == bits_per_word) ? ~word_type{0}
+                                             : ((word_type{1} << end) - 1);
+    const auto mask = high & ~((word_type{1} << begin) - 1);
+
+    m_true[word]  = (m_true[word] & ~mask) | (t & mask);
+    m_false[word] = (m_false[word] & ~mask) | (f & mask);
+
+    first = word * bits_per_word + end;
+  }
+}
+
+inline bit::stl::tribool_vector::size_type
+  bit::stl::tribool_vector::count( const storage_type& plane )
+  noexcept
+{
+  auto result = size_type{0};
+  for( auto word : plane ) {
+    result += detail::tribool_vector_popcount( word );
+  }
+  return result;
+}
+
+//=============================================================================
+// Kleene Operations
+//=============================================================================
+
+inline bit::stl::tribool_vector bit::stl::operator&&( tribool_vector lhs,
+                                                      const tribool_vector& rhs )
+{
+  lhs &= rhs;
+  return lhs;
+}
+
+inline bit::stl::tribool_vector bit::stl::operator||( tribool_vector lhs,
+                                                      const tribool_vector& rhs )
+{
+  lhs |= rhs;
+  return lhs;
+}
+
+inline bit::stl::tribool_vector bit::stl::operator!( tribool_vector v )
+{
+  v.flip();
+  return v;
+}
+
+//=============================================================================
+// Equality Comparisons
+//=============================================================================
+
+inline bool bit::stl::operator==( const tribool_vector& lhs,
+                                  const tribool_vector& rhs )
+  noexcept
+{
+  // Bits past the end are always clear, so whole words can be compared
+  return lhs.m_size == rhs.m_size &&
+         lhs.m_true == rhs.m_true &&
+         lhs.m_false == rhs.m_false;
+}
+
+inline bool bit::stl::operator!=( const tribool_vector& lhs,
+                                  const tribool_vector& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+//=============================================================================
+// Utilities
+//=============================================================================
+
+inline void bit::stl::swap( tribool_vector& lhs, tribool_vector& rhs )
+  noexcept
+{
+  lhs.swap( rhs );
+}
+
+#endif /* BIT_STL_CONTAINERS_DETAIL_TRIBOOL_VECTOR_INL */
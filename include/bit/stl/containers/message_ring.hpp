@@ -0,0 +1,288 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a position-independent ring of variable-length
+ *        messages, suitable for placement in shared memory
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_MESSAGE_RING_HPP
+#define BIT_STL_CONTAINERS_MESSAGE_RING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "span.hpp"
+
+#include "../memory/offset_ptr.hpp" // offset_ptr
+#include "../utilities/assert.hpp"  // BIT_ASSERT
+#include "../utilities/byte.hpp"    // byte
+
+#include <atomic>      // std::atomic, ATOMIC_LLONG_LOCK_FREE
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <cstring>     // std::memset, std::memcpy
+#include <new>         // placement-new
+#include <type_traits> // std::integral_constant
+#include <utility>     // std::forward
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A ring of variable-length messages that may be shared between
+    ///        processes
+    ///
+    /// A message ring is created in-place at the start of a memory region
+    /// (such as one from \c shm_open or \c memfd_create), with its message
+    /// storage following it in the same region. The storage is referenced
+    /// through an offset_ptr and all indices are lock-free atomics, so the
+    /// ring contains no absolute addresses: other processes may map the same
+    /// region at any address and attach to it.
+    ///
+    /// Messages are written in-place: a producer reserves space, writes the
+    /// message directly into the ring, and commits it. The consumer views
+    /// the message in-place and pops it once done, so no copies are required
+    /// between processes.
+    ///
+    /// There is always a single consumer. When \p MultiProducer is \c true,
+    /// any number of producers may reserve concurrently; reservations are
+    /// claimed with a compare-and-swap, and messages become visible to the
+    /// consumer in reservation order once each is committed.
+    ///
+    /// \note A producer that reserves a message but never commits it (for
+    ///       example, because its process died) blocks the consumer
+    ///
+    /// \tparam MultiProducer \c true if multiple producers may push
+    ///         concurrently
+    ///////////////////////////////////////////////////////////////////////////
+    template<bool MultiProducer>
+    class basic_message_ring
+    {
+      static_assert( ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                     "message_ring requires address-free lock-free atomics" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Static Factories
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Determines the size of the region required to create a
+      ///        message ring with \p capacity bytes of message storage
+      ///
+      /// \param capacity the storage capacity, which must be a power of 2
+      /// \return the number of bytes required
+      static constexpr size_type required_size( size_type capacity ) noexcept;
+
+      /// \brief Creates a message ring at the start of \p region
+      ///
+      /// The storage capacity is the largest power of 2 that fits in the
+      /// remainder of the region. Creation must complete before any other
+      /// process attaches to the region.
+      ///
+      /// \param region the region to create the ring in; must be aligned to
+      ///               at least \c alignof(basic_message_ring)
+      /// \param size the size of the region, in bytes
+      /// \return a pointer to the created ring
+      static basic_message_ring* create( void* region, size_type size ) noexcept;
+
+      /// \brief Attaches to a message ring previously created at the start
+      ///        of \p region
+      ///
+      /// \param region the region containing the ring
+      /// \return a pointer to the ring, or \c nullptr if \p region does not
+      ///         contain a created message ring
+      static basic_message_ring* attach( void* region ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      // Deleted copy construction
+      basic_message_ring( const basic_message_ring& ) = delete;
+
+      // Deleted move construction
+      basic_message_ring( basic_message_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      basic_message_ring& operator=( const basic_message_ring& ) = delete;
+
+      // Deleted move assignment
+      basic_message_ring& operator=( basic_message_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Producer Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Reserves space for a message of \p n bytes
+      ///
+      /// The returned span must be filled in, then passed to \c commit
+      ///
+      /// \param n the size of the message
+      /// \return a span to write the message to, or an empty span with a
+      ///         null \c data() if there is insufficient space
+      span<byte> try_reserve( size_type n ) noexcept;
+
+      /// \brief Commits a message previously reserved with \c try_reserve,
+      ///        making it visible to the consumer
+      ///
+      /// \param message the span returned from \c try_reserve
+      void commit( span<byte> message ) noexcept;
+
+      /// \brief Copies \p message into the ring
+      ///
+      /// \param message the message to push
+      /// \return \c true if the message was pushed
+      bool try_push( span<const byte> message ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Consumer Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Views the oldest committed message without removing it
+      ///
+      /// \return a span viewing the message, or an empty span with a null
+      ///         \c data() if there is no committed message
+      span<const byte> try_peek() noexcept;
+
+      /// \brief Removes the message most recently returned by \c try_peek
+      ///
+      /// \note The popped storage is zeroed before it is returned to
+      ///       producers
+      void pop() noexcept;
+
+      /// \brief Invokes \p fn with a view of the oldest committed message,
+      ///        then pops it
+      ///
+      /// \param fn the function to invoke with a \c span<const byte>
+      /// \return \c true if a message was consumed
+      template<typename Fn>
+      bool try_pop( Fn&& fn );
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether the ring is empty
+      ///
+      /// \note With concurrent producers, this result is only a snapshot
+      ///
+      /// \return \c true if no messages are reserved or committed
+      bool empty() const noexcept;
+
+      /// \brief Returns the storage capacity of the ring, in bytes
+      ///
+      /// \return the capacity
+      size_type capacity() const noexcept;
+
+      /// \brief Returns the largest message that may be pushed
+      ///
+      /// \return the maximum message size, in bytes
+      size_type max_message_size() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using index_type  = std::uint64_t;
+      using header_type = std::atomic<std::uint32_t>;
+
+      //-----------------------------------------------------------------------
+      // Private Constructor
+      //-----------------------------------------------------------------------
+    private:
+
+      basic_message_ring( size_type capacity, byte* data ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::atomic<std::uint64_t> m_magic;    ///< Identifies a created ring
+      std::uint64_t              m_capacity; ///< Power-of-2 storage size
+      offset_ptr<byte>           m_data;     ///< The message storage
+
+      /// The consumer's position; written only by the consumer
+      alignas(64) std::atomic<index_type> m_head;
+
+      /// The end of the reserved messages; written only by producers
+      alignas(64) std::atomic<index_type> m_tail;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Gets the record header at the given ring position
+      ///
+      /// \param position the (unmasked) position
+      /// \return reference to the header
+      header_type& header_at( index_type position ) noexcept;
+
+      /// \brief Computes the size of a record holding \p n bytes
+      ///
+      /// \param n the message size
+      /// \return the record size, including its header and padding
+      static constexpr size_type record_size( size_type n ) noexcept;
+
+      bool try_claim( index_type& tail, index_type desired, std::true_type ) noexcept;
+      bool try_claim( index_type& tail, index_type desired, std::false_type ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Type Aliases
+    //-------------------------------------------------------------------------
+
+    /// \brief A single-producer, single-consumer message ring
+    using spsc_message_ring = basic_message_ring<false>;
+
+    /// \brief A multi-producer, single-consumer message ring
+    using mpsc_message_ring = basic_message_ring<true>;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/message_ring.inl"
+
+#endif /* BIT_STL_CONTAINERS_MESSAGE_RING_HPP */
@@ -0,0 +1,222 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a read-only, position-independent
+ *        open-addressing hash map for use in mapped images
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_OFFSET_HASH_MAP_HPP
+#define BIT_STL_CONTAINERS_OFFSET_HASH_MAP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "offset_vector.hpp"
+
+#include "../memory/image_builder.hpp"      // image_builder, image_offset
+#include "../traits/composition/void_t.hpp" // void_t
+#include "../utilities/assert.hpp"          // BIT_ASSERT
+#include "../utilities/hash.hpp"            // hash_t, hash_value
+
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <iterator>  // std::distance, std::begin, std::end
+#include <stdexcept> // std::out_of_range
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      template<typename Key, typename = void>
+      struct offset_lookup_type{ using type = Key; };
+
+      template<typename Key>
+      struct offset_lookup_type<Key,void_t<typename Key::lookup_type>>
+      {
+        using type = typename Key::lookup_type;
+      };
+
+    } // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A read-only hash map whose storage is referenced by
+    ///        offset_ptrs
+    ///
+    /// Entries are stored densely in insertion order, and are indexed by a
+    /// power-of-two table of 32-bit slots that is probed linearly at a load
+    /// factor of at most one half. The map is populated once inside an
+    /// image_builder with \c build, and is thereafter read in place --
+    /// including from a file mapped read-only at a different address.
+    ///
+    /// Keys are hashed with \c hash_value, which must be stable across
+    /// processes (as it is for integral and string keys). Keys that define
+    /// a \c lookup_type (such as offset_string) are looked up with it.
+    ///
+    /// \tparam Key the key type
+    /// \tparam T the mapped type
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Key, typename T>
+    class offset_hash_map
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using key_type    = Key;
+      using mapped_type = T;
+      using value_type  = std::pair<Key,T>;
+      using size_type   = std::size_t;
+
+      using lookup_type = typename detail::offset_lookup_type<Key>::type;
+
+      using const_reference = const value_type&;
+      using const_pointer   = const value_type*;
+      using const_iterator  = const value_type*;
+      using iterator        = const_iterator;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty offset_hash_map
+      offset_hash_map() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Building
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Populates the offset_hash_map at \p self with the key-value
+      ///        pairs in [\p first, \p last)
+      ///
+      /// \note Keys must be unique
+      ///
+      /// \param builder the image being built
+      /// \param self the map to populate
+      /// \param first the start of the range of pairs
+      /// \param last the end of the range of pairs
+      template<typename InputIterator>
+      static void build( image_builder& builder,
+                         image_offset<offset_hash_map> self,
+                         InputIterator first, InputIterator last );
+
+      /// \brief Populates the offset_hash_map at \p self with the key-value
+      ///        pairs in \p range
+      ///
+      /// \note Keys must be unique
+      ///
+      /// \param builder the image being built
+      /// \param self the map to populate
+      /// \param range the range of pairs
+      template<typename Range>
+      static auto build( image_builder& builder,
+                         image_offset<offset_hash_map> self,
+                         const Range& range )
+        -> decltype(std::begin(range), void());
+
+      //-----------------------------------------------------------------------
+      // Lookup
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the entry with the given \p key
+      ///
+      /// \param key the key to find
+      /// \return iterator to the entry, or \c end() if there is none
+      const_iterator find( const lookup_type& key ) const noexcept;
+
+      /// \brief Counts the entries with the given \p key
+      ///
+      /// \param key the key to find
+      /// \return 1 if the key is present, 0 otherwise
+      size_type count( const lookup_type& key ) const noexcept;
+
+      /// \brief Accesses the value mapped to \p key
+      ///
+      /// \throw std::out_of_range if the key is not present
+      ///
+      /// \param key the key to find
+      /// \return reference to the mapped value
+      const mapped_type& at( const lookup_type& key ) const;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this map is empty
+      ///
+      /// \return \c true if there are no entries
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of entries
+      ///
+      /// \return the number of entries
+      size_type size() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Iterators
+      //-----------------------------------------------------------------------
+    public:
+
+      const_iterator begin() const noexcept;
+      const_iterator cbegin() const noexcept;
+      const_iterator end() const noexcept;
+      const_iterator cend() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Maps \p hash to its preferred slot in a table of
+      ///        2^(64 - \p shift) slots
+      static std::size_t home_slot( hash_t hash, std::uint32_t shift ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      offset_vector<value_type>    m_entries; ///< The entries, in build order
+      offset_vector<std::uint32_t> m_slots;   ///< 0, or 1 + an entry index
+      std::uint32_t                m_shift;   ///< 64 - log2(m_slots.size())
+    };
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/offset_hash_map.inl"
+
+#endif /* BIT_STL_CONTAINERS_OFFSET_HASH_MAP_HPP */
@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a read-only, position-independent string
+ *        for use in mapped images
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_OFFSET_STRING_HPP
+#define BIT_STL_CONTAINERS_OFFSET_STRING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "string_view.hpp"
+
+#include "../memory/image_builder.hpp" // image_builder, image_offset
+#include "../memory/offset_ptr.hpp"    // offset_ptr
+#include "../utilities/assert.hpp"     // BIT_ASSERT
+#include "../utilities/hash.hpp"       // hash_t, hash_string_segment
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint64_t
+#include <string>  // std::char_traits
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A read-only, null-terminated string whose characters are
+    ///        referenced by an offset_ptr
+    ///
+    /// A basic_offset_string is populated once inside an image_builder with
+    /// \c build, and is thereafter read in place -- including from a file
+    /// that has been mapped read-only at a different address.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_offset_string
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = CharT;
+      using traits_type     = Traits;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      using const_reference = const CharT&;
+      using const_pointer   = const CharT*;
+      using const_iterator  = const CharT*;
+
+      /// The type used to look up offset_strings, such as in an
+      /// offset_hash_map
+      using lookup_type = basic_string_view<CharT,Traits>;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty basic_offset_string
+      basic_offset_string() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Building
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Populates the basic_offset_string at \p self with a
+      ///        null-terminated copy of \p str
+      ///
+      /// \param builder the image being built
+      /// \param self the string to populate
+      /// \param str the characters to copy
+      static void build( image_builder& builder,
+                         image_offset<basic_offset_string> self,
+                         basic_string_view<CharT,Traits> str );
+
+      //-----------------------------------------------------------------------
+      // Element Access
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Accesses the character at index \p n
+      ///
+      /// \param n the index
+      /// \return reference to the character
+      const_reference operator[]( size_type n ) const noexcept;
+
+      /// \brief Gets a pointer to the characters
+      ///
+      /// \return pointer to the first character
+      const_pointer data() const noexcept;
+
+      /// \brief Gets a pointer to the null-terminated characters
+      ///
+      /// \return pointer to the null-terminated string
+      const_pointer c_str() const noexcept;
+
+      /// \brief Gets a view of the characters
+      ///
+      /// \return the view
+      basic_string_view<CharT,Traits> view() const noexcept;
+
+      /// \copydoc view()
+      operator basic_string_view<CharT,Traits>() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this string is empty
+      ///
+      /// \return \c true if the string contains no characters
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of characters
+      ///
+      /// \return the number of characters
+      size_type size() const noexcept;
+
+      /// \copydoc size()
+      size_type length() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Iterators
+      //-----------------------------------------------------------------------
+    public:
+
+      const_iterator begin() const noexcept;
+      const_iterator cbegin() const noexcept;
+      const_iterator end() const noexcept;
+      const_iterator cend() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      offset_ptr<const CharT> m_data; ///< The first character
+      std::uint64_t           m_size; ///< The number of characters
+    };
+
+    //-------------------------------------------------------------------------
+    // Public Types
+    //-------------------------------------------------------------------------
+
+    using offset_string    = basic_offset_string<char>;
+    using offset_wstring   = basic_offset_string<wchar_t>;
+    using offset_u16string = basic_offset_string<char16_t>;
+    using offset_u32string = basic_offset_string<char32_t>;
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Hashes the characters of \p str
+    ///
+    /// The hash is equal to that of a basic_string_view of the same
+    /// characters, and is stable across processes
+    ///
+    /// \param str the string to hash
+    /// \return the hash of the string
+    template<typename CharT, typename Traits>
+    hash_t hash_value( const basic_offset_string<CharT,Traits>& str ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename CharT, typename Traits>
+    bool operator==( const basic_offset_string<CharT,Traits>& lhs,
+                     const basic_offset_string<CharT,Traits>& rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator==( const basic_offset_string<CharT,Traits>& lhs,
+                     basic_string_view<CharT,Traits> rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator==( basic_string_view<CharT,Traits> lhs,
+                     const basic_offset_string<CharT,Traits>& rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator==( const basic_offset_string<CharT,Traits>& lhs,
+                     const CharT* rhs ) noexcept;
+
+    template<typename CharT, typename Traits>
+    bool operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                     const basic_offset_string<CharT,Traits>& rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                     basic_string_view<CharT,Traits> rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator!=( basic_string_view<CharT,Traits> lhs,
+                     const basic_offset_string<CharT,Traits>& rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator!=( const basic_offset_string<CharT,Traits>& lhs,
+                     const CharT* rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/offset_string.inl"
+
+#endif /* BIT_STL_CONTAINERS_OFFSET_STRING_HPP */
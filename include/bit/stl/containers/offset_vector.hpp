@@ -0,0 +1,208 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a read-only, position-independent vector
+ *        for use in mapped images
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_OFFSET_VECTOR_HPP
+#define BIT_STL_CONTAINERS_OFFSET_VECTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../memory/image_builder.hpp" // image_builder, image_offset
+#include "../memory/offset_ptr.hpp"    // offset_ptr
+#include "../utilities/assert.hpp"     // BIT_ASSERT
+
+#include <algorithm>   // std::equal
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint64_t
+#include <iterator>    // std::distance, std::begin, std::end, std::reverse_iterator
+#include <type_traits> // std::is_trivially_destructible
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A read-only contiguous sequence whose storage is referenced
+    ///        by an offset_ptr
+    ///
+    /// An offset_vector is populated once inside an image_builder with
+    /// \c build, and is thereafter read in place -- including from a file
+    /// that has been mapped read-only at a different address.
+    ///
+    /// \tparam T the element type; must be trivially destructible
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class offset_vector
+    {
+      static_assert( std::is_trivially_destructible<T>::value,
+                     "offset_vector: T must be trivially destructible" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = T;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      using reference       = const T&;
+      using const_reference = const T&;
+      using pointer         = const T*;
+      using const_pointer   = const T*;
+
+      using iterator               = const T*;
+      using const_iterator         = const T*;
+      using reverse_iterator       = std::reverse_iterator<const_iterator>;
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty offset_vector
+      offset_vector() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Building
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Populates the offset_vector at \p self with copies of the
+      ///        elements in [\p first, \p last)
+      ///
+      /// Each element is assigned with image_builder::assign, so elements
+      /// that are themselves offset containers are built recursively
+      ///
+      /// \param builder the image being built
+      /// \param self the offset_vector to populate
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIterator>
+      static void build( image_builder& builder,
+                         image_offset<offset_vector> self,
+                         InputIterator first, InputIterator last );
+
+      /// \brief Populates the offset_vector at \p self with copies of the
+      ///        elements of \p range
+      ///
+      /// \param builder the image being built
+      /// \param self the offset_vector to populate
+      /// \param range the range of elements
+      template<typename Range>
+      static auto build( image_builder& builder,
+                         image_offset<offset_vector> self,
+                         const Range& range )
+        -> decltype(std::begin(range), void());
+
+      //-----------------------------------------------------------------------
+      // Element Access
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Accesses the element at index \p n
+      ///
+      /// \param n the index
+      /// \return reference to the element
+      const_reference operator[]( size_type n ) const noexcept;
+
+      /// \brief Accesses the first element
+      ///
+      /// \return reference to the first element
+      const_reference front() const noexcept;
+
+      /// \brief Accesses the last element
+      ///
+      /// \return reference to the last element
+      const_reference back() const noexcept;
+
+      /// \brief Gets a pointer to the underlying storage
+      ///
+      /// \return pointer to the first element
+      const_pointer data() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this offset_vector is empty
+      ///
+      /// \return \c true if there are no elements
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of elements
+      ///
+      /// \return the number of elements
+      size_type size() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Iterators
+      //-----------------------------------------------------------------------
+    public:
+
+      const_iterator begin() const noexcept;
+      const_iterator cbegin() const noexcept;
+      const_iterator end() const noexcept;
+      const_iterator cend() const noexcept;
+
+      const_reverse_iterator rbegin() const noexcept;
+      const_reverse_iterator crbegin() const noexcept;
+      const_reverse_iterator rend() const noexcept;
+      const_reverse_iterator crend() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      offset_ptr<const T> m_data; ///< The first element
+      std::uint64_t       m_size; ///< The number of elements
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    bool operator==( const offset_vector<T>& lhs, const offset_vector<T>& rhs ) noexcept;
+    template<typename T>
+    bool operator!=( const offset_vector<T>& lhs, const offset_vector<T>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/offset_vector.inl"
+
+#endif /* BIT_STL_CONTAINERS_OFFSET_VECTOR_HPP */
@@ -0,0 +1,474 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains the definition for a fixed-capacity,
+ *        index-based circular array
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_PACKED_CIRCULAR_ARRAY_HPP
+#define BIT_STL_CONTAINERS_PACKED_CIRCULAR_ARRAY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../traits/transformations/uint_least_for.hpp"
+#include "../utilities/assert.hpp" // BIT_ASSERT
+
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::bidirectional_iterator_tag, std::reverse_iterator
+#include <type_traits>      // std::add_pointer_t, etc
+#include <utility>          // std::move, std::forward
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief An iterator for iterating the packed_circular_array
+      ///
+      /// The iterator stores a logical offset from the front of the container,
+      /// rather than a pointer into its storage
+      ///
+      /// \tparam Container the (possibly const) packed_circular_array type
+      /// \tparam T the (possibly const) underlying type
+      //////////////////////////////////////////////////////////////////////////
+      template<typename Container, typename T>
+      class packed_circular_array_iterator
+      {
+        //----------------------------------------------------------------------
+        // Public Member Types
+        //----------------------------------------------------------------------
+      public:
+
+        using value_type = std::remove_const_t<T>;
+        using reference  = std::add_lvalue_reference_t<T>;
+        using pointer    = std::add_pointer_t<T>;
+        using size_type  = std::size_t;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        //----------------------------------------------------------------------
+        // Constructor
+        //----------------------------------------------------------------------
+      public:
+
+        constexpr packed_circular_array_iterator( Container& container,
+                                                  size_type offset ) noexcept;
+
+        //----------------------------------------------------------------------
+        // Iteration
+        //----------------------------------------------------------------------
+      public:
+
+        constexpr packed_circular_array_iterator& operator++() noexcept;
+        constexpr packed_circular_array_iterator operator++(int) noexcept;
+
+        constexpr packed_circular_array_iterator& operator--() noexcept;
+        constexpr packed_circular_array_iterator operator--(int) noexcept;
+
+        //----------------------------------------------------------------------
+        // Observers
+        //----------------------------------------------------------------------
+      public:
+
+        constexpr reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        //----------------------------------------------------------------------
+        // Private Members
+        //----------------------------------------------------------------------
+      private:
+
+        Container* m_container; ///< The underlying container
+        size_type  m_offset;    ///< The offset from the front of the container
+
+        template<typename C, typename U>
+        friend constexpr bool operator==( const packed_circular_array_iterator<C,U>& lhs,
+                                          const packed_circular_array_iterator<C,U>& rhs ) noexcept;
+      };
+
+      template<typename C, typename T>
+      constexpr bool operator==( const packed_circular_array_iterator<C,T>& lhs,
+                                 const packed_circular_array_iterator<C,T>& rhs ) noexcept;
+
+      template<typename C, typename T>
+      constexpr bool operator!=( const packed_circular_array_iterator<C,T>& lhs,
+                                 const packed_circular_array_iterator<C,T>& rhs ) noexcept;
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fixed-capacity circular array that tracks its entries with
+    ///        indices rather than pointers
+    ///
+    /// Unlike circular_array, this type contains no self-referential
+    /// pointers: it consists only of the \p N entries and two indices of the
+    /// smallest unsigned type able to hold \p N. As a result it is:
+    ///
+    /// - trivially copyable whenever \p T is, so it may be copied with
+    ///   \c std::memcpy or placed in shared memory,
+    /// - usable in \c constexpr contexts whenever \p T is a literal type, and
+    /// - only \c sizeof(T)*N plus two small integers (and padding) in size.
+    ///
+    /// The trade-off is that all \p N entries are always alive; \p T must be
+    /// default-constructible, and entries are assigned rather than
+    /// constructed in-place. Removed entries of non-trivially destructible
+    /// types are reset to a default-constructed value to release resources.
+    ///
+    /// Like circular_array, pushing into a full packed_circular_array
+    /// overwrites the entry at the opposite end.
+    ///
+    /// \tparam T the underlying type of this circular array
+    /// \tparam N the capacity of this circular array
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t N>
+    class packed_circular_array
+    {
+      static_assert( N > 0, "packed_circular_array must have a non-zero capacity" );
+      static_assert( std::is_default_constructible<T>::value,
+                     "T must be default constructible" );
+      static_assert( std::is_move_assignable<T>::value,
+                     "T must be move assignable" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = T;
+      using reference       = std::add_lvalue_reference_t<T>;
+      using pointer         = std::add_pointer_t<T>;
+      using const_reference = std::add_lvalue_reference_t<std::add_const_t<T>>;
+      using const_pointer   = std::add_pointer_t<std::add_const_t<T>>;
+
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using index_type      = uint_least_for_t<N>;
+
+      using iterator       = detail::packed_circular_array_iterator<packed_circular_array,T>;
+      using const_iterator = detail::packed_circular_array_iterator<const packed_circular_array,const T>;
+      using reverse_iterator       = std::reverse_iterator<iterator>;
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Default constructs a packed_circular_array with no entries
+      constexpr packed_circular_array()
+        noexcept(std::is_nothrow_default_constructible<T>::value);
+
+      /// \brief Constructs a packed_circular_array by pushing each entry in
+      ///        \p ilist to the back
+      ///
+      /// \note If \p ilist contains more than \p N entries, only the last
+      ///       \p N are retained
+      ///
+      /// \param ilist the initializer list
+      constexpr packed_circular_array( std::initializer_list<T> ilist );
+
+      /// \brief Copy-constructs a packed_circular_array from an existing one
+      ///
+      /// \param other the other packed_circular_array to copy
+      packed_circular_array( const packed_circular_array& other ) = default;
+
+      /// \brief Move-constructs a packed_circular_array from an existing one
+      ///
+      /// \param other the other packed_circular_array to move
+      packed_circular_array( packed_circular_array&& other ) = default;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Copy-assigns a packed_circular_array from an existing one
+      ///
+      /// \param other the other packed_circular_array
+      /// \return reference to \c (*this)
+      packed_circular_array& operator=( const packed_circular_array& other ) = default;
+
+      /// \brief Move-assigns a packed_circular_array from an existing one
+      ///
+      /// \param other the other packed_circular_array
+      /// \return reference to \c (*this)
+      packed_circular_array& operator=( packed_circular_array&& other ) = default;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Invokes \p T's constructor with the given \p args, and
+      ///        assigns the result to the end of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c front of the array
+      ///
+      /// \param args the arguments to forward to T
+      /// \return reference to the constructed entry
+      template<typename...Args, typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      constexpr reference emplace_back( Args&&...args );
+
+      /// \brief Invokes \p T's constructor with the given \p args, and
+      ///        assigns the result to the beginning of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c back of the array
+      ///
+      /// \param args the arguments to forward to T
+      /// \return reference to the constructed entry
+      template<typename...Args, typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      constexpr reference emplace_front( Args&&...args );
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Copies \p value to the end of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c front of the array
+      ///
+      /// \param value the value to copy
+      constexpr void push_back( const T& value );
+
+      /// \brief Moves \p value to the end of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c front of the array
+      ///
+      /// \param value the value to move
+      constexpr void push_back( T&& value );
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Copies \p value to the beginning of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c back of the array
+      ///
+      /// \param value the value to copy
+      constexpr void push_front( const T& value );
+
+      /// \brief Moves \p value to the beginning of the array
+      ///
+      /// \note If the array is full, this overwrites the entry currently at
+      ///       the \c back of the array
+      ///
+      /// \param value the value to move
+      constexpr void push_front( T&& value );
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Pops the entry at the front of the packed_circular_array
+      constexpr void pop_front();
+
+      /// \brief Pops the entry at the back of the packed_circular_array
+      constexpr void pop_back();
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Clears all entries from this packed_circular_array
+      constexpr void clear();
+
+      /// \brief Swaps this packed_circular_array with another one
+      ///
+      /// \param other the other array to swap with
+      constexpr void swap( packed_circular_array& other );
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this array is empty
+      ///
+      /// \return \c true if the array is empty
+      constexpr bool empty() const noexcept;
+
+      /// \brief Returns whether this array is full
+      ///
+      /// \return \c true if the array is full
+      constexpr bool full() const noexcept;
+
+      /// \brief Returns the number of elements in this array
+      ///
+      /// \return the number of elements in this array
+      constexpr size_type size() const noexcept;
+
+      /// \brief Returns the max size of this array
+      ///
+      /// \note This result is always the same as capacity
+      /// \return the max number of elements this array can contain
+      constexpr size_type max_size() const noexcept;
+
+      /// \brief Returns the capacity of this array
+      ///
+      /// \return the capacity of this array
+      constexpr size_type capacity() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Element Access
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns a reference to the entry at offset \p n from the
+      ///        front of this array
+      ///
+      /// \param n the offset from the front
+      /// \return reference to the entry
+      constexpr reference operator[]( size_type n ) noexcept;
+
+      /// \copydoc operator[]( size_type )
+      constexpr const_reference operator[]( size_type n ) const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Returns a reference to the front element of this array
+      ///
+      /// \return reference to the front element of this array
+      constexpr reference front() noexcept;
+
+      /// \copydoc front()
+      constexpr const_reference front() const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Returns a reference to the back element of this array
+      ///
+      /// \return reference to the back element of this array
+      constexpr reference back() noexcept;
+
+      /// \copydoc back()
+      constexpr const_reference back() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Iterators
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the iterator to the beginning of this range
+      ///
+      /// \return the begin iterator
+      constexpr iterator begin() noexcept;
+
+      /// \copydoc begin
+      constexpr const_iterator begin() const noexcept;
+
+      /// \copydoc begin
+      constexpr const_iterator cbegin() const noexcept;
+
+      /// \brief Gets the iterator to the end of this range
+      ///
+      /// \return the end iterator
+      constexpr iterator end() noexcept;
+
+      /// \copydoc end
+      constexpr const_iterator end() const noexcept;
+
+      /// \copydoc end
+      constexpr const_iterator cend() const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Gets the iterator to the beginning of the reverse range
+      ///
+      /// \return the reverse iterator
+      reverse_iterator rbegin() noexcept;
+
+      /// \copydoc rbegin()
+      const_reverse_iterator rbegin() const noexcept;
+
+      /// \copydoc rbegin()
+      const_reverse_iterator crbegin() const noexcept;
+
+      /// \brief Gets the iterator to the end of the reverse range
+      ///
+      /// \return the reverse iterator
+      reverse_iterator rend() noexcept;
+
+      /// \copydoc rend()
+      const_reverse_iterator rend() const noexcept;
+
+      /// \copydoc rend()
+      const_reverse_iterator crend() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      T          m_data[N]; ///< The underlying storage
+      index_type m_begin;   ///< The index of the front entry
+      index_type m_size;    ///< The number of entries
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Converts an offset from the front into an index into the
+      ///        underlying storage
+      ///
+      /// \param n the offset, which must be no greater than \p N
+      /// \return the storage index
+      constexpr size_type to_index( size_type n ) const noexcept;
+
+      static constexpr void reset( T& entry, std::true_type ) noexcept;
+      static constexpr void reset( T& entry, std::false_type );
+    };
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Swaps two packed_circular_arrays
+    ///
+    /// \param lhs the left array
+    /// \param rhs the right array
+    template<typename T, std::size_t N>
+    constexpr void swap( packed_circular_array<T,N>& lhs,
+                         packed_circular_array<T,N>& rhs );
+
+    //-------------------------------------------------------------------------
+    // Equality
+    //-------------------------------------------------------------------------
+
+    template<typename T, std::size_t N>
+    constexpr bool operator==( const packed_circular_array<T,N>& lhs,
+                               const packed_circular_array<T,N>& rhs );
+    template<typename T, std::size_t N>
+    constexpr bool operator!=( const packed_circular_array<T,N>& lhs,
+                               const packed_circular_array<T,N>& rhs );
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/packed_circular_array.inl"
+
+#endif /* BIT_STL_CONTAINERS_PACKED_CIRCULAR_ARRAY_HPP */
@@ -0,0 +1,372 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a packed vector of tribool values
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_CONTAINERS_TRIBOOL_VECTOR_HPP
+#define BIT_STL_CONTAINERS_TRIBOOL_VECTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/assert.hpp"  // BIT_ASSERT
+#include "../utilities/tribool.hpp" // tribool
+
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t
+#include <initializer_list> // std::initializer_list
+#include <vector>           // std::vector
+
+namespace bit {
+  namespace stl {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A dynamically sized sequence of tribool values, packed at two
+    ///        bits per value
+    ///
+    /// The values are stored in two bitplanes: one marking the values that
+    /// are \c true, and one marking the values that are \c false. Values in
+    /// neither plane are indeterminate. With this encoding, the Kleene
+    /// operations over whole vectors reduce to word-wide bitwise operations
+    /// over each plane, which the compiler vectorizes:
+    ///
+    /// - \c a&&b is \c {a.true&b.true, a.false|b.false}
+    /// - \c a||b is \c {a.true|b.true, a.false&b.false}
+    /// - \c !a is \c {a.false, a.true}
+    ///
+    /// \note These are the strong Kleene connectives, under which
+    ///       \c false&&indeterminate is \c false. This differs from
+    ///       tribool's \c operator&&, which yields indeterminate.
+    //////////////////////////////////////////////////////////////////////////
+    class tribool_vector
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type      = tribool;
+      using size_type       = std::size_t;
+      using const_reference = tribool;
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A proxy to a single value of a tribool_vector
+      ///
+      /// The proxy converts to, and is assignable from, a tribool
+      ////////////////////////////////////////////////////////////////////////
+      class reference
+      {
+        //--------------------------------------------------------------------
+        // Constructors / Assignment
+        //--------------------------------------------------------------------
+      public:
+
+        reference( const reference& other ) noexcept = default;
+
+        /// \brief Assigns \p value to the referenced entry
+        ///
+        /// \param value the value to assign
+        /// \return reference to \c (*this)
+        reference& operator=( tribool value ) noexcept;
+
+        /// \brief Assigns the value of \p other to the referenced entry
+        ///
+        /// \param other the proxy to assign from
+        /// \return reference to \c (*this)
+        reference& operator=( const reference& other ) noexcept;
+
+        //--------------------------------------------------------------------
+        // Observers
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Converts the referenced entry to a tribool
+        operator tribool() const noexcept;
+
+        /// \brief Negates the referenced entry
+        ///
+        /// \return the negated entry
+        tribool operator!() const noexcept;
+
+        //--------------------------------------------------------------------
+        // Private Constructor
+        //--------------------------------------------------------------------
+      private:
+
+        reference( tribool_vector& vector, size_type index ) noexcept;
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        tribool_vector* m_vector; ///< The vector being referenced
+        size_type       m_index;  ///< The index of the entry
+
+        friend tribool_vector;
+      };
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty tribool_vector
+      tribool_vector() noexcept;
+
+      /// \brief Constructs a tribool_vector with \p count copies of \p value
+      ///
+      /// \param count the number of entries
+      /// \param value the value of every entry
+      explicit tribool_vector( size_type count, tribool value = tribool{} );
+
+      /// \brief Constructs a tribool_vector from the values in \p ilist
+      ///
+      /// \param ilist the values to store
+      tribool_vector( std::initializer_list<tribool> ilist );
+
+      tribool_vector( const tribool_vector& other ) = default;
+      tribool_vector( tribool_vector&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      tribool_vector& operator=( const tribool_vector& other ) = default;
+      tribool_vector& operator=( tribool_vector&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Capacity
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of entries
+      ///
+      /// \return the number of entries
+      size_type size() const noexcept;
+
+      /// \brief Returns whether this tribool_vector is empty
+      ///
+      /// \return \c true if there are no entries
+      bool empty() const noexcept;
+
+      /// \brief Reserves storage for at least \p count entries
+      ///
+      /// \param count the number of entries to reserve
+      void reserve( size_type count );
+
+      //----------------------------------------------------------------------
+      // Element Access
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Accesses the entry at \p index
+      ///
+      /// \pre \p index is less than \c size()
+      ///
+      /// \param index the index of the entry
+      /// \return a proxy to the entry
+      reference operator[]( size_type index ) noexcept;
+
+      /// \copydoc operator[]( size_type )
+      const_reference operator[]( size_type index ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Appends \p value to the end of this tribool_vector
+      ///
+      /// \param value the value to append
+      void push_back( tribool value );
+
+      /// \brief Removes the last entry
+      ///
+      /// \pre \c size() is not 0
+      void pop_back() noexcept;
+
+      /// \brief Resizes this tribool_vector to \p count entries, filling
+      ///        new entries with \p value
+      ///
+      /// \param count the new number of entries
+      /// \param value the value of any new entries
+      void resize( size_type count, tribool value = tribool{} );
+
+      /// \brief Removes all entries
+      void clear() noexcept;
+
+      /// \brief Sets every entry to \p value
+      ///
+      /// \param value the value to set
+      void fill( tribool value ) noexcept;
+
+      /// \brief Swaps the contents of this with \p other
+      ///
+      /// \param other the tribool_vector to swap with
+      void swap( tribool_vector& other ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Kleene Operations
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Replaces each entry with the Kleene conjunction of it and the
+      ///        corresponding entry of \p other
+      ///
+      /// \pre \c other.size() equals \c size()
+      ///
+      /// \param other the right-hand operand
+      /// \return reference to \c (*this)
+      tribool_vector& operator&=( const tribool_vector& other ) noexcept;
+
+      /// \brief Replaces each entry with the Kleene disjunction of it and the
+      ///        corresponding entry of \p other
+      ///
+      /// \pre \c other.size() equals \c size()
+      ///
+      /// \param other the right-hand operand
+      /// \return reference to \c (*this)
+      tribool_vector& operator|=( const tribool_vector& other ) noexcept;
+
+      /// \brief Replaces each entry with its Kleene negation
+      ///
+      /// Indeterminate entries remain indeterminate.
+      void flip() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Counts the entries that are \c true
+      ///
+      /// \return the number of \c true entries
+      size_type count_true() const noexcept;
+
+      /// \brief Counts the entries that are \c false
+      ///
+      /// \return the number of \c false entries
+      size_type count_false() const noexcept;
+
+      /// \brief Counts the entries that are indeterminate
+      ///
+      /// \return the number of indeterminate entries
+      size_type count_indeterminate() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using word_type    = std::uint64_t;
+      using storage_type = std::vector<word_type>;
+
+      enum : size_type { bits_per_word = 64 };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      storage_type m_true;  ///< The plane marking true entries
+      storage_type m_false; ///< The plane marking false entries
+      size_type    m_size;  ///< The number of entries
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Returns the number of words needed for \p count entries
+      static size_type words_for( size_type count ) noexcept;
+
+      /// \brief Reads the entry at \p index
+      tribool get( size_type index ) const noexcept;
+
+      /// \brief Writes \p value to the entries in [first,last)
+      void assign_range( size_type first, size_type last, tribool value ) noexcept;
+
+      /// \brief Counts the set bits in \p plane
+      static size_type count( const storage_type& plane ) noexcept;
+
+      friend bool operator==( const tribool_vector&, const tribool_vector& ) noexcept;
+    };
+
+    //------------------------------------------------------------------------
+    // Kleene Operations
+    //------------------------------------------------------------------------
+
+    /// \brief Computes the entry-wise Kleene conjunction of \p lhs and \p rhs
+    ///
+    /// \pre \c lhs.size() equals \c rhs.size()
+    ///
+    /// \param lhs the left operand
+    /// \param rhs the right operand
+    /// \return the conjunction
+    tribool_vector operator&&( tribool_vector lhs, const tribool_vector& rhs );
+
+    /// \brief Computes the entry-wise Kleene disjunction of \p lhs and \p rhs
+    ///
+    /// \pre \c lhs.size() equals \c rhs.size()
+    ///
+    /// \param lhs the left operand
+    /// \param rhs the right operand
+    /// \return the disjunction
+    tribool_vector operator||( tribool_vector lhs, const tribool_vector& rhs );
+
+    /// \brief Computes the entry-wise Kleene negation of \p v
+    ///
+    /// \param v the operand
+    /// \return the negation
+    tribool_vector operator!( tribool_vector v );
+
+    //------------------------------------------------------------------------
+    // Equality Comparisons
+    //------------------------------------------------------------------------
+
+    bool operator==( const tribool_vector& lhs, const tribool_vector& rhs ) noexcept;
+    bool operator!=( const tribool_vector& lhs, const tribool_vector& rhs ) noexcept;
+
+    //------------------------------------------------------------------------
+    // Utilities
+    //------------------------------------------------------------------------
+
+    /// \brief Swaps \p lhs with \p rhs
+    ///
+    /// \param lhs the left tribool_vector to swap
+    /// \param rhs the right tribool_vector to swap
+    void swap( tribool_vector& lhs, tribool_vector& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/tribool_vector.inl"
+
+#endif /* BIT_STL_CONTAINERS_TRIBOOL_VECTOR_HPP */
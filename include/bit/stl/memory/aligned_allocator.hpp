@@ -0,0 +1,138 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a standard allocator that over-aligns its
+ *        allocations, such as to cache lines or SIMD register widths
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_ALIGNED_ALLOCATOR_HPP
+#define BIT_STL_MEMORY_ALIGNED_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <cstddef>     // std::size_t
+#include <cstdlib>     // std::free, posix_memalign
+#include <limits>      // std::numeric_limits
+#include <new>         // std::bad_alloc
+#include <type_traits> // std::true_type
+
+#if defined(_WIN32)
+# include <malloc.h> // _aligned_malloc, _aligned_free
+#endif
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A stateless standard allocator whose allocations are aligned
+    ///        to at least \p Align bytes
+    ///
+    /// This is useful for buffers that are accessed with aligned SIMD loads,
+    /// or that must not share a cache line with neighbouring allocations.
+    ///
+    /// \tparam T the type to allocate
+    /// \tparam Align the minimum alignment; a power of two
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Align = 64>
+    class aligned_allocator
+    {
+      static_assert( Align != 0 && (Align & (Align - 1)) == 0,
+                     "aligned_allocator: Align must be a power of two" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      using propagate_on_container_move_assignment = std::true_type;
+      using is_always_equal = std::true_type;
+
+      template<typename U>
+      struct rebind{ using other = aligned_allocator<U,Align>; };
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// The alignment of every allocation
+      static constexpr std::size_t alignment = (Align < alignof(T)) ? alignof(T) : Align;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      aligned_allocator() noexcept = default;
+
+      template<typename U>
+      aligned_allocator( const aligned_allocator<U,Align>& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates aligned storage for \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      T* allocate( size_type n );
+
+      /// \brief Deallocates storage previously allocated with \c allocate
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects
+      void deallocate( T* p, size_type n ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U, std::size_t Align>
+    constexpr bool operator==( const aligned_allocator<T,Align>& lhs,
+                               const aligned_allocator<U,Align>& rhs ) noexcept;
+    template<typename T, typename U, std::size_t Align>
+    constexpr bool operator!=( const aligned_allocator<T,Align>& lhs,
+                               const aligned_allocator<U,Align>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/aligned_allocator.inl"
+
+#endif /* BIT_STL_MEMORY_ALIGNED_ALLOCATOR_HPP */
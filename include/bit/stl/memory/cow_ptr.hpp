@@ -0,0 +1,420 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a copy-on-write smart pointer that shares its
+ *        object until it is modified
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_COW_PTR_HPP
+#define BIT_STL_MEMORY_COW_PTR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/compressed_pair.hpp" // compressed_pair
+#include "../utilities/in_place.hpp"        // in_place_type_t
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::nullptr_t
+#include <memory>      // std::allocator, std::allocator_traits
+#include <type_traits> // std::enable_if_t, std::is_convertible
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The reference-counted control block of a cow_ptr
+      ///
+      /// Like the clone_ptr control blocks, this erases the type of the
+      /// managed object behind virtual clone and destroy operations.
+      ///
+      /// \tparam T the type exposed by the owning cow_ptr
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T>
+      class cow_ptr_base
+      {
+        //--------------------------------------------------------------------
+        // Constructor / Destructor
+        //--------------------------------------------------------------------
+      public:
+
+        cow_ptr_base() noexcept;
+
+        virtual ~cow_ptr_base() = default;
+
+        //--------------------------------------------------------------------
+        // Reference Counting
+        //--------------------------------------------------------------------
+      public:
+
+        void acquire() noexcept;
+
+        /// \brief Drops a reference, destroying the block on the last one
+        void release() noexcept;
+
+        std::size_t use_count() const noexcept;
+
+        //--------------------------------------------------------------------
+        //
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Creates a new, unshared block holding a copy of the object
+        virtual cow_ptr_base* clone() const = 0;
+
+        virtual T* get() noexcept = 0;
+
+        virtual void destroy() noexcept = 0;
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        std::atomic<std::size_t> m_count;
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A control block that stores the object alongside itself
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T, typename U, typename Allocator>
+      class cow_ptr_emplace : public cow_ptr_base<T>
+      {
+        //--------------------------------------------------------------------
+        // Constructor
+        //--------------------------------------------------------------------
+      public:
+
+        template<typename...Args>
+        cow_ptr_emplace( const Allocator& alloc, Args&&...args );
+
+        //--------------------------------------------------------------------
+        //
+        //--------------------------------------------------------------------
+      public:
+
+        cow_ptr_base<T>* clone() const override;
+
+        T* get() noexcept override;
+
+        void destroy() noexcept override;
+
+        //--------------------------------------------------------------------
+        // Private Member Types
+        //--------------------------------------------------------------------
+      private:
+
+        using compressed_storage = compressed_pair<Allocator,U>;
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        compressed_storage m_storage;
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A control block that adopts an existing pointer
+      ///
+      /// Clones of this block are emplaced blocks using std::allocator.
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T, typename U, typename Deleter>
+      class cow_ptr_pointer : public cow_ptr_base<T>
+      {
+        //--------------------------------------------------------------------
+        // Constructor
+        //--------------------------------------------------------------------
+      public:
+
+        cow_ptr_pointer( U* pointer, const Deleter& deleter );
+
+        //--------------------------------------------------------------------
+        //
+        //--------------------------------------------------------------------
+      public:
+
+        cow_ptr_base<T>* clone() const override;
+
+        T* get() noexcept override;
+
+        void destroy() noexcept override;
+
+        //--------------------------------------------------------------------
+        // Private Member Types
+        //--------------------------------------------------------------------
+      private:
+
+        using compressed_storage = compressed_pair<U*,Deleter>;
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        compressed_storage m_storage;
+      };
+
+      template<typename T, typename U, typename Allocator, typename...Args>
+      cow_ptr_base<T>* make_cow_block( const Allocator& alloc, Args&&...args );
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief cow_ptr is a smart pointer with value semantics that shares
+    ///        its object between copies until one of them is modified
+    ///
+    /// Copying a cow_ptr only increments an atomic reference count. The
+    /// object is cloned lazily, the first time a shared cow_ptr is accessed
+    /// through a non-const member function. Objects that are copied often
+    /// but rarely modified, such as configuration passed by value, then cost
+    /// a reference count increment rather than a deep copy.
+    ///
+    /// Const access never clones. Non-const access to a shared object
+    /// clones it, even if the caller only reads; use the const overloads
+    /// (or cow_ptr::cget) to read through a non-const cow_ptr.
+    ///
+    /// Cloning copies the most-derived object, so cow_ptr<Base> created
+    /// from a Derived keeps the Derived type.
+    ///
+    /// \note Copies of a cow_ptr may be used concurrently, but a single
+    ///       cow_ptr object may not be modified from several threads at
+    ///       once, just like any other value type.
+    ///
+    /// \tparam T the type this cow_ptr manages
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class cow_ptr
+    {
+      template<typename U>
+      using enable_if_convertible_t = std::enable_if_t<
+        std::is_convertible<U*,T*>::value
+      >;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using element_type = T;
+      using pointer      = T*;
+
+      //----------------------------------------------------------------------
+      // Constructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \{
+      /// \brief Constructs a cow_ptr with no managed object
+      cow_ptr() noexcept;
+      cow_ptr( std::nullptr_t ) noexcept;
+      /// \}
+
+      /// \brief Constructs a cow_ptr that manages \p ptr
+      ///
+      /// \param ptr the pointer to manage
+      template<typename U, typename = enable_if_convertible_t<U>>
+      explicit cow_ptr( U* ptr );
+
+      /// \brief Constructs a cow_ptr that manages \p ptr, destroying it
+      ///        with \p deleter
+      ///
+      /// \param ptr the pointer to manage
+      /// \param deleter the deleter to destroy \p ptr with
+      template<typename U, typename Deleter, typename = enable_if_convertible_t<U>>
+      cow_ptr( U* ptr, Deleter deleter );
+
+      /// \brief Constructs a cow_ptr that manages an object of type \p U,
+      ///        constructed from \p args
+      ///
+      /// \param args the arguments to forward to \p U's constructor
+      template<typename U, typename...Args, typename = enable_if_convertible_t<U>>
+      explicit cow_ptr( in_place_type_t<U>, Args&&...args );
+
+      /// \brief Constructs a cow_ptr that shares the object of \p other
+      ///
+      /// \param other the other cow_ptr to share with
+      cow_ptr( const cow_ptr& other ) noexcept;
+
+      /// \brief Constructs a cow_ptr by taking the object of \p other
+      ///
+      /// \param other the other cow_ptr to move
+      cow_ptr( cow_ptr&& other ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      ~cow_ptr();
+
+      //----------------------------------------------------------------------
+
+      cow_ptr& operator=( const cow_ptr& other ) noexcept;
+
+      cow_ptr& operator=( cow_ptr&& other ) noexcept;
+
+      cow_ptr& operator=( std::nullptr_t ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Releases the managed object
+      void reset() noexcept;
+
+      /// \brief Makes this cow_ptr the sole owner of its object, cloning
+      ///        it if it is shared
+      void detach();
+
+      void swap( cow_ptr& other ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \{
+      /// \brief Gets a pointer to the managed object
+      ///
+      /// The non-const overload detaches this cow_ptr first
+      ///
+      /// \return the managed object
+      pointer get();
+      const T* get() const noexcept;
+      /// \}
+
+      /// \brief Gets a const pointer to the managed object without
+      ///        detaching
+      ///
+      /// \return the managed object
+      const T* cget() const noexcept;
+
+      /// \{
+      /// \brief Accesses the managed object
+      ///
+      /// The non-const overloads detach this cow_ptr first
+      std::add_lvalue_reference_t<T> operator*();
+      std::add_lvalue_reference_t<const T> operator*() const noexcept;
+      pointer operator->();
+      const T* operator->() const noexcept;
+      /// \}
+
+      explicit operator bool() const noexcept;
+
+      /// \brief Gets the number of cow_ptrs sharing the managed object
+      ///
+      /// \return the number of owners, or 0 if no object is managed
+      std::size_t use_count() const noexcept;
+
+      /// \brief Queries whether this is the only cow_ptr that owns its
+      ///        object
+      ///
+      /// \return \c true if use_count() is 1
+      bool unique() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using control_block = detail::cow_ptr_base<T>;
+
+      //----------------------------------------------------------------------
+      // Private Constructors
+      //----------------------------------------------------------------------
+    private:
+
+      cow_ptr( control_block* block ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      control_block* m_control_block;
+      T*             m_ptr;
+
+      //----------------------------------------------------------------------
+      // Friends
+      //----------------------------------------------------------------------
+    private:
+
+      template<typename U, typename Allocator, typename...Args>
+      friend cow_ptr<U> allocate_cow( const Allocator& alloc, Args&&...args );
+    };
+
+    //------------------------------------------------------------------------
+    // Utilities
+    //------------------------------------------------------------------------
+
+    /// \brief Swaps the contents of two cow_ptrs
+    ///
+    /// \param lhs the left cow_ptr
+    /// \param rhs the right cow_ptr
+    template<typename T>
+    void swap( cow_ptr<T>& lhs, cow_ptr<T>& rhs ) noexcept;
+
+    /// \brief Constructs a cow_ptr managing a \p T constructed from \p args
+    ///
+    /// \param args the arguments to forward to \p T's constructor
+    /// \return the cow_ptr
+    template<typename T, typename...Args>
+    cow_ptr<T> make_cow( Args&&...args );
+
+    /// \brief Constructs a cow_ptr managing a \p T constructed from \p args,
+    ///        allocated with \p alloc
+    ///
+    /// Clones made on modification are allocated with a copy of \p alloc
+    ///
+    /// \param alloc the allocator to allocate with
+    /// \param args the arguments to forward to \p T's constructor
+    /// \return the cow_ptr
+    template<typename T, typename Allocator, typename...Args>
+    cow_ptr<T> allocate_cow( const Allocator& alloc, Args&&...args );
+
+    //------------------------------------------------------------------------
+    // Comparisons
+    //------------------------------------------------------------------------
+
+    template<typename T>
+    bool operator==( const cow_ptr<T>& lhs, std::nullptr_t ) noexcept;
+    template<typename T>
+    bool operator==( std::nullptr_t, const cow_ptr<T>& rhs ) noexcept;
+    template<typename T>
+    bool operator!=( const cow_ptr<T>& lhs, std::nullptr_t ) noexcept;
+    template<typename T>
+    bool operator!=( std::nullptr_t, const cow_ptr<T>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/cow_ptr.inl"
+
+#endif /* BIT_STL_MEMORY_COW_PTR_HPP */
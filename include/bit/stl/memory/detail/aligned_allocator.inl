@@ -0,0 +1,89 @@
+#ifndef BIT_STL_MEMORY_DETAIL_ALIGNED_ALLOCATOR_INL
+#define BIT_STL_MEMORY_DETAIL_ALIGNED_ALLOCATOR_INL
+
+//=============================================================================
+// aligned_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Align>
+constexpr std::size_t bit::stl::aligned_allocator<T,Align>::alignment;
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Align>
+template<typename U>
+inline bit::stl::aligned_allocator<T,Align>
+  ::aligned_allocator( const aligned_allocator<U,Align>& )
+  noexcept
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Align>
+inline T* bit::stl::aligned_allocator<T,Align>::allocate( size_type n )
+{
+  if( n > std::numeric_limits<size_type>::max() / sizeof(T) ) {
+    throw std::bad_alloc{};
+  }
+
+  // posix_memalign additionally requires a multiple of sizeof(void*)
+  constexpr auto align = (alignment < sizeof(void*)) ? sizeof(void*) : alignment;
+  const auto size = (n == 0) ? 1 : n * sizeof(T);
+
+#if defined(_WIN32)
+  auto* const p = ::_aligned_malloc( size, align );
+#else
+  void* p = nullptr;
+  if( ::posix_memalign( &p, align, size ) != 0 ) {
+    p = nullptr;
+  }
+#endif
+
+  if( p == nullptr ) {
+    throw std::bad_alloc{};
+  }
+  return static_cast<T*>(p);
+}
+
+template<typename T, std::size_t Align>
+inline void bit::stl::aligned_allocator<T,Align>::deallocate( T* p, size_type )
+  noexcept
+{
+#if defined(_WIN32)
+  ::_aligned_free( p );
+#else
+  std::free( p );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, std::size_t Align>
+inline constexpr bool bit::stl::operator==( const aligned_allocator<T,Align>&,
+                                            const aligned_allocator<U,Align>& )
+  noexcept
+{
+  return true;
+}
+
+template<typename T, typename U, std::size_t Align>
+inline constexpr bool bit::stl::operator!=( const aligned_allocator<T,Align>&,
+                                            const aligned_allocator<U,Align>& )
+  noexcept
+{
+  return false;
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_ALIGNED_ALLOCATOR_INL */
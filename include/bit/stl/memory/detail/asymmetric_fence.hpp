@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains the asymmetric fence used by the deferred
+ *        reclamation schemes in epoch_domain.hpp and hazard_pointer.hpp
+ *
+ * \note This is an internal header file, included by other library headers.
+ *       Do not attempt to use it directly.
+ */
+#ifndef BIT_STL_MEMORY_DETAIL_ASYMMETRIC_FENCE_HPP
+#define BIT_STL_MEMORY_DETAIL_ASYMMETRIC_FENCE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <atomic> // std::atomic_thread_fence, std::atomic_signal_fence
+
+#if defined(__linux__)
+# include <linux/membarrier.h> // MEMBARRIER_CMD_*
+# include <sys/syscall.h>      // SYS_membarrier
+# include <unistd.h>           // ::syscall
+#endif
+
+#if defined(__SANITIZE_THREAD__)
+# define BIT_STL_DETAIL_ASYMMETRIC_FENCE_SANITIZED 1
+#elif defined(__has_feature)
+# if __has_feature(thread_sanitizer)
+#   define BIT_STL_DETAIL_ASYMMETRIC_FENCE_SANITIZED 1
+# endif
+#endif
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// \{
+      /// \brief Halves of an asymmetric fence
+      ///
+      /// When the operating system can issue a barrier on other threads'
+      /// behalf, the light side is only a compiler barrier and the heavy
+      /// side forces a full fence on every running thread. Otherwise both
+      /// sides are full fences.
+      ///
+      /// \param asymmetric the result of register_asymmetric_fence()
+      inline void asymmetric_light_fence( bool asymmetric )
+        noexcept
+      {
+        if( asymmetric ) {
+          std::atomic_signal_fence( std::memory_order_seq_cst );
+        } else {
+          std::atomic_thread_fence( std::memory_order_seq_cst );
+        }
+      }
+
+      inline void asymmetric_heavy_fence( bool asymmetric )
+        noexcept
+      {
+#if defined(__linux__) && defined(SYS_membarrier)
+        if( asymmetric ) {
+          ::syscall( SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0 );
+          return;
+        }
+#else
+        (void) asymmetric;
+#endif
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+      }
+      /// \}
+
+      /// \brief Registers the process for asymmetric fences
+      ///
+      /// \return \c true if the light side may omit the hardware fence
+      inline bool register_asymmetric_fence()
+        noexcept
+      {
+#if defined(__linux__) && defined(SYS_membarrier) && \
+    !defined(BIT_STL_DETAIL_ASYMMETRIC_FENCE_SANITIZED)
+        const auto supported = ::syscall( SYS_membarrier, MEMBARRIER_CMD_QUERY, 0 );
+
+        if( supported < 0 || !(supported & MEMBARRIER_CMD_PRIVATE_EXPEDITED) ) {
+          return false;
+        }
+        return ::syscall( SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0 ) == 0;
+#else
+        // Thread sanitizer cannot see barriers issued by the kernel
+        return false;
+#endif
+      }
+
+    } // namespace detail
+  } // namespace stl
+} // namespace bit
+
+#undef BIT_STL_DETAIL_ASYMMETRIC_FENCE_SANITIZED
+
+#endif /* BIT_STL_MEMORY_DETAIL_ASYMMETRIC_FENCE_HPP */
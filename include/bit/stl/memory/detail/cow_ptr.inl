@@ -0,0 +1,470 @@
+#ifndef BIT_STL_MEMORY_DETAIL_COW_PTR_INL
+#define BIT_STL_MEMORY_DETAIL_COW_PTR_INL
+
+//=============================================================================
+// detail::cow_ptr_base
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::detail::cow_ptr_base<T>::cow_ptr_base()
+  noexcept
+  : m_count(1)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Reference Counting
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::detail::cow_ptr_base<T>::acquire()
+  noexcept
+{
+  // A new reference can only be made from an existing one, so no ordering
+  // is required
+  m_count.fetch_add( 1, std::memory_order_relaxed );
+}
+
+template<typename T>
+inline void bit::stl::detail::cow_ptr_base<T>::release()
+  noexcept
+{
+  if( m_count.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
+    destroy();
+  }
+}
+
+template<typename T>
+inline std::size_t bit::stl::detail::cow_ptr_base<T>::use_count()
+  const noexcept
+{
+  // Acquire pairs with the release in release(), so that a sole owner
+  // observes every access made through the references that were dropped
+  return m_count.load( std::memory_order_acquire );
+}
+
+//=============================================================================
+// detail::cow_ptr_emplace
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename Allocator>
+template<typename...Args>
+inline bit::stl::detail::cow_ptr_emplace<T,U,Allocator>
+  ::cow_ptr_emplace( const Allocator& alloc, Args&&...args )
+  : m_storage( std::piecewise_construct,
+               std::forward_as_tuple(alloc),
+               std::forward_as_tuple(std::forward<Args>(args)...) )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename Allocator>
+inline bit::stl::detail::cow_ptr_base<T>*
+  bit::stl::detail::cow_ptr_emplace<T,U,Allocator>::clone()
+  const
+{
+  return make_cow_block<T,U>( m_storage.first(), m_storage.second() );
+}
+
+template<typename T, typename U, typename Allocator>
+inline T* bit::stl::detail::cow_ptr_emplace<T,U,Allocator>::get()
+  noexcept
+{
+  return std::addressof(m_storage.second());
+}
+
+template<typename T, typename U, typename Allocator>
+inline void bit::stl::detail::cow_ptr_emplace<T,U,Allocator>::destroy()
+  noexcept
+{
+  using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<cow_ptr_emplace>;
+  using allocator    = typename alloc_traits::allocator_type;
+
+  // Copy the allocator out before this block, and the allocator in it,
+  // are destroyed
+
+  auto alloc = allocator(m_storage.first());
+
+  alloc_traits::destroy( alloc, this );
+  alloc_traits::deallocate( alloc, this, 1 );
+}
+
+//=============================================================================
+// detail::cow_ptr_pointer
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename Deleter>
+inline bit::stl::detail::cow_ptr_pointer<T,U,Deleter>
+  ::cow_ptr_pointer( U* pointer, const Deleter& deleter )
+  : m_storage( pointer, deleter )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename Deleter>
+inline bit::stl::detail::cow_ptr_base<T>*
+  bit::stl::detail::cow_ptr_pointer<T,U,Deleter>::clone()
+  const
+{
+  return make_cow_block<T,U>( std::allocator<U>{}, *m_storage.first() );
+}
+
+template<typename T, typename U, typename Deleter>
+inline T* bit::stl::detail::cow_ptr_pointer<T,U,Deleter>::get()
+  noexcept
+{
+  return m_storage.first();
+}
+
+template<typename T, typename U, typename Deleter>
+inline void bit::stl::detail::cow_ptr_pointer<T,U,Deleter>::destroy()
+  noexcept
+{
+  m_storage.second()( m_storage.first() );
+  delete this;
+}
+
+//=============================================================================
+// detail free functions
+//=============================================================================
+
+template<typename T, typename U, typename Allocator, typename...Args>
+inline bit::stl::detail::cow_ptr_base<T>*
+  bit::stl::detail::make_cow_block( const Allocator& alloc, Args&&...args )
+{
+  using block_type   = cow_ptr_emplace<T,U,Allocator>;
+  using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<block_type>;
+  using allocator    = typename alloc_traits::allocator_type;
+
+  auto block_alloc = allocator(alloc);
+  auto* block      = alloc_traits::allocate( block_alloc, 1 );
+
+  try {
+    alloc_traits::construct( block_alloc, block, alloc, std::forward<Args>(args)... );
+  } catch( ... ) {
+    alloc_traits::deallocate( block_alloc, block, 1 );
+    throw;
+  }
+  return block;
+}
+
+//=============================================================================
+// cow_ptr<T>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::cow_ptr()
+  noexcept
+  : m_control_block(nullptr),
+    m_ptr(nullptr)
+{
+
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::cow_ptr( std::nullptr_t )
+  noexcept
+  : cow_ptr()
+{
+
+}
+
+template<typename T>
+template<typename U, typename>
+inline bit::stl::cow_ptr<T>::cow_ptr( U* ptr )
+  : cow_ptr( ptr, std::default_delete<U>{} )
+{
+
+}
+
+template<typename T>
+template<typename U, typename Deleter, typename>
+inline bit::stl::cow_ptr<T>::cow_ptr( U* ptr, Deleter deleter )
+  : cow_ptr()
+{
+  if( ptr ) {
+    try {
+      m_control_block = new detail::cow_ptr_pointer<T,U,Deleter>( ptr, deleter );
+    } catch( ... ) {
+      deleter( ptr );
+      throw;
+    }
+    m_ptr = ptr;
+  }
+}
+
+template<typename T>
+template<typename U, typename...Args, typename>
+inline bit::stl::cow_ptr<T>::cow_ptr( in_place_type_t<U>, Args&&...args )
+  : cow_ptr( detail::make_cow_block<T,U>( std::allocator<U>{},
+                                          std::forward<Args>(args)... ) )
+{
+
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::cow_ptr( const cow_ptr& other )
+  noexcept
+  : m_control_block(other.m_control_block),
+    m_ptr(other.m_ptr)
+{
+  if( m_control_block ) {
+    m_control_block->acquire();
+  }
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::cow_ptr( cow_ptr&& other )
+  noexcept
+  : m_control_block(other.m_control_block),
+    m_ptr(other.m_ptr)
+{
+  other.m_control_block = nullptr;
+  other.m_ptr           = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::~cow_ptr()
+{
+  reset();
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::cow_ptr<T>&
+  bit::stl::cow_ptr<T>::operator=( const cow_ptr& other )
+  noexcept
+{
+  cow_ptr(other).swap(*this);
+  return (*this);
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>&
+  bit::stl::cow_ptr<T>::operator=( cow_ptr&& other )
+  noexcept
+{
+  cow_ptr(std::move(other)).swap(*this);
+  return (*this);
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>&
+  bit::stl::cow_ptr<T>::operator=( std::nullptr_t )
+  noexcept
+{
+  reset();
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::cow_ptr<T>::reset()
+  noexcept
+{
+  if( m_control_block ) {
+    m_control_block->release();
+  }
+  m_control_block = nullptr;
+  m_ptr           = nullptr;
+}
+
+template<typename T>
+inline void bit::stl::cow_ptr<T>::detach()
+{
+  if( m_control_block && m_control_block->use_count() != 1 ) {
+    auto* block = m_control_block->clone();
+
+    m_control_block->release();
+    m_control_block = block;
+    m_ptr           = block->get();
+  }
+}
+
+template<typename T>
+inline void bit::stl::cow_ptr<T>::swap( cow_ptr& other )
+  noexcept
+{
+  using std::swap;
+
+  swap( m_control_block, other.m_control_block );
+  swap( m_ptr, other.m_ptr );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::stl::cow_ptr<T>::pointer bit::stl::cow_ptr<T>::get()
+{
+  detach();
+  return m_ptr;
+}
+
+template<typename T>
+inline const T* bit::stl::cow_ptr<T>::get()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T>
+inline const T* bit::stl::cow_ptr<T>::cget()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T>
+inline std::add_lvalue_reference_t<T> bit::stl::cow_ptr<T>::operator*()
+{
+  return *get();
+}
+
+template<typename T>
+inline std::add_lvalue_reference_t<const T> bit::stl::cow_ptr<T>::operator*()
+  const noexcept
+{
+  return *m_ptr;
+}
+
+template<typename T>
+inline typename bit::stl::cow_ptr<T>::pointer bit::stl::cow_ptr<T>::operator->()
+{
+  return get();
+}
+
+template<typename T>
+inline const T* bit::stl::cow_ptr<T>::operator->()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::operator bool()
+  const noexcept
+{
+  return m_ptr != nullptr;
+}
+
+template<typename T>
+inline std::size_t bit::stl::cow_ptr<T>::use_count()
+  const noexcept
+{
+  return m_control_block ? m_control_block->use_count() : 0u;
+}
+
+template<typename T>
+inline bool bit::stl::cow_ptr<T>::unique()
+  const noexcept
+{
+  return use_count() == 1;
+}
+
+//-----------------------------------------------------------------------------
+// Private Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::cow_ptr<T>::cow_ptr( control_block* block )
+  noexcept
+  : m_control_block(block),
+    m_ptr(block->get())
+{
+
+}
+
+//=============================================================================
+// Free Functions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::swap( cow_ptr<T>& lhs, cow_ptr<T>& rhs )
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+template<typename T, typename...Args>
+inline bit::stl::cow_ptr<T> bit::stl::make_cow( Args&&...args )
+{
+  return cow_ptr<T>( in_place_type<T>, std::forward<Args>(args)... );
+}
+
+template<typename T, typename Allocator, typename...Args>
+inline bit::stl::cow_ptr<T>
+  bit::stl::allocate_cow( const Allocator& alloc, Args&&...args )
+{
+  return cow_ptr<T>( detail::make_cow_block<T,T>( alloc, std::forward<Args>(args)... ) );
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::stl::operator==( const cow_ptr<T>& lhs, std::nullptr_t )
+  noexcept
+{
+  return !lhs;
+}
+
+template<typename T>
+inline bool bit::stl::operator==( std::nullptr_t, const cow_ptr<T>& rhs )
+  noexcept
+{
+  return !rhs;
+}
+
+template<typename T>
+inline bool bit::stl::operator!=( const cow_ptr<T>& lhs, std::nullptr_t )
+  noexcept
+{
+  return static_cast<bool>(lhs);
+}
+
+template<typename T>
+inline bool bit::stl::operator!=( std::nullptr_t, const cow_ptr<T>& rhs )
+  noexcept
+{
+  return static_cast<bool>(rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_COW_PTR_INL */
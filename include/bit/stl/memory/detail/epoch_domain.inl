@@ -0,0 +1,374 @@
+#ifndef BIT_STL_MEMORY_DETAIL_EPOCH_DOMAIN_INL
+#define BIT_STL_MEMORY_DETAIL_EPOCH_DOMAIN_INL
+
+//=============================================================================
+// detail::epoch_bucket
+//=============================================================================
+
+inline std::size_t bit::stl::detail::epoch_bucket::clear()
+  noexcept
+{
+  const auto size = entries.size();
+
+  for( auto& retired : entries ) {
+    retired();
+  }
+  entries.clear();
+
+  return size;
+}
+
+//=============================================================================
+// epoch_domain
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+inline bit::stl::epoch_domain::epoch_domain( size_type batch_size )
+  : m_epoch(0),
+    m_records(nullptr),
+    m_batch_size(batch_size),
+    m_asymmetric(detail::register_asymmetric_fence()),
+    m_orphan_slots(0)
+{
+  BIT_ASSERT( batch_size != 0, "epoch_domain: batch size must be non-zero" );
+}
+
+inline bit::stl::epoch_domain::~epoch_domain()
+{
+  auto* record = m_records.load( std::memory_order_acquire );
+
+  while( record ) {
+    BIT_ASSERT( !record->in_use.load(), "epoch_domain: participant outlived its domain" );
+
+    auto* const next = record->next;
+    delete record;
+    record = next;
+  }
+
+  for( auto& orphan : m_orphans ) {
+    orphan.second();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::stl::epoch_domain::epoch_type bit::stl::epoch_domain::epoch()
+  const noexcept
+{
+  return m_epoch.load( std::memory_order_acquire );
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::detail::epoch_record* bit::stl::epoch_domain::acquire_record()
+{
+  auto* record = m_records.load( std::memory_order_acquire );
+
+  for( ; record; record = record->next ) {
+    auto expected = false;
+    if( record->in_use.compare_exchange_strong( expected, true,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed ) ) {
+      return record;
+    }
+  }
+
+  record = new detail::epoch_record;
+  record->next = m_records.load( std::memory_order_relaxed );
+  while( !m_records.compare_exchange_weak( record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed ) ) {
+    // record->next has been reloaded; retry
+  }
+  return record;
+}
+
+inline void bit::stl::epoch_domain::release_record( detail::epoch_record& record )
+{
+  const auto epoch = m_epoch.load( std::memory_order_acquire );
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if( record.has_orphan_slot ) {
+      record.has_orphan_slot = false;
+      --m_orphan_slots;
+    }
+
+    // Keep the capacity reserved for the remaining slots while adopting
+    // this record's objects
+    auto adopted = m_orphan_slots;
+    for( auto& bucket : record.buckets ) {
+      if( bucket.epoch + 2 > epoch ) {
+        adopted += bucket.entries.size();
+      }
+    }
+    m_orphans.reserve( m_orphans.size() + adopted );
+
+    for( auto& bucket : record.buckets ) {
+      if( bucket.epoch + 2 <= epoch ) {
+        bucket.clear();
+        continue;
+      }
+      for( auto& retired : bucket.entries ) {
+        m_orphans.emplace_back( bucket.epoch, retired );
+      }
+      bucket.entries.clear();
+    }
+  }
+
+  record.retired_since_collect = 0;
+  record.in_use.store( false, std::memory_order_release );
+}
+
+inline bool bit::stl::epoch_domain::try_advance()
+  noexcept
+{
+  // Make every pinned thread's local epoch visible before scanning
+  detail::asymmetric_heavy_fence( m_asymmetric );
+
+  auto epoch = m_epoch.load( std::memory_order_acquire );
+
+  for( auto* record = m_records.load( std::memory_order_acquire );
+       record;
+       record = record->next ) {
+    const auto local = record->local.load( std::memory_order_acquire );
+
+    if( (local & 1u) && (local >> 1) != epoch ) {
+      return false;
+    }
+  }
+  return m_epoch.compare_exchange_strong( epoch, epoch + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed );
+}
+
+inline bit::stl::epoch_domain::size_type bit::stl::epoch_domain::collect_orphans()
+  noexcept
+{
+  std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+
+  if( !lock.owns_lock() || m_orphans.empty() ) {
+    return 0;
+  }
+
+  const auto epoch = m_epoch.load( std::memory_order_acquire );
+  auto freed = size_type{0};
+  auto kept  = m_orphans.begin();
+
+  for( auto& orphan : m_orphans ) {
+    if( orphan.first + 2 <= epoch ) {
+      orphan.second();
+      ++freed;
+    } else {
+      *kept++ = orphan;
+    }
+  }
+  m_orphans.erase( kept, m_orphans.end() );
+
+  return freed;
+}
+
+inline void bit::stl::epoch_domain::reserve_orphan_slot( detail::epoch_record& record )
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_orphans.reserve( m_orphans.size() + m_orphan_slots + 1 );
+  ++m_orphan_slots;
+  record.has_orphan_slot = true;
+}
+
+inline void bit::stl::epoch_domain::orphan( detail::epoch_record& record,
+                                            epoch_type epoch,
+                                            detail::retired_object retired )
+  noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  BIT_ASSERT( record.has_orphan_slot, "epoch_domain: no orphan slot reserved" );
+
+  // Cannot reallocate: the slot's capacity is reserved
+  m_orphans.emplace_back( epoch, retired );
+  record.has_orphan_slot = false;
+  --m_orphan_slots;
+}
+
+//=============================================================================
+// epoch_domain::participant
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+inline bit::stl::epoch_domain::participant::participant( epoch_domain& domain )
+  : m_domain(&domain),
+    m_record(domain.acquire_record())
+{
+  try {
+    m_domain->reserve_orphan_slot( *m_record );
+  } catch( ... ) {
+    m_domain->release_record( *m_record );
+    throw;
+  }
+}
+
+inline bit::stl::epoch_domain::participant::~participant()
+{
+  BIT_ASSERT( !is_pinned(), "epoch_domain::participant: destroyed while pinned" );
+
+  m_domain->release_record( *m_record );
+}
+
+//-----------------------------------------------------------------------------
+// Critical Sections
+//-----------------------------------------------------------------------------
+
+inline bit::stl::epoch_domain::guard bit::stl::epoch_domain::participant::pin()
+  noexcept
+{
+  return guard(*this);
+}
+
+inline bool bit::stl::epoch_domain::participant::is_pinned()
+  const noexcept
+{
+  return m_record->nesting != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Reclamation
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Deleter>
+inline void bit::stl::epoch_domain::participant::retire( T* ptr, Deleter deleter )
+{
+  if( ptr == nullptr ) {
+    return;
+  }
+  push( detail::retired_object( ptr, std::move(deleter) ) );
+}
+
+inline bit::stl::epoch_domain::size_type
+  bit::stl::epoch_domain::participant::collect()
+  noexcept
+{
+  m_record->retired_since_collect = 0;
+  m_domain->try_advance();
+
+  const auto epoch = m_domain->m_epoch.load( std::memory_order_acquire );
+  auto freed = size_type{0};
+
+  for( auto& bucket : m_record->buckets ) {
+    if( !bucket.entries.empty() && bucket.epoch + 2 <= epoch ) {
+      freed += bucket.clear();
+    }
+  }
+  return freed + m_domain->collect_orphans();
+}
+
+inline bit::stl::epoch_domain::size_type
+  bit::stl::epoch_domain::participant::pending()
+  const noexcept
+{
+  auto total = size_type{0};
+
+  for( const auto& bucket : m_record->buckets ) {
+    total += bucket.entries.size();
+  }
+  return total;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::epoch_domain::participant::enter()
+  noexcept
+{
+  if( m_record->nesting++ == 0 ) {
+    const auto epoch = m_domain->m_epoch.load( std::memory_order_relaxed );
+
+    m_record->local.store( (epoch << 1) | 1u, std::memory_order_relaxed );
+    detail::asymmetric_light_fence( m_domain->m_asymmetric );
+  }
+}
+
+inline void bit::stl::epoch_domain::participant::leave()
+  noexcept
+{
+  BIT_ASSERT( m_record->nesting != 0, "epoch_domain::participant: unbalanced unpin" );
+
+  if( --m_record->nesting == 0 ) {
+    m_record->local.store( 0, std::memory_order_release );
+  }
+}
+
+inline void bit::stl::epoch_domain::participant::push( detail::retired_object retired )
+{
+  // A slot spent by an earlier failure is replaced before the object is
+  // taken, so that a failure here leaves the caller still owning it
+  if( !m_record->has_orphan_slot ) {
+    m_domain->reserve_orphan_slot( *m_record );
+  }
+
+  // Order the caller's unlinking of the object before reading the epoch it
+  // is retired in
+  std::atomic_thread_fence( std::memory_order_seq_cst );
+
+  const auto epoch = m_domain->m_epoch.load( std::memory_order_relaxed );
+  auto& bucket     = m_record->buckets[epoch % 3];
+
+  // A bucket from an older epoch is at least three epochs old, and safe
+  if( bucket.epoch != epoch ) {
+    bucket.clear();
+    bucket.epoch = epoch;
+  }
+
+  try {
+    bucket.entries.push_back( retired );
+  } catch( ... ) {
+    // The object may still be in use, so it cannot be destroyed here. The
+    // caller is usually pinned, so waiting for the epoch to advance could
+    // never finish; hand it to the domain instead
+    m_domain->orphan( *m_record, epoch, retired );
+    return;
+  }
+
+  if( ++m_record->retired_since_collect >= m_domain->m_batch_size ) {
+    collect();
+  }
+}
+
+//=============================================================================
+// epoch_domain::guard
+//=============================================================================
+
+inline bit::stl::epoch_domain::guard::guard( participant& p )
+  noexcept
+  : m_participant(&p)
+{
+  m_participant->enter();
+}
+
+inline bit::stl::epoch_domain::guard::guard( guard&& other )
+  noexcept
+  : m_participant(other.m_participant)
+{
+  other.m_participant = nullptr;
+}
+
+inline bit::stl::epoch_domain::guard::~guard()
+{
+  if( m_participant ) {
+    m_participant->leave();
+  }
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_EPOCH_DOMAIN_INL */
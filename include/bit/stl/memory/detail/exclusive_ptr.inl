@@ -15,6 +15,34 @@ public:
   virtual void* get_deleter( const std::type_info& ) noexcept = 0;
 };
 
+//=============================================================================
+// exclusive_ptr_default_block
+//=============================================================================
+
+/// A sentinel control block marking elements created with \c new and
+/// destroyed with a direct \c delete; it is never invoked
+class bit::stl::detail::exclusive_ptr_default_block final
+  : public bit::stl::detail::exclusive_ptr_control_block
+{
+public:
+
+  static exclusive_ptr_control_block* instance() noexcept;
+
+  void destroy() override{}
+
+  void* get_deleter( const std::type_info& ) noexcept override{ return nullptr; }
+};
+
+inline bit::stl::detail::exclusive_ptr_control_block*
+  bit::stl::detail::exclusive_ptr_default_block::instance()
+  noexcept
+{
+  // Constant-initialized; only the address is ever used
+  static exclusive_ptr_default_block s_block;
+
+  return &s_block;
+}
+
 //=============================================================================
 // exclusive_ptr_emplace
 //=============================================================================
@@ -76,7 +104,7 @@ inline void bit::stl::detail::exclusive_ptr_emplace<T,Allocator>::destroy()
 
 template<typename T, typename Allocator>
 inline void* bit::stl::detail::exclusive_ptr_emplace<T,Allocator>
-  ::get_deleter( const std::type_info& info )
+  ::get_deleter( const std::type_info& )
   noexcept
 {
   return nullptr;
@@ -113,7 +141,7 @@ public:
 
 private:
 
-  ::bit::stl::compressed_tuple<T, Deleter, Allocator> m_storage;
+  ::bit::stl::compressed_tuple<T*, Deleter, Allocator> m_storage;
 };
 
 template<typename T, typename Deleter, typename Allocator>
@@ -178,7 +206,7 @@ inline T* bit::stl::detail::exclusive_ptr_pointer<T,Deleter,Allocator>::get()
 {
   using bit::stl::get;
 
-  return std::addressof( get<0>(m_storage) );
+  return get<0>(m_storage);
 }
 
 //=============================================================================
@@ -190,7 +218,9 @@ inline bit::stl::exclusive_ptr<T>
   bit::stl::detail::static_pointer_cast( exclusive_ptr<U>&& other )
 {
   auto p = static_cast<T*>(other.m_ptr);
-  auto c = other.m_control_block;
+  auto c = exclusive_ptr<T>::adopt_block( other.m_control_block,
+                                           other.m_ptr,
+                                           detail::exclusive_ptr_deletable_as<T,U>{} );
 
   other.m_ptr           = nullptr;
   other.m_control_block = nullptr;
@@ -204,7 +234,9 @@ inline bit::stl::exclusive_ptr<T>
 {
   if( auto p = dynamic_cast<T*>(other.m_ptr) )
   {
-    auto c = other.m_control_block;
+    auto c = exclusive_ptr<T>::adopt_block( other.m_control_block,
+                                            other.m_ptr,
+                                            detail::exclusive_ptr_deletable_as<T,U>{} );
 
     other.m_ptr           = nullptr;
     other.m_control_block = nullptr;
@@ -219,7 +251,9 @@ inline bit::stl::exclusive_ptr<T>
   bit::stl::detail::const_pointer_cast( exclusive_ptr<U>&& other )
 {
   auto p = const_cast<T*>(other.m_ptr);
-  auto c = other.m_control_block;
+  auto c = exclusive_ptr<T>::adopt_block( other.m_control_block,
+                                           other.m_ptr,
+                                           detail::exclusive_ptr_deletable_as<T,U>{} );
 
   other.m_ptr           = nullptr;
   other.m_control_block = nullptr;
@@ -232,7 +266,9 @@ inline bit::stl::exclusive_ptr<T>
   bit::stl::detail::reinterpret_pointer_cast( exclusive_ptr<U>&& other )
 {
   auto p = reinterpret_cast<T*>(other.m_ptr);
-  auto c = other.m_control_block;
+  auto c = exclusive_ptr<T>::adopt_block( other.m_control_block,
+                                           other.m_ptr,
+                                           std::is_same<std::remove_cv_t<T>,std::remove_cv_t<U>>{} );
 
   other.m_ptr           = nullptr;
   other.m_control_block = nullptr;
@@ -296,6 +332,7 @@ template<typename Y, typename Deleter, typename Allocator, typename>
 inline bit::stl::exclusive_ptr<T>::exclusive_ptr( Y* ptr,
                                                   Deleter deleter,
                                                   Allocator alloc )
+  : exclusive_ptr( nullptr )
 {
   reset( ptr, deleter, alloc );
 }
@@ -323,8 +360,10 @@ inline bit::stl::exclusive_ptr<T>::exclusive_ptr( exclusive_ptr&& other )
 template<typename T>
 template<typename Y, typename>
 inline bit::stl::exclusive_ptr<T>::exclusive_ptr( exclusive_ptr<Y>&& other )
-  noexcept
-  : m_control_block( other.m_control_block ),
+  noexcept( detail::exclusive_ptr_deletable_as<T,Y>::value )
+  : m_control_block( adopt_block( other.m_control_block,
+                                  other.m_ptr,
+                                  detail::exclusive_ptr_deletable_as<T,Y>{} ) ),
     m_ptr( other.m_ptr )
 {
   other.m_control_block = nullptr;
@@ -346,7 +385,7 @@ bit::stl::exclusive_ptr<T>&
   bit::stl::exclusive_ptr<T>::operator=( exclusive_ptr&& other )
   noexcept
 {
-  if( m_control_block ) m_control_block->destroy();
+  destroy();
 
   m_control_block = other.m_control_block;
   m_ptr           = other.m_ptr;
@@ -361,11 +400,14 @@ template<typename T>
 template<typename Y, typename>
 bit::stl::exclusive_ptr<T>&
   bit::stl::exclusive_ptr<T>::operator=( exclusive_ptr<Y>&& other )
-  noexcept
+  noexcept( detail::exclusive_ptr_deletable_as<T,Y>::value )
 {
-  if( m_control_block ) m_control_block->destroy();
+  auto* const block = adopt_block( other.m_control_block,
+                                   other.m_ptr,
+                                   detail::exclusive_ptr_deletable_as<T,Y>{} );
+  destroy();
 
-  m_control_block = other.m_control_block;
+  m_control_block = block;
   m_ptr           = other.m_ptr;
 
   other.m_control_block = nullptr;
@@ -392,11 +434,10 @@ template<typename T>
 inline void bit::stl::exclusive_ptr<T>::reset()
   noexcept
 {
-  if( m_control_block ) {
-    m_control_block->destroy();
-    m_control_block = nullptr;
-    m_ptr           = nullptr;
-  }
+  destroy();
+
+  m_control_block = nullptr;
+  m_ptr           = nullptr;
 }
 
 template<typename T>
@@ -419,22 +460,18 @@ inline void bit::stl::exclusive_ptr<T>::reset( Y* ptr,
                                                Deleter deleter,
                                                Allocator alloc )
 {
+  using is_default = std::integral_constant<bool,
+    is_directly_deletable::value &&
+    std::is_same<Deleter,std::default_delete<Y>>::value &&
+    detail::is_std_allocator<Allocator>::value &&
+    detail::exclusive_ptr_deletable_as<T,Y>::value
+  >;
+
   reset();
 
   if(ptr) {
-    using control_block = detail::exclusive_ptr_pointer<T,Deleter,Allocator>;
-    using alloc_traits  = typename std::allocator_traits<Allocator>::template rebind_traits<control_block>;
-    using allocator     = typename alloc_traits::allocator_type;
-    using destructor    = allocator_deleter<allocator>;
-
-    allocator alloc2(alloc);
-    destructor d{alloc2,1};
-    std::unique_ptr<control_block,destructor> hold( alloc2.allocate(1), d );
-
-    alloc_traits::construct( alloc2, hold.get(), ptr, deleter, alloc );
-
+    m_control_block = make_block( ptr, deleter, alloc, is_default{} );
     m_ptr = ptr;
-    m_control_block = hold.release();
   }
 }
 
@@ -505,6 +542,124 @@ inline bit::stl::exclusive_ptr<T>::exclusive_ptr( ctor_tag,
 
 }
 
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::exclusive_ptr<T>::destroy()
+  noexcept
+{
+  if( m_control_block == detail::exclusive_ptr_default_block::instance() ) {
+    delete_element( is_directly_deletable{} );
+  } else if( m_control_block ) {
+    m_control_block->destroy();
+  }
+}
+
+template<typename T>
+inline void bit::stl::exclusive_ptr<T>::delete_element( std::true_type )
+  noexcept
+{
+  delete m_ptr;
+}
+
+template<typename T>
+inline void bit::stl::exclusive_ptr<T>::delete_element( std::false_type )
+  noexcept
+{
+  // The default block is never used for types that cannot be deleted
+  // directly
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename Y, typename Deleter, typename Allocator>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::make_block( Y*,
+                                          Deleter,
+                                          Allocator,
+                                          std::true_type )
+{
+  return detail::exclusive_ptr_default_block::instance();
+}
+
+template<typename T>
+template<typename Y, typename Deleter, typename Allocator>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::make_block( Y* ptr,
+                                          Deleter deleter,
+                                          Allocator alloc,
+                                          std::false_type )
+{
+  using control_block = detail::exclusive_ptr_pointer<Y,Deleter,Allocator>;
+  using alloc_traits  = typename std::allocator_traits<Allocator>::template rebind_traits<control_block>;
+  using allocator     = typename alloc_traits::allocator_type;
+  using destructor    = allocator_deleter<allocator>;
+
+  allocator alloc2(alloc);
+  destructor d{alloc2,1};
+  std::unique_ptr<control_block,destructor> hold( alloc2.allocate(1), d );
+
+  alloc_traits::construct( alloc2, hold.get(), ptr, deleter, alloc );
+
+  return hold.release();
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename Y>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::adopt_block( control_block_type* block,
+                                           Y*,
+                                           std::true_type )
+  noexcept
+{
+  return block;
+}
+
+template<typename T>
+template<typename Y>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::adopt_block( control_block_type* block,
+                                           Y* ptr,
+                                           std::false_type )
+{
+  if( block != detail::exclusive_ptr_default_block::instance() ) {
+    return block;
+  }
+
+  // Deleting through element_type* would be undefined, so the original
+  // type must be remembered in a real control block
+  using source_type = exclusive_ptr<std::remove_cv_t<Y>>;
+
+  return source_type::materialize_block( const_cast<std::remove_cv_t<Y>*>(ptr),
+                                         typename source_type::is_directly_deletable{} );
+}
+
+template<typename T>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::materialize_block( element_type* ptr,
+                                                 std::true_type )
+{
+  return make_block( ptr,
+                     std::default_delete<element_type>{},
+                     std::allocator<void>{},
+                     std::false_type{} );
+}
+
+template<typename T>
+inline typename bit::stl::exclusive_ptr<T>::control_block_type*
+  bit::stl::exclusive_ptr<T>::materialize_block( element_type*,
+                                                 std::false_type )
+  noexcept
+{
+  // Types that cannot be deleted directly never use the default block
+  return detail::exclusive_ptr_default_block::instance();
+}
+
 //=============================================================================
 // Free Functions
 //=============================================================================
@@ -685,7 +840,17 @@ inline bit::stl::hash_t bit::stl::hash_value( const exclusive_ptr<T>& val )
 template<typename Deleter, typename T>
 inline Deleter* bit::stl::get_deleter( const exclusive_ptr<T>& ptr )
 {
-  return static_cast<Deleter*>( ptr.m_control_block->get_deleter( typeid(T) ) );
+  using default_deleter = std::default_delete<typename exclusive_ptr<T>::element_type>;
+
+  if( ptr.m_control_block == nullptr ) return nullptr;
+
+  if( ptr.m_control_block == detail::exclusive_ptr_default_block::instance() ) {
+    static auto s_deleter = default_deleter{};
+
+    if( typeid(Deleter) != typeid(default_deleter) ) return nullptr;
+    return static_cast<Deleter*>( static_cast<void*>(&s_deleter) );
+  }
+  return static_cast<Deleter*>( ptr.m_control_block->get_deleter( typeid(Deleter) ) );
 }
 
 //-------------------------------------------------------------------------
@@ -697,12 +862,43 @@ inline bit::stl::exclusive_ptr<T> bit::stl::make_exclusive( Args&&...args )
                                 std::forward<Args>(args)... );
 }
 
+
 template<typename T, typename Allocator, typename...Args>
 inline bit::stl::exclusive_ptr<T>
   bit::stl::allocate_exclusive( const Allocator& alloc,
                                 Args&&...args )
 {
-  using tag_type      = typename exclusive_ptr<T>::ctor_tag;
+  using is_default = std::integral_constant<bool,
+    exclusive_ptr<T>::is_directly_deletable::value &&
+    detail::is_std_allocator<Allocator>::value
+  >;
+
+  return exclusive_ptr<T>::allocate( is_default{},
+                                     alloc,
+                                     std::forward<Args>(args)... );
+}
+
+template<typename T>
+template<typename Allocator, typename...Args>
+inline bit::stl::exclusive_ptr<T>
+  bit::stl::exclusive_ptr<T>::allocate( std::true_type,
+                                        const Allocator&,
+                                        Args&&...args )
+{
+  // Allocate exactly as unique_ptr would, with no control block
+  return { ctor_tag{},
+           detail::exclusive_ptr_default_block::instance(),
+           new T( std::forward<Args>(args)... ) };
+}
+
+template<typename T>
+template<typename Allocator, typename...Args>
+inline bit::stl::exclusive_ptr<T>
+  bit::stl::exclusive_ptr<T>::allocate( std::false_type,
+                                        const Allocator& alloc,
+                                        Args&&...args )
+{
+  using tag_type      = ctor_tag;
   using control_block = detail::exclusive_ptr_emplace<T,Allocator>;
   using alloc_traits  = typename std::allocator_traits<Allocator>::template rebind_traits<control_block>;
   using allocator     = typename alloc_traits::allocator_type;
@@ -9,6 +9,24 @@
 // Constructors / Assignment
 //----------------------------------------------------------------------------
 
+template<typename T>
+constexpr bit::stl::fat_ptr<T>::fat_ptr()
+  noexcept
+  : m_ptr(nullptr),
+    m_size(0)
+{
+
+}
+
+template<typename T>
+constexpr bit::stl::fat_ptr<T>::fat_ptr( T* p, std::size_t n )
+  noexcept
+  : m_ptr(p),
+    m_size(n)
+{
+
+}
+
 template<typename T>
 template<typename U>
 constexpr bit::stl::fat_ptr<T>::fat_ptr( const fat_ptr<U>& other )
@@ -72,7 +90,7 @@ constexpr std::size_t bit::stl::fat_ptr<T>::size()
 }
 
 template<typename T>
-constexpr typename bit::stl::fat_ptr<T>::element_type&
+constexpr std::add_lvalue_reference_t<typename bit::stl::fat_ptr<T>::element_type>
   bit::stl::fat_ptr<T>::operator*()
   const noexcept
 {
@@ -0,0 +1,274 @@
+#ifndef BIT_STL_MEMORY_DETAIL_FEEDBACK_ALLOCATOR_INL
+#define BIT_STL_MEMORY_DETAIL_FEEDBACK_ALLOCATOR_INL
+
+//=============================================================================
+// allocate_at_least
+//=============================================================================
+
+namespace bit { namespace stl { namespace detail {
+
+template<typename Allocator, typename = void>
+struct has_allocate_at_least : false_type{};
+
+template<typename Allocator>
+struct has_allocate_at_least<Allocator,void_t<
+  decltype(std::declval<Allocator&>().allocate_at_least( std::size_t{} ))
+>> : true_type{};
+
+template<typename Allocator>
+inline allocation_result<typename std::allocator_traits<Allocator>::pointer>
+  allocate_at_least( Allocator& alloc, std::size_t n, std::true_type )
+{
+  const auto result = alloc.allocate_at_least( n );
+
+  return { result.ptr, result.count };
+}
+
+template<typename Allocator>
+inline allocation_result<typename std::allocator_traits<Allocator>::pointer>
+  allocate_at_least( Allocator& alloc, std::size_t n, std::false_type )
+{
+  return { std::allocator_traits<Allocator>::allocate( alloc, n ), n };
+}
+
+} } } // namespace bit::stl::detail
+
+template<typename Allocator>
+inline bit::stl::allocation_result<typename std::allocator_traits<Allocator>::pointer>
+  bit::stl::allocate_at_least( Allocator& alloc, std::size_t n )
+{
+  return detail::allocate_at_least( alloc, n, detail::has_allocate_at_least<Allocator>{} );
+}
+
+//=============================================================================
+// malloc_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+inline bit::stl::fat_ptr<void>
+  bit::stl::malloc_allocator::allocate( std::size_t size, std::size_t align )
+{
+  BIT_ASSERT( align != 0 && (align & (align - 1)) == 0,
+              "malloc_allocator::allocate: align must be a power of two" );
+
+  if( size == 0 ) {
+    size = 1;
+  }
+
+#if defined(_WIN32)
+  // _aligned_free cannot release malloc storage, so everything is allocated
+  // through _aligned_malloc
+  if( align < alignof(std::max_align_t) ) {
+    align = alignof(std::max_align_t);
+  }
+  auto* const p = ::_aligned_malloc( size, align );
+#else
+  void* p = nullptr;
+  if( align <= alignof(std::max_align_t) ) {
+    p = std::malloc( size );
+  } else if( ::posix_memalign( &p, align, size ) != 0 ) {
+    p = nullptr;
+  }
+#endif
+
+  if( p == nullptr ) {
+    throw std::bad_alloc{};
+  }
+  return fat_ptr<void>{ p, usable_size( p, size, align ) };
+}
+
+inline void bit::stl::malloc_allocator::deallocate( fat_ptr<void> p )
+  noexcept
+{
+  // The C sized-free functions require the originally requested size, which
+  // the usable size reported by 'allocate' replaces; plain free is used
+#if defined(_WIN32)
+  ::_aligned_free( p.get() );
+#else
+  std::free( p.get() );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+inline std::size_t bit::stl::malloc_allocator::usable_size( void* p,
+                                                            std::size_t size,
+                                                            std::size_t align )
+  noexcept
+{
+#if defined(_WIN32)
+  (void) size;
+  return ::_aligned_msize( p, align, 0 );
+#elif defined(__APPLE__)
+  (void) size; (void) align;
+  return ::malloc_size( p );
+#elif defined(__linux__) || defined(__FreeBSD__)
+  (void) size; (void) align;
+  return ::malloc_usable_size( p );
+#else
+  (void) p; (void) align;
+  return size;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+inline constexpr bool bit::stl::operator==( const malloc_allocator&,
+                                            const malloc_allocator& )
+  noexcept
+{
+  return true;
+}
+
+inline constexpr bool bit::stl::operator!=( const malloc_allocator&,
+                                            const malloc_allocator& )
+  noexcept
+{
+  return false;
+}
+
+//=============================================================================
+// new_delete_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+inline bit::stl::fat_ptr<void>
+  bit::stl::new_delete_allocator::allocate( std::size_t size, std::size_t align )
+{
+  BIT_ASSERT( align <= alignof(std::max_align_t),
+              "new_delete_allocator::allocate: over-aligned allocations are "
+              "not supported" );
+  (void) align;
+
+  return fat_ptr<void>{ ::operator new( size ), size };
+}
+
+inline void bit::stl::new_delete_allocator::deallocate( fat_ptr<void> p )
+  noexcept
+{
+#if defined(__cpp_sized_deallocation)
+  ::operator delete( p.get(), p.size() );
+#else
+  ::operator delete( p.get() );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+inline constexpr bool bit::stl::operator==( const new_delete_allocator&,
+                                            const new_delete_allocator& )
+  noexcept
+{
+  return true;
+}
+
+inline constexpr bool bit::stl::operator!=( const new_delete_allocator&,
+                                            const new_delete_allocator& )
+  noexcept
+{
+  return false;
+}
+
+//=============================================================================
+// feedback_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T, typename SizeFeedbackAllocator>
+inline bit::stl::feedback_allocator<T,SizeFeedbackAllocator>
+  ::feedback_allocator( const SizeFeedbackAllocator& alloc )
+  : m_allocator(alloc)
+{
+
+}
+
+template<typename T, typename SizeFeedbackAllocator>
+template<typename U>
+inline bit::stl::feedback_allocator<T,SizeFeedbackAllocator>
+  ::feedback_allocator( const feedback_allocator<U,SizeFeedbackAllocator>& other )
+  : m_allocator(other.m_allocator)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T, typename SizeFeedbackAllocator>
+inline T* bit::stl::feedback_allocator<T,SizeFeedbackAllocator>
+  ::allocate( size_type n )
+{
+  return allocate_at_least( n ).ptr;
+}
+
+template<typename T, typename SizeFeedbackAllocator>
+inline bit::stl::allocation_result<T*>
+  bit::stl::feedback_allocator<T,SizeFeedbackAllocator>
+  ::allocate_at_least( size_type n )
+{
+  if( n > std::numeric_limits<size_type>::max() / sizeof(T) ) {
+    throw std::bad_alloc{};
+  }
+
+  const auto p = m_allocator.allocate( n * sizeof(T), alignof(T) );
+
+  return { static_cast<T*>(p.get()), p.size() / sizeof(T) };
+}
+
+template<typename T, typename SizeFeedbackAllocator>
+inline void bit::stl::feedback_allocator<T,SizeFeedbackAllocator>
+  ::deallocate( T* p, size_type n )
+  noexcept
+{
+  m_allocator.deallocate( fat_ptr<void>{ p, n * sizeof(T) } );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename SizeFeedbackAllocator>
+inline const SizeFeedbackAllocator&
+  bit::stl::feedback_allocator<T,SizeFeedbackAllocator>::underlying_allocator()
+  const noexcept
+{
+  return m_allocator;
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename SizeFeedbackAllocator>
+inline bool bit::stl::operator==( const feedback_allocator<T,SizeFeedbackAllocator>& lhs,
+                                  const feedback_allocator<U,SizeFeedbackAllocator>& rhs )
+  noexcept
+{
+  return lhs.underlying_allocator() == rhs.underlying_allocator();
+}
+
+template<typename T, typename U, typename SizeFeedbackAllocator>
+inline bool bit::stl::operator!=( const feedback_allocator<T,SizeFeedbackAllocator>& lhs,
+                                  const feedback_allocator<U,SizeFeedbackAllocator>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_FEEDBACK_ALLOCATOR_INL */
@@ -0,0 +1,373 @@
+#ifndef BIT_STL_MEMORY_DETAIL_HAZARD_PTR_INL
+#define BIT_STL_MEMORY_DETAIL_HAZARD_PTR_INL
+
+//=============================================================================
+// hazard_domain
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+inline bit::stl::hazard_domain::hazard_domain( size_type scan_threshold )
+  : m_records(nullptr),
+    m_record_count(0),
+    m_scan_threshold(scan_threshold),
+    m_asymmetric(detail::register_asymmetric_fence())
+{
+  BIT_ASSERT( scan_threshold != 0, "hazard_domain: scan threshold must be non-zero" );
+}
+
+inline bit::stl::hazard_domain::~hazard_domain()
+{
+  auto* record = m_records.load( std::memory_order_acquire );
+
+  while( record ) {
+    BIT_ASSERT( !record->in_use.load(), "hazard_domain: hazard_ptr outlived its domain" );
+
+    auto* const next = record->next;
+    delete record;
+    record = next;
+  }
+
+  for( auto& retired : m_retired ) {
+    retired();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Reclamation
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Deleter>
+inline void bit::stl::hazard_domain::retire( T* ptr, Deleter deleter )
+{
+  if( ptr == nullptr ) {
+    return;
+  }
+
+  auto should_scan = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_retired.emplace_back( ptr, std::move(deleter) );
+
+    const auto hazards   = m_record_count.load( std::memory_order_relaxed );
+    const auto threshold = (std::max)( m_scan_threshold, 2 * hazards );
+    should_scan = m_retired.size() >= threshold;
+  }
+
+  if( should_scan ) {
+    reclaim();
+  }
+}
+
+inline bit::stl::hazard_domain::size_type bit::stl::hazard_domain::reclaim()
+{
+  auto retired = std::vector<detail::retired_object>{};
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    retired.swap( m_retired );
+  }
+  if( retired.empty() ) {
+    return 0;
+  }
+
+  // Every hazard published before the objects were unlinked is now visible
+  detail::asymmetric_heavy_fence( m_asymmetric );
+
+  auto hazards = std::vector<const void*>{};
+  try {
+    hazards.reserve( m_record_count.load( std::memory_order_relaxed ) );
+
+    for( auto* record = m_records.load( std::memory_order_acquire );
+         record;
+         record = record->next ) {
+      const auto* const hazard = record->pointer.load( std::memory_order_acquire );
+
+      if( hazard ) {
+        hazards.push_back( hazard );
+      }
+    }
+  } catch( ... ) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retired.insert( m_retired.end(), retired.begin(), retired.end() );
+    throw;
+  }
+  std::sort( hazards.begin(), hazards.end() );
+
+  auto freed = size_type{0};
+  auto kept  = retired.begin();
+
+  for( auto& object : retired ) {
+    if( std::binary_search( hazards.begin(), hazards.end(), object.get() ) ) {
+      *kept++ = object;
+    } else {
+      object();
+      ++freed;
+    }
+  }
+  retired.erase( kept, retired.end() );
+
+  if( !retired.empty() ) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retired.insert( m_retired.end(), retired.begin(), retired.end() );
+  }
+  return freed;
+}
+
+inline bit::stl::hazard_domain::size_type bit::stl::hazard_domain::pending()
+  const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  return m_retired.size();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::detail::hazard_record* bit::stl::hazard_domain::acquire_record()
+{
+  auto* record = m_records.load( std::memory_order_acquire );
+
+  for( ; record; record = record->next ) {
+    auto expected = false;
+    if( record->in_use.compare_exchange_strong( expected, true,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed ) ) {
+      return record;
+    }
+  }
+
+  record = new detail::hazard_record;
+  record->next = m_records.load( std::memory_order_relaxed );
+  while( !m_records.compare_exchange_weak( record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed ) ) {
+    // record->next has been reloaded; retry
+  }
+  m_record_count.fetch_add( 1, std::memory_order_relaxed );
+
+  return record;
+}
+
+inline void bit::stl::hazard_domain::release_record( detail::hazard_record& record )
+  noexcept
+{
+  record.pointer.store( nullptr, std::memory_order_release );
+  record.in_use.store( false, std::memory_order_release );
+}
+
+//=============================================================================
+// hazard_ptr<T>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::hazard_ptr<T>::hazard_ptr( hazard_domain& domain )
+  : m_domain(&domain),
+    m_record(domain.acquire_record()),
+    m_ptr(nullptr)
+{
+
+}
+
+template<typename T>
+inline bit::stl::hazard_ptr<T>::hazard_ptr( hazard_ptr&& other )
+  noexcept
+  : m_domain(other.m_domain),
+    m_record(other.m_record),
+    m_ptr(other.m_ptr)
+{
+  other.m_record = nullptr;
+  other.m_ptr    = nullptr;
+}
+
+template<typename T>
+inline bit::stl::hazard_ptr<T>::~hazard_ptr()
+{
+  if( m_record ) {
+    m_domain->release_record( *m_record );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::hazard_ptr<T>&
+  bit::stl::hazard_ptr<T>::operator=( hazard_ptr&& other )
+  noexcept
+{
+  if( this != &other ) {
+    if( m_record ) {
+      m_domain->release_record( *m_record );
+    }
+    m_domain = other.m_domain;
+    m_record = other.m_record;
+    m_ptr    = other.m_ptr;
+
+    other.m_record = nullptr;
+    other.m_ptr    = nullptr;
+  }
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Protection
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename U, typename>
+inline T* bit::stl::hazard_ptr<T>::protect( const std::atomic<U*>& source )
+  noexcept
+{
+  auto* ptr = source.load( std::memory_order_relaxed );
+
+  while( !try_protect( ptr, source ) ) {
+    // ptr has been reloaded; retry
+  }
+  return m_ptr;
+}
+
+template<typename T>
+template<typename U, typename>
+inline bool bit::stl::hazard_ptr<T>::try_protect( U*& ptr,
+                                                  const std::atomic<U*>& source )
+  noexcept
+{
+  BIT_ASSERT( m_record != nullptr, "hazard_ptr: use of moved-from hazard_ptr" );
+
+  auto* const expected = ptr;
+
+  // The source's own pointer value is published; converting to T* first
+  // would move the address for a base at a nonzero offset, and the hazard
+  // would no longer match the pointer that is retired
+  publish( static_cast<const void*>(expected) );
+  detail::asymmetric_light_fence( m_domain->m_asymmetric );
+
+  // The hazard is only valid if the object was still reachable after it
+  // was published
+  ptr = source.load( std::memory_order_acquire );
+  if( ptr != expected ) {
+    reset();
+    return false;
+  }
+
+  m_ptr = ptr;
+  return true;
+}
+
+template<typename T>
+inline void bit::stl::hazard_ptr<T>::reset( T* ptr )
+  noexcept
+{
+  BIT_ASSERT( m_record != nullptr, "hazard_ptr: use of moved-from hazard_ptr" );
+
+  publish( ptr );
+  m_ptr = ptr;
+}
+
+template<typename T>
+inline void bit::stl::hazard_ptr<T>::reset()
+  noexcept
+{
+  BIT_ASSERT( m_record != nullptr, "hazard_ptr: use of moved-from hazard_ptr" );
+
+  // Release orders this thread's reads of the object before the slot is
+  // seen to be empty
+  m_record->pointer.store( nullptr, std::memory_order_release );
+  m_ptr = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::hazard_ptr<T>::get()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T>
+inline bit::stl::observer_ptr<T> bit::stl::hazard_ptr<T>::observe()
+  const noexcept
+{
+  return observer_ptr<T>{m_ptr};
+}
+
+template<typename T>
+inline T& bit::stl::hazard_ptr<T>::operator*()
+  const noexcept
+{
+  BIT_ASSERT( m_ptr != nullptr, "hazard_ptr: dereferencing null hazard_ptr" );
+
+  return *m_ptr;
+}
+
+template<typename T>
+inline T* bit::stl::hazard_ptr<T>::operator->()
+  const noexcept
+{
+  BIT_ASSERT( m_ptr != nullptr, "hazard_ptr: dereferencing null hazard_ptr" );
+
+  return m_ptr;
+}
+
+template<typename T>
+inline bit::stl::hazard_ptr<T>::operator bool()
+  const noexcept
+{
+  return m_ptr != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::stl::hazard_ptr<T>::publish( const void* ptr )
+  noexcept
+{
+  m_record->pointer.store( ptr, std::memory_order_release );
+}
+
+//=============================================================================
+// Comparison
+//=============================================================================
+
+template<typename T>
+inline bool bit::stl::operator==( const hazard_ptr<T>& lhs, std::nullptr_t )
+  noexcept
+{
+  return !lhs;
+}
+
+template<typename T>
+inline bool bit::stl::operator==( std::nullptr_t, const hazard_ptr<T>& rhs )
+  noexcept
+{
+  return !rhs;
+}
+
+template<typename T>
+inline bool bit::stl::operator!=( const hazard_ptr<T>& lhs, std::nullptr_t )
+  noexcept
+{
+  return static_cast<bool>(lhs);
+}
+
+template<typename T>
+inline bool bit::stl::operator!=( std::nullptr_t, const hazard_ptr<T>& rhs )
+  noexcept
+{
+  return static_cast<bool>(rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_HAZARD_PTR_INL */
@@ -0,0 +1,131 @@
+#ifndef BIT_STL_MEMORY_DETAIL_HUGE_PAGE_ALLOCATOR_INL
+#define BIT_STL_MEMORY_DETAIL_HUGE_PAGE_ALLOCATOR_INL
+
+//=============================================================================
+// detail
+//=============================================================================
+
+inline void* bit::stl::detail::huge_page_map( std::size_t size )
+{
+#if defined(__linux__)
+  constexpr auto page_size = huge_page_allocator<char>::huge_page_size;
+
+  // Over-map by a huge page so that an aligned range can be cut out of it;
+  // only aligned ranges are eligible for huge pages
+  auto* const raw = ::mmap( nullptr, size + page_size,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS,
+                            -1, 0 );
+  if( raw == MAP_FAILED ) {
+    throw std::bad_alloc{};
+  }
+
+  auto* const first   = static_cast<char*>(raw);
+  auto* const aligned = align_up( first, page_size );
+  const auto head     = static_cast<std::size_t>(aligned - first);
+  const auto tail     = page_size - head;
+
+  if( head != 0 ) {
+    ::munmap( first, head );
+  }
+  if( tail != 0 ) {
+    ::munmap( aligned + size, tail );
+  }
+
+# if defined(MADV_HUGEPAGE)
+  // Advisory only: regular pages are used if huge pages are unavailable
+  ::madvise( aligned, size, MADV_HUGEPAGE );
+# endif
+
+  return aligned;
+#else
+  return ::operator new( size );
+#endif
+}
+
+inline void bit::stl::detail::huge_page_unmap( void* p, std::size_t size )
+  noexcept
+{
+#if defined(__linux__)
+  ::munmap( p, size );
+#else
+  (void) size;
+  ::operator delete( p );
+#endif
+}
+
+//=============================================================================
+// huge_page_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template<typename T>
+constexpr std::size_t bit::stl::huge_page_allocator<T>::huge_page_size;
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename U>
+inline bit::stl::huge_page_allocator<T>
+  ::huge_page_allocator( const huge_page_allocator<U>& )
+  noexcept
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::huge_page_allocator<T>::allocate( size_type n )
+{
+  if( n > (std::numeric_limits<size_type>::max() - huge_page_size) / sizeof(T) ) {
+    throw std::bad_alloc{};
+  }
+
+  const auto size = n * sizeof(T);
+  if( size < huge_page_size ) {
+    return static_cast<T*>(::operator new( size ));
+  }
+  return static_cast<T*>(detail::huge_page_map( align_up( size, huge_page_size ) ));
+}
+
+template<typename T>
+inline void bit::stl::huge_page_allocator<T>::deallocate( T* p, size_type n )
+  noexcept
+{
+  const auto size = n * sizeof(T);
+  if( size < huge_page_size ) {
+    ::operator delete( p );
+    return;
+  }
+  detail::huge_page_unmap( p, align_up( size, huge_page_size ) );
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U>
+inline constexpr bool bit::stl::operator==( const huge_page_allocator<T>&,
+                                            const huge_page_allocator<U>& )
+  noexcept
+{
+  return true;
+}
+
+template<typename T, typename U>
+inline constexpr bool bit::stl::operator!=( const huge_page_allocator<T>&,
+                                            const huge_page_allocator<U>& )
+  noexcept
+{
+  return false;
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_HUGE_PAGE_ALLOCATOR_INL */
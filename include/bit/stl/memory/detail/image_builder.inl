@@ -0,0 +1,258 @@
+#ifndef BIT_STL_MEMORY_DETAIL_IMAGE_BUILDER_INL
+#define BIT_STL_MEMORY_DETAIL_IMAGE_BUILDER_INL
+
+namespace bit { namespace stl { namespace detail {
+
+/// \brief The header at the start of every image
+struct image_header
+{
+  std::uint64_t magic; ///< Identifies the bytes as an image
+  std::uint64_t size;  ///< The size of the image in bytes
+  std::uint64_t root;  ///< The byte offset of the root object, or 0
+};
+
+constexpr std::uint64_t image_magic = 0x31676d6974746962ull; // "bittimg1"
+
+template<typename T, typename Source, typename = void>
+struct is_image_buildable : false_type{};
+
+template<typename T, typename Source>
+struct is_image_buildable<T,Source,void_t<
+  decltype(T::build( std::declval<image_builder&>(),
+                     std::declval<image_offset<T>>(),
+                     std::declval<const Source&>() ))
+>> : true_type{};
+
+} } } // namespace bit::stl::detail
+
+//=============================================================================
+// image_offset<T>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline constexpr bit::stl::image_offset<T>::image_offset( std::size_t offset )
+  noexcept
+  : m_offset(offset)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline constexpr std::size_t bit::stl::image_offset<T>::offset()
+  const noexcept
+{
+  return m_offset;
+}
+
+template<typename T>
+inline constexpr bit::stl::image_offset<T>
+  bit::stl::image_offset<T>::operator[]( std::size_t n )
+  const noexcept
+{
+  return image_offset{ m_offset + n * sizeof(T) };
+}
+
+//=============================================================================
+// image_builder
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline bit::stl::image_builder::image_builder()
+  : m_buffer(),
+    m_size(0)
+{
+  reserve( sizeof(detail::image_header), alignof(detail::image_header) );
+
+  auto* const header = reinterpret_cast<detail::image_header*>(m_buffer.data());
+  header->magic = detail::image_magic;
+  header->size  = m_size;
+  header->root  = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T, typename...Args>
+inline bit::stl::image_offset<T> bit::stl::image_builder::emplace( Args&&...args )
+{
+  static_assert( std::is_trivially_destructible<T>::value,
+                 "image_builder: objects in an image are never destroyed" );
+  static_assert( alignof(T) <= alignof(std::max_align_t),
+                 "image_builder: over-aligned types are not supported" );
+
+  const auto offset = image_offset<T>{ reserve( sizeof(T), alignof(T) ) };
+
+  ::new( static_cast<void*>(get(offset)) ) T( std::forward<Args>(args)... );
+
+  return offset;
+}
+
+template<typename T>
+inline bit::stl::image_offset<T> bit::stl::image_builder::allocate( std::size_t n )
+{
+  static_assert( std::is_trivially_destructible<T>::value,
+                 "image_builder: objects in an image are never destroyed" );
+  static_assert( alignof(T) <= alignof(std::max_align_t),
+                 "image_builder: over-aligned types are not supported" );
+
+  const auto offset = image_offset<T>{ reserve( n * sizeof(T), alignof(T) ) };
+
+  auto* const p = get(offset);
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    ::new( static_cast<void*>(p + i) ) T();
+  }
+
+  return offset;
+}
+
+template<typename T, typename Source>
+inline void bit::stl::image_builder::assign( image_offset<T> target,
+                                             const Source& source )
+{
+  assign( target, source, detail::is_image_buildable<T,Source>{} );
+}
+
+template<typename T>
+inline void bit::stl::image_builder::set_root( image_offset<T> root )
+  noexcept
+{
+  reinterpret_cast<detail::image_header*>(m_buffer.data())->root = root.offset();
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::image_builder::get( image_offset<T> offset )
+  noexcept
+{
+  BIT_ASSERT( offset.offset() + sizeof(T) <= m_size,
+              "image_builder::get: offset is outside of the image" );
+
+  auto* const bytes = reinterpret_cast<unsigned char*>(m_buffer.data());
+
+  return reinterpret_cast<T*>(bytes + offset.offset());
+}
+
+template<typename T>
+inline bit::stl::image_offset<T> bit::stl::image_builder::offset_of( const T* p )
+  const noexcept
+{
+  const auto* const bytes = reinterpret_cast<const unsigned char*>(m_buffer.data());
+  const auto* const object = reinterpret_cast<const unsigned char*>(p);
+
+  BIT_ASSERT( object >= bytes && object < bytes + m_size,
+              "image_builder::offset_of: object is outside of the image" );
+
+  return image_offset<T>{ static_cast<std::size_t>(object - bytes) };
+}
+
+inline const void* bit::stl::image_builder::data()
+  const noexcept
+{
+  return m_buffer.data();
+}
+
+inline std::size_t bit::stl::image_builder::size()
+  const noexcept
+{
+  return m_size;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline std::size_t bit::stl::image_builder::reserve( std::size_t bytes,
+                                                     std::size_t align )
+{
+  const auto offset = (m_size + (align - 1)) & ~(align - 1);
+  const auto size   = offset + bytes;
+  const auto count  = (size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+
+  if( count > m_buffer.size() ) {
+    // Grow geometrically; new storage is zeroed, so padding bytes in the
+    // image are deterministic
+    m_buffer.resize( (count < m_buffer.size() * 2) ? m_buffer.size() * 2 : count );
+  }
+  m_size = size;
+
+  reinterpret_cast<detail::image_header*>(m_buffer.data())->size = m_size;
+
+  return offset;
+}
+
+template<typename T, typename Source>
+inline void bit::stl::image_builder::assign( image_offset<T> target,
+                                             const Source& source,
+                                             true_type )
+{
+  T::build( *this, target, source );
+}
+
+template<typename T, typename Source>
+inline void bit::stl::image_builder::assign( image_offset<T> target,
+                                             const Source& source,
+                                             false_type )
+{
+  *get(target) = source;
+}
+
+template<typename T, typename U, typename Source>
+inline void bit::stl::image_builder::assign( image_offset<std::pair<T,U>> target,
+                                             const Source& source,
+                                             false_type )
+{
+  // Resolve both members before either assignment can grow the image
+  auto* const pair = get(target);
+  const auto first  = offset_of( &pair->first );
+  const auto second = offset_of( &pair->second );
+
+  assign( first, source.first );
+  assign( second, source.second );
+}
+
+//=============================================================================
+// Utilities
+//=============================================================================
+
+template<typename T>
+inline const T* bit::stl::image_root( const void* data, std::size_t size )
+  noexcept
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(data);
+
+  if( data == nullptr || (address % alignof(std::max_align_t)) != 0 ) {
+    return nullptr;
+  }
+  if( size < sizeof(detail::image_header) ) {
+    return nullptr;
+  }
+
+  const auto* const header = static_cast<const detail::image_header*>(data);
+  if( header->magic != detail::image_magic || header->size > size ) {
+    return nullptr;
+  }
+  if( header->root == 0 ||
+      header->root + sizeof(T) > header->size ||
+      (header->root % alignof(T)) != 0 ) {
+    return nullptr;
+  }
+
+  return reinterpret_cast<const T*>(static_cast<const unsigned char*>(data) + header->root);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_IMAGE_BUILDER_INL */
@@ -0,0 +1,362 @@
+#ifndef BIT_STL_MEMORY_DETAIL_INSTRUMENTED_ALLOCATOR_INL
+#define BIT_STL_MEMORY_DETAIL_INSTRUMENTED_ALLOCATOR_INL
+
+//=============================================================================
+// detail::allocation_shard
+//=============================================================================
+
+inline bit::stl::detail::allocation_shard::allocation_shard()
+  noexcept
+{
+  for( auto& count : histogram ) {
+    count.store( 0, std::memory_order_relaxed );
+  }
+}
+
+//=============================================================================
+// allocation_tracker
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+inline bit::stl::allocation_tracker::allocation_tracker( const char* name )
+  : m_live_bytes(0),
+    m_peak_bytes(0),
+    m_name(name),
+    m_previous(nullptr),
+    m_next(nullptr)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+
+  auto*& head = registry_head();
+  m_next = head;
+  if( head ) {
+    head->m_previous = this;
+  }
+  head = this;
+}
+
+inline bit::stl::allocation_tracker::~allocation_tracker()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+
+  if( m_previous ) {
+    m_previous->m_next = m_next;
+  } else {
+    registry_head() = m_next;
+  }
+  if( m_next ) {
+    m_next->m_previous = m_previous;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Recording
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::allocation_tracker::record_allocation( std::size_t bytes )
+  noexcept
+{
+  auto& shard = local_shard();
+
+  shard.allocations.fetch_add( 1, std::memory_order_relaxed );
+  shard.bytes_allocated.fetch_add( bytes, std::memory_order_relaxed );
+  shard.histogram[histogram_bucket(bytes)].fetch_add( 1, std::memory_order_relaxed );
+
+  const auto live = m_live_bytes.fetch_add( bytes, std::memory_order_relaxed ) + bytes;
+  auto peak = m_peak_bytes.load( std::memory_order_relaxed );
+  while( live > peak &&
+         !m_peak_bytes.compare_exchange_weak( peak, live, std::memory_order_relaxed ) ) {
+    // peak has been reloaded; retry
+  }
+}
+
+inline void bit::stl::allocation_tracker::record_deallocation( std::size_t bytes )
+  noexcept
+{
+  auto& shard = local_shard();
+
+  shard.deallocations.fetch_add( 1, std::memory_order_relaxed );
+  shard.bytes_deallocated.fetch_add( bytes, std::memory_order_relaxed );
+
+  auto live = m_live_bytes.load( std::memory_order_relaxed );
+  while( !m_live_bytes.compare_exchange_weak( live,
+                                              (live > bytes) ? (live - bytes) : 0,
+                                              std::memory_order_relaxed ) ) {
+    // live has been reloaded; retry
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline const char* bit::stl::allocation_tracker::name()
+  const noexcept
+{
+  return m_name;
+}
+
+inline bit::stl::allocation_statistics bit::stl::allocation_tracker::snapshot()
+  const noexcept
+{
+  auto result = allocation_statistics{};
+  result.name = m_name;
+
+  for( const auto& shard : m_shards ) {
+    result.allocations       += shard.allocations.load( std::memory_order_relaxed );
+    result.deallocations     += shard.deallocations.load( std::memory_order_relaxed );
+    result.bytes_allocated   += shard.bytes_allocated.load( std::memory_order_relaxed );
+    result.bytes_deallocated += shard.bytes_deallocated.load( std::memory_order_relaxed );
+
+    for( auto i = std::size_t{0}; i < allocation_statistics::histogram_size; ++i ) {
+      result.histogram[i] += shard.histogram[i].load( std::memory_order_relaxed );
+    }
+  }
+
+  // Shards are read one at a time, so a deallocation may be seen without
+  // its allocation
+  if( result.allocations > result.deallocations ) {
+    result.live_allocations = result.allocations - result.deallocations;
+  }
+  if( result.bytes_allocated > result.bytes_deallocated ) {
+    result.live_bytes = result.bytes_allocated - result.bytes_deallocated;
+  }
+  result.peak_bytes = m_peak_bytes.load( std::memory_order_relaxed );
+
+  return result;
+}
+
+inline std::vector<bit::stl::allocation_statistics>
+  bit::stl::allocation_tracker::snapshot_all()
+{
+  auto result = std::vector<allocation_statistics>{};
+
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  for( auto* tracker = registry_head(); tracker; tracker = tracker->m_next ) {
+    result.push_back( tracker->snapshot() );
+  }
+  return result;
+}
+
+inline std::size_t bit::stl::allocation_tracker::histogram_bucket( std::size_t bytes )
+  noexcept
+{
+  auto bucket = std::size_t{0};
+
+  for( auto limit = std::size_t{16}; bytes > limit; limit <<= 1 ) {
+    if( ++bucket == allocation_statistics::histogram_size - 1 ) {
+      break;
+    }
+  }
+  return bucket;
+}
+
+//-----------------------------------------------------------------------------
+// Scopes
+//-----------------------------------------------------------------------------
+
+inline bit::stl::allocation_tracker& bit::stl::allocation_tracker::global()
+{
+  static allocation_tracker s_tracker{"global"};
+
+  return s_tracker;
+}
+
+inline bit::stl::allocation_tracker& bit::stl::allocation_tracker::current()
+{
+  auto* const tracker = current_pointer();
+
+  return tracker ? *tracker : global();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::detail::allocation_shard&
+  bit::stl::allocation_tracker::local_shard()
+  noexcept
+{
+  static std::atomic<std::size_t> s_next_index{0};
+  static thread_local const std::size_t s_index =
+    s_next_index.fetch_add( 1, std::memory_order_relaxed ) % shard_count;
+
+  return m_shards[s_index];
+}
+
+inline bit::stl::allocation_tracker*& bit::stl::allocation_tracker::current_pointer()
+  noexcept
+{
+  // A trivially destructible thread_local, so it is usable during thread
+  // exit
+  static thread_local allocation_tracker* s_current = nullptr;
+
+  return s_current;
+}
+
+inline std::mutex& bit::stl::allocation_tracker::registry_mutex()
+  noexcept
+{
+  static std::mutex s_mutex;
+
+  return s_mutex;
+}
+
+inline bit::stl::allocation_tracker*& bit::stl::allocation_tracker::registry_head()
+  noexcept
+{
+  static allocation_tracker* s_head = nullptr;
+
+  return s_head;
+}
+
+//=============================================================================
+// allocation_scope
+//=============================================================================
+
+inline bit::stl::allocation_scope::allocation_scope( allocation_tracker& tracker )
+  noexcept
+  : m_previous(allocation_tracker::current_pointer())
+{
+  allocation_tracker::current_pointer() = &tracker;
+}
+
+inline bit::stl::allocation_scope::~allocation_scope()
+{
+  allocation_tracker::current_pointer() = m_previous;
+}
+
+//=============================================================================
+// instrumented_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename Allocator>
+inline bit::stl::instrumented_allocator<Allocator>::instrumented_allocator()
+  : m_storage( std::piecewise_construct,
+               std::forward_as_tuple(),
+               std::forward_as_tuple(&allocation_tracker::current()) )
+{
+
+}
+
+template<typename Allocator>
+inline bit::stl::instrumented_allocator<Allocator>
+  ::instrumented_allocator( allocation_tracker& tracker, const Allocator& alloc )
+  : m_storage( std::piecewise_construct,
+               std::forward_as_tuple(alloc),
+               std::forward_as_tuple(&tracker) )
+{
+
+}
+
+template<typename Allocator>
+template<typename U>
+inline bit::stl::instrumented_allocator<Allocator>
+  ::instrumented_allocator( const instrumented_allocator<U>& other )
+  : m_storage( std::piecewise_construct,
+               std::forward_as_tuple(other.underlying_allocator()),
+               std::forward_as_tuple(&other.tracker()) )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename Allocator>
+inline typename bit::stl::instrumented_allocator<Allocator>::pointer
+  bit::stl::instrumented_allocator<Allocator>::allocate( size_type n )
+{
+  auto p = alloc_traits::allocate( m_storage.first(), n );
+
+  m_storage.second()->record_allocation( n * sizeof(value_type) );
+
+  return p;
+}
+
+template<typename Allocator>
+inline void bit::stl::instrumented_allocator<Allocator>::deallocate( pointer p,
+                                                                     size_type n )
+  noexcept
+{
+  m_storage.second()->record_deallocation( n * sizeof(value_type) );
+
+  alloc_traits::deallocate( m_storage.first(), p, n );
+}
+
+template<typename Allocator>
+template<typename U, typename...Args>
+inline void bit::stl::instrumented_allocator<Allocator>::construct( U* p,
+                                                                    Args&&...args )
+{
+  alloc_traits::construct( m_storage.first(), p, std::forward<Args>(args)... );
+}
+
+template<typename Allocator>
+template<typename U>
+inline void bit::stl::instrumented_allocator<Allocator>::destroy( U* p )
+{
+  alloc_traits::destroy( m_storage.first(), p );
+}
+
+template<typename Allocator>
+inline bit::stl::instrumented_allocator<Allocator>
+  bit::stl::instrumented_allocator<Allocator>::select_on_container_copy_construction()
+  const
+{
+  return instrumented_allocator{
+    tracker(),
+    alloc_traits::select_on_container_copy_construction( m_storage.first() )
+  };
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename Allocator>
+inline bit::stl::allocation_tracker&
+  bit::stl::instrumented_allocator<Allocator>::tracker()
+  const noexcept
+{
+  return *m_storage.second();
+}
+
+template<typename Allocator>
+inline const Allocator&
+  bit::stl::instrumented_allocator<Allocator>::underlying_allocator()
+  const noexcept
+{
+  return m_storage.first();
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename A1, typename A2>
+inline bool bit::stl::operator==( const instrumented_allocator<A1>& lhs,
+                                  const instrumented_allocator<A2>& rhs )
+  noexcept
+{
+  return &lhs.tracker() == &rhs.tracker() &&
+         lhs.underlying_allocator() == rhs.underlying_allocator();
+}
+
+template<typename A1, typename A2>
+inline bool bit::stl::operator!=( const instrumented_allocator<A1>& lhs,
+                                  const instrumented_allocator<A2>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_INSTRUMENTED_ALLOCATOR_INL */
@@ -0,0 +1,807 @@
+#ifndef BIT_STL_MEMORY_DETAIL_INTRUSIVE_PTR_INL
+#define BIT_STL_MEMORY_DETAIL_INTRUSIVE_PTR_INL
+
+//=============================================================================
+// detail::intrusive_disposer
+//=============================================================================
+
+inline void bit::stl::detail::intrusive_disposer::operator()()
+  const noexcept
+{
+  dispose( object );
+}
+
+//=============================================================================
+// nonatomic_count_policy
+//=============================================================================
+
+inline void bit::stl::nonatomic_count_policy::increment( counter_type& count )
+  noexcept
+{
+  ++count;
+}
+
+inline bool bit::stl::nonatomic_count_policy
+  ::decrement( counter_type& count, const detail::intrusive_disposer& )
+  noexcept
+{
+  return --count == 0;
+}
+
+inline std::size_t bit::stl::nonatomic_count_policy
+  ::use_count( const counter_type& count )
+  noexcept
+{
+  return count;
+}
+
+//=============================================================================
+// atomic_count_policy
+//=============================================================================
+
+inline void bit::stl::atomic_count_policy::increment( counter_type& count )
+  noexcept
+{
+  // A new reference can only be made from an existing one, so no ordering
+  // is required
+  count.fetch_add( 1, std::memory_order_relaxed );
+}
+
+inline bool bit::stl::atomic_count_policy
+  ::decrement( counter_type& count, const detail::intrusive_disposer& )
+  noexcept
+{
+  return count.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+}
+
+inline std::size_t bit::stl::atomic_count_policy
+  ::use_count( const counter_type& count )
+  noexcept
+{
+  return count.load( std::memory_order_relaxed );
+}
+
+//=============================================================================
+// biased_count_policy::counter_type
+//=============================================================================
+
+inline bit::stl::biased_count_policy::counter_type::counter_type()
+  noexcept
+  : m_owner( detail::biased_owner::current() ),
+    m_biased( 0 ),
+    m_merged( m_owner == nullptr ),
+    m_shared( m_owner == nullptr ? merged_flag : 0 ),
+    m_next( nullptr ),
+    m_disposer{ nullptr, nullptr }
+{
+  if( m_owner ) {
+    m_owner->acquire();
+  }
+}
+
+inline bit::stl::biased_count_policy::counter_type::~counter_type()
+{
+  if( m_owner ) {
+    m_owner->release();
+  }
+}
+
+//=============================================================================
+// biased_count_policy
+//=============================================================================
+
+inline void bit::stl::biased_count_policy::increment( counter_type& count )
+  noexcept
+{
+  if( is_owner(count) ) {
+    ++count.m_biased;
+  } else {
+    count.m_shared.fetch_add( count_unit, std::memory_order_relaxed );
+  }
+}
+
+inline bool bit::stl::biased_count_policy
+  ::decrement( counter_type& count, const detail::intrusive_disposer& disposer )
+  noexcept
+{
+  if( is_owner(count) ) {
+    auto* const owner = count.m_owner;
+
+    if( --count.m_biased != 0 ) {
+      if( owner->has_pending() ) {
+        owner->collect();
+      }
+      return false;
+    }
+
+    // The owner has released its last reference; merge the shared count
+    // unless another thread has already queued this counter, in which case
+    // the queue is responsible for it
+    auto value = count.m_shared.load( std::memory_order_relaxed );
+    while( !(value & queued_flag) ) {
+      if( count.m_shared.compare_exchange_weak( value, value | merged_flag,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed ) ) {
+        count.m_merged = true;
+        return shared_count(value) == 0;
+      }
+    }
+    owner->collect();
+    return false;
+  }
+
+  auto value = count.m_shared.load( std::memory_order_relaxed );
+  while( true ) {
+    auto next     = value - count_unit;
+    auto enqueue  = false;
+
+    // Reaching zero or below before the merge means only the owner can
+    // tell whether this was the last reference
+    if( !(value & (merged_flag | queued_flag)) && shared_count(next) <= 0 ) {
+      next   |= queued_flag;
+      enqueue = true;
+    }
+
+    if( count.m_shared.compare_exchange_weak( value, next,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_relaxed ) ) {
+      if( !enqueue ) {
+        return (value & merged_flag) && shared_count(next) == 0;
+      }
+      count.m_disposer = disposer;
+      if( count.m_owner->enqueue(count) ) {
+        return false;
+      }
+      // The owner has exited, so no thread writes to the biased count
+      return merge(count);
+    }
+  }
+}
+
+inline std::size_t bit::stl::biased_count_policy
+  ::use_count( const counter_type& count )
+  noexcept
+{
+  const auto shared = shared_count( count.m_shared.load( std::memory_order_relaxed ) );
+  const auto biased = is_owner(count) ? static_cast<std::int64_t>(count.m_biased) : 0;
+  const auto total  = shared + biased;
+
+  return total > 0 ? static_cast<std::size_t>(total) : 0u;
+}
+
+inline void bit::stl::biased_count_policy::collect()
+  noexcept
+{
+  auto* const owner = detail::biased_owner::current_if_any();
+
+  if( owner ) {
+    owner->collect();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Functions
+//-----------------------------------------------------------------------------
+
+inline std::int64_t bit::stl::biased_count_policy::shared_count( std::int64_t value )
+  noexcept
+{
+  return (value - (value & (merged_flag | queued_flag))) / count_unit;
+}
+
+inline bool bit::stl::biased_count_policy::is_owner( const counter_type& count )
+  noexcept
+{
+  // m_merged is only ever touched by the owning thread, so it may only be
+  // read once ownership is established
+  return count.m_owner != nullptr &&
+         count.m_owner == detail::biased_owner::current_if_any() &&
+         !count.m_merged;
+}
+
+inline bool bit::stl::biased_count_policy::merge( counter_type& count )
+  noexcept
+{
+  const auto biased = static_cast<std::int64_t>(count.m_biased);
+
+  count.m_biased = 0;
+  count.m_merged = true;
+
+  const auto value = count.m_shared.fetch_add( biased * count_unit + merged_flag,
+                                               std::memory_order_acq_rel );
+
+  return shared_count(value) + biased == 0;
+}
+
+//=============================================================================
+// detail::biased_owner
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::detail::biased_owner* bit::stl::detail::biased_owner::current()
+  noexcept
+{
+  auto*& owner = current_pointer();
+
+  if( owner == nullptr && !exited() ) {
+    static thread_local holder s_holder;
+    owner = s_holder.owner;
+  }
+  return owner;
+}
+
+inline bit::stl::detail::biased_owner*
+  bit::stl::detail::biased_owner::current_if_any()
+  noexcept
+{
+  return current_pointer();
+}
+
+//-----------------------------------------------------------------------------
+// Reference Counting
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::detail::biased_owner::acquire()
+  noexcept
+{
+  m_references.fetch_add( 1, std::memory_order_relaxed );
+}
+
+inline void bit::stl::detail::biased_owner::release()
+  noexcept
+{
+  if( m_references.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
+    delete this;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Queueing
+//-----------------------------------------------------------------------------
+
+inline bool bit::stl::detail::biased_owner::enqueue( counter_type& count )
+  noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if( m_dead ) {
+    return false;
+  }
+  count.m_next = m_queue;
+  m_queue      = &count;
+  m_pending.store( true, std::memory_order_relaxed );
+
+  return true;
+}
+
+inline bool bit::stl::detail::biased_owner::has_pending()
+  const noexcept
+{
+  return m_pending.load( std::memory_order_relaxed );
+}
+
+inline void bit::stl::detail::biased_owner::collect()
+  noexcept
+{
+  counter_type* queue;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    queue   = m_queue;
+    m_queue = nullptr;
+    m_pending.store( false, std::memory_order_relaxed );
+  }
+
+  while( queue ) {
+    // Read the link first; disposing destroys the counter
+    auto* const next = queue->m_next;
+
+    if( biased_count_policy::merge(*queue) ) {
+      queue->m_disposer();
+    }
+    queue = next;
+  }
+}
+
+inline void bit::stl::detail::biased_owner::exit()
+  noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_dead = true;
+  }
+  collect();
+  release();
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Functions
+//-----------------------------------------------------------------------------
+
+inline bit::stl::detail::biased_owner*&
+  bit::stl::detail::biased_owner::current_pointer()
+  noexcept
+{
+  // Trivially destructible, so this remains usable after the holder has
+  // been destroyed during thread exit
+  static thread_local biased_owner* s_owner = nullptr;
+
+  return s_owner;
+}
+
+inline bool& bit::stl::detail::biased_owner::exited()
+  noexcept
+{
+  static thread_local bool s_exited = false;
+
+  return s_exited;
+}
+
+//=============================================================================
+// detail::biased_owner::holder
+//=============================================================================
+
+inline bit::stl::detail::biased_owner::holder::holder()
+  noexcept
+  : owner( new(std::nothrow) biased_owner )
+{
+
+}
+
+inline bit::stl::detail::biased_owner::holder::~holder()
+{
+  current_pointer() = nullptr;
+  exited()          = true;
+
+  if( owner ) {
+    owner->exit();
+  }
+}
+
+//=============================================================================
+// intrusive_ref_counter
+//=============================================================================
+
+template<typename Derived, typename CountPolicy>
+inline bit::stl::intrusive_ref_counter<Derived,CountPolicy>
+  ::intrusive_ref_counter()
+  noexcept
+  : m_count{}
+{
+
+}
+
+template<typename Derived, typename CountPolicy>
+inline bit::stl::intrusive_ref_counter<Derived,CountPolicy>
+  ::intrusive_ref_counter( const intrusive_ref_counter& )
+  noexcept
+  : m_count{}
+{
+
+}
+
+template<typename Derived, typename CountPolicy>
+inline bit::stl::intrusive_ref_counter<Derived,CountPolicy>&
+  bit::stl::intrusive_ref_counter<Derived,CountPolicy>
+  ::operator=( const intrusive_ref_counter& )
+  noexcept
+{
+  return (*this);
+}
+
+//=============================================================================
+// intrusive_ptr
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline constexpr bit::stl::intrusive_ptr<T,CountPolicy>::intrusive_ptr()
+  noexcept
+  : m_ptr(nullptr)
+{
+
+}
+
+template<typename T, typename CountPolicy>
+inline constexpr bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( std::nullptr_t )
+  noexcept
+  : m_ptr(nullptr)
+{
+
+}
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( T* ptr, bool add_ref )
+  noexcept
+  : m_ptr(ptr)
+{
+  if( m_ptr && add_ref ) {
+    intrusive_ptr::add_ref( m_ptr );
+  }
+}
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( const intrusive_ptr& other )
+  noexcept
+  : intrusive_ptr( other.m_ptr )
+{
+
+}
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( intrusive_ptr&& other )
+  noexcept
+  : m_ptr(other.m_ptr)
+{
+  other.m_ptr = nullptr;
+}
+
+template<typename T, typename CountPolicy>
+template<typename U, typename>
+inline bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( const intrusive_ptr<U,CountPolicy>& other )
+  noexcept
+  : intrusive_ptr( other.m_ptr )
+{
+
+}
+
+template<typename T, typename CountPolicy>
+template<typename U, typename>
+inline bit::stl::intrusive_ptr<T,CountPolicy>
+  ::intrusive_ptr( intrusive_ptr<U,CountPolicy>&& other )
+  noexcept
+  : m_ptr(other.m_ptr)
+{
+  other.m_ptr = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>::~intrusive_ptr()
+{
+  if( m_ptr ) {
+    release( m_ptr );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>&
+  bit::stl::intrusive_ptr<T,CountPolicy>::operator=( const intrusive_ptr& other )
+  noexcept
+{
+  intrusive_ptr(other).swap(*this);
+  return (*this);
+}
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>&
+  bit::stl::intrusive_ptr<T,CountPolicy>::operator=( intrusive_ptr&& other )
+  noexcept
+{
+  intrusive_ptr(std::move(other)).swap(*this);
+  return (*this);
+}
+
+template<typename T, typename CountPolicy>
+template<typename U, typename>
+inline bit::stl::intrusive_ptr<T,CountPolicy>&
+  bit::stl::intrusive_ptr<T,CountPolicy>
+  ::operator=( const intrusive_ptr<U,CountPolicy>& other )
+  noexcept
+{
+  intrusive_ptr(other).swap(*this);
+  return (*this);
+}
+
+template<typename T, typename CountPolicy>
+template<typename U, typename>
+inline bit::stl::intrusive_ptr<T,CountPolicy>&
+  bit::stl::intrusive_ptr<T,CountPolicy>
+  ::operator=( intrusive_ptr<U,CountPolicy>&& other )
+  noexcept
+{
+  intrusive_ptr(std::move(other)).swap(*this);
+  return (*this);
+}
+
+template<typename T, typename CountPolicy>
+inline bit::stl::intrusive_ptr<T,CountPolicy>&
+  bit::stl::intrusive_ptr<T,CountPolicy>::operator=( std::nullptr_t )
+  noexcept
+{
+  reset();
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::reset()
+  noexcept
+{
+  intrusive_ptr().swap(*this);
+}
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::reset( T* ptr, bool add_ref )
+  noexcept
+{
+  intrusive_ptr(ptr,add_ref).swap(*this);
+}
+
+template<typename T, typename CountPolicy>
+inline T* bit::stl::intrusive_ptr<T,CountPolicy>::detach()
+  noexcept
+{
+  auto* const ptr = m_ptr;
+  m_ptr = nullptr;
+  return ptr;
+}
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::swap( intrusive_ptr& other )
+  noexcept
+{
+  using std::swap;
+
+  swap( m_ptr, other.m_ptr );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline constexpr typename bit::stl::intrusive_ptr<T,CountPolicy>::pointer
+  bit::stl::intrusive_ptr<T,CountPolicy>::get()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T, typename CountPolicy>
+inline std::add_lvalue_reference_t<T>
+  bit::stl::intrusive_ptr<T,CountPolicy>::operator*()
+  const noexcept
+{
+  return *m_ptr;
+}
+
+template<typename T, typename CountPolicy>
+inline constexpr typename bit::stl::intrusive_ptr<T,CountPolicy>::pointer
+  bit::stl::intrusive_ptr<T,CountPolicy>::operator->()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T, typename CountPolicy>
+inline constexpr bit::stl::intrusive_ptr<T,CountPolicy>::operator bool()
+  const noexcept
+{
+  return m_ptr != nullptr;
+}
+
+template<typename T, typename CountPolicy>
+inline std::size_t bit::stl::intrusive_ptr<T,CountPolicy>::use_count()
+  const noexcept
+{
+  return m_ptr ? CountPolicy::use_count( intrusive_ref_count(*m_ptr) ) : 0u;
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Functions
+//-----------------------------------------------------------------------------
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::add_ref( T* ptr )
+  noexcept
+{
+  CountPolicy::increment( intrusive_ref_count(*ptr) );
+}
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::release( T* ptr )
+  noexcept
+{
+  const auto disposer = detail::intrusive_disposer{ &intrusive_ptr::dispose, ptr };
+
+  if( CountPolicy::decrement( intrusive_ref_count(*ptr), disposer ) ) {
+    intrusive_dispose(*ptr);
+  }
+}
+
+template<typename T, typename CountPolicy>
+inline void bit::stl::intrusive_ptr<T,CountPolicy>::dispose( const void* ptr )
+{
+  intrusive_dispose( *static_cast<const T*>(ptr) );
+}
+
+//=============================================================================
+// Free Functions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator==( const intrusive_ptr<T,P>& lhs,
+                                  const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  return lhs.get() == rhs.get();
+}
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator!=( const intrusive_ptr<T,P>& lhs,
+                                  const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator<( const intrusive_ptr<T,P>& lhs,
+                                 const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  using common_type = std::common_type_t<T*,U*>;
+
+  return std::less<common_type>{}( lhs.get(), rhs.get() );
+}
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator>( const intrusive_ptr<T,P>& lhs,
+                                 const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  return rhs < lhs;
+}
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator<=( const intrusive_ptr<T,P>& lhs,
+                                  const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  return !(rhs < lhs);
+}
+
+template<typename T, typename U, typename P>
+inline bool bit::stl::operator>=( const intrusive_ptr<T,P>& lhs,
+                                  const intrusive_ptr<U,P>& rhs )
+  noexcept
+{
+  return !(lhs < rhs);
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename P>
+inline bool bit::stl::operator==( const intrusive_ptr<T,P>& lhs, std::nullptr_t )
+  noexcept
+{
+  return !lhs;
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator==( std::nullptr_t, const intrusive_ptr<T,P>& rhs )
+  noexcept
+{
+  return !rhs;
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator!=( const intrusive_ptr<T,P>& lhs, std::nullptr_t )
+  noexcept
+{
+  return static_cast<bool>(lhs);
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator!=( std::nullptr_t, const intrusive_ptr<T,P>& rhs )
+  noexcept
+{
+  return static_cast<bool>(rhs);
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename P>
+inline bool bit::stl::operator==( const intrusive_ptr<T,P>& lhs, const T* rhs )
+  noexcept
+{
+  return lhs.get() == rhs;
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator==( const T* lhs, const intrusive_ptr<T,P>& rhs )
+  noexcept
+{
+  return lhs == rhs.get();
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator!=( const intrusive_ptr<T,P>& lhs, const T* rhs )
+  noexcept
+{
+  return lhs.get() != rhs;
+}
+
+template<typename T, typename P>
+inline bool bit::stl::operator!=( const T* lhs, const intrusive_ptr<T,P>& rhs )
+  noexcept
+{
+  return lhs != rhs.get();
+}
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template<typename T, typename P>
+inline void bit::stl::swap( intrusive_ptr<T,P>& lhs, intrusive_ptr<T,P>& rhs )
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+template<typename T, typename P>
+inline bit::stl::hash_t bit::stl::hash_value( const intrusive_ptr<T,P>& val )
+  noexcept
+{
+  return static_cast<hash_t>(reinterpret_cast<std::uintptr_t>( val.get() ));
+}
+
+template<typename T, typename...Args>
+inline bit::stl::intrusive_ptr<T,typename T::count_policy>
+  bit::stl::make_intrusive( Args&&...args )
+{
+  return intrusive_ptr<T,typename T::count_policy>( new T( std::forward<Args>(args)... ) );
+}
+
+//-----------------------------------------------------------------------------
+// Casts
+//-----------------------------------------------------------------------------
+
+template<typename To, typename From, typename P>
+inline bit::stl::intrusive_ptr<To,P>
+  bit::stl::casts::static_pointer_cast( const intrusive_ptr<From,P>& other )
+  noexcept
+{
+  return intrusive_ptr<To,P>( static_cast<To*>(other.get()) );
+}
+
+template<typename To, typename From, typename P>
+inline bit::stl::intrusive_ptr<To,P>
+  bit::stl::casts::dynamic_pointer_cast( const intrusive_ptr<From,P>& other )
+  noexcept
+{
+  return intrusive_ptr<To,P>( dynamic_cast<To*>(other.get()) );
+}
+
+template<typename To, typename From, typename P>
+inline bit::stl::intrusive_ptr<To,P>
+  bit::stl::casts::const_pointer_cast( const intrusive_ptr<From,P>& other )
+  noexcept
+{
+  return intrusive_ptr<To,P>( const_cast<To*>(other.get()) );
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_INTRUSIVE_PTR_INL */
@@ -0,0 +1,309 @@
+#ifndef BIT_STL_MEMORY_DETAIL_MAPPED_FILE_INL
+#define BIT_STL_MEMORY_DETAIL_MAPPED_FILE_INL
+
+//=============================================================================
+// mapped_file
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+inline bit::stl::mapped_file::mapped_file()
+  noexcept
+  : m_data(nullptr),
+    m_size(0),
+    m_mode(map_mode::read_only),
+    m_is_open(false)
+{
+
+}
+
+inline bit::stl::mapped_file::mapped_file( const char* path,
+                                           map_mode mode,
+                                           bool populate )
+  : mapped_file()
+{
+  auto ec = std::error_code{};
+  mapped_file{ path, mode, populate, ec }.swap( *this );
+
+  if( ec ) {
+    throw std::system_error{ ec, path };
+  }
+}
+
+inline bit::stl::mapped_file::mapped_file( const std::string& path,
+                                           map_mode mode,
+                                           bool populate )
+  : mapped_file( path.c_str(), mode, populate )
+{
+
+}
+
+inline bit::stl::mapped_file::mapped_file( const char* path,
+                                           map_mode mode,
+                                           bool populate,
+                                           std::error_code& ec )
+  noexcept
+  : mapped_file()
+{
+  ec.clear();
+
+#if defined(_WIN32)
+  (void) path; (void) mode; (void) populate;
+  ec = std::make_error_code( std::errc::function_not_supported );
+#else
+  const auto read_write = (mode == map_mode::read_write);
+
+  const auto fd = ::open( path, (read_write ? O_RDWR : O_RDONLY) | O_CLOEXEC );
+  if( fd < 0 ) {
+    ec.assign( errno, std::generic_category() );
+    return;
+  }
+
+  struct ::stat status;
+  if( ::fstat( fd, &status ) != 0 ) {
+    ec.assign( errno, std::generic_category() );
+    ::close( fd );
+    return;
+  }
+
+  const auto size = static_cast<size_type>(status.st_size);
+  void* data = nullptr;
+
+  // Empty files cannot be mapped, but are still 'open'
+  if( size != 0 ) {
+    auto flags = MAP_SHARED;
+# if defined(MAP_POPULATE)
+    if( populate ) {
+      flags |= MAP_POPULATE;
+    }
+# endif
+
+    data = ::mmap( nullptr, size,
+                   read_write ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                   flags, fd, 0 );
+    if( data == MAP_FAILED ) {
+      ec.assign( errno, std::generic_category() );
+      ::close( fd );
+      return;
+    }
+
+# if !defined(MAP_POPULATE)
+    if( populate ) {
+      ::madvise( data, size, MADV_WILLNEED );
+    }
+# endif
+  }
+
+  // The mapping keeps the file alive; the descriptor is no longer needed
+  ::close( fd );
+
+  m_data    = data;
+  m_size    = size;
+  m_mode    = mode;
+  m_is_open = true;
+#endif
+}
+
+inline bit::stl::mapped_file::mapped_file( mapped_file&& other )
+  noexcept
+  : mapped_file()
+{
+  swap( other );
+}
+
+//-----------------------------------------------------------------------------
+
+inline bit::stl::mapped_file::~mapped_file()
+{
+  close();
+}
+
+//-----------------------------------------------------------------------------
+
+inline bit::stl::mapped_file& bit::stl::mapped_file::operator=( mapped_file&& other )
+  noexcept
+{
+  close();
+  swap( other );
+
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::mapped_file::close()
+  noexcept
+{
+#if !defined(_WIN32)
+  if( m_data != nullptr ) {
+    ::munmap( m_data, m_size );
+  }
+#endif
+
+  m_data    = nullptr;
+  m_size    = 0;
+  m_mode    = map_mode::read_only;
+  m_is_open = false;
+}
+
+inline void bit::stl::mapped_file::swap( mapped_file& other )
+  noexcept
+{
+  using std::swap;
+
+  swap( m_data, other.m_data );
+  swap( m_size, other.m_size );
+  swap( m_mode, other.m_mode );
+  swap( m_is_open, other.m_is_open );
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+inline bool bit::stl::mapped_file::advise( map_advice advice,
+                                           size_type offset,
+                                           size_type length )
+  const noexcept
+{
+#if defined(_WIN32)
+  (void) advice; (void) offset; (void) length;
+  return false;
+#else
+  if( m_data == nullptr || offset >= m_size ) {
+    return false;
+  }
+  if( length > m_size - offset ) {
+    length = m_size - offset;
+  }
+
+  // madvise requires a page-aligned start address
+  const auto page_size = static_cast<size_type>(::sysconf( _SC_PAGESIZE ));
+  const auto first     = offset & ~(page_size - 1);
+  length += offset - first;
+
+  auto flag = MADV_NORMAL;
+  switch( advice ) {
+  case map_advice::normal:     flag = MADV_NORMAL;     break;
+  case map_advice::sequential: flag = MADV_SEQUENTIAL; break;
+  case map_advice::random:     flag = MADV_RANDOM;     break;
+  case map_advice::will_need:  flag = MADV_WILLNEED;   break;
+  case map_advice::dont_need:  flag = MADV_DONTNEED;   break;
+  }
+
+  return ::madvise( static_cast<char*>(m_data) + first, length, flag ) == 0;
+#endif
+}
+
+inline void bit::stl::mapped_file::sync( bool wait )
+{
+  auto ec = std::error_code{};
+  sync( wait, ec );
+
+  if( ec ) {
+    throw std::system_error{ ec, "mapped_file::sync" };
+  }
+}
+
+inline void bit::stl::mapped_file::sync( bool wait, std::error_code& ec )
+  noexcept
+{
+  ec.clear();
+
+#if defined(_WIN32)
+  (void) wait;
+#else
+  if( m_data == nullptr || m_mode != map_mode::read_write ) {
+    return;
+  }
+
+  if( ::msync( m_data, m_size, wait ? MS_SYNC : MS_ASYNC ) != 0 ) {
+    ec.assign( errno, std::generic_category() );
+  }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::stl::span<const bit::stl::byte> bit::stl::mapped_file::bytes()
+  const noexcept
+{
+  return span<const byte>{ static_cast<const byte*>(m_data),
+                           static_cast<std::ptrdiff_t>(m_size) };
+}
+
+inline bit::stl::span<bit::stl::byte> bit::stl::mapped_file::mutable_bytes()
+  noexcept
+{
+  BIT_ASSERT( m_mode == map_mode::read_write,
+              "mapped_file::mutable_bytes: the mapping is read-only" );
+
+  return span<byte>{ static_cast<byte*>(m_data),
+                     static_cast<std::ptrdiff_t>(m_size) };
+}
+
+inline bit::stl::string_view bit::stl::mapped_file::chars()
+  const noexcept
+{
+  return string_view{ static_cast<const char*>(m_data), m_size };
+}
+
+inline bit::stl::fat_ptr<const void> bit::stl::mapped_file::region()
+  const noexcept
+{
+  return fat_ptr<const void>{ m_data, m_size };
+}
+
+inline const void* bit::stl::mapped_file::data()
+  const noexcept
+{
+  return m_data;
+}
+
+inline bit::stl::mapped_file::size_type bit::stl::mapped_file::size()
+  const noexcept
+{
+  return m_size;
+}
+
+inline bool bit::stl::mapped_file::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+inline bit::stl::map_mode bit::stl::mapped_file::mode()
+  const noexcept
+{
+  return m_mode;
+}
+
+inline bool bit::stl::mapped_file::is_open()
+  const noexcept
+{
+  return m_is_open;
+}
+
+inline bit::stl::mapped_file::operator bool()
+  const noexcept
+{
+  return is_open();
+}
+
+//=============================================================================
+// Utilities
+//=============================================================================
+
+inline void bit::stl::swap( mapped_file& lhs, mapped_file& rhs )
+  noexcept
+{
+  lhs.swap( rhs );
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_MAPPED_FILE_INL */
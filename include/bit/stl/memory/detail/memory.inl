@@ -43,6 +43,55 @@ inline void* bit::stl::from_address( std::uintptr_t address )
   return reinterpret_cast<void*>(address);
 }
 
+//------------------------------------------------------------------------
+
+inline constexpr std::size_t bit::stl::align_up( std::size_t value,
+                                                 std::size_t align )
+  noexcept
+{
+  return (value + (align - 1)) & ~(align - 1);
+}
+
+template<typename T>
+inline T* bit::stl::align_up( T* ptr, std::size_t align )
+  noexcept
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+
+  return reinterpret_cast<T*>(align_up( address, align ));
+}
+
+inline constexpr std::size_t bit::stl::align_down( std::size_t value,
+                                                   std::size_t align )
+  noexcept
+{
+  return value & ~(align - 1);
+}
+
+template<typename T>
+inline T* bit::stl::align_down( T* ptr, std::size_t align )
+  noexcept
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+
+  return reinterpret_cast<T*>(align_down( address, align ));
+}
+
+inline constexpr bool bit::stl::is_aligned( std::size_t value,
+                                            std::size_t align )
+  noexcept
+{
+  return (value & (align - 1)) == 0;
+}
+
+inline bool bit::stl::is_aligned( const volatile void* ptr, std::size_t align )
+  noexcept
+{
+  return is_aligned( reinterpret_cast<std::uintptr_t>(ptr), align );
+}
+
+//------------------------------------------------------------------------
+
 template<typename T, typename U>
 inline constexpr bool bit::stl::deep_compare( const T& lhs, const U& rhs )
   noexcept
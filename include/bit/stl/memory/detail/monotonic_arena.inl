@@ -0,0 +1,215 @@
+#ifndef BIT_STL_MEMORY_DETAIL_MONOTONIC_ARENA_INL
+#define BIT_STL_MEMORY_DETAIL_MONOTONIC_ARENA_INL
+
+//=============================================================================
+// monotonic_arena
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+inline bit::stl::monotonic_arena::monotonic_arena( size_type block_size )
+  noexcept
+  : monotonic_arena( nullptr, 0, block_size )
+{
+
+}
+
+inline bit::stl::monotonic_arena::monotonic_arena( void* buffer,
+                                                   size_type size,
+                                                   size_type block_size )
+  noexcept
+  : m_blocks(nullptr),
+    m_current(static_cast<char*>(buffer)),
+    m_end(static_cast<char*>(buffer) + size),
+    m_buffer(static_cast<char*>(buffer)),
+    m_buffer_size(size),
+    m_next_size(block_size),
+    m_initial_size(block_size)
+{
+  BIT_ASSERT( block_size != 0, "monotonic_arena: block size must be non-zero" );
+}
+
+//-----------------------------------------------------------------------------
+
+inline bit::stl::monotonic_arena::~monotonic_arena()
+{
+  release();
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+inline void* bit::stl::monotonic_arena::allocate( size_type bytes,
+                                                  size_type align )
+{
+  BIT_ASSERT( align != 0 && (align & (align - 1)) == 0,
+              "monotonic_arena::allocate: alignment must be a power of 2" );
+
+  const auto current = reinterpret_cast<std::uintptr_t>(m_current);
+  const auto adjust  = static_cast<size_type>(align_address(current, align) - current);
+  const auto space   = static_cast<size_type>(m_end - m_current);
+
+  if( m_current != nullptr && adjust <= space && bytes <= space - adjust ) {
+    auto* const result = m_current + adjust;
+    m_current = result + bytes;
+    return result;
+  }
+
+  return allocate_from_new_block( bytes, align );
+}
+
+inline void bit::stl::monotonic_arena::deallocate( void*, size_type, size_type )
+  noexcept
+{
+  // Memory is only reclaimed on release
+}
+
+inline void bit::stl::monotonic_arena::release()
+  noexcept
+{
+  while( m_blocks != nullptr ) {
+    auto* const next = m_blocks->next;
+    ::operator delete( m_blocks );
+    m_blocks = next;
+  }
+
+  m_current   = m_buffer;
+  m_end       = m_buffer + m_buffer_size;
+  m_next_size = m_initial_size;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::stl::monotonic_arena::size_type
+  bit::stl::monotonic_arena::remaining()
+  const noexcept
+{
+  return static_cast<size_type>(m_end - m_current);
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline void* bit::stl::monotonic_arena::allocate_from_new_block( size_type bytes,
+                                                                 size_type align )
+{
+  static constexpr auto max_size = std::numeric_limits<size_type>::max();
+  static constexpr auto overhead = sizeof(block_header);
+
+  if( bytes > max_size - overhead - align ) {
+    throw std::bad_alloc{};
+  }
+
+  // Over-allocate by the alignment, so that any alignment fits
+  const auto required = overhead + (align - 1) + bytes;
+  const auto size     = (m_next_size < required) ? required : m_next_size;
+
+  auto* const block = static_cast<block_header*>(::operator new( size ));
+  block->next = m_blocks;
+  m_blocks    = block;
+
+  if( m_next_size <= max_size / 2 ) {
+    m_next_size *= 2;
+  }
+
+  auto* const start  = reinterpret_cast<char*>(block + 1);
+  const auto current = reinterpret_cast<std::uintptr_t>(start);
+  auto* const result = start + (align_address(current, align) - current);
+
+  m_current = result + bytes;
+  m_end     = reinterpret_cast<char*>(block) + size;
+
+  return result;
+}
+
+inline std::uintptr_t
+  bit::stl::monotonic_arena::align_address( std::uintptr_t p, size_type align )
+  noexcept
+{
+  return (p + (align - 1)) & ~static_cast<std::uintptr_t>(align - 1);
+}
+
+//=============================================================================
+// arena_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::arena_allocator<T>::arena_allocator( monotonic_arena& arena )
+  noexcept
+  : m_arena(&arena)
+{
+
+}
+
+template<typename T>
+template<typename U>
+inline bit::stl::arena_allocator<T>
+  ::arena_allocator( const arena_allocator<U>& other )
+  noexcept
+  : m_arena(&other.arena())
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::arena_allocator<T>::allocate( size_type n )
+{
+  if( n > std::numeric_limits<size_type>::max() / sizeof(T) ) {
+    throw std::bad_alloc{};
+  }
+  return static_cast<T*>(m_arena->allocate( n * sizeof(T), alignof(T) ));
+}
+
+template<typename T>
+inline void bit::stl::arena_allocator<T>::deallocate( T* p, size_type n )
+  noexcept
+{
+  m_arena->deallocate( p, n * sizeof(T), alignof(T) );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::stl::monotonic_arena& bit::stl::arena_allocator<T>::arena()
+  const noexcept
+{
+  return *m_arena;
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U>
+inline bool bit::stl::operator==( const arena_allocator<T>& lhs,
+                                  const arena_allocator<U>& rhs )
+  noexcept
+{
+  return &lhs.arena() == &rhs.arena();
+}
+
+template<typename T, typename U>
+inline bool bit::stl::operator!=( const arena_allocator<T>& lhs,
+                                  const arena_allocator<U>& rhs )
+  noexcept
+{
+  return !(lhs==rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_MONOTONIC_ARENA_INL */
@@ -42,10 +42,18 @@ bit::stl::offset_ptr<T>::offset_ptr( U* p )
 
 }
 
+template<typename T>
+bit::stl::offset_ptr<T>::offset_ptr( const offset_ptr& other )
+  noexcept
+  : m_offset( calculate_offset(this,other.get()) )
+{
+
+}
+
 template<typename T>
 bit::stl::offset_ptr<T>::offset_ptr( offset_ptr&& other )
   noexcept
-  : m_offset(other.m_offset)
+  : m_offset( calculate_offset(this,other.get()) )
 {
   other.reset();
 }
@@ -87,11 +95,19 @@ bit::stl::offset_ptr<T>& bit::stl::offset_ptr<T>::operator=( U* p )
   return (*this);
 }
 
+template<typename T>
+bit::stl::offset_ptr<T>& bit::stl::offset_ptr<T>::operator=( const offset_ptr& other )
+  noexcept
+{
+  m_offset = calculate_offset(this,other.get());
+  return (*this);
+}
+
 template<typename T>
 bit::stl::offset_ptr<T>& bit::stl::offset_ptr<T>::operator=( offset_ptr&& other )
   noexcept
 {
-  m_offset = other.m_offset;
+  m_offset = calculate_offset(this,other.get());
   other.reset();
   return (*this);
 }
@@ -138,9 +154,10 @@ template<typename T>
 void bit::stl::offset_ptr<T>::swap( offset_ptr& other )
   noexcept
 {
-  using std::swap;
+  auto* p = get();
 
-  swap(m_offset, other.m_offset);
+  reset( other.get() );
+  other.reset( p );
 }
 
 //-----------------------------------------------------------------------------
@@ -194,9 +211,12 @@ template<typename U, typename V>
 std::ptrdiff_t bit::stl::offset_ptr<T>::calculate_offset( U* lhs, V* rhs )
   noexcept
 {
-  using byte_t = const unsigned char;
-  auto offset = reinterpret_cast<byte_t*>(lhs) - reinterpret_cast<byte_t*>(rhs);
-  return offset ? offset : 1;
+  using byte_t = const volatile unsigned char;
+
+  if( rhs == nullptr ) {
+    return 1;
+  }
+  return reinterpret_cast<byte_t*>(rhs) - reinterpret_cast<byte_t*>(lhs);
 }
 
 template<typename T>
@@ -205,6 +225,9 @@ T* bit::stl::offset_ptr<T>::calculate_address( std::true_type )
 {
   using byte_t = const unsigned char;
 
+  if( m_offset == 1 ) {
+    return nullptr;
+  }
   return reinterpret_cast<T*>(reinterpret_cast<byte_t*>(this) + m_offset);
 }
 
@@ -214,7 +237,11 @@ T* bit::stl::offset_ptr<T>::calculate_address( std::false_type )
 {
   using byte_t = unsigned char;
 
-  return reinterpret_cast<T*>(reinterpret_cast<byte_t*>(this) + m_offset);
+  if( m_offset == 1 ) {
+    return nullptr;
+  }
+  auto* self = const_cast<offset_ptr*>(this);
+  return reinterpret_cast<T*>(reinterpret_cast<byte_t*>(self) + m_offset);
 }
 
 //-----------------------------------------------------------------------------
@@ -480,7 +507,7 @@ template<typename T>
 inline bit::stl::hash_t bit::stl::hash_value( const offset_ptr<T>& val )
   noexcept
 {
-  return hash_value( val.offset() );
+  return hash_value( val.get() );
 }
 
 //-----------------------------------------------------------------------------
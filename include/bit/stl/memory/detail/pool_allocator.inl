@@ -0,0 +1,360 @@
+#ifndef BIT_STL_MEMORY_DETAIL_POOL_ALLOCATOR_INL
+#define BIT_STL_MEMORY_DETAIL_POOL_ALLOCATOR_INL
+
+//=============================================================================
+// fixed_size_pool
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template<std::size_t Size, std::size_t Align>
+constexpr std::size_t bit::stl::fixed_size_pool<Size,Align>::block_size;
+
+template<std::size_t Size, std::size_t Align>
+constexpr std::size_t bit::stl::fixed_size_pool<Size,Align>::batch_size;
+
+template<std::size_t Size, std::size_t Align>
+constexpr std::size_t bit::stl::fixed_size_pool<Size,Align>::blocks_per_slab;
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<std::size_t Size, std::size_t Align>
+inline void* bit::stl::fixed_size_pool<Size,Align>::allocate()
+{
+  auto& m = local_magazine();
+
+  // Fast path: pop from this thread's free list
+  if( m.head != nullptr ) {
+    auto* const node = m.head;
+    m.head = node->next;
+    --m.count;
+    return node;
+  }
+
+  // Carve from this thread's current slab
+  if( m.bump != m.end ) {
+    auto* const block = m.bump;
+    m.bump += block_size;
+    return block;
+  }
+
+  // An inactive magazine is always empty, so it is only checked for here
+  if( m.state != magazine_state::active && !activate( m ) ) {
+    return allocate_from_depot();
+  }
+
+  // Take back a batch freed by any thread
+  if( auto* const batch = depot_pop() ) {
+    m.head  = batch->next;
+    m.count = 0;
+    for( auto* node = m.head; node != nullptr; node = node->next ) {
+      ++m.count;
+    }
+    return batch;
+  }
+
+  auto* const slab = static_cast<char*>(::operator new( block_size * blocks_per_slab ));
+  m.bump = slab + block_size;
+  m.end  = slab + block_size * blocks_per_slab;
+
+  return slab;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline void bit::stl::fixed_size_pool<Size,Align>::deallocate( void* p )
+  noexcept
+{
+  auto& m = local_magazine();
+
+  auto* const node = static_cast<node_type*>(p);
+
+  // Once the magazine is destroyed, the block is returned as a batch of
+  // its own
+  if( m.state != magazine_state::active && !activate( m ) ) {
+    node->next = nullptr;
+    depot_push( node, node );
+    return;
+  }
+
+  node->next = m.head;
+  m.head     = node;
+
+  if( ++m.count >= 2 * batch_size ) {
+    flush_batch( m );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Magazine
+//-----------------------------------------------------------------------------
+
+template<std::size_t Size, std::size_t Align>
+inline bit::stl::fixed_size_pool<Size,Align>::magazine_holder::~magazine_holder()
+{
+  auto& m = local_magazine();
+
+  // Return the unused remainder of the slab along with the free list
+  for( ; m.bump != m.end; m.bump += block_size ) {
+    auto* const node = reinterpret_cast<node_type*>(m.bump);
+    node->next = m.head;
+    m.head     = node;
+  }
+
+  while( m.head != nullptr ) {
+    auto* const first = m.head;
+    auto* last        = first;
+    for( auto i = std::size_t{1}; i < batch_size && last->next != nullptr; ++i ) {
+      last = last->next;
+    }
+    m.head     = last->next;
+    last->next = nullptr;
+
+    depot_push( first, first );
+  }
+
+  m.count = 0;
+  m.state = magazine_state::destroyed;
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+template<std::size_t Size, std::size_t Align>
+inline typename bit::stl::fixed_size_pool<Size,Align>::magazine&
+  bit::stl::fixed_size_pool<Size,Align>::local_magazine()
+  noexcept
+{
+  // Constant-initialized and trivially destructible, so this needs no
+  // guard, and remains usable after its holder has been destroyed during
+  // thread exit
+  static thread_local magazine s_magazine;
+
+  return s_magazine;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline bool bit::stl::fixed_size_pool<Size,Align>::activate( magazine& m )
+  noexcept
+{
+  if( m.state == magazine_state::destroyed ) {
+    return false;
+  }
+
+  // Constructing the holder registers its destruction at thread exit
+  static thread_local magazine_holder s_holder;
+  (void) s_holder;
+
+  m.state = magazine_state::active;
+  return true;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline void* bit::stl::fixed_size_pool<Size,Align>::allocate_from_depot()
+{
+  if( auto* const batch = depot_pop() ) {
+    if( auto* const rest = batch->next ) {
+      depot_push( rest, rest );
+    }
+    return batch;
+  }
+
+  return ::operator new( block_size );
+}
+
+template<std::size_t Size, std::size_t Align>
+inline std::atomic<bit::stl::detail::pool_node*>&
+  bit::stl::fixed_size_pool<Size,Align>::depot()
+  noexcept
+{
+  // Constant-initialized and trivially destructible, so that magazines of
+  // exiting threads may always return blocks here
+  static std::atomic<node_type*> s_depot{nullptr};
+
+  return s_depot;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline std::atomic_flag& bit::stl::fixed_size_pool<Size,Align>::depot_lock()
+  noexcept
+{
+  // Constant-initialized and trivially destructible, as is the depot
+  static std::atomic_flag s_lock = ATOMIC_FLAG_INIT;
+
+  return s_lock;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline void bit::stl::fixed_size_pool<Size,Align>
+  ::depot_push( node_type* first, node_type* last )
+  noexcept
+{
+  auto& head = depot();
+  auto* old  = head.load( std::memory_order_relaxed );
+
+  do {
+    last->next_batch = old;
+  } while( !head.compare_exchange_weak( old, first,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed ) );
+}
+
+template<std::size_t Size, std::size_t Align>
+inline typename bit::stl::fixed_size_pool<Size,Align>::node_type*
+  bit::stl::fixed_size_pool<Size,Align>::depot_pop()
+  noexcept
+{
+  auto& head = depot();
+
+  if( head.load( std::memory_order_relaxed ) == nullptr ) return nullptr;
+
+  // Pushes only ever replace the top, so while pops are serialized, the
+  // top batch cannot be taken and returned between reading its link and
+  // swapping it out; this rules out the ABA problem
+  auto& lock = depot_lock();
+  while( lock.test_and_set( std::memory_order_acquire ) ) {
+    // spin; the lock is only held for a single compare-and-swap
+  }
+
+  auto* batch = head.load( std::memory_order_acquire );
+  while( batch != nullptr &&
+         !head.compare_exchange_weak( batch, batch->next_batch,
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire ) ) {
+    // batch has been reloaded; retry
+  }
+
+  lock.clear( std::memory_order_release );
+
+  return batch;
+}
+
+template<std::size_t Size, std::size_t Align>
+inline void bit::stl::fixed_size_pool<Size,Align>::flush_batch( magazine& m )
+  noexcept
+{
+  auto* const first = m.head;
+  auto* last        = first;
+  for( auto i = std::size_t{1}; i < batch_size; ++i ) {
+    last = last->next;
+  }
+
+  m.head      = last->next;
+  last->next  = nullptr;
+  m.count    -= batch_size;
+
+  depot_push( first, first );
+}
+
+//=============================================================================
+// pool_allocator
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template<typename T>
+constexpr std::size_t bit::stl::pool_allocator<T>::max_pooled_size;
+
+template<typename T>
+constexpr std::size_t bit::stl::pool_allocator<T>::size_class;
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename U>
+inline bit::stl::pool_allocator<T>::pool_allocator( const pool_allocator<U>& )
+  noexcept
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::pool_allocator<T>::allocate( size_type n )
+{
+  return allocate( n, is_pooled{} );
+}
+
+template<typename T>
+inline void bit::stl::pool_allocator<T>::deallocate( T* p, size_type n )
+  noexcept
+{
+  deallocate( p, n, is_pooled{} );
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::stl::pool_allocator<T>::allocate( size_type n, std::true_type )
+{
+  if( n == 1 ) {
+    return static_cast<T*>(pool_type::allocate());
+  }
+  return allocate( n, std::false_type{} );
+}
+
+template<typename T>
+inline T* bit::stl::pool_allocator<T>::allocate( size_type n, std::false_type )
+{
+  if( n > std::numeric_limits<size_type>::max() / sizeof(T) ) {
+    throw std::bad_alloc{};
+  }
+  return static_cast<T*>(::operator new( n * sizeof(T) ));
+}
+
+template<typename T>
+inline void bit::stl::pool_allocator<T>::deallocate( T* p,
+                                                     size_type n,
+                                                     std::true_type )
+  noexcept
+{
+  if( n == 1 ) {
+    pool_type::deallocate( p );
+    return;
+  }
+  deallocate( p, n, std::false_type{} );
+}
+
+template<typename T>
+inline void bit::stl::pool_allocator<T>::deallocate( T* p,
+                                                     size_type,
+                                                     std::false_type )
+  noexcept
+{
+  ::operator delete( p );
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U>
+inline constexpr bool bit::stl::operator==( const pool_allocator<T>&,
+                                            const pool_allocator<U>& )
+  noexcept
+{
+  return true;
+}
+
+template<typename T, typename U>
+inline constexpr bool bit::stl::operator!=( const pool_allocator<T>&,
+                                            const pool_allocator<U>& )
+  noexcept
+{
+  return false;
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_POOL_ALLOCATOR_INL */
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains the type-erased retired object used by the
+ *        deferred reclamation schemes in epoch_domain.hpp and
+ *        hazard_pointer.hpp
+ *
+ * \note This is an internal header file, included by other library headers.
+ *       Do not attempt to use it directly.
+ */
+#ifndef BIT_STL_MEMORY_DETAIL_RETIRED_OBJECT_HPP
+#define BIT_STL_MEMORY_DETAIL_RETIRED_OBJECT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../../utilities/aligned_storage.hpp" // aligned_storage_t
+
+#include <new>         // placement new
+#include <type_traits> // std::is_trivially_copyable, std::integral_constant
+#include <utility>     // std::move
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A retired object and the type-erased deleter to destroy it
+      ///
+      /// Deleters no larger than two pointers that are trivially copyable,
+      /// such as allocator_deleter, are stored inline; others are copied to
+      /// the heap.
+      ////////////////////////////////////////////////////////////////////////
+      class retired_object
+      {
+        //--------------------------------------------------------------------
+        // Constructors
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Retires \p object, to be destroyed with \p deleter
+        ///
+        /// \param object the object to retire
+        /// \param deleter the deleter to destroy it with
+        template<typename T, typename Deleter>
+        retired_object( T* object, Deleter deleter )
+          : m_object(const_cast<void*>(static_cast<const volatile void*>(object)))
+        {
+          store<T>( deleter, is_stored_inline<Deleter>{} );
+        }
+
+        //--------------------------------------------------------------------
+        // Observers
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Gets the address of the retired object
+        const void* get() const noexcept
+        {
+          return m_object;
+        }
+
+        //--------------------------------------------------------------------
+        // Modifiers
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Destroys the retired object
+        void operator()() noexcept
+        {
+          m_destroy( *this );
+        }
+
+        //--------------------------------------------------------------------
+        // Private Member Types
+        //--------------------------------------------------------------------
+      private:
+
+        using storage_type = aligned_storage_t<2 * sizeof(void*),alignof(void*)>;
+
+        template<typename Deleter>
+        using is_stored_inline = std::integral_constant<bool,
+          (sizeof(Deleter) <= sizeof(storage_type)) &&
+          (alignof(Deleter) <= alignof(storage_type)) &&
+          std::is_trivially_copyable<Deleter>::value
+        >;
+
+        //--------------------------------------------------------------------
+        // Private Member Functions
+        //--------------------------------------------------------------------
+      private:
+
+        template<typename T, typename Deleter>
+        void store( Deleter& deleter, std::true_type )
+        {
+          ::new(&m_deleter) Deleter( std::move(deleter) );
+          m_destroy = &destroy_inline<T,Deleter>;
+        }
+
+        template<typename T, typename Deleter>
+        void store( Deleter& deleter, std::false_type )
+        {
+          ::new(&m_deleter) Deleter*( new Deleter( std::move(deleter) ) );
+          m_destroy = &destroy_allocated<T,Deleter>;
+        }
+
+        template<typename T, typename Deleter>
+        static void destroy_inline( retired_object& retired )
+        {
+          // Trivially copyable, so there is no destructor to run
+          auto& deleter = *reinterpret_cast<Deleter*>(&retired.m_deleter);
+
+          deleter( static_cast<T*>(retired.m_object) );
+        }
+
+        template<typename T, typename Deleter>
+        static void destroy_allocated( retired_object& retired )
+        {
+          auto* const deleter = *reinterpret_cast<Deleter**>(&retired.m_deleter);
+
+          (*deleter)( static_cast<T*>(retired.m_object) );
+          delete deleter;
+        }
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        void*        m_object;
+        void       (*m_destroy)( retired_object& );
+        storage_type m_deleter;
+      };
+
+    } // namespace detail
+  } // namespace stl
+} // namespace bit
+
+#endif /* BIT_STL_MEMORY_DETAIL_RETIRED_OBJECT_HPP */
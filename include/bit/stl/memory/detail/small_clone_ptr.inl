@@ -0,0 +1,360 @@
+#ifndef BIT_STL_MEMORY_DETAIL_SMALL_CLONE_PTR_INL
+#define BIT_STL_MEMORY_DETAIL_SMALL_CLONE_PTR_INL
+
+//=============================================================================
+// detail::small_clone_ptr_handler<T,U,true>
+//=============================================================================
+
+template<typename T, typename U>
+constexpr bit::stl::detail::small_clone_ptr_vtable<T>
+  bit::stl::detail::small_clone_ptr_handler<T,U,true>::vtable;
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U>
+template<typename...Args>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,true>
+  ::create( void* storage, Args&&...args )
+{
+  return ::new(storage) U( std::forward<Args>(args)... );
+}
+
+template<typename T, typename U>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,true>
+  ::copy( const void* from, void* to )
+{
+  return ::new(to) U( *static_cast<const U*>(from) );
+}
+
+template<typename T, typename U>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,true>
+  ::move( void* from, void* to )
+  noexcept
+{
+  auto* source = static_cast<U*>(from);
+  auto* result = ::new(to) U( std::move(*source) );
+  source->~U();
+
+  return result;
+}
+
+template<typename T, typename U>
+inline void bit::stl::detail::small_clone_ptr_handler<T,U,true>
+  ::destroy( void* storage )
+  noexcept
+{
+  static_cast<U*>(storage)->~U();
+}
+
+//=============================================================================
+// detail::small_clone_ptr_handler<T,U,false>
+//=============================================================================
+
+template<typename T, typename U>
+constexpr bit::stl::detail::small_clone_ptr_vtable<T>
+  bit::stl::detail::small_clone_ptr_handler<T,U,false>::vtable;
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename U>
+template<typename...Args>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,false>
+  ::create( void* storage, Args&&...args )
+{
+  // The storage holds the pointer to the heap object
+  return *::new(storage) U*( new U( std::forward<Args>(args)... ) );
+}
+
+template<typename T, typename U>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,false>
+  ::copy( const void* from, void* to )
+{
+  return create( to, **static_cast<U* const*>(from) );
+}
+
+template<typename T, typename U>
+inline T* bit::stl::detail::small_clone_ptr_handler<T,U,false>
+  ::move( void* from, void* to )
+  noexcept
+{
+  return *::new(to) U*( *static_cast<U**>(from) );
+}
+
+template<typename T, typename U>
+inline void bit::stl::detail::small_clone_ptr_handler<T,U,false>
+  ::destroy( void* storage )
+  noexcept
+{
+  delete *static_cast<U**>(storage);
+}
+
+//=============================================================================
+// small_clone_ptr<T,Size>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>::small_clone_ptr()
+  noexcept
+  : m_vtable(nullptr),
+    m_ptr(nullptr)
+{
+
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>::small_clone_ptr( std::nullptr_t )
+  noexcept
+  : small_clone_ptr()
+{
+
+}
+
+template<typename T, std::size_t Size>
+template<typename U, typename...Args, typename>
+inline bit::stl::small_clone_ptr<T,Size>
+  ::small_clone_ptr( in_place_type_t<U>, Args&&...args )
+  : small_clone_ptr()
+{
+  construct<U>( std::forward<Args>(args)... );
+}
+
+template<typename T, std::size_t Size>
+template<typename U, typename, typename>
+inline bit::stl::small_clone_ptr<T,Size>::small_clone_ptr( U&& value )
+  : small_clone_ptr()
+{
+  construct<std::decay_t<U>>( std::forward<U>(value) );
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>
+  ::small_clone_ptr( const small_clone_ptr& other )
+  : small_clone_ptr()
+{
+  if( other.m_vtable ) {
+    m_ptr    = other.m_vtable->copy( &other.m_storage, &m_storage );
+    m_vtable = other.m_vtable;
+  }
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>
+  ::small_clone_ptr( small_clone_ptr&& other )
+  noexcept
+  : small_clone_ptr()
+{
+  move_from( other );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>::~small_clone_ptr()
+{
+  reset();
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>&
+  bit::stl::small_clone_ptr<T,Size>::operator=( const small_clone_ptr& other )
+{
+  if( this != &other ) {
+    // Copy first, so that a throwing copy leaves this unchanged
+    auto copy = other;
+    reset();
+    move_from( copy );
+  }
+  return (*this);
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>&
+  bit::stl::small_clone_ptr<T,Size>::operator=( small_clone_ptr&& other )
+  noexcept
+{
+  if( this != &other ) {
+    reset();
+    move_from( other );
+  }
+  return (*this);
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>&
+  bit::stl::small_clone_ptr<T,Size>::operator=( std::nullptr_t )
+  noexcept
+{
+  reset();
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline void bit::stl::small_clone_ptr<T,Size>::reset()
+  noexcept
+{
+  if( m_vtable ) {
+    m_vtable->destroy( &m_storage );
+  }
+  m_vtable = nullptr;
+  m_ptr    = nullptr;
+}
+
+template<typename T, std::size_t Size>
+template<typename U, typename...Args, typename>
+inline U& bit::stl::small_clone_ptr<T,Size>::emplace( Args&&...args )
+{
+  reset();
+  construct<U>( std::forward<Args>(args)... );
+
+  return static_cast<U&>(*m_ptr);
+}
+
+template<typename T, std::size_t Size>
+inline void bit::stl::small_clone_ptr<T,Size>::swap( small_clone_ptr& other )
+  noexcept
+{
+  auto temp = std::move(other);
+  other.move_from( *this );
+  move_from( temp );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline typename bit::stl::small_clone_ptr<T,Size>::pointer
+  bit::stl::small_clone_ptr<T,Size>::get()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T, std::size_t Size>
+inline bit::stl::small_clone_ptr<T,Size>::operator bool()
+  const noexcept
+{
+  return m_ptr != nullptr;
+}
+
+template<typename T, std::size_t Size>
+inline std::add_lvalue_reference_t<T>
+  bit::stl::small_clone_ptr<T,Size>::operator*()
+  const noexcept
+{
+  return *m_ptr;
+}
+
+template<typename T, std::size_t Size>
+inline typename bit::stl::small_clone_ptr<T,Size>::pointer
+  bit::stl::small_clone_ptr<T,Size>::operator->()
+  const noexcept
+{
+  return m_ptr;
+}
+
+template<typename T, std::size_t Size>
+inline bool bit::stl::small_clone_ptr<T,Size>::is_inline()
+  const noexcept
+{
+  return m_vtable != nullptr && m_vtable->is_inline;
+}
+
+//-----------------------------------------------------------------------------
+// Private Utilities
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+template<typename U, typename...Args>
+inline void bit::stl::small_clone_ptr<T,Size>::construct( Args&&...args )
+{
+  using handler = detail::small_clone_ptr_handler<T,U,is_stored_inline<U>::value>;
+
+  m_ptr    = handler::create( &m_storage, std::forward<Args>(args)... );
+  m_vtable = &handler::vtable;
+}
+
+template<typename T, std::size_t Size>
+inline void bit::stl::small_clone_ptr<T,Size>::move_from( small_clone_ptr& other )
+  noexcept
+{
+  // Precondition: this is empty
+  if( other.m_vtable ) {
+    m_ptr    = other.m_vtable->move( &other.m_storage, &m_storage );
+    m_vtable = other.m_vtable;
+
+    other.m_vtable = nullptr;
+    other.m_ptr    = nullptr;
+  }
+}
+
+//=============================================================================
+// Free Functions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline void bit::stl::swap( small_clone_ptr<T,Size>& lhs,
+                            small_clone_ptr<T,Size>& rhs )
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+template<typename T, typename U, typename...Args>
+inline bit::stl::small_clone_ptr<T>
+  bit::stl::make_small_clone( Args&&...args )
+{
+  return small_clone_ptr<T>( in_place_type<U>, std::forward<Args>(args)... );
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t Size>
+inline bool bit::stl::operator==( const small_clone_ptr<T,Size>& lhs,
+                                  std::nullptr_t )
+  noexcept
+{
+  return !lhs;
+}
+
+template<typename T, std::size_t Size>
+inline bool bit::stl::operator==( std::nullptr_t,
+                                  const small_clone_ptr<T,Size>& rhs )
+  noexcept
+{
+  return !rhs;
+}
+
+template<typename T, std::size_t Size>
+inline bool bit::stl::operator!=( const small_clone_ptr<T,Size>& lhs,
+                                  std::nullptr_t )
+  noexcept
+{
+  return static_cast<bool>(lhs);
+}
+
+template<typename T, std::size_t Size>
+inline bool bit::stl::operator!=( std::nullptr_t,
+                                  const small_clone_ptr<T,Size>& rhs )
+  noexcept
+{
+  return static_cast<bool>(rhs);
+}
+
+#endif /* BIT_STL_MEMORY_DETAIL_SMALL_CLONE_PTR_INL */
@@ -0,0 +1,348 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an epoch-based memory reclamation domain for
+ *        deferring the destruction of objects in lock-free structures
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_EPOCH_DOMAIN_HPP
+#define BIT_STL_MEMORY_EPOCH_DOMAIN_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/asymmetric_fence.hpp" // detail::asymmetric_light_fence
+#include "detail/retired_object.hpp"   // detail::retired_object
+#include "../utilities/assert.hpp"     // BIT_ASSERT
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <memory>      // std::default_delete
+#include <mutex>       // std::mutex, std::unique_lock
+#include <utility>     // std::move, std::pair
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Objects retired during a single epoch
+      ////////////////////////////////////////////////////////////////////////
+      struct epoch_bucket
+      {
+        std::uint64_t               epoch = 0;
+        std::vector<retired_object> entries;
+
+        /// \brief Destroys every object in this bucket
+        std::size_t clear() noexcept;
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The registration record for one participating thread
+      ///
+      /// Records are never unlinked while the domain lives; a record is
+      /// reused by the next thread to register after its owner leaves.
+      ////////////////////////////////////////////////////////////////////////
+      struct epoch_record
+      {
+        /// The pinned epoch shifted left by one, with the low bit set while
+        /// pinned. Records are allocated individually and are larger than a
+        /// cache line, so neighbouring records rarely share one
+        std::atomic<std::uint64_t> local{0};
+        std::atomic<bool>          in_use{true};
+        epoch_record*              next = nullptr;
+
+        // Only accessed by the owning thread
+        std::size_t  nesting = 0;
+        std::size_t  retired_since_collect = 0;
+        epoch_bucket buckets[3];
+
+        /// Whether this record holds one of the domain's reserved orphan
+        /// slots; guarded by the domain's mutex
+        bool has_orphan_slot = false;
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A domain of epoch-based memory reclamation
+    ///
+    /// Threads that read a lock-free structure register as a participant
+    /// and pin the domain, via a guard, around each access. An object
+    /// removed from the structure is retired rather than destroyed. It is
+    /// destroyed once every thread that was pinned when it was retired has
+    /// unpinned, which is detected by advancing a global epoch.
+    ///
+    /// Pinning is the read-side cost: a load and a store of thread-local
+    /// state. On Linux the store is not followed by a hardware fence; the
+    /// writer instead issues a process-wide barrier through membarrier(2)
+    /// when advancing the epoch. Nested pins only adjust a counter.
+    ///
+    /// Each participant keeps its retired objects in three limbo lists,
+    /// one per live epoch. Every \c batch_size retirements it tries to
+    /// advance the epoch and frees the lists that have become safe, so the
+    /// cost of scanning participants is amortized.
+    ///
+    /// Objects retired by a participant that leaves are handed to the
+    /// domain and freed by later collections, or when the domain is
+    /// destroyed. Each participant also holds one slot of reserved capacity
+    /// among the domain's orphans, so an object whose limbo list cannot
+    /// grow is handed to the domain without allocating.
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      class participant;
+      class guard;
+
+      using size_type  = std::size_t;
+      using epoch_type = std::uint64_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an epoch_domain
+      ///
+      /// \param batch_size the number of retirements between collections
+      explicit epoch_domain( size_type batch_size = 64 );
+
+      epoch_domain( const epoch_domain& ) = delete;
+      epoch_domain( epoch_domain&& ) = delete;
+
+      /// \brief Destroys every object still retired in this domain
+      ///
+      /// \pre no participants are registered
+      ~epoch_domain();
+
+      //----------------------------------------------------------------------
+
+      epoch_domain& operator=( const epoch_domain& ) = delete;
+      epoch_domain& operator=( epoch_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the current global epoch
+      epoch_type epoch() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      detail::epoch_record* acquire_record();
+
+      void release_record( detail::epoch_record& record );
+
+      /// \brief Advances the epoch if every pinned participant has
+      ///        observed the current one
+      bool try_advance() noexcept;
+
+      size_type collect_orphans() noexcept;
+
+      /// \brief Reserves capacity among the orphans for \p record to hand
+      ///        one object to without allocating
+      void reserve_orphan_slot( detail::epoch_record& record );
+
+      /// \brief Hands \p retired to the domain through the slot reserved
+      ///        by \p record
+      void orphan( detail::epoch_record& record,
+                   epoch_type epoch,
+                   detail::retired_object retired ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<epoch_type>                        m_epoch;
+      std::atomic<detail::epoch_record*>             m_records;
+      size_type                                      m_batch_size;
+      bool                                           m_asymmetric;
+
+      std::mutex                                     m_mutex;   ///< Guards m_orphans and m_orphan_slots
+      std::vector<std::pair<epoch_type,detail::retired_object>> m_orphans;
+
+      /// The capacity of m_orphans, beyond its size, that is reserved for
+      /// records holding an orphan slot
+      size_type                                      m_orphan_slots;
+
+      friend class participant;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A thread's registration with an epoch_domain
+    ///
+    /// A participant must only be used by one thread at a time, and must
+    /// not outlive its domain.
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain::participant
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Registers the calling thread with \p domain
+      ///
+      /// \param domain the domain to participate in
+      explicit participant( epoch_domain& domain );
+
+      participant( const participant& ) = delete;
+      participant( participant&& ) = delete;
+
+      /// \brief Unregisters, handing outstanding retired objects to the
+      ///        domain
+      ///
+      /// \pre this participant is not pinned
+      ~participant();
+
+      //----------------------------------------------------------------------
+
+      participant& operator=( const participant& ) = delete;
+      participant& operator=( participant&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Critical Sections
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pins the domain for the lifetime of the returned guard
+      ///
+      /// \return the guard
+      guard pin() noexcept;
+
+      /// \brief Queries whether this participant is pinned
+      bool is_pinned() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Reclamation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Retires \p ptr, destroying it with \p deleter once no
+      ///        pinned thread can still reference it
+      ///
+      /// \p ptr must already be unreachable for threads that pin after
+      /// this call.
+      ///
+      /// \throw std::bad_alloc if this participant's orphan slot, used
+      ///        earlier, cannot be reserved again; \p ptr is then not
+      ///        retired
+      ///
+      /// \param ptr the pointer to retire
+      /// \param deleter the deleter to destroy \p ptr with
+      template<typename T, typename Deleter = std::default_delete<T>>
+      void retire( T* ptr, Deleter deleter = Deleter{} );
+
+      /// \brief Attempts to advance the epoch, and destroys every retired
+      ///        object that has become safe to destroy
+      ///
+      /// \return the number of objects destroyed
+      size_type collect() noexcept;
+
+      /// \brief Gets the number of objects this participant has retired
+      ///        that are not yet destroyed
+      size_type pending() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      void enter() noexcept;
+
+      void leave() noexcept;
+
+      void push( detail::retired_object retired );
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      epoch_domain*         m_domain;
+      detail::epoch_record* m_record;
+
+      friend class guard;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An RAII critical section of an epoch_domain
+    ///
+    /// Pointers read from a structure protected by the domain remain valid
+    /// until the guard is destroyed.
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain::guard
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pins \p p
+      ///
+      /// \param p the participant to pin
+      explicit guard( participant& p ) noexcept;
+
+      guard( guard&& other ) noexcept;
+      guard( const guard& ) = delete;
+
+      ~guard();
+
+      //----------------------------------------------------------------------
+
+      guard& operator=( const guard& ) = delete;
+      guard& operator=( guard&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      participant* m_participant;
+    };
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/epoch_domain.inl"
+
+#endif /* BIT_STL_MEMORY_EPOCH_DOMAIN_HPP */
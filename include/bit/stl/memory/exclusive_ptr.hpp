@@ -44,6 +44,7 @@
 #include <memory>      // std::default_delete
 #include <tuple>       // std::forward_as_tuple
 #include <type_traits> // std::add_lvalue_reference_t
+#include <typeinfo>    // std::type_info
 #include <utility>     // std::piecewise_construct, std::move, std::forward
 
 namespace bit {
@@ -52,6 +53,7 @@ namespace bit {
 
     namespace detail {
       class exclusive_ptr_control_block;
+      class exclusive_ptr_default_block;
       template<typename,typename> class exclusive_ptr_emplace;
       template<typename,typename,typename> class exclusive_ptr_pointer;
       template<typename T, typename U>
@@ -62,6 +64,20 @@ namespace bit {
       exclusive_ptr<T> const_pointer_cast( exclusive_ptr<U>&& other );
       template<typename T, typename U>
       exclusive_ptr<T> reinterpret_pointer_cast( exclusive_ptr<U>&& other );
+
+      /// \brief Trait for whether an object created with \c new \c Y may be
+      ///        destroyed with \c delete through a \c T*
+      template<typename T, typename Y>
+      struct exclusive_ptr_deletable_as
+        : std::integral_constant<bool,
+            std::is_same<std::remove_cv_t<T>,std::remove_cv_t<Y>>::value ||
+            std::has_virtual_destructor<T>::value>{};
+
+      template<typename Allocator>
+      struct is_std_allocator : std::false_type{};
+
+      template<typename T>
+      struct is_std_allocator<std::allocator<T>> : std::true_type{};
     } // namespace detail
 
     //=========================================================================
@@ -77,10 +93,18 @@ namespace bit {
     /// and some possible spacial overhead of 1 extra pointer along with any
     /// additional storage required by Deleter and Allocator types.
     ///
-    /// In the  case where Deleter and Allocator are both stateless, and
-    /// this type is allocated by a call to 'make_exclusive' or
-    /// 'allocate_exclusive', then the additional storage is fixed at
-    /// 2 pointers on the stack, and no additional heap memory.
+    /// In the common case where the deleter is \c std::default_delete and the
+    /// allocator is \c std::allocator -- as with 'make_exclusive', or when
+    /// constructing from a raw pointer -- no control block is allocated at
+    /// all. The control block pointer instead refers to a shared sentinel,
+    /// and destruction is a direct \c delete with no virtual call. A real
+    /// control block is only created if such a pointer is later converted to
+    /// a type that cannot be deleted directly, such as a base without a
+    /// virtual destructor.
+    ///
+    /// With any other allocator, 'allocate_exclusive' places the control
+    /// block and the object in a single allocation, so the exclusive_ptr is
+    /// still only 2 pointers with no further heap memory.
     ///
     /// This is useful for classes that require unique ownership semantics,
     /// but offer flexibility on the underlying allocator type that can be
@@ -202,7 +226,8 @@ namespace bit {
       /// \param other the other exclusive_ptr to c
       template<typename Y,
                typename=std::enable_if_t<std::is_convertible<Y*,T*>::value>>
-      exclusive_ptr( exclusive_ptr<Y>&& other ) noexcept;
+      exclusive_ptr( exclusive_ptr<Y>&& other )
+        noexcept( detail::exclusive_ptr_deletable_as<T,Y>::value );
 
       // Deleted copy converting constructor
       template<typename Y,
@@ -239,7 +264,8 @@ namespace bit {
       /// \return reference to \c (*this)
       template<typename Y,
                typename=std::enable_if_t<std::is_convertible<Y*,T*>::value>>
-      exclusive_ptr& operator=( exclusive_ptr<Y>&& other ) noexcept;
+      exclusive_ptr& operator=( exclusive_ptr<Y>&& other )
+        noexcept( detail::exclusive_ptr_deletable_as<T,Y>::value );
 
       /// \brief Assigns \c nullptr to this \c exclusive_ptr
       ///
@@ -336,6 +362,11 @@ namespace bit {
       struct ctor_tag{};
       using control_block_type = detail::exclusive_ptr_control_block;
 
+      /// Whether elements may be deleted directly through \c element_type*
+      using is_directly_deletable = std::integral_constant<bool,
+        !std::is_void<T>::value && !std::is_array<T>::value
+      >;
+
       //-----------------------------------------------------------------------
       // Private Members
       //-----------------------------------------------------------------------
@@ -360,6 +391,61 @@ namespace bit {
                      control_block_type* block,
                      T* ptr ) noexcept;
 
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Destroys the managed element, without resetting the pointers
+      void destroy() noexcept;
+
+      void delete_element( std::true_type ) noexcept;
+      void delete_element( std::false_type ) noexcept;
+
+      /// \brief Makes the control block for managing \p ptr
+      ///
+      /// Default deleters and allocators use the sentinel default block
+      template<typename Y, typename Deleter, typename Allocator>
+      static control_block_type* make_block( Y* ptr,
+                                             Deleter deleter,
+                                             Allocator alloc,
+                                             std::true_type );
+      template<typename Y, typename Deleter, typename Allocator>
+      static control_block_type* make_block( Y* ptr,
+                                             Deleter deleter,
+                                             Allocator alloc,
+                                             std::false_type );
+
+      /// \brief Allocates an element, either directly with \c new or
+      ///        together with its control block using \p alloc
+      template<typename Allocator, typename...Args>
+      static exclusive_ptr allocate( std::true_type,
+                                     const Allocator& alloc,
+                                     Args&&...args );
+      template<typename Allocator, typename...Args>
+      static exclusive_ptr allocate( std::false_type,
+                                     const Allocator& alloc,
+                                     Args&&...args );
+
+      /// \brief Adopts the control block of an exclusive_ptr<Y> pointing to
+      ///        \p ptr, creating a real control block if \p ptr could not
+      ///        otherwise be deleted through \c element_type*
+      template<typename Y>
+      static control_block_type* adopt_block( control_block_type* block,
+                                              Y* ptr,
+                                              std::true_type ) noexcept;
+      template<typename Y>
+      static control_block_type* adopt_block( control_block_type* block,
+                                              Y* ptr,
+                                              std::false_type );
+
+      /// \brief Creates a real control block for an element that was using
+      ///        the default block
+      static control_block_type* materialize_block( element_type* ptr,
+                                                    std::true_type );
+      static control_block_type* materialize_block( element_type* ptr,
+                                                    std::false_type ) noexcept;
+
       //-----------------------------------------------------------------------
       // Friendships
       //-----------------------------------------------------------------------
@@ -44,7 +44,7 @@
 
 #include <cstddef>     // std::size_t
 #include <utility>     // std::swap
-#include <type_traits> // std::is_void, std::is_abstract
+#include <type_traits> // std::is_void, std::is_abstract, std::add_lvalue_reference_t
 
 namespace bit {
   namespace stl {
@@ -78,6 +78,9 @@ namespace bit {
       //----------------------------------------------------------------------
     public:
 
+      /// \brief Constructs a null fat_ptr of size 0
+      constexpr fat_ptr() noexcept;
+
       /// \brief Constructs a fat_ptr at the specified memory address of size
       ///        n
       ///
@@ -176,7 +179,7 @@ namespace bit {
       /// \note UB if the pointer is invalid
       ///
       /// \return reference to the pointed element
-      constexpr element_type& operator*() const noexcept;
+      constexpr std::add_lvalue_reference_t<element_type> operator*() const noexcept;
 
       /// \brief Dereferences the fat_ptr
       ///
@@ -0,0 +1,340 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains the size-feedback allocator protocol, whose
+ *        allocations report the usable size actually obtained
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_FEEDBACK_ALLOCATOR_HPP
+#define BIT_STL_MEMORY_FEEDBACK_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "fat_ptr.hpp"
+
+#include "../traits/composition/bool_constant.hpp" // true_type, false_type
+#include "../traits/composition/void_t.hpp"        // void_t
+#include "../utilities/assert.hpp"                 // BIT_ASSERT
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <cstdlib>     // std::malloc, std::free, posix_memalign
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::allocator_traits
+#include <new>         // std::bad_alloc, ::operator new, ::operator delete
+#include <type_traits> // std::is_convertible, std::true_type
+#include <utility>     // std::declval
+
+#if defined(_WIN32)
+# include <malloc.h> // _msize, _aligned_msize, _aligned_malloc
+#elif defined(__APPLE__)
+# include <malloc/malloc.h> // malloc_size
+#elif defined(__linux__) || defined(__FreeBSD__)
+# include <malloc.h> // malloc_usable_size
+#endif
+
+namespace bit {
+  namespace stl {
+
+    //=========================================================================
+    // allocation_result
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The result of allocate_at_least: the storage, and the number
+    ///        of objects it can actually hold
+    ///
+    /// \tparam Pointer the pointer type of the allocator
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Pointer>
+    struct allocation_result
+    {
+      Pointer     ptr;   ///< Pointer to the start of the storage
+      std::size_t count; ///< The number of objects the storage can hold
+    };
+
+    /// \brief Allocates storage for at least \p n objects from \p alloc
+    ///
+    /// If \p alloc provides an \c allocate_at_least member, the storage may
+    /// be larger than requested; the returned \c count must then be passed
+    /// back to \c deallocate. Otherwise this is \c allocate(n)
+    ///
+    /// \param alloc the allocator
+    /// \param n the minimum number of objects
+    /// \return the allocated storage and its capacity
+    template<typename Allocator>
+    allocation_result<typename std::allocator_traits<Allocator>::pointer>
+      allocate_at_least( Allocator& alloc, std::size_t n );
+
+    //=========================================================================
+    // is_size_feedback_allocator
+    //=========================================================================
+
+    /// \brief Type-trait to determine if \c T models SizeFeedbackAllocator
+    ///
+    /// A SizeFeedbackAllocator allocates raw bytes with
+    /// \c allocate(size,align), returning a \c fat_ptr<void> whose size is
+    /// the usable size of the allocation (which may exceed \c size), and
+    /// releases them with \c deallocate(fat_ptr<void>)
+    ///
+    /// The result is aliased as \c ::value
+    template<typename T, typename = void>
+    struct is_size_feedback_allocator : false_type{};
+
+    template<typename T>
+    struct is_size_feedback_allocator<T,void_t<
+      decltype(std::declval<T&>().deallocate( std::declval<fat_ptr<void>>() )),
+      std::enable_if_t<std::is_convertible<
+        decltype(std::declval<T&>().allocate( std::size_t{}, std::size_t{} )),
+        fat_ptr<void>
+      >::value>
+    >> : true_type{};
+
+    /// \brief Helper utility to extract is_size_feedback_allocator::value
+    template<typename T>
+    constexpr bool is_size_feedback_allocator_v = is_size_feedback_allocator<T>::value;
+
+    //=========================================================================
+    // malloc_allocator
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A SizeFeedbackAllocator over the C allocator
+    ///
+    /// The size reported for each allocation is the usable size of the
+    /// block (e.g. \c malloc_usable_size), so a request for 100 bytes that
+    /// lands in a 112-byte size class reports all 112 bytes.
+    ///////////////////////////////////////////////////////////////////////////
+    class malloc_allocator
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using is_always_equal = std::true_type;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates at least \p size bytes aligned to \p align
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param size the minimum number of bytes
+      /// \param align the alignment; a power of two
+      /// \return the allocation and its usable size
+      fat_ptr<void> allocate( std::size_t size,
+                              std::size_t align = alignof(std::max_align_t) );
+
+      /// \brief Deallocates storage previously returned by \c allocate
+      ///
+      /// \param p the allocation to release
+      void deallocate( fat_ptr<void> p ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      static std::size_t usable_size( void* p, std::size_t size, std::size_t align ) noexcept;
+    };
+
+    constexpr bool operator==( const malloc_allocator&, const malloc_allocator& ) noexcept;
+    constexpr bool operator!=( const malloc_allocator&, const malloc_allocator& ) noexcept;
+
+    //=========================================================================
+    // new_delete_allocator
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A SizeFeedbackAllocator over the global operator new
+    ///
+    /// The usable size of \c ::operator new storage cannot be queried, so
+    /// the reported size is always the requested size. In exchange, the
+    /// size is handed back to the sized \c ::operator delete, which lets
+    /// allocators skip the size-class lookup on release.
+    ///////////////////////////////////////////////////////////////////////////
+    class new_delete_allocator
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using is_always_equal = std::true_type;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates \p size bytes aligned to \p align
+      ///
+      /// \note \p align must not exceed \c alignof(std::max_align_t)
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param size the number of bytes
+      /// \param align the alignment
+      /// \return the allocation and its size
+      fat_ptr<void> allocate( std::size_t size,
+                              std::size_t align = alignof(std::max_align_t) );
+
+      /// \brief Deallocates storage previously returned by \c allocate
+      ///
+      /// \param p the allocation to release
+      void deallocate( fat_ptr<void> p ) noexcept;
+    };
+
+    constexpr bool operator==( const new_delete_allocator&, const new_delete_allocator& ) noexcept;
+    constexpr bool operator!=( const new_delete_allocator&, const new_delete_allocator& ) noexcept;
+
+    //=========================================================================
+    // feedback_allocator
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A standard allocator that allocates from a
+    ///        SizeFeedbackAllocator and exposes the extra usable space
+    ///        through \c allocate_at_least
+    ///
+    /// Containers that grow (such as circular_deque with the
+    /// circular_growth_policy) use \c allocate_at_least to adopt the whole
+    /// block as capacity, deferring their next reallocation.
+    ///
+    /// \tparam T the type to allocate
+    /// \tparam SizeFeedbackAllocator the underlying byte allocator
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, typename SizeFeedbackAllocator = malloc_allocator>
+    class feedback_allocator
+    {
+      static_assert( is_size_feedback_allocator<SizeFeedbackAllocator>::value,
+                     "feedback_allocator: SizeFeedbackAllocator must model "
+                     "the SizeFeedbackAllocator concept" );
+
+      template<typename, typename> friend class feedback_allocator;
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      using underlying_allocator_type = SizeFeedbackAllocator;
+
+      template<typename U>
+      struct rebind{ using other = feedback_allocator<U,SizeFeedbackAllocator>; };
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a feedback_allocator with a default-constructed
+      ///        underlying allocator
+      feedback_allocator() = default;
+
+      /// \brief Constructs a feedback_allocator that allocates from \p alloc
+      ///
+      /// \param alloc the underlying allocator
+      explicit feedback_allocator( const SizeFeedbackAllocator& alloc );
+
+      template<typename U>
+      feedback_allocator( const feedback_allocator<U,SizeFeedbackAllocator>& other );
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates storage for \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      T* allocate( size_type n );
+
+      /// \brief Allocates storage for at least \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the minimum number of objects
+      /// \return the storage, and the number of objects that fit in it
+      allocation_result<T*> allocate_at_least( size_type n );
+
+      /// \brief Deallocates storage previously allocated with \c allocate
+      ///        or \c allocate_at_least
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects requested from \c allocate, or
+      ///          the count returned by \c allocate_at_least
+      void deallocate( T* p, size_type n ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the underlying SizeFeedbackAllocator
+      ///
+      /// \return the underlying allocator
+      const SizeFeedbackAllocator& underlying_allocator() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      SizeFeedbackAllocator m_allocator;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U, typename SizeFeedbackAllocator>
+    bool operator==( const feedback_allocator<T,SizeFeedbackAllocator>& lhs,
+                     const feedback_allocator<U,SizeFeedbackAllocator>& rhs ) noexcept;
+    template<typename T, typename U, typename SizeFeedbackAllocator>
+    bool operator!=( const feedback_allocator<T,SizeFeedbackAllocator>& lhs,
+                     const feedback_allocator<U,SizeFeedbackAllocator>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/feedback_allocator.inl"
+
+#endif /* BIT_STL_MEMORY_FEEDBACK_ALLOCATOR_HPP */
@@ -0,0 +1,339 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains hazard pointers, a memory reclamation scheme
+ *        for lock-free structures with a bounded number of unreclaimed
+ *        objects
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_HAZARD_PTR_HPP
+#define BIT_STL_MEMORY_HAZARD_PTR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/asymmetric_fence.hpp" // detail::asymmetric_light_fence
+#include "detail/retired_object.hpp"   // detail::retired_object
+#include "observer_ptr.hpp"            // observer_ptr
+#include "../utilities/assert.hpp"     // BIT_ASSERT
+
+#include <algorithm>   // std::max, std::sort, std::binary_search
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::nullptr_t
+#include <memory>      // std::default_delete
+#include <mutex>       // std::mutex
+#include <type_traits> // std::enable_if_t, std::is_convertible
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A single hazard slot
+      ///
+      /// Records are never unlinked while the domain lives; a record is
+      /// reused by the next hazard_ptr after its owner releases it.
+      ////////////////////////////////////////////////////////////////////////
+      struct hazard_record
+      {
+        std::atomic<const void*> pointer{nullptr};
+        std::atomic<bool>        in_use{true};
+        hazard_record*           next = nullptr;
+      };
+
+    } // namespace detail
+
+    template<typename T> class hazard_ptr;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A domain of hazard-pointer memory reclamation
+    ///
+    /// Readers publish the pointer they are about to dereference in a
+    /// hazard slot through a hazard_ptr. Objects removed from a structure
+    /// are retired to the domain, and destroyed by a scan once no slot
+    /// holds their address.
+    ///
+    /// Unlike epoch_domain, a descheduled reader only keeps the objects it
+    /// protects alive: at most <tt>scan threshold + hazard count</tt>
+    /// objects are left unreclaimed after a scan. A scan is run once the
+    /// number of retired objects reaches the larger of the scan threshold
+    /// and twice the number of hazard slots, so its cost is amortized
+    /// over the retirements that triggered it.
+    ///
+    /// On Linux the fence that orders publishing a hazard before
+    /// re-validating it is replaced by a process-wide membarrier(2) issued
+    /// by the scan.
+    //////////////////////////////////////////////////////////////////////////
+    class hazard_domain
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a hazard_domain
+      ///
+      /// \param scan_threshold the minimum number of retired objects that
+      ///        triggers a scan
+      explicit hazard_domain( size_type scan_threshold = 64 );
+
+      hazard_domain( const hazard_domain& ) = delete;
+      hazard_domain( hazard_domain&& ) = delete;
+
+      /// \brief Destroys every object still retired in this domain
+      ///
+      /// \pre no hazard_ptr refers to this domain
+      ~hazard_domain();
+
+      //----------------------------------------------------------------------
+
+      hazard_domain& operator=( const hazard_domain& ) = delete;
+      hazard_domain& operator=( hazard_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Reclamation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Retires \p ptr, destroying it with \p deleter once no
+      ///        hazard_ptr protects it
+      ///
+      /// \p ptr must already be unreachable for readers that protect after
+      /// this call. Hazards are matched by address, so \p ptr must be the
+      /// same pointer value that readers protect: the value stored in the
+      /// atomic they load from, not a pointer to one of its bases. If this
+      /// throws, \p ptr is not retired.
+      ///
+      /// \param ptr the pointer to retire
+      /// \param deleter the deleter to destroy \p ptr with
+      template<typename T, typename Deleter = std::default_delete<T>>
+      void retire( T* ptr, Deleter deleter = Deleter{} );
+
+      /// \brief Scans the hazard slots and destroys every retired object
+      ///        that is not protected
+      ///
+      /// \return the number of objects destroyed
+      size_type reclaim();
+
+      /// \brief Gets the number of retired objects not yet destroyed
+      size_type pending() const;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      detail::hazard_record* acquire_record();
+
+      void release_record( detail::hazard_record& record ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<detail::hazard_record*> m_records;
+      std::atomic<size_type>              m_record_count;
+      size_type                           m_scan_threshold;
+      bool                                m_asymmetric;
+
+      mutable std::mutex                  m_mutex; ///< Guards m_retired
+      std::vector<detail::retired_object> m_retired;
+
+      template<typename> friend class hazard_ptr;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An owning hazard slot that protects one pointer at a time
+    ///
+    /// A hazard_ptr is cheap to keep alive for the lifetime of a reader;
+    /// acquiring one scans the domain's slots. While it protects a pointer,
+    /// that object is not destroyed by its domain. The protected pointer
+    /// can be handed to code that only observes it as an observer_ptr.
+    ///
+    /// A hazard_ptr must only be used by one thread at a time, and must
+    /// not outlive its domain.
+    ///
+    /// \tparam T the type of the protected object
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class hazard_ptr
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using element_type = T;
+      using pointer      = T*;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Acquires a hazard slot from \p domain
+      ///
+      /// \param domain the domain to protect objects from
+      explicit hazard_ptr( hazard_domain& domain );
+
+      /// \brief Move-constructs a hazard_ptr, taking over the slot and
+      ///        protection of \p other
+      ///
+      /// \param other the other hazard_ptr to move
+      hazard_ptr( hazard_ptr&& other ) noexcept;
+      hazard_ptr( const hazard_ptr& ) = delete;
+
+      /// \brief Releases the hazard slot
+      ~hazard_ptr();
+
+      //----------------------------------------------------------------------
+
+      /// \brief Move-assigns a hazard_ptr, releasing this slot
+      ///
+      /// \param other the other hazard_ptr to move
+      /// \return reference to \c (*this)
+      hazard_ptr& operator=( hazard_ptr&& other ) noexcept;
+      hazard_ptr& operator=( const hazard_ptr& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Protection
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Protects the pointer currently held in \p source
+      ///
+      /// The returned pointer stays valid until this hazard_ptr is reset
+      /// or protects another pointer, even if \p source changes.
+      ///
+      /// The slot publishes the \c U* loaded from \p source, before any
+      /// conversion to \c T*, so that it matches the pointer that is later
+      /// retired.
+      ///
+      /// \param source the atomic pointer to load from
+      /// \return the protected pointer
+      template<typename U,
+               typename = std::enable_if_t<std::is_convertible<U*,T*>::value>>
+      T* protect( const std::atomic<U*>& source ) noexcept;
+
+      /// \brief Attempts to protect \p ptr, which was loaded from \p source
+      ///
+      /// As with \c protect, the slot publishes the \c U* itself.
+      ///
+      /// \param ptr the pointer to protect; updated with the current value
+      ///        of \p source on failure
+      /// \param source the atomic pointer \p ptr was loaded from
+      /// \return \c true if \p ptr is protected
+      template<typename U,
+               typename = std::enable_if_t<std::is_convertible<U*,T*>::value>>
+      bool try_protect( U*& ptr, const std::atomic<U*>& source ) noexcept;
+
+      /// \brief Publishes \p ptr without validating it
+      ///
+      /// The caller must guarantee that \p ptr cannot have been retired
+      /// before this call, for example because it is already protected.
+      /// The slot publishes \p ptr itself, so it only matches a retired
+      /// pointer of the same address.
+      ///
+      /// \param ptr the pointer to protect
+      void reset( T* ptr ) noexcept;
+
+      /// \brief Stops protecting the current pointer
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the protected pointer
+      T* get() const noexcept;
+
+      /// \brief Gets the protected pointer as an observer_ptr
+      observer_ptr<T> observe() const noexcept;
+
+      /// \brief Dereferences the protected pointer
+      ///
+      /// \pre \c get() is not \c nullptr
+      T& operator*() const noexcept;
+
+      /// \brief Accesses a member of the protected object
+      ///
+      /// \pre \c get() is not \c nullptr
+      T* operator->() const noexcept;
+
+      /// \brief Checks whether a pointer is protected
+      explicit operator bool() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      void publish( const void* ptr ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      hazard_domain*         m_domain;
+      detail::hazard_record* m_record;
+      T*                     m_ptr;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparison
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    bool operator==( const hazard_ptr<T>& lhs, std::nullptr_t ) noexcept;
+    template<typename T>
+    bool operator==( std::nullptr_t, const hazard_ptr<T>& rhs ) noexcept;
+    template<typename T>
+    bool operator!=( const hazard_ptr<T>& lhs, std::nullptr_t ) noexcept;
+    template<typename T>
+    bool operator!=( std::nullptr_t, const hazard_ptr<T>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/hazard_ptr.inl"
+
+#endif /* BIT_STL_MEMORY_HAZARD_PTR_HPP */
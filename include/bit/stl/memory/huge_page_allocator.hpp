@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a standard allocator for large buffers that
+ *        are backed by transparent huge pages where available
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+#define BIT_STL_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "memory.hpp" // align_up
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <limits>      // std::numeric_limits
+#include <new>         // std::bad_alloc, operator new
+#include <type_traits> // std::true_type
+
+#if defined(__linux__)
+# include <sys/mman.h> // ::mmap, ::munmap, ::madvise
+#endif
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// \{
+      /// \brief Maps and unmaps \p size bytes aligned to a huge page
+      ///
+      /// \p size must be a multiple of the huge page size
+      void* huge_page_map( std::size_t size );
+      void huge_page_unmap( void* p, std::size_t size ) noexcept;
+      /// \}
+
+    } // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A stateless standard allocator for large, long-lived buffers
+    ///
+    /// Allocations of at least \c huge_page_size bytes are mapped directly
+    /// from the operating system, aligned to a huge page and rounded up to
+    /// a whole number of them. On Linux the mapping is advised to use
+    /// transparent huge pages, so a large hash table or ring buffer needs
+    /// far fewer TLB entries. If huge pages are disabled the mapping is
+    /// backed by regular pages instead.
+    ///
+    /// Smaller allocations, and every allocation on other platforms, are
+    /// forwarded to the global \c operator new.
+    ///
+    /// \tparam T the type to allocate
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class huge_page_allocator
+    {
+      static_assert( alignof(T) <= alignof(std::max_align_t),
+                     "huge_page_allocator: over-aligned types are not supported" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      using propagate_on_container_move_assignment = std::true_type;
+      using is_always_equal = std::true_type;
+
+      template<typename U>
+      struct rebind{ using other = huge_page_allocator<U>; };
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// The size of a huge page, and the smallest mapped allocation
+      static constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      huge_page_allocator() noexcept = default;
+
+      template<typename U>
+      huge_page_allocator( const huge_page_allocator<U>& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates storage for \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      T* allocate( size_type n );
+
+      /// \brief Deallocates storage previously allocated with \c allocate
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects
+      void deallocate( T* p, size_type n ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U>
+    constexpr bool operator==( const huge_page_allocator<T>& lhs,
+                               const huge_page_allocator<U>& rhs ) noexcept;
+    template<typename T, typename U>
+    constexpr bool operator!=( const huge_page_allocator<T>& lhs,
+                               const huge_page_allocator<U>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/huge_page_allocator.inl"
+
+#endif /* BIT_STL_MEMORY_HUGE_PAGE_ALLOCATOR_HPP */
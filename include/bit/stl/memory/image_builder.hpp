@@ -0,0 +1,261 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a builder for position-independent memory
+ *        images, which may be written to a file and mapped at any address
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_IMAGE_BUILDER_HPP
+#define BIT_STL_MEMORY_IMAGE_BUILDER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../traits/composition/bool_constant.hpp" // true_type, false_type
+#include "../traits/composition/void_t.hpp"        // void_t
+#include "../utilities/assert.hpp"                 // BIT_ASSERT
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <cstdint>     // std::uint64_t
+#include <new>         // placement new
+#include <type_traits> // std::is_trivially_destructible
+#include <utility>     // std::pair, std::forward, std::declval
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace stl {
+
+    //=========================================================================
+    // image_offset<T>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A typed byte offset of an object within an image_builder
+    ///
+    /// Unlike a pointer, an image_offset remains valid while the builder
+    /// grows.
+    ///
+    /// \tparam T the type of the object at the offset
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class image_offset
+    {
+      //-----------------------------------------------------------------------
+      // Constructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an image_offset to the byte \p offset
+      ///
+      /// \param offset the byte offset from the start of the image
+      constexpr explicit image_offset( std::size_t offset ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the byte offset from the start of the image
+      ///
+      /// \return the byte offset
+      constexpr std::size_t offset() const noexcept;
+
+      /// \brief Gets the offset of the \p n'th object of an array starting
+      ///        at this offset
+      ///
+      /// \param n the index of the object
+      /// \return the offset of the object
+      constexpr image_offset operator[]( std::size_t n ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::size_t m_offset;
+    };
+
+    //=========================================================================
+    // image_builder
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Builds a position-independent image of objects in one
+    ///        contiguous buffer
+    ///
+    /// Objects in the image refer to one another through offset_ptr, so the
+    /// finished bytes may be written to a file and later mapped read-only
+    /// at any address, with no deserialization step. Containers such as
+    /// offset_vector, offset_string and offset_hash_map provide a static
+    /// \c build function that populates them inside a builder.
+    ///
+    /// Growing the buffer relocates it, which invalidates pointers returned
+    /// by \c get, but not image_offsets. Objects must be trivially
+    /// destructible, since the image is never destroyed object-by-object.
+    ///
+    /// \note The image layout is that of the building platform; it must be
+    ///       mapped by a process with the same ABI
+    ///////////////////////////////////////////////////////////////////////////
+    class image_builder
+    {
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an image_builder containing only the image header
+      image_builder();
+
+      image_builder( image_builder&& other ) = default;
+      image_builder( const image_builder& other ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      image_builder& operator=( image_builder&& other ) = default;
+      image_builder& operator=( const image_builder& other ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a T in the image from \p args
+      ///
+      /// \param args the arguments to forward to T's constructor
+      /// \return the offset of the new object
+      template<typename T, typename...Args>
+      image_offset<T> emplace( Args&&...args );
+
+      /// \brief Default-constructs an array of \p n T in the image
+      ///
+      /// \param n the number of objects
+      /// \return the offset of the first object
+      template<typename T>
+      image_offset<T> allocate( std::size_t n );
+
+      /// \brief Assigns \p source to the object at \p target
+      ///
+      /// If T provides a static \c build(image_builder&,image_offset<T>,source)
+      /// function, it is used, allowing nested containers to be populated.
+      /// \c std::pair objects are assigned member-wise. Otherwise, the
+      /// object is assigned directly
+      ///
+      /// \param target the object to assign to
+      /// \param source the value to assign
+      template<typename T, typename Source>
+      void assign( image_offset<T> target, const Source& source );
+
+      /// \brief Marks \p root as the object returned by image_root
+      ///
+      /// \param root the root object
+      template<typename T>
+      void set_root( image_offset<T> root ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets a pointer to the object at \p offset
+      ///
+      /// \note The pointer is invalidated by the next allocation
+      ///
+      /// \param offset the offset of the object
+      /// \return pointer to the object
+      template<typename T>
+      T* get( image_offset<T> offset ) noexcept;
+
+      /// \brief Gets the offset of an object in the image from a pointer
+      ///        to it
+      ///
+      /// This is used to name members of objects in the image
+      ///
+      /// \param p pointer to an object in the image
+      /// \return the offset of the object
+      template<typename T>
+      image_offset<T> offset_of( const T* p ) const noexcept;
+
+      /// \brief Gets the bytes of the image
+      ///
+      /// \return pointer to the start of the image
+      const void* data() const noexcept;
+
+      /// \brief Gets the size of the image in bytes
+      ///
+      /// \return the size of the image
+      std::size_t size() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Reserves \p bytes aligned to \p align at the end of the
+      ///        image
+      ///
+      /// \return the byte offset of the reserved space
+      std::size_t reserve( std::size_t bytes, std::size_t align );
+
+      template<typename T, typename Source>
+      void assign( image_offset<T> target, const Source& source, true_type );
+      template<typename T, typename Source>
+      void assign( image_offset<T> target, const Source& source, false_type );
+      template<typename T, typename U, typename Source>
+      void assign( image_offset<std::pair<T,U>> target, const Source& source, false_type );
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::vector<std::max_align_t> m_buffer;
+      std::size_t m_size;
+    };
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Gets the root object of an image built by image_builder
+    ///
+    /// \param data pointer to the start of the image; must be aligned to
+    ///             \c alignof(std::max_align_t)
+    /// \param size the size of the image in bytes
+    /// \return pointer to the root object, or \c nullptr if \p data does
+    ///         not contain a valid image with a root
+    template<typename T>
+    const T* image_root( const void* data, std::size_t size ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/image_builder.inl"
+
+#endif /* BIT_STL_MEMORY_IMAGE_BUILDER_HPP */
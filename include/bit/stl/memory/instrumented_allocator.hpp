@@ -0,0 +1,423 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an allocator adaptor that attributes
+ *        allocations to named trackers, for finding where memory churn
+ *        comes from
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_INSTRUMENTED_ALLOCATOR_HPP
+#define BIT_STL_MEMORY_INSTRUMENTED_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/compressed_pair.hpp" // compressed_pair
+
+#include <array>       // std::array
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <memory>      // std::allocator_traits
+#include <mutex>       // std::mutex, std::lock_guard
+#include <tuple>       // std::forward_as_tuple
+#include <type_traits> // std::true_type, std::false_type
+#include <utility>     // std::forward, std::piecewise_construct
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace stl {
+
+    //=========================================================================
+    // allocation_statistics
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A snapshot of the allocations attributed to one tracker
+    ///
+    /// Counters are gathered without stopping other threads, so a snapshot
+    /// taken while allocations are in flight may be slightly inconsistent.
+    ///////////////////////////////////////////////////////////////////////////
+    struct allocation_statistics
+    {
+      /// The number of histogram buckets. Bucket 0 counts allocations of up
+      /// to 16 bytes, and each following bucket doubles the limit; the last
+      /// bucket counts everything larger.
+      static constexpr std::size_t histogram_size = 16;
+
+      const char* name = nullptr;
+
+      std::size_t allocations       = 0;
+      std::size_t deallocations     = 0;
+      std::size_t live_allocations  = 0;
+      std::size_t bytes_allocated   = 0;
+      std::size_t bytes_deallocated = 0;
+      std::size_t live_bytes        = 0;
+      std::size_t peak_bytes        = 0;
+
+      std::array<std::size_t,histogram_size> histogram = {};
+    };
+
+    //=========================================================================
+    // allocation_tracker
+    //=========================================================================
+
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The counters updated by the threads sharing one shard
+      ///
+      /// Shards are cache-line aligned, so that the shards of different
+      /// threads never share a line
+      ////////////////////////////////////////////////////////////////////////
+      struct alignas(64) allocation_shard
+      {
+        std::atomic<std::size_t> allocations{0};
+        std::atomic<std::size_t> deallocations{0};
+        std::atomic<std::size_t> bytes_allocated{0};
+        std::atomic<std::size_t> bytes_deallocated{0};
+
+        std::atomic<std::size_t> histogram[allocation_statistics::histogram_size];
+
+        allocation_shard() noexcept;
+      };
+
+    } // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A named tag that allocations are attributed to
+    ///
+    /// Every tracker registers itself for the duration of its lifetime, so
+    /// that all trackers can be reported with \c snapshot_all.
+    ///
+    /// Counters are split across shards, and each thread only updates its
+    /// own shard, so recording an allocation is a handful of uncontended
+    /// relaxed atomic additions. Only the live-byte count used for the peak
+    /// is shared between threads.
+    ///////////////////////////////////////////////////////////////////////////
+    class allocation_tracker
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs and registers a tracker named \p name
+      ///
+      /// \param name the name to report; must outlive the tracker
+      explicit allocation_tracker( const char* name );
+
+      allocation_tracker( const allocation_tracker& ) = delete;
+      allocation_tracker( allocation_tracker&& ) = delete;
+
+      /// \brief Unregisters this tracker
+      ~allocation_tracker();
+
+      //----------------------------------------------------------------------
+
+      allocation_tracker& operator=( const allocation_tracker& ) = delete;
+      allocation_tracker& operator=( allocation_tracker&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Recording
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Records an allocation of \p bytes bytes
+      ///
+      /// \param bytes the size of the allocation
+      void record_allocation( std::size_t bytes ) noexcept;
+
+      /// \brief Records a deallocation of \p bytes bytes
+      ///
+      /// The live-byte count saturates at zero rather than wrapping if more
+      /// is deallocated than was recorded as allocated
+      ///
+      /// \param bytes the size of the deallocation
+      void record_deallocation( std::size_t bytes ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the name of this tracker
+      const char* name() const noexcept;
+
+      /// \brief Gathers the statistics recorded so far
+      allocation_statistics snapshot() const noexcept;
+
+      /// \brief Gathers the statistics of every registered tracker
+      static std::vector<allocation_statistics> snapshot_all();
+
+      /// \brief Gets the histogram bucket that an allocation of \p bytes
+      ///        bytes is counted in
+      ///
+      /// \param bytes the size of the allocation
+      /// \return the bucket index
+      static std::size_t histogram_bucket( std::size_t bytes ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Scopes
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the tracker for allocations that are not otherwise
+      ///        attributed
+      static allocation_tracker& global();
+
+      /// \brief Gets the tracker of the innermost allocation_scope on this
+      ///        thread, or \c global() if there is none
+      static allocation_tracker& current();
+
+      //----------------------------------------------------------------------
+      // Private Static Members
+      //----------------------------------------------------------------------
+    private:
+
+      static constexpr std::size_t shard_count = 8;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      detail::allocation_shard& local_shard() noexcept;
+
+      static allocation_tracker*& current_pointer() noexcept;
+
+      static std::mutex& registry_mutex() noexcept;
+      static allocation_tracker*& registry_head() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      detail::allocation_shard m_shards[shard_count];
+      std::atomic<std::size_t> m_live_bytes;
+      std::atomic<std::size_t> m_peak_bytes;
+      const char*              m_name;
+
+      // Registry links, guarded by registry_mutex()
+      allocation_tracker*      m_previous;
+      allocation_tracker*      m_next;
+
+      friend class allocation_scope;
+    };
+
+    //=========================================================================
+    // allocation_scope
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Attributes the allocations of default-constructed
+    ///        instrumented_allocators to a tracker for the duration of a
+    ///        scope on the current thread
+    ///
+    /// Scopes nest; the innermost one wins.
+    ///////////////////////////////////////////////////////////////////////////
+    class allocation_scope
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Makes \p tracker the current tracker on this thread
+      ///
+      /// \param tracker the tracker to attribute allocations to
+      explicit allocation_scope( allocation_tracker& tracker ) noexcept;
+
+      allocation_scope( const allocation_scope& ) = delete;
+      allocation_scope( allocation_scope&& ) = delete;
+
+      /// \brief Restores the previously current tracker
+      ~allocation_scope();
+
+      //----------------------------------------------------------------------
+
+      allocation_scope& operator=( const allocation_scope& ) = delete;
+      allocation_scope& operator=( allocation_scope&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      allocation_tracker* m_previous;
+    };
+
+    //=========================================================================
+    // instrumented_allocator
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An allocator adaptor that records every allocation made
+    ///        through \p Allocator in an allocation_tracker
+    ///
+    /// The adaptor is usable anywhere the underlying allocator is, and
+    /// rebinds to an instrumented allocator of the rebound underlying
+    /// allocator with the same tracker. This lets control blocks, such as
+    /// those of allocate_exclusive, be attributed to the same tracker.
+    ///
+    /// Instrumented allocators compare equal only if they share a tracker
+    /// and their underlying allocators compare equal, and the allocator
+    /// always propagates with the container's contents. Memory is therefore
+    /// always deallocated through the tracker that recorded its allocation.
+    ///
+    /// \tparam Allocator the allocator to instrument
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Allocator>
+    class instrumented_allocator
+    {
+      using alloc_traits = std::allocator_traits<Allocator>;
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using underlying_allocator_type = Allocator;
+
+      using value_type         = typename alloc_traits::value_type;
+      using pointer            = typename alloc_traits::pointer;
+      using const_pointer      = typename alloc_traits::const_pointer;
+      using void_pointer       = typename alloc_traits::void_pointer;
+      using const_void_pointer = typename alloc_traits::const_void_pointer;
+      using size_type          = typename alloc_traits::size_type;
+      using difference_type    = typename alloc_traits::difference_type;
+
+      // Containers exchange memory only together with its tracker
+      using propagate_on_container_copy_assignment = std::true_type;
+      using propagate_on_container_move_assignment = std::true_type;
+      using propagate_on_container_swap = std::true_type;
+      using is_always_equal = std::false_type;
+
+      template<typename U>
+      struct rebind
+      {
+        using other = instrumented_allocator<typename alloc_traits::template rebind_alloc<U>>;
+      };
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an instrumented_allocator that records to the
+      ///        current tracker, as set by allocation_scope
+      instrumented_allocator();
+
+      /// \brief Constructs an instrumented_allocator that records to
+      ///        \p tracker
+      ///
+      /// \param tracker the tracker to record allocations to
+      /// \param alloc the underlying allocator
+      explicit instrumented_allocator( allocation_tracker& tracker,
+                                       const Allocator& alloc = Allocator() );
+
+      /// \brief Converts an instrumented_allocator of a rebound allocator,
+      ///        keeping its tracker
+      ///
+      /// \param other the other allocator
+      template<typename U>
+      instrumented_allocator( const instrumented_allocator<U>& other );
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates storage for \p n objects from the underlying
+      ///        allocator, and records it
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      pointer allocate( size_type n );
+
+      /// \brief Deallocates storage through the underlying allocator, and
+      ///        records it
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects
+      void deallocate( pointer p, size_type n ) noexcept;
+
+      /// \brief Constructs an object through the underlying allocator
+      ///
+      /// \param p the location to construct at
+      /// \param args the arguments to forward to the constructor
+      template<typename U, typename...Args>
+      void construct( U* p, Args&&...args );
+
+      /// \brief Destroys an object through the underlying allocator
+      ///
+      /// \param p the object to destroy
+      template<typename U>
+      void destroy( U* p );
+
+      /// \brief Gets the allocator to use for a copy of a container
+      instrumented_allocator select_on_container_copy_construction() const;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the tracker that allocations are recorded to
+      allocation_tracker& tracker() const noexcept;
+
+      /// \brief Gets the underlying allocator
+      const Allocator& underlying_allocator() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      compressed_pair<Allocator,allocation_tracker*> m_storage;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename A1, typename A2>
+    bool operator==( const instrumented_allocator<A1>& lhs,
+                     const instrumented_allocator<A2>& rhs ) noexcept;
+    template<typename A1, typename A2>
+    bool operator!=( const instrumented_allocator<A1>& lhs,
+                     const instrumented_allocator<A2>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/instrumented_allocator.inl"
+
+#endif /* BIT_STL_MEMORY_INSTRUMENTED_ALLOCATOR_HPP */
@@ -0,0 +1,579 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an intrusive reference-counted smart pointer,
+ *        along with the counting policies it supports
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_INTRUSIVE_PTR_HPP
+#define BIT_STL_MEMORY_INTRUSIVE_PTR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/hash.hpp" // hash_t
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::nullptr_t
+#include <cstdint>     // std::int64_t, std::uintptr_t
+#include <functional>  // std::less
+#include <mutex>       // std::mutex
+#include <new>         // std::nothrow
+#include <type_traits> // std::enable_if_t, std::is_convertible, std::common_type_t
+#include <utility>     // std::forward
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// \brief A type-erased call that destroys a reference-counted object
+      struct intrusive_disposer
+      {
+        void (*dispose)( const void* );
+        const void* object;
+
+        void operator()() const noexcept;
+      };
+
+      class biased_owner;
+
+    } // namespace detail
+
+    //=========================================================================
+    // X.Y.1 : count policies
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A count policy using plain integer arithmetic
+    ///
+    /// This is the cheapest policy, but objects using it must never be
+    /// shared between threads.
+    ///////////////////////////////////////////////////////////////////////////
+    struct nonatomic_count_policy
+    {
+      using counter_type = std::size_t;
+
+      static void increment( counter_type& count ) noexcept;
+
+      /// \brief Decrements \p count
+      ///
+      /// \return \c true if the object should be disposed
+      static bool decrement( counter_type& count,
+                             const detail::intrusive_disposer& disposer ) noexcept;
+
+      static std::size_t use_count( const counter_type& count ) noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A count policy using atomic read-modify-write operations
+    ///
+    /// This is the same scheme as std::shared_ptr, and is safe to share
+    /// between any number of threads.
+    ///////////////////////////////////////////////////////////////////////////
+    struct atomic_count_policy
+    {
+      using counter_type = std::atomic<std::size_t>;
+
+      static void increment( counter_type& count ) noexcept;
+
+      static bool decrement( counter_type& count,
+                             const detail::intrusive_disposer& disposer ) noexcept;
+
+      static std::size_t use_count( const counter_type& count ) noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A count policy that biases the count towards the thread that
+    ///        created the object
+    ///
+    /// This implements biased reference counting. Each object is owned by
+    /// the thread that constructed it, and that thread adjusts a private
+    /// count with plain loads and stores. Every other thread adjusts a
+    /// separate atomic count.
+    ///
+    /// When the owner's count reaches zero the two counts are merged, and
+    /// from then on the object behaves as if atomically counted.
+    ///
+    /// If another thread releases the last reference it knows of while the
+    /// owner still holds a biased count, the object is queued with its
+    /// owner. The owner merges the queue:
+    /// - when it next releases a reference;
+    /// - when collect() is called;
+    /// - when the thread exits.
+    ///
+    /// Objects queued with a thread that has already exited are merged
+    /// immediately by the releasing thread.
+    ///
+    /// This suits objects that are mostly used by the thread that made them
+    /// but are occasionally shared. The counter is larger than the other
+    /// policies', and use_count() is only exact on the owning thread.
+    ///////////////////////////////////////////////////////////////////////////
+    struct biased_count_policy
+    {
+      class counter_type
+      {
+      public:
+
+        counter_type() noexcept;
+        counter_type( const counter_type& ) = delete;
+        ~counter_type();
+
+        counter_type& operator=( const counter_type& ) = delete;
+
+      private:
+
+        detail::biased_owner*     m_owner;
+        std::size_t               m_biased;  ///< Owner-only count
+        bool                      m_merged;  ///< Owner-only merge state
+        std::atomic<std::int64_t> m_shared;  ///< Count * 4 | queued | merged
+        counter_type*             m_next;    ///< Link in the owner's queue
+        detail::intrusive_disposer m_disposer;
+
+        friend struct biased_count_policy;
+        friend class detail::biased_owner;
+      };
+
+      static void increment( counter_type& count ) noexcept;
+
+      static bool decrement( counter_type& count,
+                             const detail::intrusive_disposer& disposer ) noexcept;
+
+      static std::size_t use_count( const counter_type& count ) noexcept;
+
+      /// \brief Merges every object queued with the calling thread,
+      ///        disposing any whose count has reached zero
+      static void collect() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Static Members
+      //-----------------------------------------------------------------------
+    private:
+
+      static constexpr std::int64_t merged_flag = 1;
+      static constexpr std::int64_t queued_flag = 2;
+      static constexpr std::int64_t count_unit  = 4;
+
+      static std::int64_t shared_count( std::int64_t value ) noexcept;
+
+      static bool is_owner( const counter_type& count ) noexcept;
+
+      /// \brief Folds the biased count into the shared count
+      ///
+      /// \return \c true if the object should be disposed
+      static bool merge( counter_type& count ) noexcept;
+
+      friend class detail::biased_owner;
+    };
+
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Per-thread state for biased_count_policy
+      ///
+      /// This is reference counted by every counter biased towards it, so
+      /// that other threads may still queue with it after its thread exits
+      ////////////////////////////////////////////////////////////////////////
+      class biased_owner
+      {
+        using counter_type = biased_count_policy::counter_type;
+
+        //--------------------------------------------------------------------
+        // Static Functions
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Gets the owner for the calling thread, creating it if
+        ///        necessary
+        ///
+        /// \return the owner, or \c nullptr if the thread is exiting
+        static biased_owner* current() noexcept;
+
+        /// \brief Gets the owner for the calling thread, if it has one
+        static biased_owner* current_if_any() noexcept;
+
+        //--------------------------------------------------------------------
+        // Reference Counting
+        //--------------------------------------------------------------------
+      public:
+
+        void acquire() noexcept;
+
+        void release() noexcept;
+
+        //--------------------------------------------------------------------
+        // Queueing
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Queues \p count for merging by the owning thread
+        ///
+        /// \return \c false if the owning thread has exited, in which case
+        ///         the caller must merge \p count itself
+        bool enqueue( counter_type& count ) noexcept;
+
+        bool has_pending() const noexcept;
+
+        /// \brief Merges every queued counter; only called on the owning
+        ///        thread
+        void collect() noexcept;
+
+        /// \brief Marks the owning thread as exited, and merges the queue
+        void exit() noexcept;
+
+        //--------------------------------------------------------------------
+        // Private Static Functions
+        //--------------------------------------------------------------------
+      private:
+
+        static biased_owner*& current_pointer() noexcept;
+
+        static bool& exited() noexcept;
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        std::mutex                m_mutex;
+        counter_type*             m_queue   = nullptr;
+        bool                      m_dead    = false;
+        std::atomic<bool>         m_pending{false};
+        std::atomic<std::size_t>  m_references{1};
+
+        //--------------------------------------------------------------------
+        // Private Member Types
+        //--------------------------------------------------------------------
+      private:
+
+        /// \brief Owns the calling thread's biased_owner, and marks it
+        ///        exited when the thread ends
+        struct holder
+        {
+          holder() noexcept;
+          ~holder();
+
+          biased_owner* owner;
+        };
+      };
+
+    } // namespace detail
+
+    //=========================================================================
+    // X.Y.2 : intrusive_ref_counter
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A base class that embeds a reference count into \p Derived
+    ///
+    /// Copying an intrusive_ref_counter does not copy the count; each object
+    /// starts unreferenced.
+    ///
+    /// Types that do not derive from this may still be used with
+    /// intrusive_ptr by providing the ADL-findable functions
+    /// \c intrusive_ref_count and \c intrusive_dispose.
+    ///
+    /// \tparam Derived the type deriving from this (CRTP)
+    /// \tparam CountPolicy the counting policy
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Derived, typename CountPolicy = atomic_count_policy>
+    class intrusive_ref_counter
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using count_policy = CountPolicy;
+      using counter_type = typename CountPolicy::counter_type;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //-----------------------------------------------------------------------
+    protected:
+
+      intrusive_ref_counter() noexcept;
+      intrusive_ref_counter( const intrusive_ref_counter& ) noexcept;
+      ~intrusive_ref_counter() = default;
+
+      intrusive_ref_counter& operator=( const intrusive_ref_counter& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      mutable counter_type m_count;
+
+      //-----------------------------------------------------------------------
+      // Hooks
+      //-----------------------------------------------------------------------
+    private:
+
+      friend counter_type& intrusive_ref_count( const intrusive_ref_counter& r ) noexcept
+      {
+        return r.m_count;
+      }
+
+      friend void intrusive_dispose( const intrusive_ref_counter& r ) noexcept
+      {
+        delete static_cast<const Derived*>(&r);
+      }
+    };
+
+    //=========================================================================
+    // X.Y.3 : intrusive_ptr
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A shared-ownership smart pointer whose reference count is
+    ///        stored in the managed object
+    ///
+    /// Unlike std::shared_ptr, no separate control block is allocated. The
+    /// cost of counting is chosen by \p CountPolicy.
+    ///
+    /// The policy is not deduced from \p T, so that intrusive_ptr may be
+    /// used with incomplete types. Using a policy that differs from the
+    /// object's counter is a compile-time error.
+    ///
+    /// \tparam T the type of the managed object
+    /// \tparam CountPolicy the counting policy of \p T
+    /// \satisfies{NullablePointer}
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, typename CountPolicy = atomic_count_policy>
+    class intrusive_ptr
+    {
+      template<typename U>
+      using enable_if_convertible_t = std::enable_if_t<
+        std::is_convertible<U*,T*>::value
+      >;
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using element_type = T;
+      using pointer      = T*;
+      using count_policy = CountPolicy;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \{
+      /// \brief Constructs an intrusive_ptr that manages no object
+      constexpr intrusive_ptr() noexcept;
+      constexpr intrusive_ptr( std::nullptr_t ) noexcept;
+      /// \}
+
+      /// \brief Constructs an intrusive_ptr that manages \p ptr
+      ///
+      /// \param ptr the pointer to manage
+      /// \param add_ref whether to add a reference; pass \c false to adopt
+      ///                a reference previously released with detach()
+      explicit intrusive_ptr( T* ptr, bool add_ref = true ) noexcept;
+
+      intrusive_ptr( const intrusive_ptr& other ) noexcept;
+
+      intrusive_ptr( intrusive_ptr&& other ) noexcept;
+
+      template<typename U, typename = enable_if_convertible_t<U>>
+      intrusive_ptr( const intrusive_ptr<U,CountPolicy>& other ) noexcept;
+
+      template<typename U, typename = enable_if_convertible_t<U>>
+      intrusive_ptr( intrusive_ptr<U,CountPolicy>&& other ) noexcept;
+
+      //-----------------------------------------------------------------------
+
+      ~intrusive_ptr();
+
+      //-----------------------------------------------------------------------
+
+      intrusive_ptr& operator=( const intrusive_ptr& other ) noexcept;
+
+      intrusive_ptr& operator=( intrusive_ptr&& other ) noexcept;
+
+      template<typename U, typename = enable_if_convertible_t<U>>
+      intrusive_ptr& operator=( const intrusive_ptr<U,CountPolicy>& other ) noexcept;
+
+      template<typename U, typename = enable_if_convertible_t<U>>
+      intrusive_ptr& operator=( intrusive_ptr<U,CountPolicy>&& other ) noexcept;
+
+      intrusive_ptr& operator=( std::nullptr_t ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Releases the managed object
+      void reset() noexcept;
+
+      /// \brief Replaces the managed object with \p ptr
+      ///
+      /// \param ptr the new pointer to manage
+      /// \param add_ref whether to add a reference to \p ptr
+      void reset( T* ptr, bool add_ref = true ) noexcept;
+
+      /// \brief Releases ownership without decrementing the count
+      ///
+      /// \return the pointer that was managed
+      T* detach() noexcept;
+
+      void swap( intrusive_ptr& other ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      constexpr pointer get() const noexcept;
+
+      std::add_lvalue_reference_t<T> operator*() const noexcept;
+
+      constexpr pointer operator->() const noexcept;
+
+      constexpr explicit operator bool() const noexcept;
+
+      /// \brief Gets the number of references to the managed object
+      ///
+      /// \return the count, or 0 if no object is managed
+      std::size_t use_count() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Static Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      static void add_ref( T* ptr ) noexcept;
+
+      static void release( T* ptr ) noexcept;
+
+      static void dispose( const void* ptr );
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      T* m_ptr;
+
+      template<typename U, typename P>
+      friend class intrusive_ptr;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparison
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U, typename P>
+    bool operator==( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+    template<typename T, typename U, typename P>
+    bool operator!=( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+    template<typename T, typename U, typename P>
+    bool operator<( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+    template<typename T, typename U, typename P>
+    bool operator>( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+    template<typename T, typename U, typename P>
+    bool operator<=( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+    template<typename T, typename U, typename P>
+    bool operator>=( const intrusive_ptr<T,P>& lhs, const intrusive_ptr<U,P>& rhs ) noexcept;
+
+    template<typename T, typename P>
+    bool operator==( const intrusive_ptr<T,P>& lhs, std::nullptr_t ) noexcept;
+    template<typename T, typename P>
+    bool operator==( std::nullptr_t, const intrusive_ptr<T,P>& rhs ) noexcept;
+    template<typename T, typename P>
+    bool operator!=( const intrusive_ptr<T,P>& lhs, std::nullptr_t ) noexcept;
+    template<typename T, typename P>
+    bool operator!=( std::nullptr_t, const intrusive_ptr<T,P>& rhs ) noexcept;
+
+    template<typename T, typename P>
+    bool operator==( const intrusive_ptr<T,P>& lhs, const T* rhs ) noexcept;
+    template<typename T, typename P>
+    bool operator==( const T* lhs, const intrusive_ptr<T,P>& rhs ) noexcept;
+    template<typename T, typename P>
+    bool operator!=( const intrusive_ptr<T,P>& lhs, const T* rhs ) noexcept;
+    template<typename T, typename P>
+    bool operator!=( const T* lhs, const intrusive_ptr<T,P>& rhs ) noexcept;
+
+    //=========================================================================
+    // X.Y.4 : intrusive_ptr utilities
+    //=========================================================================
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Swaps the contents of \p lhs with \p rhs
+    ///
+    /// \param lhs the left intrusive_ptr to swap
+    /// \param rhs the right intrusive_ptr to swap
+    template<typename T, typename P>
+    void swap( intrusive_ptr<T,P>& lhs, intrusive_ptr<T,P>& rhs ) noexcept;
+
+    /// \brief Hashes this intrusive_ptr
+    ///
+    /// \param val the value to hash
+    /// \return the hash of the underlying pointer
+    template<typename T, typename P>
+    hash_t hash_value( const intrusive_ptr<T,P>& val ) noexcept;
+
+    /// \brief Constructs a \p T from \p args and manages it with an
+    ///        intrusive_ptr
+    ///
+    /// \param args the arguments to forward to \p T's constructor
+    /// \return the intrusive_ptr
+    template<typename T, typename...Args>
+    intrusive_ptr<T,typename T::count_policy> make_intrusive( Args&&...args );
+
+    //-------------------------------------------------------------------------
+    // Casts
+    //-------------------------------------------------------------------------
+
+    inline namespace casts {
+
+      template<typename To, typename From, typename P>
+      intrusive_ptr<To,P> static_pointer_cast( const intrusive_ptr<From,P>& other ) noexcept;
+
+      template<typename To, typename From, typename P>
+      intrusive_ptr<To,P> dynamic_pointer_cast( const intrusive_ptr<From,P>& other ) noexcept;
+
+      template<typename To, typename From, typename P>
+      intrusive_ptr<To,P> const_pointer_cast( const intrusive_ptr<From,P>& other ) noexcept;
+
+    } // inline namespace casts
+  } // namespace stl
+} // namespace bit
+
+#include "detail/intrusive_ptr.inl"
+
+#endif /* BIT_STL_MEMORY_INTRUSIVE_PTR_HPP */
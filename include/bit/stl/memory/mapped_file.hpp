@@ -0,0 +1,298 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an RAII memory-mapped file, whose contents
+ *        are exposed as span, string_view and fat_ptr views
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_MAPPED_FILE_HPP
+#define BIT_STL_MEMORY_MAPPED_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "fat_ptr.hpp"
+
+#include "../containers/span.hpp"        // span
+#include "../containers/string_view.hpp" // string_view
+#include "../utilities/assert.hpp"       // BIT_ASSERT
+#include "../utilities/byte.hpp"         // byte
+
+#include <cerrno>       // errno
+#include <cstddef>      // std::size_t
+#include <string>       // std::string
+#include <system_error> // std::error_code, std::system_error
+
+#if !defined(_WIN32)
+# include <fcntl.h>    // ::open
+# include <sys/mman.h> // ::mmap, ::munmap, ::madvise, ::msync
+# include <sys/stat.h> // ::fstat
+# include <unistd.h>   // ::close
+#endif
+
+namespace bit {
+  namespace stl {
+
+    /// \brief The access mode of a mapped_file
+    enum class map_mode
+    {
+      read_only,  ///< The mapping may only be read
+      read_write, ///< Writes to the mapping are written back to the file
+    };
+
+    /// \brief The expected access pattern of (part of) a mapped_file, used
+    ///        to tune read-ahead
+    enum class map_advice
+    {
+      normal,     ///< No particular pattern
+      sequential, ///< Read front-to-back; read ahead aggressively
+      random,     ///< Read in no particular order; do not read ahead
+      will_need,  ///< Will be read soon; start reading it in now
+      dont_need,  ///< Will not be read soon; its pages may be reclaimed
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A file mapped into memory for the lifetime of this object
+    ///
+    /// The contents are viewed in place through \c bytes(), \c chars() or
+    /// \c region(), so even multi-gigabyte files can be parsed without
+    /// copying them through \c read(). The file descriptor is closed as soon
+    /// as the mapping is established.
+    ///
+    /// Errors are reported with std::system_error, or through a
+    /// std::error_code for the overloads that accept one.
+    ///
+    /// \note The size of the mapping is that of the file when it was opened;
+    ///       a read_write mapping cannot grow the file
+    ///////////////////////////////////////////////////////////////////////////
+    class mapped_file
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a mapped_file that does not map anything
+      mapped_file() noexcept;
+
+      /// \brief Maps the file at \p path
+      ///
+      /// \throw std::system_error if the file cannot be opened or mapped
+      ///
+      /// \param path the path of the file
+      /// \param mode the access mode
+      /// \param populate whether to pre-fault the whole file into memory
+      ///        (\c MAP_POPULATE), so that later reads never block on I/O
+      explicit mapped_file( const char* path,
+                            map_mode mode = map_mode::read_only,
+                            bool populate = false );
+
+      /// \copydoc mapped_file( const char*, map_mode, bool )
+      explicit mapped_file( const std::string& path,
+                            map_mode mode = map_mode::read_only,
+                            bool populate = false );
+
+      /// \brief Maps the file at \p path, reporting errors through \p ec
+      ///
+      /// On failure, the mapped_file does not map anything
+      ///
+      /// \param path the path of the file
+      /// \param mode the access mode
+      /// \param populate whether to pre-fault the whole file into memory
+      /// \param ec set to the error on failure, or cleared on success
+      mapped_file( const char* path,
+                   map_mode mode,
+                   bool populate,
+                   std::error_code& ec ) noexcept;
+
+      /// \brief Move-constructs a mapped_file from \p other
+      ///
+      /// \param other the mapped_file to move; it no longer maps anything
+      mapped_file( mapped_file&& other ) noexcept;
+
+      mapped_file( const mapped_file& other ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Unmaps the file
+      ~mapped_file();
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Move-assigns \p other to this mapped_file, unmapping the
+      ///        current file
+      ///
+      /// \param other the mapped_file to move
+      /// \return reference to \c (*this)
+      mapped_file& operator=( mapped_file&& other ) noexcept;
+
+      mapped_file& operator=( const mapped_file& other ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Unmaps the file, if any
+      void close() noexcept;
+
+      /// \brief Swaps this mapped_file with \p other
+      ///
+      /// \param other the other mapped_file
+      void swap( mapped_file& other ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Operations
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Advises the system of the access pattern of the bytes in
+      ///        [\p offset, \p offset + \p length)
+      ///
+      /// \param advice the expected access pattern
+      /// \param offset the offset of the first byte
+      /// \param length the number of bytes; clamped to the end of the file
+      /// \return \c true if the advice was accepted
+      bool advise( map_advice advice,
+                   size_type offset = 0,
+                   size_type length = npos ) const noexcept;
+
+      /// \brief Writes modified pages of a read_write mapping back to the
+      ///        file
+      ///
+      /// \throw std::system_error on failure
+      ///
+      /// \param wait whether to block until the write completes
+      void sync( bool wait = true );
+
+      /// \brief Writes modified pages of a read_write mapping back to the
+      ///        file, reporting errors through \p ec
+      ///
+      /// \param wait whether to block until the write completes
+      /// \param ec set to the error on failure, or cleared on success
+      void sync( bool wait, std::error_code& ec ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the contents of the file as bytes
+      ///
+      /// \return a view of the mapped bytes
+      span<const byte> bytes() const noexcept;
+
+      /// \brief Gets the contents of a read_write mapping as mutable bytes
+      ///
+      /// \note The mapping must be read_write
+      ///
+      /// \return a mutable view of the mapped bytes
+      span<byte> mutable_bytes() noexcept;
+
+      /// \brief Gets the contents of the file as characters
+      ///
+      /// \return a view of the mapped characters
+      string_view chars() const noexcept;
+
+      /// \brief Gets the mapped region
+      ///
+      /// \return a fat_ptr to the start of the mapping, sized to the file
+      fat_ptr<const void> region() const noexcept;
+
+      /// \brief Gets a pointer to the start of the mapping
+      ///
+      /// \return pointer to the mapping, or \c nullptr if nothing (or an
+      ///         empty file) is mapped
+      const void* data() const noexcept;
+
+      /// \brief Gets the size of the mapping
+      ///
+      /// \return the size of the mapped file in bytes
+      size_type size() const noexcept;
+
+      /// \brief Returns whether the mapped file is empty
+      ///
+      /// \return \c true if no bytes are mapped
+      bool empty() const noexcept;
+
+      /// \brief Gets the access mode of the mapping
+      ///
+      /// \return the access mode
+      map_mode mode() const noexcept;
+
+      /// \brief Returns whether a file is mapped
+      ///
+      /// \return \c true if a file is mapped
+      bool is_open() const noexcept;
+
+      /// \copydoc is_open()
+      explicit operator bool() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      void*     m_data;    ///< The start of the mapping
+      size_type m_size;    ///< The size of the mapping
+      map_mode  m_mode;    ///< The access mode
+      bool      m_is_open; ///< Whether a file is mapped (possibly empty)
+    };
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Swaps two mapped_files
+    ///
+    /// \param lhs the left mapped_file
+    /// \param rhs the right mapped_file
+    void swap( mapped_file& lhs, mapped_file& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/mapped_file.inl"
+
+#endif /* BIT_STL_MEMORY_MAPPED_FILE_HPP */
@@ -87,6 +87,68 @@ namespace bit {
     /// \return the pointer pointing to the given address
     void* from_address( std::uintptr_t address ) noexcept;
 
+    //------------------------------------------------------------------------
+    // Pointer Alignment
+    //------------------------------------------------------------------------
+
+    /// \brief Rounds \p value up to the nearest multiple of \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param value the value to round up
+    /// \param align the alignment to round to
+    /// \return the smallest multiple of \p align not less than \p value
+    constexpr std::size_t align_up( std::size_t value,
+                                    std::size_t align ) noexcept;
+
+    /// \brief Advances \p ptr to the nearest address aligned to \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param ptr the pointer to align
+    /// \param align the alignment to align to
+    /// \return the aligned pointer
+    template<typename T>
+    T* align_up( T* ptr, std::size_t align ) noexcept;
+
+    /// \brief Rounds \p value down to the nearest multiple of \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param value the value to round down
+    /// \param align the alignment to round to
+    /// \return the largest multiple of \p align not greater than \p value
+    constexpr std::size_t align_down( std::size_t value,
+                                      std::size_t align ) noexcept;
+
+    /// \brief Retreats \p ptr to the nearest address aligned to \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param ptr the pointer to align
+    /// \param align the alignment to align to
+    /// \return the aligned pointer
+    template<typename T>
+    T* align_down( T* ptr, std::size_t align ) noexcept;
+
+    /// \brief Determines whether \p value is a multiple of \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param value the value to test
+    /// \param align the alignment to test against
+    /// \return \c true if \p value is aligned to \p align
+    constexpr bool is_aligned( std::size_t value, std::size_t align ) noexcept;
+
+    /// \brief Determines whether \p ptr is aligned to \p align
+    ///
+    /// \pre \p align is a non-zero power of two
+    ///
+    /// \param ptr the pointer to test
+    /// \param align the alignment to test against
+    /// \return \c true if \p ptr is aligned to \p align
+    bool is_aligned( const volatile void* ptr, std::size_t align ) noexcept;
+
     //------------------------------------------------------------------------
     // Comparisons
     //------------------------------------------------------------------------
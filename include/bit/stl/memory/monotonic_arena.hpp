@@ -0,0 +1,298 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a monotonic (bump-pointer) arena and a
+ *        standard allocator that draws from it
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_MONOTONIC_ARENA_HPP
+#define BIT_STL_MEMORY_MONOTONIC_ARENA_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/assert.hpp" // BIT_ASSERT
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <cstdint>     // std::uintptr_t
+#include <limits>      // std::numeric_limits
+#include <new>         // std::bad_alloc, ::operator new
+#include <type_traits> // std::true_type
+
+namespace bit {
+  namespace stl {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An arena that allocates by bumping a pointer, and releases
+    ///        everything at once
+    ///
+    /// Memory is carved out of a chain of blocks. Allocation is O(1): the
+    /// current pointer is aligned and advanced, and a new block is only
+    /// requested from the global allocator when the current block is
+    /// exhausted. Each new block is twice the size of the last.
+    ///
+    /// Deallocation does nothing; all memory is reclaimed together when the
+    /// arena is released or destroyed. This makes the arena well suited to
+    /// per-request or per-frame allocations with a common lifetime.
+    ///
+    /// An initial buffer (such as one on the stack) may be supplied, in
+    /// which case no heap memory is used until it is exhausted.
+    ///////////////////////////////////////////////////////////////////////////
+    class monotonic_arena
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type default_block_size = 4096;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an arena whose first block will be
+      ///        \p block_size bytes
+      ///
+      /// No memory is allocated until the first allocation
+      ///
+      /// \param block_size the size of the first block
+      explicit monotonic_arena( size_type block_size = default_block_size ) noexcept;
+
+      /// \brief Constructs an arena that allocates from \p buffer before
+      ///        falling back to heap blocks
+      ///
+      /// \param buffer the initial buffer; must outlive the arena
+      /// \param size the size of \p buffer
+      /// \param block_size the size of the first heap block
+      monotonic_arena( void* buffer,
+                       size_type size,
+                       size_type block_size = default_block_size ) noexcept;
+
+      // Deleted copy construction
+      monotonic_arena( const monotonic_arena& ) = delete;
+
+      // Deleted move construction
+      monotonic_arena( monotonic_arena&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Releases all blocks owned by this arena
+      ~monotonic_arena();
+
+      //-----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      monotonic_arena& operator=( const monotonic_arena& ) = delete;
+
+      // Deleted move assignment
+      monotonic_arena& operator=( monotonic_arena&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates \p bytes bytes aligned to \p align
+      ///
+      /// \throw std::bad_alloc if a new block cannot be allocated
+      ///
+      /// \param bytes the number of bytes to allocate
+      /// \param align the alignment; must be a power of 2
+      /// \return pointer to the allocated memory
+      void* allocate( size_type bytes,
+                      size_type align = alignof(std::max_align_t) );
+
+      /// \brief Does nothing; memory is only reclaimed by \c release
+      ///
+      /// \param p the pointer to deallocate
+      /// \param bytes the number of bytes allocated
+      /// \param align the alignment of the allocation
+      void deallocate( void* p, size_type bytes, size_type align ) noexcept;
+
+      /// \brief Releases every heap block, and resets allocation to the
+      ///        start of the initial buffer
+      ///
+      /// \note All memory previously allocated from this arena is invalidated
+      void release() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of bytes that may be allocated from the
+      ///        current block without requesting a new one
+      ///
+      /// \return the remaining bytes in the current block
+      size_type remaining() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      /// The header placed at the start of every heap block
+      struct block_header
+      {
+        block_header* next;
+      };
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      block_header* m_blocks;         ///< The most recent heap block
+      char*         m_current;        ///< The next free byte
+      char*         m_end;            ///< The end of the current block
+      char*         m_buffer;         ///< The initial buffer, if any
+      size_type     m_buffer_size;    ///< The size of the initial buffer
+      size_type     m_next_size;      ///< The size of the next heap block
+      size_type     m_initial_size;   ///< The size of the first heap block
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Allocates from a new block, when the current one is exhausted
+      void* allocate_from_new_block( size_type bytes, size_type align );
+
+      /// \brief Aligns \p p up to \p align
+      static std::uintptr_t align_address( std::uintptr_t p, size_type align ) noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A standard allocator that allocates from a monotonic_arena
+    ///
+    /// The allocator refers to the arena, which must outlive it and all
+    /// containers using it. Allocators compare equal when they refer to the
+    /// same arena.
+    ///
+    /// \tparam T the type to allocate
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class arena_allocator
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      using propagate_on_container_copy_assignment = std::true_type;
+      using propagate_on_container_move_assignment = std::true_type;
+      using propagate_on_container_swap            = std::true_type;
+
+      template<typename U>
+      struct rebind{ using other = arena_allocator<U>; };
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an allocator that allocates from \p arena
+      ///
+      /// \param arena the arena to allocate from
+      arena_allocator( monotonic_arena& arena ) noexcept;
+
+      /// \brief Constructs an allocator that allocates from the same arena
+      ///        as \p other
+      ///
+      /// \param other the other allocator
+      template<typename U>
+      arena_allocator( const arena_allocator<U>& other ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates storage for \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      T* allocate( size_type n );
+
+      /// \brief Does nothing; the storage is reclaimed with the arena
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects
+      void deallocate( T* p, size_type n ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the arena this allocator allocates from
+      ///
+      /// \return the arena
+      monotonic_arena& arena() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      monotonic_arena* m_arena;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U>
+    bool operator==( const arena_allocator<T>& lhs,
+                     const arena_allocator<U>& rhs ) noexcept;
+    template<typename T, typename U>
+    bool operator!=( const arena_allocator<T>& lhs,
+                     const arena_allocator<U>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/monotonic_arena.inl"
+
+#endif /* BIT_STL_MEMORY_MONOTONIC_ARENA_HPP */
@@ -52,6 +52,12 @@ namespace bit {
     ///////////////////////////////////////////////////////////////////////////
     /// \brief An offset pointer based on boost::offset_ptr
     ///
+    /// Since the offset is relative to the offset_ptr itself, copying an
+    /// offset_ptr recomputes the offset for the new location. This allows
+    /// structures containing offset_ptrs to be placed in memory that is
+    /// mapped at different addresses (such as shared memory), provided
+    /// the pointee lives in the same mapping.
+    ///
     /// \note Like boost::offset_ptr, an offset value of '1' is used to
     ///       represent nullptr internally, since it is unlikely for an offset
     ///       of 1 to ever be valid. 0 is not used, since a self-assignment of
@@ -97,7 +103,7 @@ namespace bit {
       /// \brief Copy-constructs an offset_ptr from another offset_ptr
       ///
       /// \param other the other offset_ptr to copy
-      offset_ptr( const offset_ptr& other ) noexcept = default;
+      offset_ptr( const offset_ptr& other ) noexcept;
 
       /// \brief Move-constructs an offset_ptr from another offset_ptr
       ///
@@ -132,7 +138,7 @@ namespace bit {
       ///
       /// \param other the other offset_ptr to copy
       /// \return reference to \c (*this)
-      offset_ptr& operator=( const offset_ptr& other ) noexcept = default;
+      offset_ptr& operator=( const offset_ptr& other ) noexcept;
 
       /// \brief Move-assigns an offset_ptr from another offset_ptr
       ///
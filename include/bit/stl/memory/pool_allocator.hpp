@@ -0,0 +1,308 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a size-class pool allocator for small,
+ *        fixed-size objects
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_POOL_ALLOCATOR_HPP
+#define BIT_STL_MEMORY_POOL_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <limits>      // std::numeric_limits
+#include <new>         // std::bad_alloc, ::operator new
+#include <type_traits> // std::integral_constant, std::true_type
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// \brief A free block in a fixed_size_pool
+      ///
+      /// The first node of a batch in the depot also links to the next batch
+      struct pool_node
+      {
+        pool_node* next;
+        pool_node* next_batch;
+      };
+
+    } // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A process-wide pool of blocks of a single size and alignment
+    ///
+    /// Each thread owns a magazine: an intrusive free list of blocks, and
+    /// the unused remainder of the slab it last carved blocks from.
+    /// Allocation and deallocation only touch the calling thread's
+    /// magazine, and so require no synchronization.
+    ///
+    /// When a magazine grows past twice the batch size, a batch of blocks is
+    /// pushed to a global depot; when a magazine runs dry, it takes a batch
+    /// back before carving a new slab. Blocks freed by a thread other than
+    /// the one that allocated them thereby flow back to allocating threads.
+    /// When a thread exits, its magazine is returned to the depot; blocks
+    /// that the thread allocates or frees after that, such as from the
+    /// destructors of other thread_local objects, go straight to the depot.
+    ///
+    /// Pushes to the depot are lock-free. Pops are serialized by a spin lock
+    /// held for a single compare-and-swap, so that a pop takes one batch in
+    /// constant time and leaves the rest of the depot visible to others.
+    ///
+    /// Slabs are never returned to the system.
+    ///
+    /// \tparam Size the size of each block
+    /// \tparam Align the alignment of each block
+    ///////////////////////////////////////////////////////////////////////////
+    template<std::size_t Size, std::size_t Align = alignof(std::max_align_t)>
+    class fixed_size_pool
+    {
+      static_assert( Align != 0 && (Align & (Align - 1)) == 0,
+                     "Alignment must be a power of 2" );
+      static_assert( Align <= alignof(std::max_align_t),
+                     "fixed_size_pool does not support over-aligned blocks" );
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// The size of each block, after accounting for alignment and the
+      /// free-list links
+      static constexpr std::size_t block_size =
+        ((Size < sizeof(detail::pool_node) ? sizeof(detail::pool_node) : Size)
+         + (Align - 1)) & ~(Align - 1);
+
+      /// The number of blocks moved between a magazine and the depot at once
+      static constexpr std::size_t batch_size = 64;
+
+      /// The number of blocks carved from each slab
+      static constexpr std::size_t blocks_per_slab =
+        (65536 / block_size) < batch_size ? batch_size : (65536 / block_size);
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates a single block
+      ///
+      /// \throw std::bad_alloc if a new slab cannot be allocated
+      ///
+      /// \return pointer to the block
+      static void* allocate();
+
+      /// \brief Returns a block to the pool
+      ///
+      /// The block may have been allocated by any thread
+      ///
+      /// \param p the block to return
+      static void deallocate( void* p ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using node_type = detail::pool_node;
+
+      /// Whether a magazine holds blocks for its thread
+      enum class magazine_state : unsigned char
+      {
+        unused,    ///< Nothing has been pooled on this thread yet
+        active,    ///< The magazine will be returned at thread exit
+        destroyed  ///< The magazine has been returned; blocks bypass it
+      };
+
+      /// The per-thread cache of free blocks
+      ///
+      /// This is trivially destructible, so that it remains usable when
+      /// other thread_local objects are destroyed after its holder
+      struct magazine
+      {
+        node_type*     head  = nullptr;
+        std::size_t    count = 0;
+        char*          bump  = nullptr;
+        char*          end   = nullptr;
+        magazine_state state = magazine_state::unused;
+      };
+
+      /// Returns this thread's magazine to the depot when the thread exits
+      struct magazine_holder
+      {
+        ~magazine_holder();
+      };
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      static magazine& local_magazine() noexcept;
+
+      /// \brief Registers the return of \p m at thread exit
+      ///
+      /// \return \c false if \p m has already been returned
+      static bool activate( magazine& m ) noexcept;
+
+      /// \brief Allocates a single block without this thread's magazine
+      static void* allocate_from_depot();
+
+      static std::atomic<node_type*>& depot() noexcept;
+
+      /// \brief Gets the lock that serializes pops from the depot
+      static std::atomic_flag& depot_lock() noexcept;
+
+      /// \brief Pushes a chain of batches, from \p first to \p last, to the
+      ///        depot
+      static void depot_push( node_type* first, node_type* last ) noexcept;
+
+      /// \brief Pops a single batch from the depot
+      ///
+      /// \return the batch, or \c nullptr if the depot is empty
+      static node_type* depot_pop() noexcept;
+
+      /// \brief Moves \c batch_size blocks from \p m to the depot
+      static void flush_batch( magazine& m ) noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A stateless standard allocator that draws single objects from
+    ///        a fixed_size_pool
+    ///
+    /// Objects are grouped into size classes in multiples of 16 bytes, so
+    /// that types of similar size share a pool. Array allocations, objects
+    /// larger than \c max_pooled_size, and over-aligned types are forwarded
+    /// to the global \c operator new.
+    ///
+    /// \tparam T the type to allocate
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class pool_allocator
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      using propagate_on_container_move_assignment = std::true_type;
+      using is_always_equal = std::true_type;
+
+      template<typename U>
+      struct rebind{ using other = pool_allocator<U>; };
+
+      //-----------------------------------------------------------------------
+      // Public Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// The largest object size drawn from a pool
+      static constexpr std::size_t max_pooled_size = 256;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      pool_allocator() noexcept = default;
+
+      template<typename U>
+      pool_allocator( const pool_allocator<U>& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates storage for \p n objects of type T
+      ///
+      /// \throw std::bad_alloc on failure
+      ///
+      /// \param n the number of objects
+      /// \return pointer to the storage
+      T* allocate( size_type n );
+
+      /// \brief Deallocates storage previously allocated with \c allocate
+      ///
+      /// \param p the pointer to deallocate
+      /// \param n the number of objects
+      void deallocate( T* p, size_type n ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using is_pooled = std::integral_constant<bool,
+        (sizeof(T) <= max_pooled_size) &&
+        (alignof(T) <= alignof(std::max_align_t))
+      >;
+
+      static constexpr std::size_t size_class = (sizeof(T) + 15) & ~std::size_t{15};
+
+      using pool_type = fixed_size_pool<size_class,
+        (alignof(T) < alignof(detail::pool_node)) ? alignof(detail::pool_node) : alignof(T)
+      >;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      T* allocate( size_type n, std::true_type );
+      T* allocate( size_type n, std::false_type );
+
+      void deallocate( T* p, size_type n, std::true_type ) noexcept;
+      void deallocate( T* p, size_type n, std::false_type ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename U>
+    constexpr bool operator==( const pool_allocator<T>& lhs,
+                               const pool_allocator<U>& rhs ) noexcept;
+    template<typename T, typename U>
+    constexpr bool operator!=( const pool_allocator<T>& lhs,
+                               const pool_allocator<U>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/pool_allocator.inl"
+
+#endif /* BIT_STL_MEMORY_POOL_ALLOCATOR_HPP */
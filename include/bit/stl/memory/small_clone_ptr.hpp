@@ -0,0 +1,325 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a clone_ptr variant that stores small objects
+ *        inline, without allocating
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_MEMORY_SMALL_CLONE_PTR_HPP
+#define BIT_STL_MEMORY_SMALL_CLONE_PTR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/aligned_storage.hpp" // aligned_storage_t, max_align
+#include "../utilities/in_place.hpp"        // in_place_type_t
+
+#include <cstddef>     // std::size_t, std::nullptr_t
+#include <new>         // placement new
+#include <type_traits> // std::enable_if_t, std::is_convertible, ...
+#include <utility>     // std::forward, std::move
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Per-type operations used by small_clone_ptr to copy, relocate,
+      ///        and destroy the object in its storage
+      ///
+      /// Each function receives the address of the small_clone_ptr storage,
+      /// which holds either the object itself or a pointer to a heap
+      /// allocated object, and returns the new address of the \c T
+      /// subobject.
+      ///
+      /// \tparam T the type exposed by the owning small_clone_ptr
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T>
+      struct small_clone_ptr_vtable
+      {
+        T*   (*copy)( const void* from, void* to );
+        T*   (*move)( void* from, void* to ); // never throws
+        void (*destroy)( void* storage );     // never throws
+        bool is_inline;
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The handler for objects of type \c U, stored either inline
+      ///        (\p Inline is \c true) or on the heap
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T, typename U, bool Inline>
+      struct small_clone_ptr_handler;
+
+      template<typename T, typename U>
+      struct small_clone_ptr_handler<T,U,true>
+      {
+        template<typename...Args>
+        static T* create( void* storage, Args&&...args );
+
+        static T* copy( const void* from, void* to );
+        static T* move( void* from, void* to ) noexcept;
+        static void destroy( void* storage ) noexcept;
+
+        static constexpr small_clone_ptr_vtable<T> vtable = {
+          &copy, &move, &destroy, true
+        };
+      };
+
+      template<typename T, typename U>
+      struct small_clone_ptr_handler<T,U,false>
+      {
+        template<typename...Args>
+        static T* create( void* storage, Args&&...args );
+
+        static T* copy( const void* from, void* to );
+        static T* move( void* from, void* to ) noexcept;
+        static void destroy( void* storage ) noexcept;
+
+        static constexpr small_clone_ptr_vtable<T> vtable = {
+          &copy, &move, &destroy, false
+        };
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A clone_ptr that stores objects of up to \p Size bytes inline
+    ///
+    /// Like clone_ptr, small_clone_ptr gives polymorphic objects value
+    /// semantics: copying the pointer copies the most-derived object, and
+    /// destroying it destroys that object.
+    ///
+    /// Objects no larger than \p Size, no more aligned than \c max_align,
+    /// and nothrow-move-constructible are constructed directly in the
+    /// small_clone_ptr, so creating, copying and moving them never touches
+    /// the allocator. Larger objects fall back to the heap.
+    ///
+    /// Copying, moving, and destruction dispatch through a static table of
+    /// operations generated for each stored type, so the stored types do
+    /// not need a virtual clone function. The address of the \c T
+    /// subobject is cached, so access costs no indirection.
+    ///
+    /// \tparam T the type this small_clone_ptr exposes
+    /// \tparam Size the number of bytes available for inline storage
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Size = 48>
+    class small_clone_ptr
+    {
+      static_assert( Size >= sizeof(void*),
+                     "small_clone_ptr must have room to store a pointer" );
+
+      template<typename U>
+      using enable_if_convertible_t = std::enable_if_t<
+        std::is_convertible<U*,T*>::value
+      >;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using element_type = T;
+      using pointer      = T*;
+
+      /// \brief Trait indicating whether \p U is stored inline
+      ///
+      /// \tparam U the type to check
+      template<typename U>
+      using is_stored_inline = std::integral_constant<bool,
+        (sizeof(U) <= Size) &&
+        (alignof(U) <= max_align) &&
+        std::is_nothrow_move_constructible<U>::value
+      >;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \{
+      /// \brief Constructs a small_clone_ptr with no managed object
+      small_clone_ptr() noexcept;
+      small_clone_ptr( std::nullptr_t ) noexcept;
+      /// \}
+
+      /// \brief Constructs a small_clone_ptr that manages an object of type
+      ///        \p U, constructed from \p args
+      ///
+      /// \param args the arguments to forward to \p U's constructor
+      template<typename U, typename...Args,
+               typename = enable_if_convertible_t<U>>
+      explicit small_clone_ptr( in_place_type_t<U>, Args&&...args );
+
+      /// \brief Constructs a small_clone_ptr that manages a copy of \p value
+      ///
+      /// \param value the value to copy or move
+      template<typename U,
+               typename = std::enable_if_t<!std::is_same<std::decay_t<U>,small_clone_ptr>::value &&
+                                           !std::is_same<std::decay_t<U>,std::nullptr_t>::value>,
+               typename = enable_if_convertible_t<std::decay_t<U>>>
+      small_clone_ptr( U&& value );
+
+      /// \brief Constructs a small_clone_ptr by copying the object managed
+      ///        by \p other
+      ///
+      /// \param other the other small_clone_ptr to copy
+      small_clone_ptr( const small_clone_ptr& other );
+
+      /// \brief Constructs a small_clone_ptr by taking the object managed
+      ///        by \p other
+      ///
+      /// Inline objects are relocated; heap objects are transferred.
+      /// \p other is left empty
+      ///
+      /// \param other the other small_clone_ptr to move
+      small_clone_ptr( small_clone_ptr&& other ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      ~small_clone_ptr();
+
+      //----------------------------------------------------------------------
+
+      small_clone_ptr& operator=( const small_clone_ptr& other );
+
+      small_clone_ptr& operator=( small_clone_ptr&& other ) noexcept;
+
+      small_clone_ptr& operator=( std::nullptr_t ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Destroys the managed object, if any
+      void reset() noexcept;
+
+      /// \brief Replaces the managed object with one of type \p U
+      ///        constructed from \p args
+      ///
+      /// \param args the arguments to forward to \p U's constructor
+      /// \return reference to the new object
+      template<typename U, typename...Args,
+               typename = enable_if_convertible_t<U>>
+      U& emplace( Args&&...args );
+
+      /// \brief Swaps the managed objects of \c this and \p other
+      ///
+      /// \param other the other small_clone_ptr to swap with
+      void swap( small_clone_ptr& other ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      pointer get() const noexcept;
+
+      explicit operator bool() const noexcept;
+
+      std::add_lvalue_reference_t<T> operator*() const noexcept;
+
+      pointer operator->() const noexcept;
+
+      /// \brief Queries whether the managed object is stored inline
+      ///
+      /// \return \c true if an object is managed and it lives in this
+      ///         small_clone_ptr's own storage
+      bool is_inline() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using vtable_type  = detail::small_clone_ptr_vtable<T>;
+      using storage_type = aligned_storage_t<Size,max_align>;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      storage_type       m_storage;
+      const vtable_type* m_vtable;
+      T*                 m_ptr;
+
+      //----------------------------------------------------------------------
+      // Private Utilities
+      //----------------------------------------------------------------------
+    private:
+
+      template<typename U, typename...Args>
+      void construct( Args&&...args );
+
+      void move_from( small_clone_ptr& other ) noexcept;
+    };
+
+    //------------------------------------------------------------------------
+    // Utilities
+    //------------------------------------------------------------------------
+
+    /// \brief Swaps the contents of two small_clone_ptrs
+    ///
+    /// \param lhs the left small_clone_ptr
+    /// \param rhs the right small_clone_ptr
+    template<typename T, std::size_t Size>
+    void swap( small_clone_ptr<T,Size>& lhs,
+               small_clone_ptr<T,Size>& rhs ) noexcept;
+
+    /// \brief Constructs a small_clone_ptr<T> managing an object of type
+    ///        \p U, constructed from \p args
+    ///
+    /// \tparam T the type exposed by the small_clone_ptr
+    /// \tparam U the type of object to construct
+    /// \param args the arguments to forward to \p U's constructor
+    /// \return the small_clone_ptr
+    template<typename T, typename U = T, typename...Args>
+    small_clone_ptr<T> make_small_clone( Args&&...args );
+
+    //------------------------------------------------------------------------
+    // Comparisons
+    //------------------------------------------------------------------------
+
+    template<typename T, std::size_t Size>
+    bool operator==( const small_clone_ptr<T,Size>& lhs, std::nullptr_t ) noexcept;
+    template<typename T, std::size_t Size>
+    bool operator==( std::nullptr_t, const small_clone_ptr<T,Size>& rhs ) noexcept;
+    template<typename T, std::size_t Size>
+    bool operator!=( const small_clone_ptr<T,Size>& lhs, std::nullptr_t ) noexcept;
+    template<typename T, std::size_t Size>
+    bool operator!=( std::nullptr_t, const small_clone_ptr<T,Size>& rhs ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/small_clone_ptr.inl"
+
+#endif /* BIT_STL_MEMORY_SMALL_CLONE_PTR_HPP */
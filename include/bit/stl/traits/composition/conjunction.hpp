@@ -50,6 +50,9 @@ namespace bit {
     template<typename...>
     struct conjunction;
 
+    template<>
+    struct conjunction<> : true_type{};
+
     template<typename B1>
     struct conjunction<B1> : B1{};
 
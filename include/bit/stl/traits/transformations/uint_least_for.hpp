@@ -0,0 +1,73 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines a type-trait for selecting the smallest
+ *        unsigned integral type able to represent a given value
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_TRAITS_TRANSFORMATIONS_UINT_LEAST_FOR_HPP
+#define BIT_STL_TRAITS_TRANSFORMATIONS_UINT_LEAST_FOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../composition/identity.hpp"
+
+#include <cstdint>     // std::uint_least8_t, etc
+#include <cstddef>     // std::size_t
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::conditional_t
+
+namespace bit {
+  namespace stl {
+
+    /// \brief Type-trait for selecting the smallest unsigned integral type
+    ///        that is able to represent \c Value
+    ///
+    /// This is useful for compacting indices and sizes whose upper-bound is
+    /// known at compile-time.
+    ///
+    /// The result is aliased as \c ::type
+    template<std::size_t Value>
+    struct uint_least_for : identity<
+      std::conditional_t<(Value <= std::numeric_limits<std::uint_least8_t>::max()),std::uint_least8_t,
+      std::conditional_t<(Value <= std::numeric_limits<std::uint_least16_t>::max()),std::uint_least16_t,
+      std::conditional_t<(Value <= std::numeric_limits<std::uint_least32_t>::max()),std::uint_least32_t,
+      std::uint_least64_t>>>
+    >{};
+
+    /// \brief Helper utility to extract uint_least_for::type
+    template<std::size_t Value>
+    using uint_least_for_t = typename uint_least_for<Value>::type;
+
+  } // namespace stl
+} // namespace bit
+
+#endif /* BIT_STL_TRAITS_TRANSFORMATIONS_UINT_LEAST_FOR_HPP */
@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains utilities for blocking on an atomic word until
+ *        its value changes
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_UTILITIES_ATOMIC_WAIT_HPP
+#define BIT_STL_UTILITIES_ATOMIC_WAIT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::microseconds
+#include <climits> // INT_MAX
+#include <cstdint> // std::uint32_t
+#include <thread>  // std::this_thread::yield
+
+#if defined(__linux__)
+# include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+# include <sys/syscall.h> // SYS_futex
+# include <unistd.h>      // ::syscall
+#endif
+
+namespace bit {
+  namespace stl {
+
+    /// \brief Blocks the calling thread until \p word no longer holds
+    ///        \p old
+    ///
+    /// Waiting is adaptive: the word is first polled briefly, then the
+    /// thread yields, and finally the thread is parked in the kernel until
+    /// notified. On Linux parking uses a futex; on other platforms the
+    /// thread sleeps in short intervals instead.
+    ///
+    /// Spurious returns do not occur, but the value may have changed back to
+    /// \p old again by the time this function returns.
+    ///
+    /// \param word the word to wait on
+    /// \param old the value to wait for a change from
+    void atomic_wait( const std::atomic<std::uint32_t>& word,
+                      std::uint32_t old ) noexcept;
+
+    /// \brief Wakes at least one thread blocked in \c atomic_wait on \p word
+    ///
+    /// \param word the word to notify
+    void atomic_notify_one( std::atomic<std::uint32_t>& word ) noexcept;
+
+    /// \brief Wakes all threads blocked in \c atomic_wait on \p word
+    ///
+    /// \param word the word to notify
+    void atomic_notify_all( std::atomic<std::uint32_t>& word ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/atomic_wait.inl"
+
+#endif /* BIT_STL_UTILITIES_ATOMIC_WAIT_HPP */
@@ -0,0 +1,467 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an optional type that encodes its empty state
+ *        in a sentinel value of the underlying type
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_UTILITIES_COMPACT_OPTIONAL_HPP
+#define BIT_STL_UTILITIES_COMPACT_OPTIONAL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "assert.hpp"   // BIT_ASSERT
+#include "hash.hpp"     // hash_t
+#include "in_place.hpp" // in_place_t
+#include "optional.hpp" // nullopt_t, bad_optional_access
+
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <cstring>     // std::memcpy
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::enable_if_t
+#include <utility>     // std::forward, std::move
+
+namespace bit {
+  namespace stl {
+
+    template<typename CharT, typename Traits> class basic_hashed_string_view;
+
+    //=========================================================================
+    // struct : compact_optional_traits
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Traits describing the sentinel value that a compact_optional
+    ///        uses to represent the empty state
+    ///
+    /// Specializations must provide:
+    /// - \c static T empty_value() noexcept, returning the sentinel, and
+    /// - \c static bool is_empty( const T& ) noexcept, testing for it
+    ///
+    /// The primary template is left undefined; types without an obvious
+    /// sentinel, such as integers, must name one explicitly with
+    /// compact_optional_sentinel.
+    ///
+    /// \tparam T the type to provide a sentinel for
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct compact_optional_traits;
+
+    /// \brief Pointers are empty when they are null
+    template<typename T>
+    struct compact_optional_traits<T*>
+    {
+      static constexpr T* empty_value() noexcept;
+      static constexpr bool is_empty( T* value ) noexcept;
+    };
+
+    /// \brief floats are empty when they hold a reserved quiet-NaN payload
+    ///
+    /// NaNs produced by arithmetic carry a different payload, and remain
+    /// representable values.
+    template<>
+    struct compact_optional_traits<float>
+    {
+      static float empty_value() noexcept;
+      static bool is_empty( float value ) noexcept;
+    };
+
+    /// \brief doubles are empty when they hold a reserved quiet-NaN payload
+    ///
+    /// NaNs produced by arithmetic carry a different payload, and remain
+    /// representable values.
+    template<>
+    struct compact_optional_traits<double>
+    {
+      static double empty_value() noexcept;
+      static bool is_empty( double value ) noexcept;
+    };
+
+    /// \brief Hashed string views are empty when they view a null pointer
+    ///
+    /// A default-constructed basic_hashed_string_view views a null pointer,
+    /// and so cannot be stored as a value.
+    template<typename CharT, typename Traits>
+    struct compact_optional_traits<basic_hashed_string_view<CharT,Traits>>
+    {
+      static constexpr basic_hashed_string_view<CharT,Traits> empty_value() noexcept;
+      static constexpr bool is_empty( const basic_hashed_string_view<CharT,Traits>& value ) noexcept;
+    };
+
+    //=========================================================================
+    // struct : compact_optional_sentinel
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Traits that reserve the constant \p Sentinel as the empty state
+    ///
+    /// This is intended for integral and enum types, e.g.
+    /// \code
+    /// using optional_index = compact_optional<
+    ///   std::uint32_t,
+    ///   compact_optional_sentinel<std::uint32_t,0xffffffff>
+    /// >;
+    /// \endcode
+    ///
+    /// \tparam T        the underlying type
+    /// \tparam Sentinel the value that represents the empty state
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, T Sentinel>
+    struct compact_optional_sentinel
+    {
+      static constexpr T empty_value() noexcept;
+      static constexpr bool is_empty( T value ) noexcept;
+    };
+
+    //=========================================================================
+    // class : compact_optional
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An optional that stores its empty state in a sentinel value of
+    ///        \p T, rather than in a separate flag
+    ///
+    /// A compact_optional<T> is exactly the size of \c T, whereas optional<T>
+    /// adds a bool and its padding; \c optional<std::uint32_t> is 8 bytes
+    /// and \c optional<T*> is 16, while their compact_optional counterparts
+    /// are 4 and 8 bytes respectively.
+    ///
+    /// The trade-off is that the sentinel itself is no longer a storable
+    /// value; storing it is a precondition violation.
+    ///
+    /// \tparam T      the underlying type. Must be copyable and assignable
+    /// \tparam Traits the compact_optional_traits describing the sentinel
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, typename Traits = compact_optional_traits<T>>
+    class compact_optional
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type  = T;
+      using traits_type = Traits;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a compact_optional that does not contain a value
+      constexpr compact_optional() noexcept;
+
+      /// \brief Constructs a compact_optional that does not contain a value
+      constexpr compact_optional( nullopt_t ) noexcept;
+
+      /// \brief Constructs a compact_optional that contains \p value
+      ///
+      /// \pre \p value is not the sentinel
+      ///
+      /// \param value the value to copy
+      constexpr compact_optional( const value_type& value );
+
+      /// \brief Constructs a compact_optional that contains \p value
+      ///
+      /// \pre \p value is not the sentinel
+      ///
+      /// \param value the value to move
+      constexpr compact_optional( value_type&& value );
+
+      /// \brief Constructs a compact_optional that contains a value
+      ///        direct-initialized from \p args
+      ///
+      /// \pre the constructed value is not the sentinel
+      ///
+      /// \param tag     the in_place tag
+      /// \param args... the arguments to pass to T's constructor
+      template<typename...Args>
+      constexpr explicit compact_optional( in_place_t tag, Args&&...args );
+
+      /// \brief Constructs a compact_optional from an optional
+      ///
+      /// \pre \p other does not contain the sentinel
+      ///
+      /// \param other the optional to copy
+      compact_optional( const optional<T>& other );
+
+      compact_optional( const compact_optional& other ) = default;
+      compact_optional( compact_optional&& other ) = default;
+
+      //-----------------------------------------------------------------------
+      // Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      compact_optional& operator=( const compact_optional& other ) = default;
+      compact_optional& operator=( compact_optional&& other ) = default;
+
+      /// \brief Clears the contained value
+      ///
+      /// \return reference to \c (*this)
+      compact_optional& operator=( nullopt_t ) noexcept;
+
+      /// \brief Assigns \p value to this compact_optional
+      ///
+      /// \pre \p value is not the sentinel
+      ///
+      /// \param value the value to assign
+      /// \return reference to \c (*this)
+      template<typename U,
+               typename = std::enable_if_t<std::is_same<std::decay_t<U>,T>::value>>
+      compact_optional& operator=( U&& value );
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      constexpr value_type* operator->() noexcept;
+
+      constexpr const value_type* operator->() const noexcept;
+
+      constexpr value_type& operator*() & noexcept;
+
+      constexpr value_type&& operator*() && noexcept;
+
+      constexpr const value_type& operator*() const& noexcept;
+
+      constexpr const value_type&& operator*() const&& noexcept;
+
+      /// \brief Checks whether \c *this contains a value
+      ///
+      /// \return \c true if \c *this contains a value, \c false if \c *this
+      ///         holds the sentinel
+      constexpr explicit operator bool() const noexcept;
+
+      /// \copydoc operator bool()
+      constexpr bool has_value() const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Returns the contained value
+      ///
+      /// \throws bad_optional_access if \c *this does not contain a value.
+      ///
+      /// \return the value of \c *this
+      constexpr value_type& value() &;
+
+      /// \copydoc value() &
+      constexpr const value_type& value() const &;
+
+      /// \copydoc value() &
+      constexpr value_type&& value() &&;
+
+      /// \copydoc value() &
+      constexpr const value_type&& value() const &&;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Returns the contained value if \c *this has a value,
+      ///        otherwise returns \p default_value.
+      ///
+      /// \param default_value the value to use in case \c *this is empty
+      /// \return the contained value, or \p default_value
+      template<typename U>
+      constexpr value_type value_or( U&& default_value ) const &;
+
+      /// \copydoc value_or( U&& ) const &
+      template<typename U>
+      constexpr value_type value_or( U&& default_value ) &&;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Swaps the contents with those of \p other
+      ///
+      /// \param other the compact_optional to exchange the contents with
+      void swap( compact_optional& other );
+
+      /// \brief Clears the contained value by storing the sentinel
+      void reset() noexcept;
+
+      /// \brief Replaces the contained value with one direct-initialized
+      ///        from \p args
+      ///
+      /// \pre the constructed value is not the sentinel
+      ///
+      /// \param args... the arguments to pass to the constructor
+      /// \return reference to the new value
+      template<typename...Args>
+      value_type& emplace( Args&&...args );
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      T m_value; ///< The value, or the sentinel when empty
+    };
+
+    //=========================================================================
+    // Equality Operators
+    //=========================================================================
+
+    //-------------------------------------------------------------------------
+    // Compare two compact_optional objects
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename Traits>
+    constexpr bool operator==( const compact_optional<T,Traits>& lhs,
+                                  const compact_optional<T,Traits>& rhs );
+
+    template<typename T, typename Traits>
+    constexpr bool operator!=( const compact_optional<T,Traits>& lhs,
+                                  const compact_optional<T,Traits>& rhs );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<( const compact_optional<T,Traits>& lhs,
+                                 const compact_optional<T,Traits>& rhs );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>( const compact_optional<T,Traits>& lhs,
+                                 const compact_optional<T,Traits>& rhs );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<=( const compact_optional<T,Traits>& lhs,
+                                  const compact_optional<T,Traits>& rhs );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>=( const compact_optional<T,Traits>& lhs,
+                                  const compact_optional<T,Traits>& rhs );
+
+    //-------------------------------------------------------------------------
+    // Compare a compact_optional object with a nullopt
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename Traits>
+    constexpr bool operator==( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator==( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator!=( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator!=( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator<( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator<( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator>( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator>( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator<=( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator<=( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator>=( const compact_optional<T,Traits>& opt, nullopt_t ) noexcept;
+
+    template<typename T, typename Traits>
+    constexpr bool operator>=( nullopt_t, const compact_optional<T,Traits>& opt ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Compare a compact_optional object with a T
+    //-------------------------------------------------------------------------
+
+    template<typename T, typename Traits>
+    constexpr bool operator==( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator==( const T& value, const compact_optional<T,Traits>& opt );
+
+    template<typename T, typename Traits>
+    constexpr bool operator!=( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator!=( const T& value, const compact_optional<T,Traits>& opt );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<( const T& value, const compact_optional<T,Traits>& opt );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>( const T& value, const compact_optional<T,Traits>& opt );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<=( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator<=( const T& value, const compact_optional<T,Traits>& opt );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>=( const compact_optional<T,Traits>& opt, const T& value );
+
+    template<typename T, typename Traits>
+    constexpr bool operator>=( const T& value, const compact_optional<T,Traits>& opt );
+
+    //-------------------------------------------------------------------------
+    // Non-member functions
+    //-------------------------------------------------------------------------
+
+    /// \brief Swaps \p lhs and \p rhs
+    ///
+    /// \param lhs the left compact_optional to swap
+    /// \param rhs the right compact_optional to swap
+    template<typename T, typename Traits>
+    void swap( compact_optional<T,Traits>& lhs, compact_optional<T,Traits>& rhs );
+
+    /// \brief Retrieves the hash from a given compact_optional
+    ///
+    /// An empty compact_optional hashes the same as an empty optional.
+    ///
+    /// \param opt the compact_optional to retrieve the hash from
+    /// \return the hash of the contained value, or 0
+    template<typename T, typename Traits>
+    constexpr hash_t hash_value( const compact_optional<T,Traits>& opt ) noexcept;
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/compact_optional.inl"
+
+#endif /* BIT_STL_UTILITIES_COMPACT_OPTIONAL_HPP */
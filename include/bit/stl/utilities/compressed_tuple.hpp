@@ -177,7 +177,7 @@ namespace bit {
         : compressed_tuple_storage<Idx,T0,std::is_empty<T0>::value && !std::is_final<T0>::value && !is_one_of<T0,Ts...>::value>,
           compressed_tuple_impl<Idx+1,Ts...>
       {
-        using storage_type = compressed_tuple_storage<Idx,T0,std::is_empty<T0>::value && !std::is_final<T0>::value>;
+        using storage_type = compressed_tuple_storage<Idx,T0,std::is_empty<T0>::value && !std::is_final<T0>::value && !is_one_of<T0,Ts...>::value>;
         using base_type = compressed_tuple_impl<Idx+1,Ts...>;
 
         //---------------------------------------------------------------------
@@ -290,7 +290,13 @@ namespace bit {
       /// \brief Constructs a compressed_tuple by copy-constructing each
       ///        element
       ///
+      /// \note This overload is only enabled for non-empty tuples, where it
+      ///       does not collide with the default constructor
+      ///
       /// \param args the arguments to copy
+#ifndef BIT_DOXYGEN_BUILD
+      template<bool B = (sizeof...(Types) > 0), typename = std::enable_if_t<B>>
+#endif
       explicit constexpr compressed_tuple( const Types&...args );
 
       // (3)
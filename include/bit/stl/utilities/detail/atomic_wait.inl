@@ -0,0 +1,112 @@
+#ifndef BIT_STL_UTILITIES_DETAIL_ATOMIC_WAIT_INL
+#define BIT_STL_UTILITIES_DETAIL_ATOMIC_WAIT_INL
+
+namespace bit {
+  namespace stl {
+    namespace detail {
+
+      /// Number of polls before yielding
+      constexpr int atomic_wait_spin_count  = 64;
+
+      /// Number of yields before parking
+      constexpr int atomic_wait_yield_count = 4;
+
+      inline void atomic_wait_pause()
+        noexcept
+      {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#endif
+      }
+
+#if defined(__linux__)
+
+      static_assert( sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                     "futex requires an unpadded atomic word" );
+
+      inline std::uint32_t* futex_address( const std::atomic<std::uint32_t>& word )
+        noexcept
+      {
+        return reinterpret_cast<std::uint32_t*>(
+          const_cast<std::atomic<std::uint32_t>*>(&word)
+        );
+      }
+
+      inline void atomic_park( const std::atomic<std::uint32_t>& word,
+                               std::uint32_t old )
+        noexcept
+      {
+        // The kernel rechecks the value, so a wake between the caller's
+        // load and this call is never lost
+        ::syscall( SYS_futex, futex_address(word), FUTEX_WAIT_PRIVATE,
+                   old, nullptr, nullptr, 0 );
+      }
+
+      inline void atomic_unpark( std::atomic<std::uint32_t>& word, int count )
+        noexcept
+      {
+        ::syscall( SYS_futex, futex_address(word), FUTEX_WAKE_PRIVATE,
+                   count, nullptr, nullptr, 0 );
+      }
+
+#else
+
+      inline void atomic_park( const std::atomic<std::uint32_t>&,
+                               std::uint32_t )
+        noexcept
+      {
+        std::this_thread::sleep_for( std::chrono::microseconds(50) );
+      }
+
+      inline void atomic_unpark( std::atomic<std::uint32_t>&, int )
+        noexcept
+      {
+
+      }
+
+#endif
+
+    } // namespace detail
+  } // namespace stl
+} // namespace bit
+
+//-----------------------------------------------------------------------------
+// Waiting
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::atomic_wait( const std::atomic<std::uint32_t>& word,
+                                   std::uint32_t old )
+  noexcept
+{
+  for( auto i = 0; i < detail::atomic_wait_spin_count; ++i ) {
+    if( word.load( std::memory_order_acquire ) != old ) return;
+    detail::atomic_wait_pause();
+  }
+
+  for( auto i = 0; i < detail::atomic_wait_yield_count; ++i ) {
+    if( word.load( std::memory_order_acquire ) != old ) return;
+    std::this_thread::yield();
+  }
+
+  while( word.load( std::memory_order_acquire ) == old ) {
+    detail::atomic_park( word, old );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Notification
+//-----------------------------------------------------------------------------
+
+inline void bit::stl::atomic_notify_one( std::atomic<std::uint32_t>& word )
+  noexcept
+{
+  detail::atomic_unpark( word, 1 );
+}
+
+inline void bit::stl::atomic_notify_all( std::atomic<std::uint32_t>& word )
+  noexcept
+{
+  detail::atomic_unpark( word, INT_MAX );
+}
+
+#endif /* BIT_STL_UTILITIES_DETAIL_ATOMIC_WAIT_INL */
@@ -0,0 +1,624 @@
+#ifndef BIT_STL_UTILITIES_DETAIL_COMPACT_OPTIONAL_INL
+#define BIT_STL_UTILITIES_DETAIL_COMPACT_OPTIONAL_INL
+
+//=============================================================================
+// compact_optional_traits
+//=============================================================================
+
+template<typename T>
+inline constexpr T* bit::stl::compact_optional_traits<T*>::empty_value()
+  noexcept
+{
+  return nullptr;
+}
+
+template<typename T>
+inline constexpr bool bit::stl::compact_optional_traits<T*>::is_empty( T* value )
+  noexcept
+{
+  return value == nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+// The sentinels are quiet NaNs with a payload that no arithmetic operation
+// produces, so they are compared by their bits rather than with isnan
+static_assert( std::numeric_limits<float>::is_iec559 && sizeof(float) == sizeof(std::uint32_t),
+               "compact_optional_traits<float> requires IEEE-754 binary32 floats" );
+static_assert( std::numeric_limits<double>::is_iec559 && sizeof(double) == sizeof(std::uint64_t),
+               "compact_optional_traits<double> requires IEEE-754 binary64 doubles" );
+
+inline float bit::stl::compact_optional_traits<float>::empty_value()
+  noexcept
+{
+  const auto bits = std::uint32_t{0x7fe5a5a5};
+
+  auto result = float{};
+  std::memcpy( &result, &bits, sizeof(result) );
+  return result;
+}
+
+inline bool bit::stl::compact_optional_traits<float>::is_empty( float value )
+  noexcept
+{
+  auto bits = std::uint32_t{};
+  std::memcpy( &bits, &value, sizeof(bits) );
+  return bits == 0x7fe5a5a5;
+}
+
+inline double bit::stl::compact_optional_traits<double>::empty_value()
+  noexcept
+{
+  const auto bits = std::uint64_t{0x7ffca5a5a5a5a5a5};
+
+  auto result = double{};
+  std::memcpy( &result, &bits, sizeof(result) );
+  return result;
+}
+
+inline bool bit::stl::compact_optional_traits<double>::is_empty( double value )
+  noexcept
+{
+  auto bits = std::uint64_t{};
+  std::memcpy( &bits, &value, sizeof(bits) );
+  return bits == 0x7ffca5a5a5a5a5a5;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline constexpr bit::stl::basic_hashed_string_view<CharT,Traits>
+  bit::stl::compact_optional_traits<bit::stl::basic_hashed_string_view<CharT,Traits>>
+  ::empty_value()
+  noexcept
+{
+  return basic_hashed_string_view<CharT,Traits>{};
+}
+
+template<typename CharT, typename Traits>
+inline constexpr bool
+  bit::stl::compact_optional_traits<bit::stl::basic_hashed_string_view<CharT,Traits>>
+  ::is_empty( const basic_hashed_string_view<CharT,Traits>& value )
+  noexcept
+{
+  return value.data() == nullptr;
+}
+
+//=============================================================================
+// compact_optional_sentinel
+//=============================================================================
+
+template<typename T, T Sentinel>
+inline constexpr T bit::stl::compact_optional_sentinel<T,Sentinel>::empty_value()
+  noexcept
+{
+  return Sentinel;
+}
+
+template<typename T, T Sentinel>
+inline constexpr bool bit::stl::compact_optional_sentinel<T,Sentinel>::is_empty( T value )
+  noexcept
+{
+  return value == Sentinel;
+}
+
+//=============================================================================
+// compact_optional
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::compact_optional<T,Traits>::compact_optional()
+  noexcept
+  : m_value(Traits::empty_value())
+{
+
+}
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::compact_optional<T,Traits>::compact_optional( nullopt_t )
+  noexcept
+  : compact_optional()
+{
+
+}
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::compact_optional<T,Traits>
+  ::compact_optional( const value_type& value )
+  : m_value(value)
+{
+  BIT_ASSERT( !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+}
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::compact_optional<T,Traits>
+  ::compact_optional( value_type&& value )
+  : m_value(std::move(value))
+{
+  BIT_ASSERT( !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+}
+
+template<typename T, typename Traits>
+template<typename...Args>
+inline constexpr bit::stl::compact_optional<T,Traits>
+  ::compact_optional( in_place_t, Args&&...args )
+  : m_value(std::forward<Args>(args)...)
+{
+  BIT_ASSERT( !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+}
+
+template<typename T, typename Traits>
+inline bit::stl::compact_optional<T,Traits>
+  ::compact_optional( const optional<T>& other )
+  : m_value(other ? *other : Traits::empty_value())
+{
+  BIT_ASSERT( !other || !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+}
+
+//-----------------------------------------------------------------------------
+// Assignment
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline bit::stl::compact_optional<T,Traits>&
+  bit::stl::compact_optional<T,Traits>::operator=( nullopt_t )
+  noexcept
+{
+  reset();
+  return (*this);
+}
+
+template<typename T, typename Traits>
+template<typename U, typename>
+inline bit::stl::compact_optional<T,Traits>&
+  bit::stl::compact_optional<T,Traits>::operator=( U&& value )
+{
+  m_value = std::forward<U>(value);
+
+  BIT_ASSERT( !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type*
+  bit::stl::compact_optional<T,Traits>::operator->()
+  noexcept
+{
+  return &m_value;
+}
+
+template<typename T, typename Traits>
+inline constexpr const typename bit::stl::compact_optional<T,Traits>::value_type*
+  bit::stl::compact_optional<T,Traits>::operator->()
+  const noexcept
+{
+  return &m_value;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type&
+  bit::stl::compact_optional<T,Traits>::operator*()
+  & noexcept
+{
+  return m_value;
+}
+
+template<typename T, typename Traits>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type&&
+  bit::stl::compact_optional<T,Traits>::operator*()
+  && noexcept
+{
+  return std::move(m_value);
+}
+
+template<typename T, typename Traits>
+inline constexpr const typename bit::stl::compact_optional<T,Traits>::value_type&
+  bit::stl::compact_optional<T,Traits>::operator*()
+  const & noexcept
+{
+  return m_value;
+}
+
+template<typename T, typename Traits>
+inline constexpr const typename bit::stl::compact_optional<T,Traits>::value_type&&
+  bit::stl::compact_optional<T,Traits>::operator*()
+  const && noexcept
+{
+  return std::move(m_value);
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::compact_optional<T,Traits>::operator bool()
+  const noexcept
+{
+  return has_value();
+}
+
+template<typename T, typename Traits>
+inline constexpr bool bit::stl::compact_optional<T,Traits>::has_value()
+  const noexcept
+{
+  return !Traits::is_empty(m_value);
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type&
+  bit::stl::compact_optional<T,Traits>::value()
+  &
+{
+  return has_value() ? m_value : throw bad_optional_access();
+}
+
+template<typename T, typename Traits>
+inline constexpr const typename bit::stl::compact_optional<T,Traits>::value_type&
+  bit::stl::compact_optional<T,Traits>::value()
+  const &
+{
+  return has_value() ? m_value : throw bad_optional_access();
+}
+
+template<typename T, typename Traits>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type&&
+  bit::stl::compact_optional<T,Traits>::value()
+  &&
+{
+  return has_value() ? std::move(m_value) : throw bad_optional_access();
+}
+
+template<typename T, typename Traits>
+inline constexpr const typename bit::stl::compact_optional<T,Traits>::value_type&&
+  bit::stl::compact_optional<T,Traits>::value()
+  const &&
+{
+  return has_value() ? std::move(m_value) : throw bad_optional_access();
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+template<typename U>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type
+  bit::stl::compact_optional<T,Traits>::value_or( U&& default_value )
+  const &
+{
+  return has_value() ? m_value : static_cast<value_type>(std::forward<U>(default_value));
+}
+
+template<typename T, typename Traits>
+template<typename U>
+inline constexpr typename bit::stl::compact_optional<T,Traits>::value_type
+  bit::stl::compact_optional<T,Traits>::value_or( U&& default_value )
+  &&
+{
+  return has_value() ? std::move(m_value) : static_cast<value_type>(std::forward<U>(default_value));
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline void bit::stl::compact_optional<T,Traits>::swap( compact_optional& other )
+{
+  using std::swap;
+
+  swap( m_value, other.m_value );
+}
+
+template<typename T, typename Traits>
+inline void bit::stl::compact_optional<T,Traits>::reset()
+  noexcept
+{
+  m_value = Traits::empty_value();
+}
+
+template<typename T, typename Traits>
+template<typename...Args>
+inline typename bit::stl::compact_optional<T,Traits>::value_type&
+  bit::stl::compact_optional<T,Traits>::emplace( Args&&...args )
+{
+  m_value = value_type( std::forward<Args>(args)... );
+
+  BIT_ASSERT( !Traits::is_empty(m_value),
+              "compact_optional: the sentinel cannot be stored as a value" );
+  return m_value;
+}
+
+//=============================================================================
+// Equality Operators
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Compare two compact_optional objects
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator==( const compact_optional<T,Traits>& lhs,
+                       const compact_optional<T,Traits>& rhs )
+{
+  if(static_cast<bool>(lhs) != static_cast<bool>(rhs)) return false;
+  if(!static_cast<bool>(lhs)) return true;
+  return *lhs == *rhs;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator!=( const compact_optional<T,Traits>& lhs,
+                       const compact_optional<T,Traits>& rhs )
+{
+  if(static_cast<bool>(lhs) != static_cast<bool>(rhs)) return true;
+  if(!static_cast<bool>(lhs)) return false;
+  return *lhs != *rhs;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<( const compact_optional<T,Traits>& lhs,
+                      const compact_optional<T,Traits>& rhs )
+{
+  if(!static_cast<bool>(rhs)) return false;
+  if(!static_cast<bool>(lhs)) return true;
+  return *lhs < *rhs;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>( const compact_optional<T,Traits>& lhs,
+                      const compact_optional<T,Traits>& rhs )
+{
+  if(!static_cast<bool>(lhs)) return false;
+  if(!static_cast<bool>(rhs)) return true;
+  return *lhs > *rhs;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<=( const compact_optional<T,Traits>& lhs,
+                       const compact_optional<T,Traits>& rhs )
+{
+  if(!static_cast<bool>(lhs)) return true;
+  if(!static_cast<bool>(rhs)) return false;
+  return *lhs <= *rhs;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>=( const compact_optional<T,Traits>& lhs,
+                       const compact_optional<T,Traits>& rhs )
+{
+  if(!static_cast<bool>(rhs)) return true;
+  if(!static_cast<bool>(lhs)) return false;
+  return *lhs >= *rhs;
+}
+
+//-----------------------------------------------------------------------------
+// Compare a compact_optional object with a nullopt
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator==( const compact_optional<T,Traits>& opt, nullopt_t )
+  noexcept
+{
+  return !opt;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator==( nullopt_t, const compact_optional<T,Traits>& opt )
+  noexcept
+{
+  return !opt;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator!=( const compact_optional<T,Traits>& opt, nullopt_t )
+  noexcept
+{
+  return static_cast<bool>(opt);
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator!=( nullopt_t, const compact_optional<T,Traits>& opt )
+  noexcept
+{
+  return static_cast<bool>(opt);
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<( const compact_optional<T,Traits>&, nullopt_t )
+  noexcept
+{
+  return false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<( nullopt_t, const compact_optional<T,Traits>& opt )
+  noexcept
+{
+  return static_cast<bool>(opt);
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>( const compact_optional<T,Traits>& opt, nullopt_t )
+  noexcept
+{
+  return static_cast<bool>(opt);
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>( nullopt_t, const compact_optional<T,Traits>& )
+  noexcept
+{
+  return false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<=( const compact_optional<T,Traits>& opt, nullopt_t )
+  noexcept
+{
+  return !opt;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<=( nullopt_t, const compact_optional<T,Traits>& )
+  noexcept
+{
+  return true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>=( const compact_optional<T,Traits>&, nullopt_t )
+  noexcept
+{
+  return true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>=( nullopt_t, const compact_optional<T,Traits>& opt )
+  noexcept
+{
+  return !opt;
+}
+
+//-----------------------------------------------------------------------------
+// Compare a compact_optional object with a T
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator==( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt == value : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator==( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value == *opt : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator!=( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt != value : true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator!=( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value != *opt : true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt < value : true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value < *opt : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt > value : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value > *opt : true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<=( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt <= value : true;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator<=( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value <= *opt : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>=( const compact_optional<T,Traits>& opt, const T& value )
+{
+  return static_cast<bool>(opt) ? *opt >= value : false;
+}
+
+template<typename T, typename Traits>
+inline constexpr bool
+  bit::stl::operator>=( const T& value, const compact_optional<T,Traits>& opt )
+{
+  return static_cast<bool>(opt) ? value >= *opt : true;
+}
+
+//-----------------------------------------------------------------------------
+// Non-member functions
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Traits>
+inline void bit::stl::swap( compact_optional<T,Traits>& lhs,
+                            compact_optional<T,Traits>& rhs )
+{
+  lhs.swap(rhs);
+}
+
+template<typename T, typename Traits>
+inline constexpr bit::stl::hash_t
+  bit::stl::hash_value( const compact_optional<T,Traits>& opt )
+  noexcept
+{
+  if( opt ) {
+    return hash_value( *opt );
+  }
+  return static_cast<hash_t>(0);
+}
+
+#endif /* BIT_STL_UTILITIES_DETAIL_COMPACT_OPTIONAL_INL */
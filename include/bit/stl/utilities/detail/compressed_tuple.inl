@@ -151,6 +151,16 @@ inline void bit::stl::detail::compressed_tuple_storage<Idx,T,false>
 // Constructors
 //-----------------------------------------------------------------------------
 
+template<std::size_t Idx, typename T0, typename...Ts>
+inline constexpr bit::stl::detail::compressed_tuple_impl<Idx,T0,Ts...>
+  ::compressed_tuple_impl()
+  noexcept
+  : storage_type(),
+    base_type()
+{
+
+}
+
 template<std::size_t Idx, typename T0, typename...Ts>
 template<typename Arg0, typename...Args>
 inline constexpr bit::stl::detail::compressed_tuple_impl<Idx,T0,Ts...>
@@ -210,6 +220,14 @@ inline void bit::stl::detail::compressed_tuple_impl<Idx,T0,Ts...>
 // Constructors
 //-----------------------------------------------------------------------------
 
+template<std::size_t Idx>
+inline constexpr bit::stl::detail::compressed_tuple_impl<Idx>
+  ::compressed_tuple_impl()
+  noexcept
+{
+
+}
+
 template<std::size_t Idx>
 inline constexpr bit::stl::detail::compressed_tuple_impl<Idx>
   ::compressed_tuple_impl( in_place_t )
@@ -266,9 +284,10 @@ inline void bit::stl::detail::compressed_tuple_impl<Idx>
 
 // (2)
 template<typename...Types>
+template<bool B, typename>
 inline constexpr bit::stl::compressed_tuple<Types...>
   ::compressed_tuple( const Types&...args )
-  : base_type( in_place, std::piecewise_construct, args... )
+  : base_type( in_place, args... )
 {
 
 }
@@ -52,6 +52,366 @@ inline const Enum*
   return nullptr;
 }
 
+//=============================================================================
+// Registered enums
+//=============================================================================
+
+namespace bit { namespace stl { namespace detail {
+
+  // These are deliberately not constexpr: reaching either while building an
+  // enum_table is a compile error that names the problem
+  inline void enum_registered_names_must_be_unique() noexcept{}
+  inline void enum_perfect_hash_not_found() noexcept{}
+
+  /// \brief Rounds \p n up to the next power of two
+  constexpr std::size_t enum_table_pow2( std::size_t n )
+    noexcept
+  {
+    auto result = std::size_t{1};
+    while( result < n ) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  /// \brief Mixes the hash of a name with the seed of its bucket
+  constexpr std::size_t enum_table_mix( std::size_t hash, std::size_t seed )
+    noexcept
+  {
+    const auto x = (hash ^ seed) * static_cast<std::size_t>(0x9e3779b97f4a7c15ull);
+
+    return x ^ (x >> (sizeof(std::size_t) * 4));
+  }
+
+  /// \brief The offset of \p e from \p first, in the unsigned domain so that
+  ///        it is defined for any pair of values
+  template<typename Enum>
+  constexpr std::uintmax_t enum_table_offset( Enum e, Enum first )
+    noexcept
+  {
+    using underlying_type = std::underlying_type_t<Enum>;
+
+    return static_cast<std::uintmax_t>(static_cast<underlying_type>(e)) -
+           static_cast<std::uintmax_t>(static_cast<underlying_type>(first));
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// \brief The compile-time tables of a registered enum
+  ///
+  /// Names are found with a hash-and-displace perfect hash: the hash of a
+  /// name selects a bucket, and the seed of that bucket displaces the name
+  /// into a slot that no other name occupies. A lookup is therefore one hash,
+  /// two loads, and a single string comparison.
+  ///
+  /// Values are found by their offset from the first enumerator when the
+  /// enumerators are sequential, and by a binary search otherwise.
+  ///
+  /// \tparam Enum the enum type
+  /// \tparam N the number of registered enumerators
+  ///////////////////////////////////////////////////////////////////////////
+  template<typename Enum, std::size_t N>
+  struct enum_table
+  {
+    static constexpr std::size_t bucket_count = enum_table_pow2( N / 2 + 1 );
+    static constexpr std::size_t slot_count   = enum_table_pow2( N * 2 );
+
+    Enum        values[N];
+    const char* names[N];
+    std::size_t lengths[N];
+    std::size_t order[N];               ///< indices, sorted by value
+    std::size_t seeds[bucket_count];
+    std::size_t slots[slot_count];      ///< index + 1 of each name, or 0
+    bool        is_sequential;          ///< whether values[i] is values[0] + i
+
+    constexpr enum_table() noexcept
+      : values{},
+        names{},
+        lengths{},
+        order{},
+        seeds{},
+        slots{},
+        is_sequential(true)
+    {
+
+    }
+
+    /// \brief Finds the index of the first enumerator with the value \p e
+    ///
+    /// \return the index, or \c N if \p e is not registered
+    constexpr std::size_t find_value( Enum e ) const noexcept;
+
+    /// \brief Finds the index of the enumerator named by \p str
+    ///
+    /// \return the index, or \c N if \p str is not registered
+    constexpr std::size_t find_name( const char* str,
+                                     std::size_t count ) const noexcept;
+  };
+
+  template<typename Enum, std::size_t N>
+  inline constexpr std::size_t enum_table<Enum,N>::find_value( Enum e )
+    const noexcept
+  {
+    if( is_sequential ) {
+      const auto offset = enum_table_offset( e, values[0] );
+
+      return (offset < N) ? static_cast<std::size_t>(offset) : N;
+    }
+
+    using underlying_type = std::underlying_type_t<Enum>;
+
+    const auto value = static_cast<underlying_type>(e);
+    auto first = std::size_t{0};
+    auto count = N;
+
+    while( count > 0 ) {
+      const auto step = count / 2;
+      if( static_cast<underlying_type>(values[order[first + step]]) < value ) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+
+    if( first != N && static_cast<underlying_type>(values[order[first]]) == value ) {
+      return order[first];
+    }
+    return N;
+  }
+
+  template<typename Enum, std::size_t N>
+  inline constexpr std::size_t enum_table<Enum,N>::find_name( const char* str,
+                                                              std::size_t count )
+    const noexcept
+  {
+    const auto hash = static_cast<std::size_t>(hash_string_segment( str, count ));
+    const auto seed = seeds[hash & (bucket_count - 1)];
+    const auto slot = slots[enum_table_mix( hash, seed ) & (slot_count - 1)];
+
+    if( slot == 0 || lengths[slot - 1] != count ) {
+      return N;
+    }
+
+    const auto* name = names[slot - 1];
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      if( name[i] != str[i] ) {
+        return N;
+      }
+    }
+    return slot - 1;
+  }
+
+  //-------------------------------------------------------------------------
+
+  /// \brief Builds the enum_table of the enumerators in \p Registry
+  ///
+  /// \tparam Registry the enum_registry specialization of the enum
+  template<typename Registry>
+  constexpr enum_table<typename Registry::enum_type,Registry::size>
+    make_enum_table()
+  {
+    using enum_type  = typename Registry::enum_type;
+    using table_type = enum_table<enum_type,Registry::size>;
+
+    constexpr auto size         = Registry::size;
+    constexpr auto bucket_count = table_type::bucket_count;
+    constexpr auto slot_count   = table_type::slot_count;
+    constexpr auto max_seed     = std::size_t{1} << 16;
+
+    auto table = table_type{};
+    std::size_t hashes[size] = {};
+
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      table.values[i] = Registry::value(i);
+      table.names[i]  = Registry::name(i);
+
+      auto length = std::size_t{0};
+      while( table.names[i][length] != '\0' ) {
+        ++length;
+      }
+      table.lengths[i] = length;
+      hashes[i] = static_cast<std::size_t>(hash_string_segment( table.names[i], length ));
+
+      if( enum_table_offset( table.values[i], table.values[0] ) != i ) {
+        table.is_sequential = false;
+      }
+    }
+
+    // Sort the indices by value; the sort is stable, so that an alias
+    // converts to the name of the enumerator registered first
+    using underlying_type = std::underlying_type_t<enum_type>;
+
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      const auto value = static_cast<underlying_type>(table.values[i]);
+      auto j = i;
+
+      for( ; j > 0 && static_cast<underlying_type>(table.values[table.order[j - 1]]) > value; --j ) {
+        table.order[j] = table.order[j - 1];
+      }
+      table.order[j] = i;
+    }
+
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      for( auto j = std::size_t{0}; j < i; ++j ) {
+        if( table.lengths[i] != table.lengths[j] ) {
+          continue;
+        }
+
+        auto k = std::size_t{0};
+        while( k < table.lengths[i] && table.names[i][k] == table.names[j][k] ) {
+          ++k;
+        }
+        if( k == table.lengths[i] ) {
+          enum_registered_names_must_be_unique();
+        }
+      }
+    }
+
+    // Displace the largest buckets first, while the most slots are free
+    std::size_t bucket_sizes[bucket_count] = {};
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      ++bucket_sizes[hashes[i] & (bucket_count - 1)];
+    }
+
+    for( auto bucket_size = size; bucket_size > 0; --bucket_size ) {
+      for( auto bucket = std::size_t{0}; bucket < bucket_count; ++bucket ) {
+        if( bucket_sizes[bucket] != bucket_size ) {
+          continue;
+        }
+
+        std::size_t members[size] = {};
+        std::size_t candidates[size] = {};
+        auto count = std::size_t{0};
+
+        for( auto i = std::size_t{0}; i < size; ++i ) {
+          if( (hashes[i] & (bucket_count - 1)) == bucket ) {
+            members[count++] = i;
+          }
+        }
+
+        auto seed = std::size_t{0};
+        for( ; seed < max_seed; ++seed ) {
+          auto is_free = true;
+
+          for( auto i = std::size_t{0}; i < count && is_free; ++i ) {
+            const auto slot = enum_table_mix( hashes[members[i]], seed ) & (slot_count - 1);
+
+            is_free = (table.slots[slot] == 0);
+            for( auto j = std::size_t{0}; j < i && is_free; ++j ) {
+              is_free = (candidates[j] != slot);
+            }
+            candidates[i] = slot;
+          }
+
+          if( is_free ) {
+            break;
+          }
+        }
+
+        if( seed == max_seed ) {
+          enum_perfect_hash_not_found();
+        }
+
+        table.seeds[bucket] = seed;
+        for( auto i = std::size_t{0}; i < count; ++i ) {
+          table.slots[candidates[i]] = members[i] + 1;
+        }
+      }
+    }
+
+    return table;
+  }
+
+  //-------------------------------------------------------------------------
+
+  /// \brief The enumerators of an enum, as registered by BIT_REGISTER_ENUM
+  ///
+  /// Specializations provide \c enum_type, the number of enumerators as
+  /// \c size, and the constexpr functions \c value(i) and \c name(i)
+  template<typename Enum>
+  struct enum_registry;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// \brief The enum_traits of an enum registered by BIT_REGISTER_ENUM
+  ///
+  /// \tparam Enum the enum type
+  ///////////////////////////////////////////////////////////////////////////
+  template<typename Enum>
+  struct registered_enum_traits
+  {
+    static constexpr bool is_bitmask = is_enum_bitmask<Enum>::value;
+
+    static const char* to_string( Enum e );
+
+    static Enum from_string( string_view s );
+
+    static constexpr const Enum* begin() noexcept;
+
+    static constexpr const Enum* end() noexcept;
+
+  private:
+
+    using registry_type = enum_registry<Enum>;
+    using table_type    = enum_table<Enum,registry_type::size>;
+
+    static constexpr table_type table = make_enum_table<registry_type>();
+  };
+
+  template<typename Enum>
+  constexpr bool registered_enum_traits<Enum>::is_bitmask;
+
+  template<typename Enum>
+  constexpr typename registered_enum_traits<Enum>::table_type
+    registered_enum_traits<Enum>::table;
+
+  template<typename Enum>
+  inline const char* registered_enum_traits<Enum>::to_string( Enum e )
+  {
+    const auto index = table.find_value( e );
+
+    if( index == registry_type::size ) {
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+      throw bad_enum_cast("bad_enum_cast: value is not a registered enumerator");
+#else
+      BIT_ALWAYS_ASSERT(false,"bad_enum_cast: value is not a registered enumerator");
+#endif
+    }
+
+    return table.names[index];
+  }
+
+  template<typename Enum>
+  inline Enum registered_enum_traits<Enum>::from_string( string_view s )
+  {
+    const auto index = table.find_name( s.data(), s.size() );
+
+    if( index == registry_type::size ) {
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+      throw bad_enum_cast("bad_enum_cast: string does not name a registered enumerator");
+#else
+      BIT_ALWAYS_ASSERT(false,"bad_enum_cast: string does not name a registered enumerator");
+#endif
+    }
+
+    return table.values[index];
+  }
+
+  template<typename Enum>
+  inline constexpr const Enum* registered_enum_traits<Enum>::begin()
+    noexcept
+  {
+    return table.values;
+  }
+
+  template<typename Enum>
+  inline constexpr const Enum* registered_enum_traits<Enum>::end()
+    noexcept
+  {
+    return table.values + registry_type::size;
+  }
+
+} } } // namespace bit::stl::detail
+
 //=============================================================================
 // X.Y.3, class enum_range
 //=============================================================================
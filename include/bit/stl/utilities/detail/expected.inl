@@ -251,6 +251,26 @@ inline constexpr bit::stl::detail::expected_base<true,T,E>
 
 }
 
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::detail::expected_base<true,T,E>
+  ::expected_base( expected_invoke_value_t tag, Fn&& fn, Args&&...args )
+  : m_storage( tag, std::forward<Fn>(fn), std::forward<Args>(args)... ),
+    m_has_value(true)
+{
+
+}
+
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::detail::expected_base<true,T,E>
+  ::expected_base( expected_invoke_error_t tag, Fn&& fn, Args&&...args )
+  : m_storage( tag, std::forward<Fn>(fn), std::forward<Args>(args)... ),
+    m_has_value(false)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
@@ -294,7 +314,7 @@ inline constexpr T&&
   bit::stl::detail::expected_base<true,T,E>::get_value()
   && noexcept
 {
-  return m_storage.value;
+  return std::move(m_storage.value);
 }
 
 template<typename T, typename E>
@@ -310,7 +330,7 @@ inline constexpr const T&&
   bit::stl::detail::expected_base<true,T,E>::get_value()
   const && noexcept
 {
-  return m_storage.value;
+  return std::move(m_storage.value);
 }
 
 //-----------------------------------------------------------------------------
@@ -328,7 +348,7 @@ inline constexpr  bit::stl::unexpected_type<E>&&
   bit::stl::detail::expected_base<true,T,E>::get_unexpected()
   && noexcept
 {
-  return m_storage.error;
+  return std::move(m_storage.error);
 }
 
 template<typename T, typename E>
@@ -344,7 +364,7 @@ inline constexpr const  bit::stl::unexpected_type<E>&&
   bit::stl::detail::expected_base<true,T,E>::get_unexpected()
   const && noexcept
 {
-  return m_storage.error;
+  return std::move(m_storage.error);
 }
 
 //-----------------------------------------------------------------------------
@@ -447,6 +467,26 @@ inline constexpr bit::stl::detail::expected_base<false,T,E>
 
 }
 
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::detail::expected_base<false,T,E>
+  ::expected_base( expected_invoke_value_t tag, Fn&& fn, Args&&...args )
+  : m_storage( tag, std::forward<Fn>(fn), std::forward<Args>(args)... ),
+    m_has_value(true)
+{
+
+}
+
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::detail::expected_base<false,T,E>
+  ::expected_base( expected_invoke_error_t tag, Fn&& fn, Args&&...args )
+  : m_storage( tag, std::forward<Fn>(fn), std::forward<Args>(args)... ),
+    m_has_value(false)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 
 template<typename T, typename E>
@@ -496,7 +536,7 @@ inline constexpr T&&
   bit::stl::detail::expected_base<false,T,E>::get_value()
   && noexcept
 {
-  return m_storage.value;
+  return std::move(m_storage.value);
 }
 
 template<typename T, typename E>
@@ -512,7 +552,7 @@ inline constexpr const T&&
   bit::stl::detail::expected_base<false,T,E>::get_value()
   const && noexcept
 {
-  return m_storage.value;
+  return std::move(m_storage.value);
 }
 
 //-----------------------------------------------------------------------------
@@ -530,7 +570,7 @@ inline constexpr  bit::stl::unexpected_type<E>&&
   bit::stl::detail::expected_base<false,T,E>::get_unexpected()
   && noexcept
 {
-  return m_storage.error;
+  return std::move(m_storage.error);
 }
 
 template<typename T, typename E>
@@ -546,7 +586,7 @@ inline constexpr const  bit::stl::unexpected_type<E>&&
   bit::stl::detail::expected_base<false,T,E>::get_unexpected()
   const && noexcept
 {
-  return m_storage.error;
+  return std::move(m_storage.error);
 }
 
 //-----------------------------------------------------------------------------
@@ -559,7 +599,7 @@ inline void bit::stl::detail::expected_base<false,T,E>::destruct()
   if( m_has_value ) {
     m_storage.value.~T();
   } else if( !m_has_value ) {
-    m_storage.error.~E();
+    m_storage.error.~unexpected_type<E>();
   }
 }
 
@@ -649,7 +689,7 @@ inline constexpr bit::stl::expected<T,E>::expected()
 
 template<typename T, typename E>
 inline bit::stl::expected<T,E>
-  ::expected( enable_overload_if<std::is_copy_constructible<T>::value &&
+  ::expected( enable_overload_if_t<std::is_copy_constructible<T>::value &&
                                  std::is_copy_constructible<E>::value,
                                  const expected&> other )
   : base_type()
@@ -663,7 +703,7 @@ inline bit::stl::expected<T,E>
 
 template<typename T, typename E>
 inline bit::stl::expected<T,E>
-  ::expected( enable_overload_if<std::is_move_constructible<T>::value &&
+  ::expected( enable_overload_if_t<std::is_move_constructible<T>::value &&
                                  std::is_move_constructible<E>::value,
                                  expected&&> other )
   : base_type()
@@ -750,6 +790,15 @@ inline constexpr bit::stl::expected<T,E>
 
 }
 
+template<typename T, typename E>
+template<typename UError, typename>
+inline constexpr bit::stl::expected<T,E>
+  ::expected( unexpected_type<E>&& unexpected )
+  : base_type( unexpect, std::move(unexpected.value()) )
+{
+
+}
+
 template<typename T, typename E>
 template<typename Err, typename>
 inline constexpr bit::stl::expected<T,E>
@@ -781,6 +830,26 @@ inline constexpr bit::stl::expected<T,E>
 
 //-----------------------------------------------------------------------------
 
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::expected<T,E>
+  ::expected( detail::expected_invoke_value_t tag, Fn&& fn, Args&&...args )
+  : base_type( tag, std::forward<Fn>(fn), std::forward<Args>(args)... )
+{
+
+}
+
+template<typename T, typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::expected<T,E>
+  ::expected( detail::expected_invoke_error_t tag, Fn&& fn, Args&&...args )
+  : base_type( tag, std::forward<Fn>(fn), std::forward<Args>(args)... )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
 template<typename T, typename E>
 template<typename U, typename F, typename>
 inline bit::stl::expected<T,E>& bit::stl::expected<T,E>
@@ -920,7 +989,7 @@ template<typename T, typename E>
 inline constexpr T&& bit::stl::expected<T,E>::operator*()
   &&
 {
-  return base_type::get_value();
+  return std::move(base_type::get_value());
 }
 
 template<typename T, typename E>
@@ -934,7 +1003,7 @@ template<typename T, typename E>
 inline constexpr const T&& bit::stl::expected<T,E>::operator*()
   const &&
 {
-  return base_type::get_value();
+  return std::move(base_type::get_value());
 }
 
 //-----------------------------------------------------------------------------
@@ -1018,7 +1087,7 @@ template<typename U>
 inline constexpr T bit::stl::expected<T,E>::value_or( U&& default_value )
   &&
 {
-  return bool(*this) ? base_type::get_value() : std::forward<U>(default_value);
+  return bool(*this) ? std::move(base_type::get_value()) : std::forward<U>(default_value);
 }
 
 //-----------------------------------------------------------------------------
@@ -1064,7 +1133,7 @@ template<typename U>
 inline constexpr E bit::stl::expected<T,E>::error_or( U&& default_value )
   &&
 {
-  return !bool(*this) ? base_type::get_unexpected().value() : std::forward<U>(default_value);
+  return !bool(*this) ? std::move(base_type::get_unexpected().value()) : std::forward<U>(default_value);
 }
 
 //-----------------------------------------------------------------------------
@@ -1138,19 +1207,205 @@ inline constexpr const bit::stl::unexpected_type<E>&&
 // Monadic Functions
 //-----------------------------------------------------------------------------
 
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,T&>
+  bit::stl::expected<T,E>::and_then( Fn&& fn )
+  &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,T&>;
+
+  return and_then_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,T&&>
+  bit::stl::expected<T,E>::and_then( Fn&& fn )
+  &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,T&&>;
+
+  return and_then_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const T&>
+  bit::stl::expected<T,E>::and_then( Fn&& fn )
+  const &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const T&>;
+
+  return and_then_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const T&&>
+  bit::stl::expected<T,E>::and_then( Fn&& fn )
+  const &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const T&&>;
+
+  return and_then_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn,T&>,E>
+  bit::stl::expected<T,E>::transform( Fn&& fn )
+  &
+{
+  using value_type  = detail::expected_invoke_result_t<Fn,T&>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( *this, std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn,T&&>,E>
+  bit::stl::expected<T,E>::transform( Fn&& fn )
+  &&
+{
+  using value_type  = detail::expected_invoke_result_t<Fn,T&&>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( std::move(*this), std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn,const T&>,E>
+  bit::stl::expected<T,E>::transform( Fn&& fn )
+  const &
+{
+  using value_type  = detail::expected_invoke_result_t<Fn,const T&>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( *this, std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn,const T&&>,E>
+  bit::stl::expected<T,E>::transform( Fn&& fn )
+  const &&
+{
+  using value_type  = detail::expected_invoke_result_t<Fn,const T&&>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( std::move(*this), std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,E&>
+  bit::stl::expected<T,E>::or_else( Fn&& fn )
+  &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,E&>;
+
+  return or_else_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,E&&>
+  bit::stl::expected<T,E>::or_else( Fn&& fn )
+  &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,E&&>;
+
+  return or_else_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const E&>
+  bit::stl::expected<T,E>::or_else( Fn&& fn )
+  const &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const E&>;
+
+  return or_else_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const E&&>
+  bit::stl::expected<T,E>::or_else( Fn&& fn )
+  const &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const E&&>;
+
+  return or_else_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<T,bit::stl::detail::expected_invoke_result_t<Fn,E&>>
+  bit::stl::expected<T,E>::transform_error( Fn&& fn )
+  &
+{
+  using result_type = expected<T,detail::expected_invoke_result_t<Fn,E&>>;
+
+  return transform_error_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<T,bit::stl::detail::expected_invoke_result_t<Fn,E&&>>
+  bit::stl::expected<T,E>::transform_error( Fn&& fn )
+  &&
+{
+  using result_type = expected<T,detail::expected_invoke_result_t<Fn,E&&>>;
+
+  return transform_error_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<T,bit::stl::detail::expected_invoke_result_t<Fn,const E&>>
+  bit::stl::expected<T,E>::transform_error( Fn&& fn )
+  const &
+{
+  using result_type = expected<T,detail::expected_invoke_result_t<Fn,const E&>>;
+
+  return transform_error_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename T, typename E>
+template<typename Fn>
+inline bit::stl::expected<T,bit::stl::detail::expected_invoke_result_t<Fn,const E&&>>
+  bit::stl::expected<T,E>::transform_error( Fn&& fn )
+  const &&
+{
+  using result_type = expected<T,detail::expected_invoke_result_t<Fn,const E&&>>;
+
+  return transform_error_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
 template<typename T, typename E>
 template<typename Fn, typename>
 bit::stl::invoke_result_t<Fn,const T&>
   bit::stl::expected<T,E>::flat_map( Fn&& fn )
   const
 {
-  if( has_value() ) return std::forward<Fn>(fn);
-  else if( has_error() ) return { get_unexpected() };
-#if BIT_COMPILER_EXCEPTIONS_ENABLED
-  throw bad_expected_access<void>{};
-#else
-  BIT_ALWAYS_ASSERT( has_error(), "expected must have error" );
-#endif
+  return and_then( std::forward<Fn>(fn) );
 }
 
 template<typename T, typename E>
@@ -1159,13 +1414,79 @@ bit::stl::expected<bit::stl::invoke_result_t<Fn,const T&>,E>
   bit::stl::expected<T,E>::map( Fn&& fn )
   const
 {
-  if( has_value() ) return { std::forward<Fn>(fn) };
-  else if( has_error() ) return { get_unexpected() };
-#if BIT_COMPILER_EXCEPTIONS_ENABLED
-  throw bad_expected_access<void>{};
-#else
-  BIT_ALWAYS_ASSERT( has_error(), "expected must have error" );
-#endif
+  return transform( std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T, typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<T,E>::and_then_impl( Self&& self, Fn&& fn )
+{
+  static_assert( is_expected<Result>::value,
+                 "and_then: fn must return an expected" );
+  static_assert( std::is_same<typename Result::error_type,E>::value,
+                 "and_then: fn must return an expected with the same error type" );
+
+  if( self.has_value() ) {
+    return ::bit::stl::invoke( std::forward<Fn>(fn), *std::forward<Self>(self) );
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename T, typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<T,E>::transform_impl( Self&& self,
+                                                       Fn&& fn,
+                                                       std::false_type )
+{
+  if( self.has_value() ) {
+    return Result( detail::expected_invoke_value_t{0},
+                   std::forward<Fn>(fn), *std::forward<Self>(self) );
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename T, typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<T,E>::transform_impl( Self&& self,
+                                                       Fn&& fn,
+                                                       std::true_type )
+{
+  if( self.has_value() ) {
+    ::bit::stl::invoke( std::forward<Fn>(fn), *std::forward<Self>(self) );
+    return Result();
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename T, typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<T,E>::or_else_impl( Self&& self, Fn&& fn )
+{
+  static_assert( is_expected<Result>::value,
+                 "or_else: fn must return an expected" );
+  static_assert( std::is_same<typename Result::value_type,T>::value,
+                 "or_else: fn must return an expected with the same value type" );
+
+  if( self.has_value() ) {
+    return Result( in_place, *std::forward<Self>(self) );
+  }
+  return ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Self>(self).error() );
+}
+
+template<typename T, typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<T,E>::transform_error_impl( Self&& self,
+                                                             Fn&& fn )
+{
+  if( self.has_value() ) {
+    return Result( in_place, *std::forward<Self>(self) );
+  }
+  return Result( detail::expected_invoke_error_t{0},
+                 std::forward<Fn>(fn), std::forward<Self>(self).error() );
 }
 
 //=============================================================================
@@ -1185,22 +1506,26 @@ inline constexpr bit::stl::expected<void,E>::expected()
 
 template<typename E>
 inline bit::stl::expected<void,E>
-  ::expected( enable_overload_if<std::is_copy_constructible<E>::value,
+  ::expected( enable_overload_if_t<std::is_copy_constructible<E>::value,
                                  const expected&> other )
   : base_type()
 {
-  if ( other.has_error() ) {
+  if( other.has_value() ) {
+    base_type::emplace_value();
+  } else if ( other.has_error() ) {
     base_type::emplace_error( other.get_unexpected() );
   }
 }
 
 template<typename E>
 inline bit::stl::expected<void,E>
-  ::expected( enable_overload_if<std::is_move_constructible<E>::value,
+  ::expected( enable_overload_if_t<std::is_move_constructible<E>::value,
                                  expected&&> other )
   : base_type()
 {
-  if ( other.has_error() ) {
+  if( other.has_value() ) {
+    base_type::emplace_value();
+  } else if ( other.has_error() ) {
     base_type::emplace_error( std::move(other.get_unexpected()) );
   }
 }
@@ -1212,7 +1537,9 @@ template<typename G, typename>
 inline bit::stl::expected<void,E>::expected( const expected<void,G>& other )
   : base_type()
 {
-  if ( other.has_error() ) {
+  if( other.has_value() ) {
+    base_type::emplace_value();
+  } else if ( other.has_error() ) {
     base_type::emplace_error( other.get_unexpected() );
   }
 }
@@ -1222,9 +1549,10 @@ template<typename G, typename>
 inline bit::stl::expected<void,E>::expected( expected<void,G>&& other )
   : base_type()
 {
-  if ( other.has_error() ) {
+  if( other.has_value() ) {
+    base_type::emplace_value();
+  } else if ( other.has_error() ) {
     base_type::emplace_error( std::move(other.get_unexpected()) );
-
   }
 }
 
@@ -1248,6 +1576,15 @@ inline constexpr bit::stl::expected<void,E>
 
 }
 
+template<typename E>
+template<typename UError, typename>
+inline constexpr bit::stl::expected<void,E>
+  ::expected( unexpected_type<E>&& unexpected )
+  : base_type( unexpect, std::move(unexpected) )
+{
+
+}
+
 template<typename E>
 template<typename Err, typename>
 inline constexpr bit::stl::expected<void,E>
@@ -1279,6 +1616,17 @@ inline constexpr bit::stl::expected<void,E>
 
 //-----------------------------------------------------------------------------
 
+template<typename E>
+template<typename Fn, typename...Args>
+inline constexpr bit::stl::expected<void,E>
+  ::expected( detail::expected_invoke_error_t tag, Fn&& fn, Args&&...args )
+  : base_type( tag, std::forward<Fn>(fn), std::forward<Args>(args)... )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
 template<typename E>
 inline bit::stl::expected<void,E>&
   bit::stl::expected<void,E>::operator=( const expected& other )
@@ -1434,7 +1782,7 @@ template<typename U>
 inline constexpr E bit::stl::expected<void,E>::error_or( U&& default_value )
   &&
 {
-  return !bool(*this) ? base_type::get_unexpected().value() : std::forward<U>(default_value);
+  return !bool(*this) ? std::move(base_type::get_unexpected().value()) : std::forward<U>(default_value);
 }
 
 //-----------------------------------------------------------------------
@@ -1507,19 +1855,205 @@ inline constexpr const bit::stl::unexpected_type<E>&&
 // Monadic Functions
 //-----------------------------------------------------------------------------
 
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn>
+  bit::stl::expected<void,E>::and_then( Fn&& fn )
+  &
+{
+  using result_type = detail::expected_invoke_result_t<Fn>;
+
+  return and_then_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn>
+  bit::stl::expected<void,E>::and_then( Fn&& fn )
+  &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn>;
+
+  return and_then_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn>
+  bit::stl::expected<void,E>::and_then( Fn&& fn )
+  const &
+{
+  using result_type = detail::expected_invoke_result_t<Fn>;
+
+  return and_then_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn>
+  bit::stl::expected<void,E>::and_then( Fn&& fn )
+  const &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn>;
+
+  return and_then_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn>,E>
+  bit::stl::expected<void,E>::transform( Fn&& fn )
+  &
+{
+  using value_type  = detail::expected_invoke_result_t<Fn>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( *this, std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn>,E>
+  bit::stl::expected<void,E>::transform( Fn&& fn )
+  &&
+{
+  using value_type  = detail::expected_invoke_result_t<Fn>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( std::move(*this), std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn>,E>
+  bit::stl::expected<void,E>::transform( Fn&& fn )
+  const &
+{
+  using value_type  = detail::expected_invoke_result_t<Fn>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( *this, std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<bit::stl::detail::expected_invoke_result_t<Fn>,E>
+  bit::stl::expected<void,E>::transform( Fn&& fn )
+  const &&
+{
+  using value_type  = detail::expected_invoke_result_t<Fn>;
+  using result_type = expected<value_type,E>;
+
+  return transform_impl<result_type>( std::move(*this), std::forward<Fn>(fn),
+                                      std::is_void<value_type>{} );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,E&>
+  bit::stl::expected<void,E>::or_else( Fn&& fn )
+  &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,E&>;
+
+  return or_else_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,E&&>
+  bit::stl::expected<void,E>::or_else( Fn&& fn )
+  &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,E&&>;
+
+  return or_else_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const E&>
+  bit::stl::expected<void,E>::or_else( Fn&& fn )
+  const &
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const E&>;
+
+  return or_else_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::detail::expected_invoke_result_t<Fn,const E&&>
+  bit::stl::expected<void,E>::or_else( Fn&& fn )
+  const &&
+{
+  using result_type = detail::expected_invoke_result_t<Fn,const E&&>;
+
+  return or_else_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<void,bit::stl::detail::expected_invoke_result_t<Fn,E&>>
+  bit::stl::expected<void,E>::transform_error( Fn&& fn )
+  &
+{
+  using result_type = expected<void,detail::expected_invoke_result_t<Fn,E&>>;
+
+  return transform_error_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<void,bit::stl::detail::expected_invoke_result_t<Fn,E&&>>
+  bit::stl::expected<void,E>::transform_error( Fn&& fn )
+  &&
+{
+  using result_type = expected<void,detail::expected_invoke_result_t<Fn,E&&>>;
+
+  return transform_error_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<void,bit::stl::detail::expected_invoke_result_t<Fn,const E&>>
+  bit::stl::expected<void,E>::transform_error( Fn&& fn )
+  const &
+{
+  using result_type = expected<void,detail::expected_invoke_result_t<Fn,const E&>>;
+
+  return transform_error_impl<result_type>( *this, std::forward<Fn>(fn) );
+}
+
+template<typename E>
+template<typename Fn>
+inline bit::stl::expected<void,bit::stl::detail::expected_invoke_result_t<Fn,const E&&>>
+  bit::stl::expected<void,E>::transform_error( Fn&& fn )
+  const &&
+{
+  using result_type = expected<void,detail::expected_invoke_result_t<Fn,const E&&>>;
+
+  return transform_error_impl<result_type>( std::move(*this), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+
 template<typename E>
 template<typename Fn, typename>
 bit::stl::invoke_result_t<Fn>
   bit::stl::expected<void,E>::flat_map( Fn&& fn )
   const
 {
-  if( has_value() ) return std::forward<Fn>(fn);
-  else if( has_error() ) return { get_unexpected() };
-#if BIT_COMPILER_EXCEPTIONS_ENABLED
-  throw bad_expected_access<void>{};
-#else
-  BIT_ALWAYS_ASSERT( has_error(), "expected must have error" );
-#endif
+  return and_then( std::forward<Fn>(fn) );
 }
 
 template<typename E>
@@ -1528,13 +2062,78 @@ bit::stl::expected<bit::stl::invoke_result_t<Fn>,E>
   bit::stl::expected<void,E>::map( Fn&& fn )
   const
 {
-  if( has_value() ) return { std::forward<Fn>(fn) };
-  else if( has_error() ) return { get_unexpected() };
-#if BIT_COMPILER_EXCEPTIONS_ENABLED
-  throw bad_expected_access<void>{};
-#else
-  BIT_ALWAYS_ASSERT( has_error(), "expected must have error" );
-#endif
+  return transform( std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<void,E>::and_then_impl( Self&& self, Fn&& fn )
+{
+  static_assert( is_expected<Result>::value,
+                 "and_then: fn must return an expected" );
+  static_assert( std::is_same<typename Result::error_type,E>::value,
+                 "and_then: fn must return an expected with the same error type" );
+
+  if( self.has_value() ) {
+    return ::bit::stl::invoke( std::forward<Fn>(fn) );
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<void,E>::transform_impl( Self&& self,
+                                                          Fn&& fn,
+                                                          std::false_type )
+{
+  if( self.has_value() ) {
+    return Result( detail::expected_invoke_value_t{0}, std::forward<Fn>(fn) );
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<void,E>::transform_impl( Self&& self,
+                                                          Fn&& fn,
+                                                          std::true_type )
+{
+  if( self.has_value() ) {
+    ::bit::stl::invoke( std::forward<Fn>(fn) );
+    return Result();
+  }
+  return Result( unexpect, std::forward<Self>(self).error() );
+}
+
+template<typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<void,E>::or_else_impl( Self&& self, Fn&& fn )
+{
+  static_assert( is_expected<Result>::value,
+                 "or_else: fn must return an expected" );
+  static_assert( std::is_void<typename Result::value_type>::value,
+                 "or_else: fn must return an expected with the same value type" );
+
+  if( self.has_value() ) {
+    return Result();
+  }
+  return ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Self>(self).error() );
+}
+
+template<typename E>
+template<typename Result, typename Self, typename Fn>
+inline Result bit::stl::expected<void,E>::transform_error_impl( Self&& self,
+                                                                Fn&& fn )
+{
+  if( self.has_value() ) {
+    return Result();
+  }
+  return Result( detail::expected_invoke_error_t{0},
+                 std::forward<Fn>(fn), std::forward<Self>(self).error() );
 }
 
 //=============================================================================
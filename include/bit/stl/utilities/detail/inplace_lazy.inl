@@ -0,0 +1,268 @@
+#ifndef BIT_STL_UTILITIES_DETAIL_INPLACE_LAZY_INL
+#define BIT_STL_UTILITIES_DETAIL_INPLACE_LAZY_INL
+
+namespace bit {
+  namespace stl {
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,Args...>::inplace_lazy()
+      : m_state(false)
+    {
+      uninitialized_construct_at<arguments_type>( std::addressof(m_storage) );
+    }
+
+
+    template<typename T, typename...Args>
+    template<typename...UArgs, typename>
+    inline inplace_lazy<T,Args...>::inplace_lazy( in_place_t, UArgs&&...args )
+      : m_state(false)
+    {
+      uninitialized_construct_at<arguments_type>( std::addressof(m_storage),
+                                                  std::forward<UArgs>(args)... );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,Args...>::inplace_lazy( const inplace_lazy& other )
+      : m_state(other.m_state.is_initialized())
+    {
+      if( m_state.is_initialized() ) {
+        uninitialized_construct_at<T>( std::addressof(m_storage), *other );
+      } else {
+        const auto& args = *other.arguments();
+
+        uninitialized_construct_at<arguments_type>( std::addressof(m_storage), args );
+      }
+    }
+
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,Args...>::inplace_lazy( inplace_lazy&& other )
+      : m_state(other.m_state.is_initialized())
+    {
+      if( m_state.is_initialized() ) {
+        uninitialized_construct_at<T>( std::addressof(m_storage), *std::move(other) );
+      } else {
+        uninitialized_construct_at<arguments_type>( std::addressof(m_storage),
+                                                    std::move(*other.arguments()) );
+      }
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,Args...>::~inplace_lazy()
+    {
+      if( m_state.is_initialized() ) {
+        destroy_at( ptr() );
+      } else {
+        destroy_at( arguments() );
+      }
+    }
+
+    //------------------------------------------------------------------------
+    // Modifiers
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline void inplace_lazy<T,Args...>::initialize()
+      const
+    {
+      lazy_construct();
+    }
+
+    //------------------------------------------------------------------------
+    // Observers
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,Args...>::operator bool()
+      const noexcept
+    {
+      return m_state.is_initialized();
+    }
+
+
+    template<typename T, typename...Args>
+    inline bool inplace_lazy<T,Args...>::has_value()
+      const noexcept
+    {
+      return m_state.is_initialized();
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type*
+      inplace_lazy<T,Args...>::operator->()
+    {
+      return ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline const typename inplace_lazy<T,Args...>::value_type*
+      inplace_lazy<T,Args...>::operator->()
+      const
+    {
+      return ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type&
+      inplace_lazy<T,Args...>::operator*()
+      &
+    {
+      return *ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline const typename inplace_lazy<T,Args...>::value_type&
+      inplace_lazy<T,Args...>::operator*()
+      const &
+    {
+      return *ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type&&
+      inplace_lazy<T,Args...>::operator*()
+      &&
+    {
+      return std::move(*ptr());
+    }
+
+
+    template<typename T, typename...Args>
+    inline const typename inplace_lazy<T,Args...>::value_type&&
+      inplace_lazy<T,Args...>::operator*()
+      const &&
+    {
+      return std::move(*ptr());
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type&
+      inplace_lazy<T,Args...>::value()
+      &
+    {
+      lazy_construct();
+      return *ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline const typename inplace_lazy<T,Args...>::value_type&
+      inplace_lazy<T,Args...>::value()
+      const &
+    {
+      lazy_construct();
+      return *ptr();
+    }
+
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type&&
+      inplace_lazy<T,Args...>::value()
+      &&
+    {
+      lazy_construct();
+      return std::move(*ptr());
+    }
+
+
+    template<typename T, typename...Args>
+    inline const typename inplace_lazy<T,Args...>::value_type&&
+      inplace_lazy<T,Args...>::value()
+      const &&
+    {
+      lazy_construct();
+      return std::move(*ptr());
+    }
+
+    //------------------------------------------------------------------------
+    // Private Member Functions
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::value_type*
+      inplace_lazy<T,Args...>::ptr()
+      const
+    {
+      return static_cast<value_type*>( static_cast<void*>( std::addressof(m_storage) ) );
+    }
+
+
+    template<typename T, typename...Args>
+    inline typename inplace_lazy<T,Args...>::arguments_type*
+      inplace_lazy<T,Args...>::arguments()
+      const
+    {
+      return static_cast<arguments_type*>( static_cast<void*>( std::addressof(m_storage) ) );
+    }
+
+
+    template<typename T, typename...Args>
+    inline void inplace_lazy<T,Args...>::lazy_construct()
+      const
+    {
+      m_state.initialize( [this]{
+        construct_from_arguments( std::index_sequence_for<Args...>{} );
+      } );
+    }
+
+
+    template<typename T, typename...Args>
+    template<std::size_t...Idxs>
+    inline void inplace_lazy<T,Args...>
+      ::construct_from_arguments( std::index_sequence<Idxs...> )
+      const
+    {
+      // As with std::move_if_noexcept, the arguments are only consumed if
+      // the construction cannot fail; otherwise they must survive a retry
+      using reference = std::conditional_t<
+        std::is_nothrow_constructible<T,Args&&...>::value,
+        arguments_type&&,
+        arguments_type&
+      >;
+
+      // The value is constructed over the arguments, so they are first moved
+      // out of the way
+      auto args = std::move(*arguments());
+      destroy_at( arguments() );
+
+      try {
+        uninitialized_construct_at<T>( std::addressof(m_storage),
+                                       get<Idxs>( static_cast<reference>(args) )... );
+      } catch( ... ) {
+        // Cannot throw; arguments_type is nothrow move-constructible
+        uninitialized_construct_at<arguments_type>( std::addressof(m_storage),
+                                                    std::move(args) );
+        throw;
+      }
+    }
+
+    //------------------------------------------------------------------------
+    // Utilities
+    //------------------------------------------------------------------------
+
+    template<typename T, typename...Args>
+    inline inplace_lazy<T,std::decay_t<Args>...> make_inplace_lazy( Args&&...args )
+    {
+      return inplace_lazy<T,std::decay_t<Args>...>( in_place, std::forward<Args>(args)... );
+    }
+
+  } // namespace stl
+} // namespace bit
+
+#endif /* BIT_STL_UTILITIES_DETAIL_INPLACE_LAZY_INL */
@@ -3,53 +3,170 @@
 
 namespace bit {
   namespace stl {
+    namespace detail {
+
+      //----------------------------------------------------------------------
+      // lazy_state<lazy_unsynchronized_policy>
+      //----------------------------------------------------------------------
+
+      inline lazy_state<lazy_unsynchronized_policy>::lazy_state( bool is_initialized )
+        noexcept
+        : m_is_initialized(is_initialized)
+      {
+
+      }
+
+      inline bool lazy_state<lazy_unsynchronized_policy>::is_initialized()
+        const noexcept
+      {
+        return m_is_initialized;
+      }
+
+      template<typename Fn>
+      inline void lazy_state<lazy_unsynchronized_policy>::initialize( Fn&& fn )
+        const
+      {
+        if(!m_is_initialized) {
+          std::forward<Fn>(fn)();
+          m_is_initialized = true;
+        }
+      }
+
+      inline void lazy_state<lazy_unsynchronized_policy>::reset()
+        noexcept
+      {
+        m_is_initialized = false;
+      }
+
+      //----------------------------------------------------------------------
+      // lazy_state<lazy_concurrent_policy>
+      //----------------------------------------------------------------------
+
+      inline lazy_state<lazy_concurrent_policy>::lazy_state( bool is_initialized )
+        noexcept
+        : m_state(is_initialized ? initialized : uninitialized)
+      {
+
+      }
+
+      inline bool lazy_state<lazy_concurrent_policy>::is_initialized()
+        const noexcept
+      {
+        return m_state.load( std::memory_order_acquire ) == initialized;
+      }
+
+      template<typename Fn>
+      inline void lazy_state<lazy_concurrent_policy>::initialize( Fn&& fn )
+        const
+      {
+        // Fast path: a single acquire-load once the value is published
+        if( m_state.load( std::memory_order_acquire ) != initialized ) {
+          initialize_slow( std::forward<Fn>(fn) );
+        }
+      }
+
+      inline void lazy_state<lazy_concurrent_policy>::reset()
+        noexcept
+      {
+        m_state.store( uninitialized, std::memory_order_relaxed );
+      }
+
+      template<typename Fn>
+      inline void lazy_state<lazy_concurrent_policy>::initialize_slow( Fn&& fn )
+        const
+      {
+        auto state = m_state.load( std::memory_order_acquire );
+
+        while( state != initialized ) {
+          if( state == uninitialized ) {
+            if( !m_state.compare_exchange_weak( state, constructing,
+                                                std::memory_order_acquire,
+                                                std::memory_order_acquire ) ) {
+              continue;
+            }
+
+            // This thread won the race, and constructs the value. A failed
+            // construction hands the lazy back so that a waiter may retry
+            try {
+              std::forward<Fn>(fn)();
+            } catch( ... ) {
+              release( uninitialized );
+              throw;
+            }
+            release( initialized );
+            return;
+          }
+
+          // Another thread is constructing; flag that a wakeup is needed
+          // before parking, so that the constructor knows to notify
+          if( state == constructing &&
+              !m_state.compare_exchange_weak( state, contended,
+                                              std::memory_order_acquire,
+                                              std::memory_order_acquire ) ) {
+            continue;
+          }
+
+          atomic_wait( m_state, contended );
+          state = m_state.load( std::memory_order_acquire );
+        }
+      }
+
+      inline void lazy_state<lazy_concurrent_policy>::release( std::uint32_t state )
+        const noexcept
+      {
+        if( m_state.exchange( state, std::memory_order_acq_rel ) == contended ) {
+          atomic_notify_all( m_state );
+        }
+      }
+
+    } // namespace detail
 
     //------------------------------------------------------------------------
     // Constructors
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline lazy<T>::lazy()
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>::lazy()
       noexcept
       : m_ctor_function([](void* ptr){ uninitialized_tuple_construct_at<T>(ptr, std::forward_as_tuple() ); }),
         m_storage(),
-        m_is_initialized(false)
+        m_state(false)
     {
 
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline lazy<T>::lazy( const lazy& other )
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>::lazy( const lazy& other )
       : m_ctor_function(other.m_ctor_function),
-        m_is_initialized(other.m_is_initialized)
+        m_state(other.m_state.is_initialized())
     {
-      if(m_is_initialized) {
+      if(m_state.is_initialized()) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple(*other) );
       }
     }
 
 
-    template<typename T>
-    inline lazy<T>::lazy( lazy&& other )
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>::lazy( lazy&& other )
       : m_ctor_function(std::move(other.m_ctor_function)),
-        m_is_initialized(std::move(other.m_is_initialized))
+        m_state(other.m_state.is_initialized())
     {
-      if( m_is_initialized ) {
+      if( m_state.is_initialized() ) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple( *std::move(other) ) );
       }
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U>::value && !std::is_convertible<const U&, T>::value>*>
-    inline lazy<T>::lazy( const lazy<U>& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U,Policy>::value && !std::is_convertible<const U&, T>::value>*>
+    inline lazy<T,Policy>::lazy( const lazy<U,Policy>& other )
       : m_ctor_function(nullptr),
-        m_is_initialized(other.m_is_initialized)
+        m_state(other.m_state.is_initialized())
     {
-      if( m_is_initialized ) {
+      if( m_state.is_initialized() ) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple( *other ) );
       } else {
         auto  copy = other;
@@ -64,13 +181,13 @@ namespace bit {
     }
 
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U>::value && std::is_convertible<const U&, T>::value>*>
-    inline lazy<T>::lazy( const lazy<U>& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U,Policy>::value && std::is_convertible<const U&, T>::value>*>
+    inline lazy<T,Policy>::lazy( const lazy<U,Policy>& other )
       : m_ctor_function(nullptr),
-        m_is_initialized(other.m_is_initialized)
+        m_state(other.m_state.is_initialized())
     {
-      if( m_is_initialized ) {
+      if( m_state.is_initialized() ) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple( *other ) );
       } else {
         auto  copy = other;
@@ -86,13 +203,13 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U>::value && !std::is_convertible<U&&, T>::value>*>
-    inline lazy<T>::lazy( lazy<U>&& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U,Policy>::value && !std::is_convertible<U&&, T>::value>*>
+    inline lazy<T,Policy>::lazy( lazy<U,Policy>&& other )
       : m_ctor_function(nullptr),
-        m_is_initialized(std::move(other.m_is_initialized))
+        m_state(other.m_state.is_initialized())
     {
-      if( m_is_initialized ) {
+      if( m_state.is_initialized() ) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple( *std::move(other) ) );
       } else {
         auto&& ref  = std::move(other).value();
@@ -106,13 +223,13 @@ namespace bit {
     }
 
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U>::value && std::is_convertible<U&&, T>::value>*>
-    inline lazy<T>::lazy( lazy<U>&& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U,Policy>::value && std::is_convertible<U&&, T>::value>*>
+    inline lazy<T,Policy>::lazy( lazy<U,Policy>&& other )
       : m_ctor_function(nullptr),
-        m_is_initialized(std::move(other.m_is_initialized))
+        m_state(other.m_state.is_initialized())
     {
-      if( m_is_initialized ) {
+      if( m_state.is_initialized() ) {
         uninitialized_tuple_construct_at<T>( std::addressof(m_storage), std::forward_as_tuple( *std::move(other) ) );
       } else {
         auto&& ref  = std::move(other).value();
@@ -127,64 +244,79 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
+    template<typename T, typename Policy>
     template<typename...Args, typename>
-    inline lazy<T>::lazy( in_place_t, Args&&... args )
+    inline lazy<T,Policy>::lazy( in_place_t, Args&&... args )
       : m_ctor_function(nullptr),
-        m_is_initialized(false)
+        m_state(false)
     {
       auto arg_tuple = std::make_tuple( std::forward<Args>(args)... );
 
+      // As with std::move_if_noexcept, the arguments are only consumed if
+      // the construction cannot fail; otherwise they must survive a retry
+      using reference = std::conditional_t<
+        std::is_nothrow_constructible<T,std::decay_t<Args>&&...>::value,
+        decltype(arg_tuple)&&,
+        decltype(arg_tuple)&
+      >;
+
       m_ctor_function = [arg_tuple]( void* ptr )
         mutable
       {
-        uninitialized_tuple_construct_at<T>( ptr, std::move(arg_tuple) );
+        uninitialized_tuple_construct_at<T>( ptr, static_cast<reference>(arg_tuple) );
       };
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
+    template<typename T, typename Policy>
     template<typename U, typename...Args, typename>
-    inline lazy<T>::lazy( in_place_t, std::initializer_list<U> ilist, Args&&... args )
+    inline lazy<T,Policy>::lazy( in_place_t, std::initializer_list<U> ilist, Args&&... args )
       : m_ctor_function(nullptr),
-        m_is_initialized(false)
+        m_state(false)
     {
       auto arg_tuple = std::make_tuple( std::move(ilist), std::forward<Args>(args)... );
 
+      // See lazy( in_place_t, Args&&... )
+      using reference = std::conditional_t<
+        std::is_nothrow_constructible<T,std::initializer_list<U>&&,std::decay_t<Args>&&...>::value,
+        decltype(arg_tuple)&&,
+        decltype(arg_tuple)&
+      >;
+
       m_ctor_function = [arg_tuple]( void* ptr )
         mutable
       {
-        uninitialized_tuple_construct_at<T>( ptr, std::move(arg_tuple) );
+        uninitialized_tuple_construct_at<T>( ptr, static_cast<reference>(arg_tuple) );
       };
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_direct_initializable<T,U>::value && std::is_convertible<U&&, T>::value>*>
-    inline lazy<T>::lazy( U&& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_direct_initializable<T,U,Policy>::value && std::is_convertible<U&&, T>::value>*>
+    inline lazy<T,Policy>::lazy( U&& other )
       : m_ctor_function([other](void* ptr) mutable { uninitialized_tuple_construct_at<T>(ptr, std::forward_as_tuple( std::move(other) ) );} ),
-        m_is_initialized(false)
+        m_state(false)
     {
 
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_direct_initializable<T,U>::value && !std::is_convertible<U&&, T>::value>*>
-    inline lazy<T>::lazy( U&& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_direct_initializable<T,U,Policy>::value && !std::is_convertible<U&&, T>::value>*>
+    inline lazy<T,Policy>::lazy( U&& other )
       : m_ctor_function([other](void* ptr) mutable { uninitialized_tuple_construct_at<T>(ptr, std::forward_as_tuple( std::move(other) ) );} ),
-        m_is_initialized(false)
+        m_state(false)
     {
 
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline lazy<T>::~lazy()
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>::~lazy()
     {
       destruct();
     }
@@ -193,14 +325,14 @@ namespace bit {
     // Assignment
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline lazy<T>& lazy<T>::operator=( const lazy& other )
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>& lazy<T,Policy>::operator=( const lazy& other )
     {
-      if( m_is_initialized && other.m_is_initialized ) {
+      if( m_state.is_initialized() && other.m_state.is_initialized() ) {
         (*ptr()) = (*other);
-      } else if( m_is_initialized ) {
+      } else if( m_state.is_initialized() ) {
         (*ptr()) = other.value();
-      } else if( other.m_is_initialized ) {
+      } else if( other.m_state.is_initialized() ) {
         value() = (*other);
       } else {
         m_ctor_function = other.m_ctor_function;
@@ -209,14 +341,14 @@ namespace bit {
     }
 
 
-    template<typename T>
-    inline lazy<T>& lazy<T>::operator=( lazy&& other )
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>& lazy<T,Policy>::operator=( lazy&& other )
     {
-      if( m_is_initialized && other.m_is_initialized ) {
+      if( m_state.is_initialized() && other.m_state.is_initialized() ) {
         (*ptr()) = *std::move(other);
-      } else if( m_is_initialized ) {
+      } else if( m_state.is_initialized() ) {
         (*ptr()) = std::move(other).value();
-      } else if( other.m_is_initialized ) {
+      } else if( other.m_state.is_initialized() ) {
         value() = *std::move(other);
       } else {
         m_ctor_function = std::move(other.m_ctor_function);
@@ -226,15 +358,15 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_assignment<T,U>::value>*>
-    inline lazy<T>& lazy<T>::operator=( const lazy<U>& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_assignment<T,U,Policy>::value>*>
+    inline lazy<T,Policy>& lazy<T,Policy>::operator=( const lazy<U,Policy>& other )
     {
-      if( m_is_initialized && other.m_is_initialized ) {
+      if( m_state.is_initialized() && other.m_state.is_initialized() ) {
         (*ptr()) = (*other);
-      } else if( m_is_initialized ) {
+      } else if( m_state.is_initialized() ) {
         (*ptr()) = other.value();
-      } else if( other.m_is_initialized ) {
+      } else if( other.m_state.is_initialized() ) {
         value() = *other;
       } else {
         auto  copy = other;
@@ -249,15 +381,15 @@ namespace bit {
     }
 
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_assignment<T,U>::value>*>
-    inline lazy<T>& lazy<T>::operator=( lazy<U>&& other )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_assignment<T,U,Policy>::value>*>
+    inline lazy<T,Policy>& lazy<T,Policy>::operator=( lazy<U,Policy>&& other )
     {
-      if( m_is_initialized && other.m_is_initialized ) {
+      if( m_state.is_initialized() && other.m_state.is_initialized() ) {
         (*ptr()) = *std::move(other);
-      } else if( m_is_initialized ) {
+      } else if( m_state.is_initialized() ) {
         (*ptr()) = std::move(other).value();
-      } else if( other.m_is_initialized ) {
+      } else if( other.m_state.is_initialized() ) {
         value() = *std::move(other);
       } else {
         auto&& ref  = std::move(other).value();
@@ -272,9 +404,9 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    template<typename U, std::enable_if_t<detail::lazy_is_direct_init_assignable<T,U>::value>*>
-    inline lazy<T>& lazy<T>::operator=( U&& value )
+    template<typename T, typename Policy>
+    template<typename U, std::enable_if_t<detail::lazy_is_direct_init_assignable<T,U,Policy>::value>*>
+    inline lazy<T,Policy>& lazy<T,Policy>::operator=( U&& value )
     {
       this->value() = std::forward<U>(value);
       return (*this);
@@ -284,29 +416,29 @@ namespace bit {
     // Modifiers
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline void lazy<T>::initialize()
+    template<typename T, typename Policy>
+    inline void lazy<T,Policy>::initialize()
       const
     {
       lazy_construct();
     }
 
-    template<typename T>
-    inline void lazy<T>::reset()
+    template<typename T, typename Policy>
+    inline void lazy<T,Policy>::reset()
     {
       destruct();
     }
 
-    template<typename T>
-    inline void lazy<T>::swap( lazy& other )
+    template<typename T, typename Policy>
+    inline void lazy<T,Policy>::swap( lazy& other )
     {
       using std::swap;
 
-      if( m_is_initialized && other.m_is_initialized ) {
+      if( m_state.is_initialized() && other.m_state.is_initialized() ) {
         swap(*ptr(),*other);
-      } else if( m_is_initialized ) {
+      } else if( m_state.is_initialized() ) {
         swap(*ptr(),other.value());
-      } else if( other.m_is_initialized ) {
+      } else if( other.m_state.is_initialized() ) {
         swap(value(),*other);
       } else {
         swap(m_ctor_function, other.m_ctor_function);
@@ -317,64 +449,64 @@ namespace bit {
     // Observers
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline lazy<T>::operator bool()
+    template<typename T, typename Policy>
+    inline lazy<T,Policy>::operator bool()
       const noexcept
     {
-      return m_is_initialized;
+      return m_state.is_initialized();
     }
 
 
-    template<typename T>
-    inline bool lazy<T>::has_value()
+    template<typename T, typename Policy>
+    inline bool lazy<T,Policy>::has_value()
       const noexcept
     {
-      return m_is_initialized;
+      return m_state.is_initialized();
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline typename lazy<T>::value_type* lazy<T>::operator->()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type* lazy<T,Policy>::operator->()
     {
       return ptr();
     }
 
 
-    template<typename T>
-    inline const typename lazy<T>::value_type* lazy<T>::operator->()
+    template<typename T, typename Policy>
+    inline const typename lazy<T,Policy>::value_type* lazy<T,Policy>::operator->()
       const
     {
       return ptr();
     }
 
 
-    template<typename T>
-    inline typename lazy<T>::value_type& lazy<T>::operator*()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type& lazy<T,Policy>::operator*()
       &
     {
       return *ptr();
     }
 
 
-    template<typename T>
-    inline const typename lazy<T>::value_type& lazy<T>::operator*()
+    template<typename T, typename Policy>
+    inline const typename lazy<T,Policy>::value_type& lazy<T,Policy>::operator*()
       const &
     {
       return *ptr();
     }
 
 
-    template<typename T>
-    inline typename lazy<T>::value_type&& lazy<T>::operator*()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type&& lazy<T,Policy>::operator*()
       &&
     {
       return std::move(*ptr());
     }
 
 
-    template<typename T>
-    inline const typename lazy<T>::value_type&& lazy<T>::operator*()
+    template<typename T, typename Policy>
+    inline const typename lazy<T,Policy>::value_type&& lazy<T,Policy>::operator*()
       const &&
     {
       return std::move(*ptr());
@@ -382,8 +514,8 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline typename lazy<T>::value_type& lazy<T>::value()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type& lazy<T,Policy>::value()
       &
     {
       lazy_construct();
@@ -391,8 +523,8 @@ namespace bit {
     }
 
 
-    template<typename T>
-    inline const typename lazy<T>::value_type& lazy<T>::value()
+    template<typename T, typename Policy>
+    inline const typename lazy<T,Policy>::value_type& lazy<T,Policy>::value()
       const &
     {
       lazy_construct();
@@ -400,8 +532,8 @@ namespace bit {
     }
 
 
-    template<typename T>
-    inline typename lazy<T>::value_type&& lazy<T>::value()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type&& lazy<T,Policy>::value()
       &&
     {
       lazy_construct();
@@ -409,8 +541,8 @@ namespace bit {
     }
 
 
-    template<typename T>
-    inline const typename lazy<T>::value_type&& lazy<T>::value()
+    template<typename T, typename Policy>
+    inline const typename lazy<T,Policy>::value_type&& lazy<T,Policy>::value()
       const &&
     {
       lazy_construct();
@@ -419,18 +551,18 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
+    template<typename T, typename Policy>
     template<typename U>
-    inline typename lazy<T>::value_type lazy<T>::value_or( U&& default_value )
+    inline typename lazy<T,Policy>::value_type lazy<T,Policy>::value_or( U&& default_value )
       const &
     {
       return has_value() ? (*ptr()) : std::forward<U>(default_value);
     }
 
 
-    template<typename T>
+    template<typename T, typename Policy>
     template<typename U>
-    inline typename lazy<T>::value_type lazy<T>::value_or( U&& default_value )
+    inline typename lazy<T,Policy>::value_type lazy<T,Policy>::value_or( U&& default_value )
       &&
     {
       return has_value() ? (*ptr()) : std::forward<U>(default_value);
@@ -441,11 +573,11 @@ namespace bit {
     // Private Constructor
     //------------------------------------------------------------------------
 
-    template<typename T>
+    template<typename T, typename Policy>
     template<typename Ctor>
-    inline lazy<T>::lazy( ctor_tag, Ctor&& ctor )
+    inline lazy<T,Policy>::lazy( ctor_tag, Ctor&& ctor )
       : m_ctor_function([ctor](void* ptr){ uninitialized_tuple_construct_at<T>(ptr, ctor()); }),
-        m_is_initialized(false)
+        m_state(false)
     {
 
     }
@@ -454,30 +586,27 @@ namespace bit {
     // Private Member Functions
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline typename lazy<T>::value_type* lazy<T>::ptr()
+    template<typename T, typename Policy>
+    inline typename lazy<T,Policy>::value_type* lazy<T,Policy>::ptr()
       const
     {
       return static_cast<value_type*>( static_cast<void*>( std::addressof(m_storage) ) );
     }
 
 
-    template<typename T>
-    inline void lazy<T>::lazy_construct() const
+    template<typename T, typename Policy>
+    inline void lazy<T,Policy>::lazy_construct() const
     {
-      if(!m_is_initialized) {
-        m_ctor_function( std::addressof(m_storage) );
-        m_is_initialized = true;
-      }
+      m_state.initialize( [this]{ m_ctor_function( std::addressof(m_storage) ); } );
     }
 
 
-    template<typename T>
-    inline void lazy<T>::destruct()
+    template<typename T, typename Policy>
+    inline void lazy<T,Policy>::destruct()
     {
-      if(m_is_initialized) {
+      if(m_state.is_initialized()) {
         destroy_at<T>( static_cast<T*>(static_cast<void*>(std::addressof(m_storage))) );
-        m_is_initialized = false;
+        m_state.reset();
       }
     }
 
@@ -485,8 +614,8 @@ namespace bit {
     // Utilities
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline std::size_t hash_value( const lazy<T>& val )
+    template<typename T, typename Policy>
+    inline std::size_t hash_value( const lazy<T,Policy>& val )
     {
       return hash_value( val.value() );
     }
@@ -514,8 +643,8 @@ namespace bit {
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline void swap( lazy<T>& lhs, lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline void swap( lazy<T,Policy>& lhs, lazy<T,Policy>& rhs )
     {
       lhs.swap(rhs);
     }
@@ -524,119 +653,119 @@ namespace bit {
     // Comparisons
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline bool operator==( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator==( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() == rhs.value();
     }
 
-    template<typename T>
-    inline bool operator==( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator==( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() == rhs;
     }
 
-    template<typename T>
-    inline bool operator==( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator==( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs == rhs.value();
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline bool operator!=( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator!=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() != rhs.value();
     }
 
-    template<typename T>
-    inline bool operator!=( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator!=( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() != rhs;
     }
 
-    template<typename T>
-    inline bool operator!=( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator!=( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs != rhs.value();
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline bool operator<( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() < rhs.value();
     }
 
-    template<typename T>
-    inline bool operator<( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() < rhs;
     }
 
-    template<typename T>
-    inline bool operator<( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs < rhs.value();
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline bool operator<=( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() <= rhs.value();
     }
 
-    template<typename T>
-    inline bool operator<=( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<=( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() <= rhs;
     }
 
-    template<typename T>
-    inline bool operator<=( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator<=( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs <= rhs.value();
     }
 
     //------------------------------------------------------------------------
-    template<typename T>
-    inline bool operator>( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() > rhs.value();
     }
 
-    template<typename T>
-    inline bool operator>( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() > rhs;
     }
 
-    template<typename T>
-    inline bool operator>( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs > rhs.value();
     }
 
     //------------------------------------------------------------------------
 
-    template<typename T>
-    inline bool operator>=( const lazy<T>& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs.value() >= rhs.value();
     }
 
-    template<typename T>
-    inline bool operator>=( const lazy<T>& lhs, const T& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>=( const lazy<T,Policy>& lhs, const T& rhs )
     {
       return lhs.value() >= rhs;
     }
 
-    template<typename T>
-    inline bool operator>=( const T& lhs, const lazy<T>& rhs )
+    template<typename T, typename Policy>
+    inline bool operator>=( const T& lhs, const lazy<T,Policy>& rhs )
     {
       return lhs >= rhs.value();
     }
@@ -142,14 +142,14 @@ template<typename...Types>
 inline constexpr std::size_t bit::stl::variant<Types...>::index()
   const noexcept
 {
-  return base_type::m_index;
+  return (base_type::m_index == index_type(-1)) ? variant_npos : base_type::m_index;
 }
 
 template<typename...Types>
 inline constexpr bool bit::stl::variant<Types...>::valueless_by_exception()
   const noexcept
 {
-  return base_type::m_index == variant_npos;
+  return base_type::m_index == index_type(-1);
 }
 
 //----------------------------------------------------------------------------
@@ -184,7 +184,7 @@ inline bit::stl::variant_alternative_t<I, bit::stl::variant<Types...>>&
 
   base_type::destruct();
   auto& result = static_emplace<I>( in_place_index<I>, base_type::m_union, std::forward<Args>(args)... );
-  base_type::m_index = I;
+  base_type::m_index = static_cast<index_type>(I);
 
   return result;
 }
@@ -199,7 +199,7 @@ inline bit::stl::variant_alternative_t<I, bit::stl::variant<Types...>>&
 
   base_type::destruct();
   auto& result = static_emplace<I>( in_place_index<I>, base_type::m_union, il, std::forward<Args>(args)... );
-  base_type::m_index = I;
+  base_type::m_index = static_cast<index_type>(I);
 
   return result;
 }
@@ -347,7 +347,7 @@ inline void bit::stl::variant<Types...>
 {
   base_type::destruct();
   runtime_emplace_impl( index, base_type::m_union, std::forward<VariantUnion>(source) );
-  base_type::m_index = index;
+  base_type::m_index = static_cast<index_type>(index);
 }
 
 template<typename...Types>
@@ -666,6 +666,200 @@ constexpr std::add_pointer_t<const T> bit::stl::get_if( const variant<Types...>*
   return get_if<detail::index_from<T,Types...>::value>( pv );
 }
 
+//=============================================================================
+// 23.7.7 : visitation
+//=============================================================================
+
+namespace bit { namespace stl { namespace detail {
+
+  /// \brief Unchecked access to variant alternatives, for use where the
+  ///        active index is already known
+  struct variant_access
+  {
+    template<std::size_t I, typename Variant>
+    using result_t = std::conditional_t<
+      std::is_lvalue_reference<Variant>::value,
+      decltype(std::declval<Variant&>().get( in_place_index<I> )),
+      std::remove_reference_t<decltype(std::declval<Variant&>().get( in_place_index<I> ))>&&
+    >;
+
+    template<std::size_t I, typename Variant>
+    static constexpr result_t<I,Variant> get( Variant&& v )
+      noexcept
+    {
+      return static_cast<result_t<I,Variant>>( v.get( in_place_index<I> ) );
+    }
+  };
+
+  //---------------------------------------------------------------------------
+
+  /// \brief Returns the \p k'th digit of the mixed-radix number \p flat,
+  ///        whose radices are \p Sizes, most significant first
+  template<std::size_t...Sizes>
+  inline constexpr std::size_t variant_visit_digit( std::size_t flat,
+                                                    std::size_t k )
+    noexcept
+  {
+    constexpr std::size_t sizes[] = { Sizes... };
+
+    auto stride = std::size_t{1};
+    for( auto i = k + 1; i < sizeof...(Sizes); ++i ) {
+      stride *= sizes[i];
+    }
+    return (flat / stride) % sizes[k];
+  }
+
+  /// \brief Returns the number of combinations of alternatives
+  template<std::size_t...Sizes>
+  inline constexpr std::size_t variant_visit_count()
+    noexcept
+  {
+    constexpr std::size_t sizes[] = { 1, Sizes... };
+
+    auto count = std::size_t{1};
+    for( auto size : sizes ) {
+      count *= size;
+    }
+    return count;
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename R, typename Indices, typename Visitor, typename...Variants>
+  struct variant_visit_entry;
+
+  template<typename R, std::size_t...Is, typename Visitor, typename...Variants>
+  struct variant_visit_entry<R,std::index_sequence<Is...>,Visitor,Variants...>
+  {
+    static R invoke( Visitor&& visitor, Variants&&...variants )
+    {
+      return ::bit::stl::invoke( std::forward<Visitor>(visitor),
+                                 variant_access::get<Is>( std::forward<Variants>(variants) )... );
+    }
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename R, typename Visitor, typename...Variants>
+  struct variant_visit_table
+  {
+    using function_type = R(*)( Visitor&&, Variants&&... );
+
+    template<std::size_t Flat, std::size_t...Ks>
+    static constexpr function_type entry( std::index_sequence<Ks...> )
+      noexcept
+    {
+      return &variant_visit_entry<
+        R,
+        std::index_sequence<variant_visit_digit<variant_size<std::decay_t<Variants>>::value...>( Flat, Ks )...>,
+        Visitor,
+        Variants...
+      >::invoke;
+    }
+
+    /// \brief Dispatches through a table of function pointers, which keeps
+    ///        instantiation linear in the number of combinations
+    template<std::size_t...Flats>
+    static R dispatch( std::size_t flat,
+                       std::index_sequence<Flats...>,
+                       std::false_type,
+                       Visitor&& visitor,
+                       Variants&&...variants )
+    {
+      static constexpr function_type table[] = {
+        entry<Flats>( std::index_sequence_for<Variants...>{} )...
+      };
+
+      return table[flat]( std::forward<Visitor>(visitor),
+                          std::forward<Variants>(variants)... );
+    }
+
+    /// \brief Dispatches through a binary search on the flat index, which
+    ///        lets every call inline into the caller
+    template<std::size_t...Flats>
+    static R dispatch( std::size_t flat,
+                       std::index_sequence<Flats...>,
+                       std::true_type,
+                       Visitor&& visitor,
+                       Variants&&...variants )
+    {
+      return search<0,sizeof...(Flats)>( flat,
+                                         std::integral_constant<bool,(sizeof...(Flats) == 1)>{},
+                                         std::forward<Visitor>(visitor),
+                                         std::forward<Variants>(variants)... );
+    }
+
+  private:
+
+    template<std::size_t Lo, std::size_t Hi>
+    static R search( std::size_t,
+                     std::true_type,
+                     Visitor&& visitor,
+                     Variants&&...variants )
+    {
+      return entry<Lo>( std::index_sequence_for<Variants...>{} )(
+        std::forward<Visitor>(visitor),
+        std::forward<Variants>(variants)...
+      );
+    }
+
+    template<std::size_t Lo, std::size_t Hi>
+    static R search( std::size_t flat,
+                     std::false_type,
+                     Visitor&& visitor,
+                     Variants&&...variants )
+    {
+      constexpr auto mid = Lo + (Hi - Lo) / 2;
+
+      if( flat < mid ) {
+        return search<Lo,mid>( flat,
+                               std::integral_constant<bool,(mid - Lo == 1)>{},
+                               std::forward<Visitor>(visitor),
+                               std::forward<Variants>(variants)... );
+      }
+      return search<mid,Hi>( flat,
+                             std::integral_constant<bool,(Hi - mid == 1)>{},
+                             std::forward<Visitor>(visitor),
+                             std::forward<Variants>(variants)... );
+    }
+  };
+
+  /// \brief The largest number of combinations that visit dispatches with
+  ///        an inlined binary search rather than a table of function
+  ///        pointers; past this, the search's unpredictable branches cost
+  ///        more than the table's single indirect call
+  constexpr std::size_t variant_visit_search_limit = 8;
+
+} } } // namespace bit::stl::detail
+
+template<typename Visitor, typename...Variants>
+inline decltype(auto) bit::stl::visit( Visitor&& visitor,
+                                       Variants&&...variants )
+{
+  using result_type = decltype( invoke( std::declval<Visitor>(),
+                                        get<0>( std::declval<Variants>() )... ) );
+  using table_type = detail::variant_visit_table<result_type,Visitor,Variants...>;
+
+  constexpr auto count = detail::variant_visit_count<variant_size<std::decay_t<Variants>>::value...>();
+
+  // Flatten the active indices into a single row-major table index
+  auto flat = std::size_t{0};
+  auto valueless = false;
+
+  using expand = int[];
+  (void) expand{ 0, ( valueless = valueless || variants.valueless_by_exception(),
+                      flat = flat * variant_size<std::decay_t<Variants>>::value + variants.index(),
+                      0 )... };
+
+  if( valueless ) throw bad_variant_access{};
+
+  return table_type::dispatch( flat,
+                               std::make_index_sequence<count>{},
+                               std::integral_constant<bool,(count <= detail::variant_visit_search_limit)>{},
+                               std::forward<Visitor>(visitor),
+                               std::forward<Variants>(variants)... );
+}
+
 //-----------------------------------------------------------------------------
 
 namespace bit { namespace stl { namespace detail {
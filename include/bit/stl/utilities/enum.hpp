@@ -39,12 +39,17 @@
 
 #include "assert.hpp"
 #include "compiler_traits.hpp"
+#include "hash.hpp"   // hash_string_segment
+#include "macros.hpp" // BIT_EXPAND_VA_ARGS
 
 #include "../traits/composition/conjunction.hpp"
 
 // TODO(bitwizeshift): sever dependency to 'containers'
 #include "../containers/string_view.hpp"
 
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uintmax_t
+#include <stdexcept>   // std::runtime_error
 #include <type_traits> // std::enable_if
 
 namespace bit {
@@ -86,6 +91,9 @@ namespace bit {
     /// This struct also must specialize a begin() and end() function that
     /// returns type const Enum*, if an enum is to be used for iteration
     ///
+    /// \note BIT_REGISTER_ENUM generates all of these from a list of
+    ///       enumerators
+    ///
     /// \tparam Enum the enum type
     //////////////////////////////////////////////////////////////////////////
     template<typename Enum>
@@ -255,6 +263,62 @@ namespace bit {
   } // namespace stl
 } // namespace bit
 
+//=============================================================================
+// Enum registration
+//=============================================================================
+
+//! \def BIT_REGISTER_ENUM(Enum,...)
+//!
+//! \brief Specializes \c bit::stl::enum_traits for \p Enum from the list of
+//!        its enumerators
+//!
+//! The names and values are built into \c constexpr tables at compile time.
+//! \c to_string indexes the names by the enumerator's offset from the first
+//! one if the enumerators are sequential, and binary searches them otherwise;
+//! \c from_string is a perfect hash over \c hash_string_segment, so that it
+//! costs a single string comparison. \c begin and \c end iterate the
+//! enumerators in the order they were listed.
+//!
+//! Up to 64 enumerators may be registered, and their names must be unique;
+//! an alias converts to the name of the first enumerator with its value.
+//! This must be used at global scope.
+//!
+//! \code
+//! enum class color{ red, green, blue };
+//!
+//! BIT_REGISTER_ENUM(color, red, green, blue);
+//! \endcode
+#define BIT_REGISTER_ENUM(Enum,...)                                        \
+  template<>                                                               \
+  struct bit::stl::detail::enum_registry<Enum>                             \
+  {                                                                        \
+    using enum_type = Enum;                                                \
+                                                                           \
+    static constexpr std::size_t size = BIT_COUNT_VA_ARGS(__VA_ARGS__);    \
+                                                                           \
+    static constexpr enum_type value( std::size_t i ) noexcept             \
+    {                                                                      \
+      const enum_type values[] = {                                         \
+        BIT_EXPAND_VA_ARGS(BIT_REGISTER_ENUM_VALUE,__VA_ARGS__)            \
+      };                                                                   \
+      return values[i];                                                    \
+    }                                                                      \
+                                                                           \
+    static constexpr const char* name( std::size_t i ) noexcept            \
+    {                                                                      \
+      const char* const names[] = {                                        \
+        BIT_EXPAND_VA_ARGS(BIT_REGISTER_ENUM_NAME,__VA_ARGS__)             \
+      };                                                                   \
+      return names[i];                                                     \
+    }                                                                      \
+  };                                                                       \
+                                                                           \
+  template<>                                                               \
+  struct bit::stl::enum_traits<Enum>                                       \
+    : ::bit::stl::detail::registered_enum_traits<Enum>{}
+#define BIT_REGISTER_ENUM_VALUE(enumerator) enum_type::enumerator,
+#define BIT_REGISTER_ENUM_NAME(enumerator)  #enumerator,
+
 #include "detail/enum.inl"
 
 #endif /* BIT_STL_UTILITIES_ENUM_HPP */
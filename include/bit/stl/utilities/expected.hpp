@@ -47,11 +47,13 @@
 #include "tribool.hpp"         // tribools
 #include "compiler_traits.hpp" // BIT_COMPILER_EXCEPTIONS_ENABLED
 #include "assert.hpp"          // BIT_ALWAYS_ASSERT
+#include "macros.hpp"          // BIT_UNIQUE_NAME
 
 #include <initializer_list> // std::initializer_list
 #include <stdexcept>        // std::logic_error
 #include <type_traits>  // std::is_constructible
 #include <system_error> // std::error_condition
+#include <utility>      // std::declval, std::forward
 
 namespace bit {
   namespace stl {
@@ -312,6 +314,33 @@ namespace bit {
 
     namespace detail {
 
+      //=======================================================================
+      // expected invoke tags
+      //=======================================================================
+
+      /// \brief Tag used to construct an expected's value directly from the
+      ///        result of invoking a function
+      struct expected_invoke_value_t
+      {
+        constexpr explicit expected_invoke_value_t(int){}
+      };
+
+      /// \brief Tag used to construct an expected's error directly from the
+      ///        result of invoking a function
+      struct expected_invoke_error_t
+      {
+        constexpr explicit expected_invoke_error_t(int){}
+      };
+
+      /// \brief The decayed result of invoking \p Fn with \p Args
+      ///
+      /// \note This is spelled with decltype, rather than invoke_result_t, so
+      ///       that ref-qualified overloads that are not invocable are
+      ///       discarded instead of failing hard
+      template<typename Fn, typename...Args>
+      using expected_invoke_result_t
+        = std::decay_t<decltype(::bit::stl::invoke( std::declval<Fn>(), std::declval<Args>()... ))>;
+
       //=======================================================================
       // expected_base
       //=======================================================================
@@ -332,6 +361,10 @@ namespace bit {
         constexpr expected_base( in_place_t, Args&&...args );
         template<typename...Args>
         constexpr expected_base( unexpect_t, Args&&...args );
+        template<typename Fn, typename...Args>
+        constexpr expected_base( expected_invoke_value_t, Fn&& fn, Args&&...args );
+        template<typename Fn, typename...Args>
+        constexpr expected_base( expected_invoke_error_t, Fn&& fn, Args&&...args );
 
         //---------------------------------------------------------------------
         // Observers
@@ -400,6 +433,20 @@ namespace bit {
 
           }
 
+          template<typename Fn, typename...Args>
+          constexpr storage_type( expected_invoke_value_t, Fn&& fn, Args&&...args )
+            : value( ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Args>(args)... ) )
+          {
+
+          }
+
+          template<typename Fn, typename...Args>
+          constexpr storage_type( expected_invoke_error_t, Fn&& fn, Args&&...args )
+            : error( in_place, ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Args>(args)... ) )
+          {
+
+          }
+
           empty<void>        dummy;
           T                  value;
           unexpected_type<E> error;
@@ -429,6 +476,10 @@ namespace bit {
         constexpr expected_base( in_place_t, Args&&...args );
         template<typename...Args>
         constexpr expected_base( unexpect_t, Args&&...args );
+        template<typename Fn, typename...Args>
+        constexpr expected_base( expected_invoke_value_t, Fn&& fn, Args&&...args );
+        template<typename Fn, typename...Args>
+        constexpr expected_base( expected_invoke_error_t, Fn&& fn, Args&&...args );
 
         //---------------------------------------------------------------------
 
@@ -507,6 +558,20 @@ namespace bit {
 
           }
 
+          template<typename Fn, typename...Args>
+          constexpr storage_type( expected_invoke_value_t, Fn&& fn, Args&&...args )
+            : value( ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Args>(args)... ) )
+          {
+
+          }
+
+          template<typename Fn, typename...Args>
+          constexpr storage_type( expected_invoke_error_t, Fn&& fn, Args&&...args )
+            : error( in_place, ::bit::stl::invoke( std::forward<Fn>(fn), std::forward<Args>(args)... ) )
+          {
+
+          }
+
           ~storage_type(){}
 
           empty<void>        dummy;
@@ -583,7 +648,7 @@ namespace bit {
       ///        initializing an object of type T with the expression T{}
       ///
       /// \post \code bool(*this) \endcode
-      template<typename U=T,typename = std::enable_if_t<std::is_default_constructible<T>::value>>
+      template<typename U=T,typename = std::enable_if_t<std::is_default_constructible<U>::value>>
       constexpr expected();
 
       //-----------------------------------------------------------------------
@@ -591,10 +656,10 @@ namespace bit {
       /// \brief Copy-constructs an expected from an existing expected
       ///
       /// \param other the other expected
-      expected( enable_overload_if<std::is_copy_constructible<T>::value &&
+      expected( enable_overload_if_t<std::is_copy_constructible<T>::value &&
                                    std::is_copy_constructible<E>::value,
                                    const expected&> other );
-      expected( disable_overload_if<std::is_copy_constructible<T>::value &&
+      expected( disable_overload_if_t<std::is_copy_constructible<T>::value &&
                                     std::is_copy_constructible<E>::value,
                                     const expected&> other ) = delete;
 
@@ -603,10 +668,10 @@ namespace bit {
       /// \brief Move-constructs an expected from an existing expected
       ///
       /// \param other the other expected
-      expected( enable_overload_if<std::is_move_constructible<T>::value &&
+      expected( enable_overload_if_t<std::is_move_constructible<T>::value &&
                                    std::is_move_constructible<E>::value,
                                    expected&&> other );
-      expected( disable_overload_if<std::is_move_constructible<T>::value &&
+      expected( disable_overload_if_t<std::is_move_constructible<T>::value &&
                                     std::is_move_constructible<E>::value,
                                     expected&&> other ) = delete;
 
@@ -676,6 +741,13 @@ namespace bit {
       template<typename UError=E, typename = std::enable_if_t<std::is_copy_constructible<UError>::value>>
       constexpr expected( unexpected_type<E> const& unexpected );
 
+      /// \brief Constructs the underlying error by moving it out of a given
+      ///        unexpected type
+      ///
+      /// \param unexpected the unexpected type
+      template<typename UError=E, typename = std::enable_if_t<std::is_move_constructible<UError>::value>>
+      constexpr expected( unexpected_type<E>&& unexpected );
+
       /// \brief Constructs the underlying error from a given unexpected type
       ///
       /// \param unexpected the unexpected type
@@ -842,6 +914,90 @@ namespace bit {
       //------------------------------------------------------------------------
     public:
 
+      /// \{
+      /// \brief Invokes \p fn with the contained value, returning its result
+      ///
+      /// \p fn must return an expected with the same error type. If this
+      /// expected contains an error, the error is propagated to the result
+      /// instead, and \p fn is not invoked.
+      ///
+      /// The value is forwarded with the value category of this expected, so
+      /// chaining on a temporary moves rather than copies, and the result of
+      /// \p fn is returned directly without an intermediate.
+      ///
+      /// \param fn the function to invoke with the value
+      /// \return the result of \p fn, or the propagated error
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,T&> and_then( Fn&& fn ) &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,T&&> and_then( Fn&& fn ) &&;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const T&> and_then( Fn&& fn ) const &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const T&&> and_then( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn with the contained value, wrapping its result
+      ///        in an expected
+      ///
+      /// The result of \p fn is constructed directly in the returned
+      /// expected. If \p fn returns \c void, the result is an
+      /// \c expected<void,E>. If this expected contains an error, the error is
+      /// propagated to the result instead, and \p fn is not invoked.
+      ///
+      /// \param fn the function to invoke with the value
+      /// \return an expected containing the result of \p fn, or the error
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn,T&>,E> transform( Fn&& fn ) &;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn,T&&>,E> transform( Fn&& fn ) &&;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn,const T&>,E> transform( Fn&& fn ) const &;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn,const T&&>,E> transform( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn with the contained error, returning its result
+      ///
+      /// \p fn must return an expected with the same value type. If this
+      /// expected contains a value, the value is propagated to the result
+      /// instead, and \p fn is not invoked.
+      ///
+      /// \param fn the function to invoke with the error
+      /// \return the result of \p fn, or the propagated value
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,E&> or_else( Fn&& fn ) &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,E&&> or_else( Fn&& fn ) &&;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const E&> or_else( Fn&& fn ) const &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const E&&> or_else( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn with the contained error, wrapping its result
+      ///        as the error of an expected
+      ///
+      /// If this expected contains a value, the value is propagated to the
+      /// result instead, and \p fn is not invoked.
+      ///
+      /// \param fn the function to invoke with the error
+      /// \return an expected containing the value, or the result of \p fn
+      template<typename Fn>
+      expected<T,detail::expected_invoke_result_t<Fn,E&>> transform_error( Fn&& fn ) &;
+      template<typename Fn>
+      expected<T,detail::expected_invoke_result_t<Fn,E&&>> transform_error( Fn&& fn ) &&;
+      template<typename Fn>
+      expected<T,detail::expected_invoke_result_t<Fn,const E&>> transform_error( Fn&& fn ) const &;
+      template<typename Fn>
+      expected<T,detail::expected_invoke_result_t<Fn,const E&&>> transform_error( Fn&& fn ) const &&;
+      /// \}
+
+      //-----------------------------------------------------------------------
+
       /// \brief Invokes the function \p fn with this expected as the argument
       ///
       /// If this expected contains an error, the result also contains an error
@@ -864,6 +1020,39 @@ namespace bit {
                typename=std::enable_if_t<is_invocable<Fn, const T&>::value>>
       expected<invoke_result_t<Fn,const T&>,E> map( Fn&& fn ) const;
 
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename,typename> friend class expected;
+
+      /// \brief Constructs the value from the result of invoking \p fn
+      template<typename Fn, typename...Args>
+      constexpr expected( detail::expected_invoke_value_t, Fn&& fn, Args&&...args );
+
+      /// \brief Constructs the error from the result of invoking \p fn
+      template<typename Fn, typename...Args>
+      constexpr expected( detail::expected_invoke_error_t, Fn&& fn, Args&&...args );
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename Result, typename Self, typename Fn>
+      static Result and_then_impl( Self&& self, Fn&& fn );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_impl( Self&& self, Fn&& fn, std::false_type );
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_impl( Self&& self, Fn&& fn, std::true_type );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result or_else_impl( Self&& self, Fn&& fn );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_error_impl( Self&& self, Fn&& fn );
     };
 
     //=========================================================================
@@ -903,9 +1092,9 @@ namespace bit {
       /// \brief Copy-constructs an expected from an existing expected
       ///
       /// \param other the other expected
-      expected( enable_overload_if<std::is_copy_constructible<E>::value,
+      expected( enable_overload_if_t<std::is_copy_constructible<E>::value,
                                    const expected&> other );
-      expected( disable_overload_if<std::is_copy_constructible<E>::value,
+      expected( disable_overload_if_t<std::is_copy_constructible<E>::value,
                                     const expected&> other ) = delete;
 
       //-----------------------------------------------------------------------
@@ -913,9 +1102,9 @@ namespace bit {
       /// \brief Move-constructs an expected from an existing expected
       ///
       /// \param other the other expected
-      expected( enable_overload_if<std::is_move_constructible<E>::value,
+      expected( enable_overload_if_t<std::is_move_constructible<E>::value,
                                    expected&&> other );
-      expected( disable_overload_if<std::is_move_constructible<E>::value,
+      expected( disable_overload_if_t<std::is_move_constructible<E>::value,
                                     expected&&> other ) = delete;
 
       //-----------------------------------------------------------------------
@@ -945,6 +1134,13 @@ namespace bit {
       template<typename UError=E, typename = std::enable_if_t<std::is_copy_constructible<UError>::value>>
       constexpr expected( unexpected_type<E> const& unexpected );
 
+      /// \brief Constructs the underlying error by moving it out of a given
+      ///        unexpected type
+      ///
+      /// \param unexpected the unexpected type
+      template<typename UError=E, typename = std::enable_if_t<std::is_move_constructible<UError>::value>>
+      constexpr expected( unexpected_type<E>&& unexpected );
+
       /// \brief Constructs the underlying error from a given unexpected type
       ///
       /// \param unexpected the unexpected type
@@ -1077,6 +1273,81 @@ namespace bit {
       //------------------------------------------------------------------------
     public:
 
+      /// \{
+      /// \brief Invokes \p fn, returning its result
+      ///
+      /// \p fn must return an expected with the same error type. If this
+      /// expected contains an error, the error is propagated to the result
+      /// instead, and \p fn is not invoked.
+      ///
+      /// \param fn the function to invoke
+      /// \return the result of \p fn, or the propagated error
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn> and_then( Fn&& fn ) &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn> and_then( Fn&& fn ) &&;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn> and_then( Fn&& fn ) const &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn> and_then( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn, wrapping its result in an expected
+      ///
+      /// The result of \p fn is constructed directly in the returned
+      /// expected. If this expected contains an error, the error is propagated
+      /// to the result instead, and \p fn is not invoked.
+      ///
+      /// \param fn the function to invoke
+      /// \return an expected containing the result of \p fn, or the error
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn>,E> transform( Fn&& fn ) &;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn>,E> transform( Fn&& fn ) &&;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn>,E> transform( Fn&& fn ) const &;
+      template<typename Fn>
+      expected<detail::expected_invoke_result_t<Fn>,E> transform( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn with the contained error, returning its result
+      ///
+      /// \p fn must return an \c expected<void,G>. If this expected does not
+      /// contain an error, the result is also without error, and \p fn is not
+      /// invoked.
+      ///
+      /// \param fn the function to invoke with the error
+      /// \return the result of \p fn
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,E&> or_else( Fn&& fn ) &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,E&&> or_else( Fn&& fn ) &&;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const E&> or_else( Fn&& fn ) const &;
+      template<typename Fn>
+      detail::expected_invoke_result_t<Fn,const E&&> or_else( Fn&& fn ) const &&;
+      /// \}
+
+      /// \{
+      /// \brief Invokes \p fn with the contained error, wrapping its result
+      ///        as the error of an expected
+      ///
+      /// \param fn the function to invoke with the error
+      /// \return an expected without error, or the result of \p fn
+      template<typename Fn>
+      expected<void,detail::expected_invoke_result_t<Fn,E&>> transform_error( Fn&& fn ) &;
+      template<typename Fn>
+      expected<void,detail::expected_invoke_result_t<Fn,E&&>> transform_error( Fn&& fn ) &&;
+      template<typename Fn>
+      expected<void,detail::expected_invoke_result_t<Fn,const E&>> transform_error( Fn&& fn ) const &;
+      template<typename Fn>
+      expected<void,detail::expected_invoke_result_t<Fn,const E&&>> transform_error( Fn&& fn ) const &&;
+      /// \}
+
+      //-----------------------------------------------------------------------
+
       /// \brief Invokes the function \p fn with this expected as the argument
       ///
       /// If this expected contains an error, the result also contains an error
@@ -1099,6 +1370,35 @@ namespace bit {
                typename=std::enable_if_t<is_invocable<Fn>::value>>
       expected<invoke_result_t<Fn>,E> map( Fn&& fn ) const;
 
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename,typename> friend class expected;
+
+      /// \brief Constructs the error from the result of invoking \p fn
+      template<typename Fn, typename...Args>
+      constexpr expected( detail::expected_invoke_error_t, Fn&& fn, Args&&...args );
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      template<typename Result, typename Self, typename Fn>
+      static Result and_then_impl( Self&& self, Fn&& fn );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_impl( Self&& self, Fn&& fn, std::false_type );
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_impl( Self&& self, Fn&& fn, std::true_type );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result or_else_impl( Self&& self, Fn&& fn );
+
+      template<typename Result, typename Self, typename Fn>
+      static Result transform_error_impl( Self&& self, Fn&& fn );
     };
 
     //=========================================================================
@@ -1201,6 +1501,54 @@ namespace bit {
   } // namespace stl
 } // namespace bit
 
+//=============================================================================
+// Early-return helpers
+//=============================================================================
+
+//! \def BIT_EXPECTED_TRY(name,expression)
+//!
+//! \brief Evaluates the expected \p expression, returning its error from the
+//!        enclosing function if it has no value, and otherwise declaring
+//!        \p name as a reference to the contained value
+//!
+//! The expected is bound by reference and a temporary is lifetime-extended,
+//! so neither the expected nor its value are copied. The enclosing function
+//! must return an expected that is constructible from the unexpected_type of
+//! \p expression.
+//!
+//! \code
+//! bit::stl::expected<int> parse_port( string_view text )
+//! {
+//!   BIT_EXPECTED_TRY( digits, parse_digits( text ) );
+//!   return to_port( digits );
+//! }
+//! \endcode
+#define BIT_EXPECTED_TRY(name,expression) \
+  BIT_EXPECTED_TRY_H1(name,expression,BIT_UNIQUE_NAME(bit_expected_try_))
+#define BIT_EXPECTED_TRY_H1(name,expression,result)                     \
+  auto&& result = (expression);                                     \
+  if( !result.has_value() ) {                                       \
+    return std::forward<decltype(result)>(result).get_unexpected(); \
+  }                                                                 \
+  auto&& name = *std::forward<decltype(result)>(result)
+
+//! \def BIT_EXPECTED_TRY_VOID(expression)
+//!
+//! \brief Evaluates the expected \p expression, returning its error from the
+//!        enclosing function if it has no value
+//!
+//! This is the counterpart to BIT_EXPECTED_TRY for expressions whose value
+//! is not needed, such as an \c expected<void,E>
+#define BIT_EXPECTED_TRY_VOID(expression) \
+  BIT_EXPECTED_TRY_VOID_H1(expression,BIT_UNIQUE_NAME(bit_expected_try_))
+#define BIT_EXPECTED_TRY_VOID_H1(expression,result)                   \
+  do {                                                                \
+    auto&& result = (expression);                                     \
+    if( !result.has_value() ) {                                       \
+      return std::forward<decltype(result)>(result).get_unexpected(); \
+    }                                                                 \
+  } while( false )
+
 #include "detail/expected.inl"
 
 #endif /* BIT_STL_UTILITIES_EXPECTED_HPP */
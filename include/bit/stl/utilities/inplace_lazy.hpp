@@ -0,0 +1,265 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an allocation-free lazy-initializing wrapper
+ *        that stores its constructor arguments in place
+ *****************************************************************************/
+
+
+/*
+  The MIT License (MIT)
+
+  Bit Standard Template Library.
+  https://github.com/bitwizeshift/bit-stl
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_STL_UTILITIES_INPLACE_LAZY_HPP
+#define BIT_STL_UTILITIES_INPLACE_LAZY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "compressed_tuple.hpp" // compressed_tuple
+#include "in_place.hpp"         // in_place_t
+#include "lazy.hpp"             // lazy_unsynchronized_policy
+#include "uninitialized_storage.hpp"
+
+#include "../traits/composition/conjunction.hpp"
+
+#include <type_traits> // std::aligned_union_t, std::decay_t, etc
+#include <utility>     // std::index_sequence_for
+
+namespace bit {
+  namespace stl {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A lazy type that stores the arguments for its deferred
+    ///        construction in place, and never allocates
+    ///
+    /// Unlike \c lazy, which type-erases its constructor behind a
+    /// \c std::function, the argument types are part of this type. The
+    /// arguments are kept in a \c compressed_tuple that shares storage with
+    /// the value it constructs, so empty arguments occupy no space and the
+    /// size of an \c inplace_lazy approaches \c sizeof(T)+1.
+    ///
+    /// The arguments are consumed by the construction; once initialized,
+    /// the value cannot be reset. Like \c std::move_if_noexcept, arguments
+    /// are only forwarded as rvalues if constructing \p T cannot throw, so
+    /// that a failed construction leaves them intact for a later retry.
+    ///
+    /// \tparam T the type contained within this lazy
+    /// \tparam Args the types of the arguments used to construct \p T
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, typename...Args>
+    class inplace_lazy
+    {
+      static_assert( conjunction<std::is_nothrow_move_constructible<Args>...>::value,
+                     "inplace_lazy: arguments must be nothrow move-constructible" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T; ///< The type to lazily construct
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an uninitialized lazy with value-initialized
+      ///        arguments
+      inplace_lazy();
+
+      /// \brief Constructs an uninitialized lazy that will be constructed
+      ///        with the arguments specified in \p args...
+      ///
+      /// \param args the arguments to use for deferred construction
+#ifndef BIT_DOXYGEN_BUILD
+      template<typename...UArgs, typename = std::enable_if_t<sizeof...(UArgs) == sizeof...(Args)>>
+#else
+      template<typename...UArgs>
+#endif
+      explicit inplace_lazy( in_place_t, UArgs&&...args );
+
+      /// \brief Copy-constructs a lazy type
+      ///
+      /// If the lazy being copied was already initialized, this copies the
+      /// value. Otherwise the arguments are copied, and this too will be
+      /// uninitialized
+      ///
+      /// \param other the lazy being copied
+      inplace_lazy( const inplace_lazy& other );
+
+      /// \brief Move-constructs a lazy type
+      ///
+      /// If the lazy being moved was already initialized, this moves the
+      /// value. Otherwise the arguments are moved, and this too will be
+      /// uninitialized
+      ///
+      /// \param other the lazy being moved
+      inplace_lazy( inplace_lazy&& other );
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destructs this lazy, and either the value or the arguments
+      ~inplace_lazy();
+
+      //----------------------------------------------------------------------
+
+      // The arguments are consumed on initialization, so there is no state
+      // to fall back to if assignment were to fail part-way
+      inplace_lazy& operator=( const inplace_lazy& ) = delete;
+      inplace_lazy& operator=( inplace_lazy&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Explicitly initializes this lazy if not initialized before
+      void initialize() const;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns \c true if this lazy contains a value (is initialized)
+      ///
+      /// This is an alias of has_value
+      explicit operator bool() const noexcept;
+
+      /// \brief Determines whether this lazy contains a value (is initialized)
+      ///
+      /// \return \c true when initialized, \c false otherwise
+      bool has_value() const noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Returns a pointer to the underlying lazy type
+      ///
+      /// \note It is undefined behaviour to call this if has_value returns
+      ///       \c false
+      ///
+      /// \return a pointer to the contained type
+      value_type* operator->();
+
+      /// \copydoc operator->()
+      const value_type* operator->() const;
+
+      /// \brief Returns a reference to the underlying lazy type
+      ///
+      /// \note It is undefined behaviour to call this if has_value returns
+      ///       \c false
+      ///
+      /// \return a reference to the contained type
+      value_type& operator*() &;
+
+      /// \copydoc operator*() &
+      const value_type& operator*() const &;
+
+      /// \copydoc operator*() &
+      value_type&& operator*() &&;
+
+      /// \copydoc operator*() &
+      const value_type&& operator*() const &&;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Returns a reference to the contained value
+      ///
+      /// If the lazy is not initialized prior to calling this, it will be
+      /// initialized here
+      ///
+      /// \return a reference to the contained value
+      value_type& value() &;
+
+      /// \copydoc value() &
+      const value_type& value() const &;
+
+      /// \copydoc value() &
+      value_type&& value() &&;
+
+      /// \copydoc value() &
+      const value_type&& value() const &&;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using arguments_type = compressed_tuple<Args...>;
+      using storage_type   = std::aligned_union_t<0,T,arguments_type>;
+
+      // A failed construction moves the arguments back into the storage;
+      // if that could throw, the storage would be left holding neither
+      static_assert( std::is_nothrow_move_constructible<arguments_type>::value,
+                     "inplace_lazy: arguments must be nothrow move-constructible" );
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      mutable storage_type                           m_storage; ///< The value or the arguments
+      detail::lazy_state<lazy_unsynchronized_policy> m_state;   ///< Is this lazy initialized
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Retrieves a pointer to the internal lazy target
+      value_type* ptr() const;
+
+      /// \brief Retrieves a pointer to the stored arguments
+      arguments_type* arguments() const;
+
+      /// \brief Lazy-constructs the underlying type
+      void lazy_construct() const;
+
+      /// \brief Constructs the value from the arguments that precede it in
+      ///        the storage
+      template<std::size_t...Idxs>
+      void construct_from_arguments( std::index_sequence<Idxs...> ) const;
+    };
+
+    //------------------------------------------------------------------------
+    // Utilities
+    //------------------------------------------------------------------------
+
+    /// \brief Makes an inplace_lazy that constructs a \p T from copies of
+    ///        the given arguments
+    ///
+    /// \param args the arguments to store for T's constructor
+    /// \return the lazy instance
+    template<typename T, typename...Args>
+    inplace_lazy<T,std::decay_t<Args>...> make_inplace_lazy( Args&&...args );
+
+  } // namespace stl
+} // namespace bit
+
+#include "detail/inplace_lazy.inl"
+
+#endif /* BIT_STL_UTILITIES_INPLACE_LAZY_HPP */
@@ -37,6 +37,7 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "atomic_wait.hpp" // atomic_wait, atomic_notify_all
 #include "in_place.hpp"    // in_place_t
 #include "uninitialized_storage.hpp"
 
@@ -44,87 +45,177 @@
 #include "../traits/composition/disjunction.hpp"
 #include "../traits/composition/negation.hpp"
 
+#include <atomic>      // std::atomic
+#include <cstdint>     // std::uint32_t
 #include <functional> // std::function
 #include <type_traits> // std::is_constructible, std::is_convertible, etc
 
 namespace bit {
   namespace stl {
 
-    template<typename> class lazy;
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Initialization policy for lazy types that are only ever
+    ///        accessed from a single thread at a time
+    ///
+    /// Initialization is tracked with a plain flag, so concurrent access to
+    /// a lazy with this policy is a data race. This is the default policy.
+    //////////////////////////////////////////////////////////////////////////
+    struct lazy_unsynchronized_policy{};
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Initialization policy for lazy types that may be initialized
+    ///        and observed from multiple threads
+    ///
+    /// Once initialized, accessing the value costs a single acquire-load.
+    /// Before then, the first thread to access the lazy constructs the
+    /// value while any other thread blocks until construction completes.
+    /// If construction throws, the lazy is left uninitialized, the exception
+    /// propagates to the constructing thread, and one of the blocked threads
+    /// retries the construction.
+    ///
+    /// Only the const member functions are synchronized; modifiers such as
+    /// assignment, \c reset, and \c swap still require exclusive access.
+    //////////////////////////////////////////////////////////////////////////
+    struct lazy_concurrent_policy{};
+
+    template<typename T, typename Policy = lazy_unsynchronized_policy>
+    class lazy;
+
+    /// \brief A lazy type that is safe to initialize from multiple threads
+    ///
+    /// \tparam T the type contained within the lazy
+    template<typename T>
+    using concurrent_lazy = lazy<T,lazy_concurrent_policy>;
 
     namespace detail {
 
-      template<typename T, typename U>
+      /// \brief The initialization state of a lazy, specialized by policy
+      template<typename Policy>
+      class lazy_state;
+
+      template<>
+      class lazy_state<lazy_unsynchronized_policy>
+      {
+      public:
+
+        explicit lazy_state( bool is_initialized ) noexcept;
+
+        bool is_initialized() const noexcept;
+
+        template<typename Fn>
+        void initialize( Fn&& fn ) const;
+
+        void reset() noexcept;
+
+      private:
+
+        mutable bool m_is_initialized;
+      };
+
+      template<>
+      class lazy_state<lazy_concurrent_policy>
+      {
+      public:
+
+        explicit lazy_state( bool is_initialized ) noexcept;
+
+        bool is_initialized() const noexcept;
+
+        template<typename Fn>
+        void initialize( Fn&& fn ) const;
+
+        void reset() noexcept;
+
+      private:
+
+        enum : std::uint32_t
+        {
+          uninitialized = 0,
+          constructing  = 1, ///< Being constructed; no thread is waiting
+          contended     = 2, ///< Being constructed; threads are waiting
+          initialized   = 3
+        };
+
+        mutable std::atomic<std::uint32_t> m_state;
+
+        template<typename Fn>
+        void initialize_slow( Fn&& fn ) const;
+
+        /// \brief Publishes \p state, waking any waiting threads
+        void release( std::uint32_t state ) const noexcept;
+      };
+
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_ctor_base : negation<
         disjunction<
-          std::is_constructible<T, lazy<U>&>,
-          std::is_constructible<T, const lazy<U>&>,
-          std::is_constructible<T, lazy<U>&&>,
-          std::is_constructible<T, const lazy<U>&&>,
-
-          std::is_convertible<lazy<U>&, T>,
-          std::is_convertible<const lazy<U>&, T>,
-          std::is_convertible<lazy<U>&&, T>,
-          std::is_convertible<const lazy<U>&&, T>
+          std::is_constructible<T, lazy<U,Policy>&>,
+          std::is_constructible<T, const lazy<U,Policy>&>,
+          std::is_constructible<T, lazy<U,Policy>&&>,
+          std::is_constructible<T, const lazy<U,Policy>&&>,
+
+          std::is_convertible<lazy<U,Policy>&, T>,
+          std::is_convertible<const lazy<U,Policy>&, T>,
+          std::is_convertible<lazy<U,Policy>&&, T>,
+          std::is_convertible<const lazy<U,Policy>&&, T>
         >
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_copy_ctor : conjunction<
-        lazy_is_enabled_ctor_base<T,U>,
+        lazy_is_enabled_ctor_base<T,U,Policy>,
         std::is_constructible<T,const U&>
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_move_ctor : conjunction<
-      lazy_is_enabled_ctor_base<T,U>,
+      lazy_is_enabled_ctor_base<T,U,Policy>,
         std::is_constructible<T, U&&>
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_assignment_base : negation<
         disjunction<
-          std::is_constructible<T, lazy<U>&>,
-          std::is_constructible<T, const lazy<U>&>,
-          std::is_constructible<T, lazy<U>&&>,
-          std::is_constructible<T, const lazy<U>&&>,
-
-          std::is_convertible<lazy<U>&, T>,
-          std::is_convertible<const lazy<U>&, T>,
-          std::is_convertible<lazy<U>&&, T>,
-          std::is_convertible<const lazy<U>&&, T>,
-
-          std::is_assignable<T&, lazy<U>&>,
-          std::is_assignable<T&, const lazy<U>&>,
-          std::is_assignable<T&, lazy<U>&&>,
-          std::is_assignable<T&, const lazy<U>&&>
+          std::is_constructible<T, lazy<U,Policy>&>,
+          std::is_constructible<T, const lazy<U,Policy>&>,
+          std::is_constructible<T, lazy<U,Policy>&&>,
+          std::is_constructible<T, const lazy<U,Policy>&&>,
+
+          std::is_convertible<lazy<U,Policy>&, T>,
+          std::is_convertible<const lazy<U,Policy>&, T>,
+          std::is_convertible<lazy<U,Policy>&&, T>,
+          std::is_convertible<const lazy<U,Policy>&&, T>,
+
+          std::is_assignable<T&, lazy<U,Policy>&>,
+          std::is_assignable<T&, const lazy<U,Policy>&>,
+          std::is_assignable<T&, lazy<U,Policy>&&>,
+          std::is_assignable<T&, const lazy<U,Policy>&&>
         >
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_copy_assignment : conjunction<
-        lazy_is_enabled_assignment_base<T,U>,
+        lazy_is_enabled_assignment_base<T,U,Policy>,
         std::is_assignable<T&, const U&>,
         std::is_constructible<T, const U&>
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_enabled_move_assignment : conjunction<
-        lazy_is_enabled_assignment_base<T,U>,
+        lazy_is_enabled_assignment_base<T,U,Policy>,
         std::is_assignable<T&, U&&>,
         std::is_constructible<T, U&&>
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_direct_initializable : conjunction<
         std::is_constructible<T, U&&>,
         negation<std::is_same<std::decay_t<U>,in_place_t>>,
-        negation<std::is_same<std::decay_t<U>,lazy<T>>>
+        negation<std::is_same<std::decay_t<U>,lazy<T,Policy>>>
       >{};
 
-      template<typename T, typename U>
+      template<typename T, typename U, typename Policy>
       struct lazy_is_direct_init_assignable : conjunction<
-        negation<std::is_same<std::decay_t<U>,lazy<T>>>,
+        negation<std::is_same<std::decay_t<U>,lazy<T,Policy>>>,
         std::is_constructible<T,U>,
         std::is_assignable<T,U>,
         disjunction<
@@ -141,9 +232,14 @@ namespace bit {
     /// The stored lazy-loaded class, \c T, will always be instantiated
     /// before being accessed, and destructed when put out of scope.
     ///
+    /// Whether a lazy may be shared across threads is decided by the
+    /// \p Policy; see \c lazy_unsynchronized_policy and
+    /// \c lazy_concurrent_policy.
+    ///
     /// \tparam T the type contained within this \c Lazy
+    /// \tparam Policy the initialization policy
     //////////////////////////////////////////////////////////////////////////
-    template<typename T>
+    template<typename T, typename Policy>
     class lazy
     {
       //----------------------------------------------------------------------
@@ -190,19 +286,19 @@ namespace bit {
       ///
       /// \param other the lazy to copy
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U>::value && !std::is_convertible<const U&, T>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U,Policy>::value && !std::is_convertible<const U&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      lazy( const lazy<U>& other );
+      lazy( const lazy<U,Policy>& other );
 
-      /// \copydoc lazy( const lazy<U>& )
+      /// \copydoc lazy( const lazy<U,Policy>& )
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U>::value && std::is_convertible<const U&, T>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_ctor<T,U,Policy>::value && std::is_convertible<const U&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      explicit lazy( const lazy<U>& other );
+      explicit lazy( const lazy<U,Policy>& other );
 
       //----------------------------------------------------------------------
 
@@ -215,19 +311,19 @@ namespace bit {
       ///
       /// \param other the lazy to copy
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U>::value && !std::is_convertible<U&&, T>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U,Policy>::value && !std::is_convertible<U&&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      lazy( lazy<U>&& other );
+      lazy( lazy<U,Policy>&& other );
 
-      /// \copydoc lazy( lazy<U>&& )
+      /// \copydoc lazy( lazy<U,Policy>&& )
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U>::value && std::is_convertible<U&&, T>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_ctor<T,U,Policy>::value && std::is_convertible<U&&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      explicit lazy( lazy<U>&& other );
+      explicit lazy( lazy<U,Policy>&& other );
 
       //----------------------------------------------------------------------
 
@@ -266,7 +362,7 @@ namespace bit {
       ///
       /// \param value the value to use to use to initialzie the lazy
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U = T, std::enable_if_t<detail::lazy_is_direct_initializable<T,U>::value && std::is_convertible<U&&, T>::value>* = nullptr>
+      template<typename U = T, std::enable_if_t<detail::lazy_is_direct_initializable<T,U,Policy>::value && std::is_convertible<U&&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
@@ -274,7 +370,7 @@ namespace bit {
 
       /// \copydoc lazy( U&& )
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U = T, std::enable_if_t<detail::lazy_is_direct_initializable<T,U>::value && !std::is_convertible<U&&, T>::value>* = nullptr>
+      template<typename U = T, std::enable_if_t<detail::lazy_is_direct_initializable<T,U,Policy>::value && !std::is_convertible<U&&, T>::value>* = nullptr>
 #else
       template<typename U>
 #endif
@@ -320,11 +416,11 @@ namespace bit {
       ///
       /// \param other the other lazy to copy
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_assignment<T,U>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_copy_assignment<T,U,Policy>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      lazy& operator=( const lazy<U>& other );
+      lazy& operator=( const lazy<U,Policy>& other );
 
       /// \brief Move-assigns a lazy from a convertible lazy type
       ///
@@ -336,17 +432,17 @@ namespace bit {
       ///
       /// \param other the other lazy to copy
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_assignment<T,U>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_enabled_move_assignment<T,U,Policy>::value>* = nullptr>
 #else
       template<typename U>
 #endif
-      lazy& operator=( lazy<U>&& other );
+      lazy& operator=( lazy<U,Policy>&& other );
 
       /// \brief Direct initializes a value using perfect-forwarding
       ///
       /// \param value the value to initialize this lazy with
 #ifndef BIT_DOXYGEN_BUILD
-      template<typename U, std::enable_if_t<detail::lazy_is_direct_init_assignable<T,U>::value>* = nullptr>
+      template<typename U, std::enable_if_t<detail::lazy_is_direct_init_assignable<T,U,Policy>::value>* = nullptr>
 #else
       template<typename U>
 #endif
@@ -463,9 +559,9 @@ namespace bit {
       //----------------------------------------------------------------------
     private:
 
-      std::function<void(void*)> m_ctor_function;  ///< The construction function
-      mutable storage_type       m_storage;        ///< The storage type
-      mutable bool               m_is_initialized; ///< Is this lazy initialized
+      std::function<void(void*)> m_ctor_function; ///< The construction function
+      mutable storage_type       m_storage;       ///< The storage type
+      detail::lazy_state<Policy> m_state;         ///< Is this lazy initialized
 
       //----------------------------------------------------------------------
       // Private Constructors
@@ -501,7 +597,7 @@ namespace bit {
       //----------------------------------------------------------------------
     private:
 
-      template<typename>
+      template<typename,typename>
       friend class lazy;
 
       template<typename U,typename Ctor>
@@ -518,8 +614,8 @@ namespace bit {
     ///
     /// \param val the value to retrieve the has of
     /// \return the hash of the lazy
-    template<typename T>
-    std::size_t hash_value( const lazy<T>& val );
+    template<typename T, typename Policy>
+    std::size_t hash_value( const lazy<T,Policy>& val );
 
     //------------------------------------------------------------------------
 
@@ -559,8 +655,8 @@ namespace bit {
     ///
     /// \param lhs the left lazy to swap
     /// \param rhs the right lazy to swap
-    template<typename T>
-    void swap( lazy<T>& lhs, lazy<T>& rhs );
+    template<typename T, typename Policy>
+    void swap( lazy<T,Policy>& lhs, lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
     // Comparisons
@@ -574,16 +670,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator==( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator==( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator==( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator==( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator==( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator==( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator==( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator==( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator==( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator==( const T& lhs, const lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
 
@@ -595,16 +691,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator!=( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator!=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator!=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator!=( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator!=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator!=( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator!=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator!=( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator!=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator!=( const T& lhs, const lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
 
@@ -616,16 +712,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator<( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator<( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator<( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator<( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator<( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator<( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator<( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator<( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator<( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator<( const T& lhs, const lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
 
@@ -637,16 +733,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator<=( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator<=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator<=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator<=( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator<=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator<=( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator<=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator<=( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator<=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator<=( const T& lhs, const lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
 
@@ -658,16 +754,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator>( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator>( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator>( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator>( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator>( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator>( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator>( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator>( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator>( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator>( const T& lhs, const lazy<T,Policy>& rhs );
 
     //------------------------------------------------------------------------
 
@@ -679,16 +775,16 @@ namespace bit {
     ///
     /// \param lhs the left argument
     /// \param rhs the right argument
-    template<typename T>
-    bool operator>=( const lazy<T>& lhs, const lazy<T>& rhs );
+    template<typename T, typename Policy>
+    bool operator>=( const lazy<T,Policy>& lhs, const lazy<T,Policy>& rhs );
 
-    /// \copydoc operator>=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator>=( const lazy<T>& lhs, const T& rhs );
+    /// \copydoc operator>=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator>=( const lazy<T,Policy>& lhs, const T& rhs );
 
-    /// \copydoc operator>=( const lazy<T>&, const lazy<T>& )
-    template<typename T>
-    bool operator>=( const T& lhs, const lazy<T>& rhs );
+    /// \copydoc operator>=( const lazy<T,Policy>&, const lazy<T,Policy>& )
+    template<typename T, typename Policy>
+    bool operator>=( const T& lhs, const lazy<T,Policy>& rhs );
 
   } // namespace stl
 } // namespace bit
@@ -87,9 +87,9 @@
 //!        either a unique counter or the line number (if the counter is
 //!        not otherwise available)
 #ifdef __COUNTER__
-# define BIT_UNIQUE_NAME(name) BIT_JOIN(name,BIT_STRINGIZE(__COUNTER__))
+# define BIT_UNIQUE_NAME(name) BIT_JOIN(name,__COUNTER__)
 #else
-# define BIT_UNIQUE_NAME(name) BIT_JOIN(name,BIT_STRINGIZE(__LINE__))
+# define BIT_UNIQUE_NAME(name) BIT_JOIN(name,__LINE__)
 #endif
 
 //! \def BIT_EMPTY
@@ -367,16 +367,16 @@
 // VARIADIC MACROS
 //----------------------------------------------------------------------------
 
-// Counting variadic arguments
+// Counting variadic arguments, up to 64
 #if (_MSC_VER >= 1400)
-# define BIT_NUM_ARGS_REVERSE_SEQUENCE 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
-# define BIT_COUNT_VA_ARGS_HELPER(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, N, ...) N
+# define BIT_NUM_ARGS_REVERSE_SEQUENCE 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+# define BIT_COUNT_VA_ARGS_HELPER(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, N, ...) N
 # define BIT_LEFT_PARENTHESIS    (
 # define BIT_RIGHT_PARENTHESIS   )
 # define BIT_COUNT_VA_ARGS(...)    BIT_COUNT_VA_ARGS_HELPER BIT_LEFT_PARENTHESIS __VA_ARGS__, BIT_NUM_ARGS_REVERSE_SEQUENCE BIT_RIGHT_PARENTHESIS
 #else
-# define BIT_COUNT_VA_ARGS_HELPER(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, N, ...)    N
-# define BIT_COUNT_VA_ARGS(...)    BIT_COUNT_VA_ARGS_HELPER(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+# define BIT_COUNT_VA_ARGS_HELPER(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, N, ...)    N
+# define BIT_COUNT_VA_ARGS(...)    BIT_COUNT_VA_ARGS_HELPER(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
 #endif
 
 // BIT_PASS_VA_ARGS passes __VA_ARGS__ as multiple parameters to another macro
@@ -386,7 +386,7 @@
 # define BIT_PASS_VA_ARGS(op, ...) op(__VA_ARGS__)
 #endif
 
-// Variadic macro expansion
+// Variadic macro expansion, up to 64 arguments
 #define BIT_EXPAND_VA_ARGS_0(op)
 #define BIT_EXPAND_VA_ARGS_1(op, a1) \
   op(a1)
@@ -408,6 +408,114 @@
   op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9)
 #define BIT_EXPAND_VA_ARGS_10(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10) \
   op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10)
+#define BIT_EXPAND_VA_ARGS_11(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11)
+#define BIT_EXPAND_VA_ARGS_12(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12)
+#define BIT_EXPAND_VA_ARGS_13(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13)
+#define BIT_EXPAND_VA_ARGS_14(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14)
+#define BIT_EXPAND_VA_ARGS_15(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15)
+#define BIT_EXPAND_VA_ARGS_16(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16)
+#define BIT_EXPAND_VA_ARGS_17(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17)
+#define BIT_EXPAND_VA_ARGS_18(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18)
+#define BIT_EXPAND_VA_ARGS_19(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19)
+#define BIT_EXPAND_VA_ARGS_20(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20)
+#define BIT_EXPAND_VA_ARGS_21(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21)
+#define BIT_EXPAND_VA_ARGS_22(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22)
+#define BIT_EXPAND_VA_ARGS_23(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23)
+#define BIT_EXPAND_VA_ARGS_24(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24)
+#define BIT_EXPAND_VA_ARGS_25(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25)
+#define BIT_EXPAND_VA_ARGS_26(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26)
+#define BIT_EXPAND_VA_ARGS_27(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27)
+#define BIT_EXPAND_VA_ARGS_28(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28)
+#define BIT_EXPAND_VA_ARGS_29(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29)
+#define BIT_EXPAND_VA_ARGS_30(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30)
+#define BIT_EXPAND_VA_ARGS_31(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31)
+#define BIT_EXPAND_VA_ARGS_32(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32)
+#define BIT_EXPAND_VA_ARGS_33(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33)
+#define BIT_EXPAND_VA_ARGS_34(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34)
+#define BIT_EXPAND_VA_ARGS_35(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35)
+#define BIT_EXPAND_VA_ARGS_36(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36)
+#define BIT_EXPAND_VA_ARGS_37(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37)
+#define BIT_EXPAND_VA_ARGS_38(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38)
+#define BIT_EXPAND_VA_ARGS_39(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39)
+#define BIT_EXPAND_VA_ARGS_40(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40)
+#define BIT_EXPAND_VA_ARGS_41(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41)
+#define BIT_EXPAND_VA_ARGS_42(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42)
+#define BIT_EXPAND_VA_ARGS_43(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43)
+#define BIT_EXPAND_VA_ARGS_44(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44)
+#define BIT_EXPAND_VA_ARGS_45(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45)
+#define BIT_EXPAND_VA_ARGS_46(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46)
+#define BIT_EXPAND_VA_ARGS_47(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47)
+#define BIT_EXPAND_VA_ARGS_48(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48)
+#define BIT_EXPAND_VA_ARGS_49(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49)
+#define BIT_EXPAND_VA_ARGS_50(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50)
+#define BIT_EXPAND_VA_ARGS_51(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51)
+#define BIT_EXPAND_VA_ARGS_52(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52)
+#define BIT_EXPAND_VA_ARGS_53(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53)
+#define BIT_EXPAND_VA_ARGS_54(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54)
+#define BIT_EXPAND_VA_ARGS_55(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55)
+#define BIT_EXPAND_VA_ARGS_56(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56)
+#define BIT_EXPAND_VA_ARGS_57(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57)
+#define BIT_EXPAND_VA_ARGS_58(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58)
+#define BIT_EXPAND_VA_ARGS_59(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59)
+#define BIT_EXPAND_VA_ARGS_60(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59) op(a60)
+#define BIT_EXPAND_VA_ARGS_61(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59) op(a60) op(a61)
+#define BIT_EXPAND_VA_ARGS_62(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59) op(a60) op(a61) op(a62)
+#define BIT_EXPAND_VA_ARGS_63(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62, a63) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59) op(a60) op(a61) op(a62) op(a63)
+#define BIT_EXPAND_VA_ARGS_64(op, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62, a63, a64) \
+  op(a1) op(a2) op(a3) op(a4) op(a5) op(a6) op(a7) op(a8) op(a9) op(a10) op(a11) op(a12) op(a13) op(a14) op(a15) op(a16) op(a17) op(a18) op(a19) op(a20) op(a21) op(a22) op(a23) op(a24) op(a25) op(a26) op(a27) op(a28) op(a29) op(a30) op(a31) op(a32) op(a33) op(a34) op(a35) op(a36) op(a37) op(a38) op(a39) op(a40) op(a41) op(a42) op(a43) op(a44) op(a45) op(a46) op(a47) op(a48) op(a49) op(a50) op(a51) op(a52) op(a53) op(a54) op(a55) op(a56) op(a57) op(a58) op(a59) op(a60) op(a61) op(a62) op(a63) op(a64)
 
 #define BIT_EXPAND_ARGS(n,op,...) BIT_JOIN(BIT_EXPAND_VA_ARGS_,n)(op,__VA_ARGS__)
 
@@ -38,12 +38,14 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "in_place.hpp"
+#include "invoke.hpp"
 #include "monostate.hpp"
 #include "utility.hpp"
 
-#include "../traits/composition/sfinae.hpp"      // enable_overload_if
-#include "../traits/composition/conjunction.hpp" // conjunction
-#include "../traits/relationships/nth_type.hpp"  // nth_type
+#include "../traits/composition/sfinae.hpp"              // enable_overload_if
+#include "../traits/composition/conjunction.hpp"         // conjunction
+#include "../traits/relationships/nth_type.hpp"          // nth_type
+#include "../traits/transformations/uint_least_for.hpp" // uint_least_for_t
 
 #include <initializer_list> // std::initializer_list
 #include <memory>           // std::uses_allocator
@@ -64,6 +66,8 @@ namespace bit {
 
       struct variant_empty{};
 
+      struct variant_access;
+
       //=======================================================================
       // variant_union
       //=======================================================================
@@ -205,9 +209,13 @@ namespace bit {
       {
       public:
 
+        /// The smallest index type that can also represent the valueless
+        /// state, which is stored as the largest value of the type
+        using index_type = uint_least_for_t<sizeof...(Types)>;
+
         constexpr variant_base()
           : m_union(),
-            m_index(-1)
+            m_index(index_type(-1))
         {
 
         }
@@ -215,7 +223,7 @@ namespace bit {
         template<std::size_t N, typename...Args>
         constexpr variant_base( in_place_index_t<N>, Args&&...args )
           : m_union( in_place_index<N>, std::forward<Args>(args)... ),
-            m_index( N )
+            m_index( static_cast<index_type>(N) )
         {
 
         }
@@ -226,7 +234,7 @@ namespace bit {
       protected:
 
         variant_union<true,Types...> m_union;
-        std::size_t                  m_index;
+        index_type                   m_index;
 
         //---------------------------------------------------------------------
         // Protected Member Functions
@@ -235,7 +243,7 @@ namespace bit {
 
         void destruct()
         {
-          m_index = std::size_t(-1);
+          m_index = index_type(-1);
         }
 
         template<std::size_t I>
@@ -259,9 +267,13 @@ namespace bit {
       {
       public:
 
+        /// The smallest index type that can also represent the valueless
+        /// state, which is stored as the largest value of the type
+        using index_type = uint_least_for_t<sizeof...(Types)>;
+
         constexpr variant_base()
           : m_union(),
-            m_index(-1)
+            m_index(index_type(-1))
         {
 
         }
@@ -269,7 +281,7 @@ namespace bit {
         template<std::size_t N, typename...Args>
         constexpr variant_base( in_place_index_t<N>, Args&&...args )
           : m_union( in_place_index<N>, std::forward<Args>(args)... ),
-            m_index( N )
+            m_index( static_cast<index_type>(N) )
         {
 
         }
@@ -285,7 +297,7 @@ namespace bit {
       protected:
 
         variant_union<false,Types...> m_union;
-        std::size_t                   m_index;
+        index_type                    m_index;
 
         //---------------------------------------------------------------------
         // Protected Member Functions
@@ -294,10 +306,10 @@ namespace bit {
 
         void destruct()
         {
-          if( m_index == std::size_t(-1) ) return;
+          if( m_index == index_type(-1) ) return;
 
           destroy_impl( m_index, m_union );
-          m_index = std::size_t(-1);
+          m_index = index_type(-1);
         }
 
         template<std::size_t I>
@@ -993,6 +1005,8 @@ namespace bit {
       template<typename...Ts>
       using union_type = detail::variant_union<is_trivial,Ts...>;
 
+      using index_type = typename base_type::index_type;
+
       //----------------------------------------------------------------------
       // Private Element Access
       //----------------------------------------------------------------------
@@ -1013,6 +1027,8 @@ namespace bit {
       friend constexpr const variant_alternative_t<I, variant<UTypes...>>&
         get( const variant<UTypes...>& v );
 
+      friend struct detail::variant_access;
+
 
       //----------------------------------------------------------------------
       // Private Member Functions
@@ -1231,6 +1247,31 @@ namespace bit {
     constexpr std::add_pointer_t<const T> get_if( const variant<Types...>* pv ) noexcept;
     /// \}
 
+    //=========================================================================
+    // 23.7.7 : visitation
+    //=========================================================================
+
+    /// \brief Applies the \p visitor to the alternatives held by each of the
+    ///        \p variants
+    ///
+    /// The active indices of the \p variants are flattened into a single
+    /// index over every combination of alternatives. With at most
+    /// \c detail::variant_visit_search_limit (8) combinations, that index
+    /// selects the call through an inlined binary search, which lets the
+    /// visitor be inlined at each call. With more, dispatch is a single
+    /// indirect call through a compile-time table of function pointers,
+    /// so the cost does not grow with the number of alternatives.
+    ///
+    /// \throws bad_variant_access if any of the \p variants is
+    ///         \c valueless_by_exception
+    ///
+    /// \param visitor the Callable to invoke with every alternative
+    /// \param variants the variants whose alternatives to pass on
+    /// \return the result of invoking the visitor; this must be the same
+    ///         type for every combination of alternatives
+    template<typename Visitor, typename...Variants>
+    decltype(auto) visit( Visitor&& visitor, Variants&&...variants );
+
     //-------------------------------------------------------------------------
     // Utilities
     //-------------------------------------------------------------------------
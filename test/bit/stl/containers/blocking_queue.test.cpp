@@ -0,0 +1,172 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the blocking_queue
+ *****************************************************************************/
+
+#include <bit/stl/containers/blocking_queue.hpp>
+
+#include <algorithm> // std::equal, std::sort
+#include <iterator>  // std::back_inserter
+#include <memory>    // std::unique_ptr
+#include <numeric>   // std::iota
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+#include <catch.hpp>
+
+//-----------------------------------------------------------------------------
+// Producers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("blocking_queue::try_push( const T& )", "[producers]")
+{
+  bit::stl::blocking_queue<int> queue(2);
+
+  SECTION("Queue is not full")
+  {
+    REQUIRE( queue.try_push(1) );
+    REQUIRE( queue.size() == 1 );
+  }
+
+  SECTION("Queue is full")
+  {
+    queue.try_push(1);
+    queue.try_push(2);
+
+    REQUIRE_FALSE( queue.try_push(3) );
+    REQUIRE( queue.size() == 2 );
+  }
+}
+
+TEST_CASE("blocking_queue::push_wait( InputIt, InputIt )", "[producers]")
+{
+  bit::stl::blocking_queue<int> queue(3);
+  const auto values = std::vector<int>{1,2,3,4,5,6,7};
+
+  auto consumed = std::vector<int>{};
+  auto consumer = std::thread([&]{
+    while( consumed.size() < values.size() ) {
+      queue.pop_up_to( 2, std::back_inserter(consumed) );
+    }
+  });
+
+  queue.push_wait( values.begin(), values.end() );
+  consumer.join();
+
+  SECTION("All values are received in order")
+  {
+    REQUIRE( consumed == values );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Consumers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("blocking_queue::try_pop( T& )", "[consumers]")
+{
+  bit::stl::blocking_queue<std::unique_ptr<int>> queue(2);
+  auto out = std::unique_ptr<int>{};
+
+  SECTION("Queue is empty")
+  {
+    REQUIRE_FALSE( queue.try_pop(out) );
+  }
+
+  SECTION("Queue is not empty")
+  {
+    queue.push_wait( std::make_unique<int>(42) );
+
+    REQUIRE( queue.try_pop(out) );
+    REQUIRE( *out == 42 );
+    REQUIRE( queue.empty() );
+  }
+}
+
+TEST_CASE("blocking_queue::pop_wait()", "[consumers]")
+{
+  bit::stl::blocking_queue<std::unique_ptr<int>> queue(1);
+
+  SECTION("Waits for a value from another thread")
+  {
+    auto producer = std::thread([&]{
+      queue.push_wait( std::make_unique<int>(42) );
+    });
+
+    const auto value = queue.pop_wait();
+    producer.join();
+
+    REQUIRE( *value == 42 );
+  }
+}
+
+TEST_CASE("blocking_queue::try_pop_up_to( size_type, OutputIt )", "[consumers]")
+{
+  bit::stl::blocking_queue<int> queue(4);
+  const int values[] = {1,2,3};
+  queue.push_wait( std::begin(values), std::end(values) );
+
+  auto out = std::vector<int>{};
+
+  SECTION("Pops at most n values")
+  {
+    queue.try_pop_up_to( 2, std::back_inserter(out) );
+
+    REQUIRE( out == (std::vector<int>{1,2}) );
+    REQUIRE( queue.size() == 1 );
+  }
+
+  SECTION("Pops at most size() values")
+  {
+    queue.try_pop_up_to( 10, std::back_inserter(out) );
+
+    REQUIRE( out == (std::vector<int>{1,2,3}) );
+    REQUIRE( queue.empty() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Concurrency
+//-----------------------------------------------------------------------------
+
+TEST_CASE("blocking_queue with concurrent producers and consumers", "[concurrency]")
+{
+  static constexpr auto threads = 3;
+  static constexpr auto count   = 5000;
+
+  bit::stl::blocking_queue<int> queue(8);
+
+  auto producers = std::vector<std::thread>{};
+  auto consumers = std::vector<std::thread>{};
+  auto received  = std::vector<std::vector<int>>( threads );
+
+  for( auto t = 0; t < threads; ++t ) {
+    producers.emplace_back([&queue,t]{
+      for( auto i = 0; i < count; ++i ) {
+        queue.push_wait( t * count + i );
+      }
+    });
+    consumers.emplace_back([&queue,&received,t]{
+      for( auto i = 0; i < count; ++i ) {
+        received[t].push_back( queue.pop_wait() );
+      }
+    });
+  }
+
+  for( auto& thread : producers ) thread.join();
+  for( auto& thread : consumers ) thread.join();
+
+  auto all = std::vector<int>{};
+  for( auto& values : received ) {
+    all.insert( all.end(), values.begin(), values.end() );
+  }
+  std::sort( all.begin(), all.end() );
+
+  SECTION("Every value is received exactly once")
+  {
+    auto expected = std::vector<int>( threads * count );
+    std::iota( expected.begin(), expected.end(), 0 );
+
+    REQUIRE( all == expected );
+  }
+}
@@ -6,7 +6,11 @@
 #include <bit/stl/containers/circular_deque.hpp>
 
 #include <algorithm> // std::equal
+#include <iterator>  // std::back_inserter
+#include <memory>    // std::allocator
+#include <string>    // std::string
 #include <utility>   // std::move
+#include <vector>    // std::vector
 
 #include <catch.hpp>
 
@@ -844,6 +848,235 @@ TEST_CASE("circular_deque::pop_front()","[modifier]")
 
 //-----------------------------------------------------------------------------
 
+TEST_CASE("circular_deque::push_back( const T& ) with circular_overwrite_policy","[modifier]")
+{
+  const auto size = 5u;
+  auto deque = bit::stl::circular_deque<int>{size};
+
+  // Wraps the deque around more than once
+  for( auto i = 0; i < 12; ++i ) {
+    deque.push_back(i);
+  }
+
+  SECTION("Size is capacity")
+  {
+    REQUIRE( deque.size() == size );
+  }
+
+  SECTION("Evicts the oldest entries")
+  {
+    const int expected[] = {7,8,9,10,11};
+
+    REQUIRE( std::equal(deque.begin(),deque.end(),std::begin(expected),std::end(expected)) );
+  }
+}
+
+TEST_CASE("circular_deque::push_back( const T& ) with circular_growth_policy","[modifier]")
+{
+  const auto size = 4u;
+  auto deque = bit::stl::circular_deque<int,std::allocator<int>,bit::stl::circular_growth_policy>{size};
+
+  // Wraps the storage before growing so that growth must unwrap entries
+  for( auto i = 0; i < 3; ++i ) {
+    deque.push_back(i);
+  }
+  deque.pop_front();
+  deque.pop_front();
+  for( auto i = 3; i < 10; ++i ) {
+    deque.push_back(i);
+  }
+
+  SECTION("Capacity doubles when full")
+  {
+    REQUIRE( deque.capacity() == size * 2 );
+  }
+
+  SECTION("Keeps all entries in order")
+  {
+    const int expected[] = {2,3,4,5,6,7,8,9};
+
+    REQUIRE( std::equal(deque.begin(),deque.end(),std::begin(expected),std::end(expected)) );
+  }
+}
+
+TEST_CASE("circular_deque::push_front( T&& ) with circular_growth_policy","[modifier]")
+{
+  auto deque = bit::stl::circular_deque<nothrow_moveable,std::allocator<nothrow_moveable>,bit::stl::circular_growth_policy>{};
+
+  nothrow_moveable::copy_calls = 0;
+  for( auto i = 0; i < 5; ++i ) {
+    deque.push_front( nothrow_moveable{i} );
+  }
+
+  SECTION("Grows from an empty deque")
+  {
+    REQUIRE( deque.capacity() == 8 );
+  }
+
+  SECTION("Keeps all entries in order")
+  {
+    const nothrow_moveable expected[] = {4,3,2,1,0};
+
+    REQUIRE( std::equal(deque.begin(),deque.end(),std::begin(expected),std::end(expected)) );
+  }
+
+  SECTION("Does not call copy constructor")
+  {
+    REQUIRE( nothrow_moveable::copy_calls == 0 );
+  }
+}
+
+TEST_CASE("circular_deque insertion of its own entries with circular_growth_policy","[modifier]")
+{
+  using deque_type = bit::stl::circular_deque<std::string,std::allocator<std::string>,bit::stl::circular_growth_policy>;
+
+  // Strings long enough to own heap storage, so a use-after-relocate is
+  // visible as a lost value rather than a surviving small buffer
+  const auto first = std::string(32,'a');
+  const auto last  = std::string(32,'z');
+
+  auto deque = deque_type{2};
+  deque.push_back(first);
+  deque.push_back(last);
+
+  SECTION("push_back( const T& ) of the front entry")
+  {
+    deque.push_back( deque.front() );
+
+    REQUIRE( deque.size() == 3 );
+    REQUIRE( deque.front() == first );
+    REQUIRE( deque.back() == first );
+  }
+
+  SECTION("push_front( const T& ) of the back entry")
+  {
+    deque.push_front( deque.back() );
+
+    REQUIRE( deque.size() == 3 );
+    REQUIRE( deque.front() == last );
+    REQUIRE( deque.back() == last );
+  }
+
+  SECTION("emplace_back( Args&&... ) from the back entry")
+  {
+    deque.emplace_back( deque.back(), 1 );
+
+    REQUIRE( deque.size() == 3 );
+    REQUIRE( deque.back() == last.substr(1) );
+  }
+
+  SECTION("emplace_front( Args&&... ) from the front entry")
+  {
+    deque.emplace_front( deque.front(), 1 );
+
+    REQUIRE( deque.size() == 3 );
+    REQUIRE( deque.front() == first.substr(1) );
+    REQUIRE( deque.back() == last );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("circular_deque::drain_into( OutputIt )","[modifier]")
+{
+  const auto size = 5u;
+  auto deque = bit::stl::circular_deque<nothrow_moveable>{size};
+
+  SECTION("Deque is empty")
+  {
+    auto output = std::vector<nothrow_moveable>{};
+    deque.drain_into( std::back_inserter(output) );
+
+    SECTION("Writes no entries")
+    {
+      REQUIRE( output.empty() );
+    }
+  }
+
+  SECTION("Deque wraps around the end of storage")
+  {
+    for( auto i = 0; i < 8; ++i ) {
+      deque.push_back( nothrow_moveable{i} );
+    }
+    const nothrow_moveable expected[] = {3,4,5,6,7};
+
+    auto output = std::vector<nothrow_moveable>{};
+    nothrow_moveable::copy_calls = 0;
+    deque.drain_into( std::back_inserter(output) );
+
+    SECTION("Writes entries from front to back")
+    {
+      REQUIRE( std::equal(output.begin(),output.end(),std::begin(expected),std::end(expected)) );
+    }
+
+    SECTION("Does not call copy constructor")
+    {
+      REQUIRE( nothrow_moveable::copy_calls == 0 );
+    }
+
+    SECTION("Deque is empty")
+    {
+      REQUIRE( deque.empty() );
+    }
+
+    SECTION("Capacity is unchanged")
+    {
+      REQUIRE( deque.capacity() == size );
+    }
+  }
+}
+
+TEST_CASE("circular_deque::snapshot( span<T> )","[modifier]")
+{
+  const auto size = 5u;
+  auto deque = bit::stl::circular_deque<int>{size};
+
+  for( auto i = 0; i < 7; ++i ) {
+    deque.push_back(i);
+  }
+
+  SECTION("Output is large enough for all entries")
+  {
+    int output[8] = {};
+    const auto count = deque.snapshot( output );
+    const int expected[] = {2,3,4,5,6};
+
+    SECTION("Returns the number of entries copied")
+    {
+      REQUIRE( count == size );
+    }
+
+    SECTION("Copies entries from front to back")
+    {
+      REQUIRE( std::equal(output, output + count, std::begin(expected), std::end(expected)) );
+    }
+
+    SECTION("Deque is unchanged")
+    {
+      REQUIRE( std::equal(deque.begin(),deque.end(),std::begin(expected),std::end(expected)) );
+    }
+  }
+
+  SECTION("Output is smaller than the deque")
+  {
+    int output[4] = {};
+    const auto count = deque.snapshot( output );
+    const int expected[] = {2,3,4,5};
+
+    SECTION("Returns the size of the output")
+    {
+      REQUIRE( count == 4 );
+    }
+
+    SECTION("Copies the oldest entries")
+    {
+      REQUIRE( std::equal(std::begin(output), std::end(output), std::begin(expected), std::end(expected)) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_CASE("circular_deque::swap( circular_deque& )","[modifier]")
 {
   const auto size = 5u;
@@ -6,6 +6,9 @@
 #include <bit/stl/containers/circular_queue.hpp>
 
 #include <algorithm> // std::equal
+#include <iterator>  // std::begin, std::end
+#include <memory>    // std::allocator
+#include <string>    // std::string
 #include <utility>   // std::move
 
 #include <catch.hpp>
@@ -555,6 +558,65 @@ TEST_CASE("circular_queue::pop()","[modifier]")
 
 //-----------------------------------------------------------------------------
 
+TEST_CASE("circular_queue::push( const T& ) with circular_growth_policy","[modifier]")
+{
+  const auto size = 3u;
+  auto queue = bit::stl::circular_queue<copyable,std::allocator<copyable>,bit::stl::circular_growth_policy>{size};
+
+  queue.push( copyable{0} );
+  queue.push( copyable{1} );
+  queue.pop();
+  for( auto i = 2; i < 7; ++i ) {
+    queue.push( copyable{i} );
+  }
+
+  SECTION("Capacity doubles when full")
+  {
+    REQUIRE( queue.capacity() == size * 2 );
+  }
+
+  SECTION("Keeps all entries in order")
+  {
+    const int expected[] = {1,2,3,4,5,6};
+    const auto has_value = []( const copyable& lhs, int rhs ){
+      return lhs.value == rhs;
+    };
+
+    REQUIRE( std::equal(queue.begin(),queue.end(),std::begin(expected),std::end(expected),has_value) );
+  }
+}
+
+TEST_CASE("circular_queue insertion of its own entries with circular_growth_policy","[modifier]")
+{
+  using queue_type = bit::stl::circular_queue<std::string,std::allocator<std::string>,bit::stl::circular_growth_policy>;
+
+  const auto first = std::string(32,'a');
+  const auto last  = std::string(32,'z');
+
+  auto queue = queue_type{2};
+  queue.push(first);
+  queue.push(last);
+
+  SECTION("push( const T& ) of the front entry")
+  {
+    queue.push( queue.front() );
+
+    REQUIRE( queue.size() == 3 );
+    REQUIRE( queue.front() == first );
+    REQUIRE( queue.back() == first );
+  }
+
+  SECTION("emplace( Args&&... ) from the back entry")
+  {
+    queue.emplace( queue.back(), 1 );
+
+    REQUIRE( queue.size() == 3 );
+    REQUIRE( queue.back() == last.substr(1) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_CASE("circular_queue::swap( circular_queue& )","[modifier]")
 {
   const auto size = 5u;
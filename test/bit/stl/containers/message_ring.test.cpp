@@ -0,0 +1,270 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the message_ring
+ *****************************************************************************/
+
+#include <bit/stl/containers/message_ring.hpp>
+
+#include <cstring> // std::memcpy
+#include <memory>  // std::align
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  //---------------------------------------------------------------------------
+
+  /// A region of memory suitably aligned to hold a message ring
+  class region
+  {
+  public:
+
+    explicit region( std::size_t capacity )
+      : m_size(bit::stl::spsc_message_ring::required_size(capacity)),
+        m_storage(m_size + alignment)
+    {
+
+    }
+
+    void* data() noexcept
+    {
+      auto* p     = static_cast<void*>(m_storage.data());
+      auto  space = m_storage.size();
+      return std::align( alignment, m_size, p, space );
+    }
+
+    std::size_t size() const noexcept { return m_size; }
+
+  private:
+
+    static constexpr std::size_t alignment = alignof(bit::stl::spsc_message_ring);
+
+    std::size_t       m_size;
+    std::vector<char> m_storage;
+  };
+
+  //---------------------------------------------------------------------------
+
+  template<typename Ring>
+  bool push_value( Ring& ring, int value )
+  {
+    auto message = ring.try_reserve( sizeof(int) );
+    if( message.data() == nullptr ) return false;
+
+    std::memcpy( message.data(), &value, sizeof(int) );
+    ring.commit( message );
+    return true;
+  }
+
+  template<typename Ring>
+  int pop_value( Ring& ring )
+  {
+    auto value = 0;
+    ring.try_pop([&]( bit::stl::span<const bit::stl::byte> message ){
+      REQUIRE( message.size() == sizeof(int) );
+      std::memcpy( &value, message.data(), sizeof(int) );
+    });
+    return value;
+  }
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Static Factories
+//-----------------------------------------------------------------------------
+
+TEST_CASE("message_ring::create( void*, size_type )", "[factory]")
+{
+  auto storage = region{256};
+  auto* ring = bit::stl::spsc_message_ring::create( storage.data(), storage.size() );
+
+  SECTION("Ring is empty")
+  {
+    REQUIRE( ring->empty() );
+  }
+
+  SECTION("Capacity is the requested power of 2")
+  {
+    REQUIRE( ring->capacity() == 256 );
+  }
+
+  SECTION("Attaching returns the created ring")
+  {
+    REQUIRE( bit::stl::spsc_message_ring::attach( storage.data() ) == ring );
+  }
+}
+
+TEST_CASE("message_ring::attach( void* )", "[factory]")
+{
+  auto storage = region{256};
+  std::memset( storage.data(), 0, storage.size() );
+
+  SECTION("Uncreated region returns null")
+  {
+    REQUIRE( bit::stl::spsc_message_ring::attach( storage.data() ) == nullptr );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("message_ring::try_push( span<const byte> )", "[modifiers]")
+{
+  auto storage = region{128};
+  auto* ring = bit::stl::spsc_message_ring::create( storage.data(), storage.size() );
+
+  const char text[] = "hello";
+  const auto message = bit::stl::span<const bit::stl::byte>(
+    reinterpret_cast<const bit::stl::byte*>(text), sizeof(text)
+  );
+
+  SECTION("Message is visible to the consumer")
+  {
+    REQUIRE( ring->try_push( message ) );
+
+    const auto peeked = ring->try_peek();
+
+    REQUIRE( peeked.size() == sizeof(text) );
+    REQUIRE( std::memcmp( peeked.data(), text, sizeof(text) ) == 0 );
+  }
+
+  SECTION("Message larger than max_message_size fails")
+  {
+    const auto large = std::vector<bit::stl::byte>( ring->max_message_size() + 1 );
+    const auto span  = bit::stl::span<const bit::stl::byte>(
+      large.data(), static_cast<std::ptrdiff_t>(large.size())
+    );
+
+    REQUIRE_FALSE( ring->try_push( span ) );
+  }
+
+  SECTION("Pushing to a full ring fails")
+  {
+    // Each int occupies a 16 byte record
+    for( auto i = 0; i < 8; ++i ) {
+      REQUIRE( push_value( *ring, i ) );
+    }
+
+    REQUIRE_FALSE( push_value( *ring, 8 ) );
+  }
+}
+
+TEST_CASE("message_ring::try_pop( Fn&& )", "[modifiers]")
+{
+  auto storage = region{128};
+  auto* ring = bit::stl::spsc_message_ring::create( storage.data(), storage.size() );
+
+  SECTION("Empty ring returns false")
+  {
+    REQUIRE_FALSE( ring->try_pop([]( bit::stl::span<const bit::stl::byte> ){}) );
+  }
+
+  SECTION("Messages are popped in order")
+  {
+    push_value( *ring, 1 );
+    push_value( *ring, 2 );
+
+    REQUIRE( pop_value( *ring ) == 1 );
+    REQUIRE( pop_value( *ring ) == 2 );
+    REQUIRE( ring->empty() );
+  }
+
+  SECTION("Messages that do not fit before the end are padded")
+  {
+    auto large = std::vector<bit::stl::byte>( 40 );
+    const auto span = bit::stl::span<const bit::stl::byte>(
+      large.data(), static_cast<std::ptrdiff_t>(large.size())
+    );
+
+    // Two 48 byte records leave 32 bytes before the end of storage
+    REQUIRE( ring->try_push( span ) );
+    REQUIRE( ring->try_push( span ) );
+    ring->try_pop([]( bit::stl::span<const bit::stl::byte> ){});
+    ring->try_pop([]( bit::stl::span<const bit::stl::byte> ){});
+
+    REQUIRE( ring->try_push( span ) );
+
+    const auto peeked = ring->try_peek();
+    REQUIRE( peeked.size() == 40 );
+    REQUIRE( static_cast<const void*>(peeked.data()) ==
+             static_cast<const void*>(static_cast<const bit::stl::byte*>(storage.data()) +
+                                      sizeof(bit::stl::spsc_message_ring) + 8) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Position Independence
+//-----------------------------------------------------------------------------
+
+TEST_CASE("message_ring attached at a different address", "[position]")
+{
+  auto first  = region{128};
+  auto second = region{128};
+  auto* ring = bit::stl::spsc_message_ring::create( first.data(), first.size() );
+
+  push_value( *ring, 42 );
+
+  // Simulates a second process mapping the region at a different address
+  std::memcpy( second.data(), first.data(), first.size() );
+  auto* attached = bit::stl::spsc_message_ring::attach( second.data() );
+
+  REQUIRE( attached != nullptr );
+  REQUIRE( pop_value( *attached ) == 42 );
+  REQUIRE( pop_value( *ring ) == 42 );
+}
+
+//-----------------------------------------------------------------------------
+// Concurrency
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpsc_message_ring with concurrent producers", "[concurrency]")
+{
+  static constexpr auto producers = 4;
+  static constexpr auto count     = 10000;
+
+  auto storage = region{1024};
+  auto* ring = bit::stl::mpsc_message_ring::create( storage.data(), storage.size() );
+
+  auto threads = std::vector<std::thread>{};
+  for( auto p = 0; p < producers; ++p ) {
+    threads.emplace_back([ring,p]{
+      for( auto i = 0; i < count; ++i ) {
+        while( !push_value( *ring, p * count + i ) ) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  auto last     = std::vector<int>( producers, -1 );
+  auto received = 0;
+  auto ordered  = true;
+  while( received < producers * count ) {
+    ring->try_pop([&]( bit::stl::span<const bit::stl::byte> message ){
+      auto value = 0;
+      std::memcpy( &value, message.data(), sizeof(int) );
+
+      const auto producer = value / count;
+      ordered = ordered && (value % count == last[producer] + 1);
+      last[producer] = value % count;
+      ++received;
+    });
+  }
+
+  for( auto& thread : threads ) {
+    thread.join();
+  }
+
+  SECTION("Each producer's messages arrive in order")
+  {
+    REQUIRE( ordered );
+  }
+
+  SECTION("Ring is empty once all are consumed")
+  {
+    REQUIRE( ring->empty() );
+  }
+}
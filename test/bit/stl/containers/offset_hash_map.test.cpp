@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the offset_hash_map
+ *****************************************************************************/
+
+#include <bit/stl/containers/offset_hash_map.hpp>
+#include <bit/stl/containers/offset_string.hpp>
+
+#include <cstdint>   // std::uint32_t
+#include <cstdio>    // std::tmpfile, std::fwrite
+#include <stdexcept> // std::out_of_range
+#include <string>    // std::string, std::to_string
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/mman.h> // mmap, munmap
+#endif
+
+#include <catch.hpp>
+
+namespace {
+
+  struct lookup_table
+  {
+    bit::stl::offset_hash_map<bit::stl::offset_string,std::uint32_t> index;
+    bit::stl::offset_vector<bit::stl::offset_string> names;
+  };
+
+  std::vector<std::string> make_names( std::size_t n )
+  {
+    auto names = std::vector<std::string>{};
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      names.push_back( "name-" + std::to_string(i) );
+    }
+    return names;
+  }
+
+  bit::stl::image_builder build_table( const std::vector<std::string>& names )
+  {
+    auto pairs = std::vector<std::pair<std::string,std::uint32_t>>{};
+    for( auto i = std::size_t{0}; i < names.size(); ++i ) {
+      pairs.emplace_back( names[i], static_cast<std::uint32_t>(i) );
+    }
+
+    using map_type = bit::stl::offset_hash_map<bit::stl::offset_string,std::uint32_t>;
+    using names_type = bit::stl::offset_vector<bit::stl::offset_string>;
+
+    auto builder = bit::stl::image_builder{};
+    const auto root = builder.emplace<lookup_table>();
+
+    map_type::build( builder, builder.offset_of(&builder.get(root)->index), pairs );
+    names_type::build( builder, builder.offset_of(&builder.get(root)->names), names );
+    builder.set_root( root );
+
+    return builder;
+  }
+
+} // anonymous namespace
+
+TEST_CASE("offset_hash_map::offset_hash_map()", "[ctor]")
+{
+  const auto map = bit::stl::offset_hash_map<int,int>{};
+
+  REQUIRE( map.empty() );
+  REQUIRE( map.find(1) == map.end() );
+}
+
+TEST_CASE("offset_hash_map<int,int>", "[lookup]")
+{
+  auto source = std::vector<std::pair<int,int>>{};
+  for( auto i = 0; i < 1000; ++i ) {
+    source.emplace_back( i * 64, i );
+  }
+
+  auto builder = bit::stl::image_builder{};
+  const auto self = builder.emplace<bit::stl::offset_hash_map<int,int>>();
+  bit::stl::offset_hash_map<int,int>::build( builder, self, source );
+
+  const auto& map = *builder.get(self);
+
+  SECTION("Contains every entry")
+  {
+    REQUIRE( map.size() == 1000 );
+
+    auto found = 0;
+    for( const auto& entry : source ) {
+      found += (map.at(entry.first) == entry.second);
+    }
+    REQUIRE( found == 1000 );
+  }
+
+  SECTION("Missing keys are not found")
+  {
+    REQUIRE( map.count(1) == 0 );
+    REQUIRE_THROWS_AS( map.at(1), std::out_of_range );
+  }
+
+  SECTION("Iterates entries in build order")
+  {
+    REQUIRE( map.begin()->first == 0 );
+    REQUIRE( (map.end() - 1)->second == 999 );
+  }
+}
+
+TEST_CASE("offset_hash_map<offset_string,T>", "[lookup]")
+{
+  const auto names   = make_names( 100 );
+  const auto builder = build_table( names );
+  const auto* table  = bit::stl::image_root<lookup_table>( builder.data(), builder.size() );
+
+  REQUIRE( table != nullptr );
+
+  SECTION("Keys are looked up by string_view")
+  {
+    REQUIRE( table->index.at("name-42") == 42 );
+    REQUIRE( table->index.at(std::string{"name-7"}) == 7 );
+    REQUIRE( table->index.count("name-100") == 0 );
+  }
+
+  SECTION("Nested containers share the image")
+  {
+    REQUIRE( table->names[table->index.at("name-99")] == "name-99" );
+  }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("offset_hash_map mapped read-only from a file", "[lookup]")
+{
+  const auto names = make_names( 500 );
+
+  auto* file = std::tmpfile();
+  REQUIRE( file != nullptr );
+
+  auto size = std::size_t{0};
+  {
+    const auto builder = build_table( names );
+    size = builder.size();
+
+    REQUIRE( std::fwrite( builder.data(), 1, size, file ) == size );
+    REQUIRE( std::fflush( file ) == 0 );
+  } // The builder's memory is released before the file is mapped
+
+  auto* const mapping = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, ::fileno(file), 0 );
+  REQUIRE( mapping != MAP_FAILED );
+
+  const auto* table = bit::stl::image_root<lookup_table>( mapping, size );
+  REQUIRE( table != nullptr );
+
+  auto found = std::size_t{0};
+  for( auto i = std::size_t{0}; i < names.size(); ++i ) {
+    const auto it = table->index.find( names[i] );
+    found += (it != table->index.end() && it->second == i && table->names[i] == it->first);
+  }
+  REQUIRE( found == names.size() );
+
+  ::munmap( mapping, size );
+  std::fclose( file );
+}
+#endif
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the basic_offset_string
+ *****************************************************************************/
+
+#include <bit/stl/containers/offset_string.hpp>
+
+#include <cstring> // std::strlen
+#include <string>  // std::string
+
+#include <catch.hpp>
+
+TEST_CASE("basic_offset_string::basic_offset_string()", "[ctor]")
+{
+  const auto string = bit::stl::offset_string{};
+
+  REQUIRE( string.empty() );
+  REQUIRE( std::strlen(string.c_str()) == 0 );
+}
+
+TEST_CASE("basic_offset_string::build( image_builder&, image_offset<basic_offset_string>, basic_string_view )", "[building]")
+{
+  auto builder = bit::stl::image_builder{};
+  const auto self = builder.emplace<bit::stl::offset_string>();
+  bit::stl::offset_string::build( builder, self, std::string{"hello world"} );
+
+  const auto& string = *builder.get(self);
+
+  SECTION("Contains the characters")
+  {
+    REQUIRE( string == "hello world" );
+    REQUIRE( string.size() == 11 );
+  }
+
+  SECTION("Is null-terminated")
+  {
+    REQUIRE( std::strlen(string.c_str()) == 11 );
+  }
+
+  SECTION("Hashes equal to a string_view of the same characters")
+  {
+    const auto view = bit::stl::string_view{"hello world"};
+
+    REQUIRE( hash_value(string) == hash_value(view) );
+    REQUIRE( string == view );
+  }
+}
@@ -0,0 +1,67 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the offset_vector
+ *****************************************************************************/
+
+#include <bit/stl/containers/offset_vector.hpp>
+
+#include <algorithm> // std::equal
+#include <cstddef>   // std::max_align_t
+#include <cstring>   // std::memcpy
+#include <vector>    // std::vector
+
+#include <catch.hpp>
+
+TEST_CASE("offset_vector::offset_vector()", "[ctor]")
+{
+  const auto vector = bit::stl::offset_vector<int>{};
+
+  REQUIRE( vector.empty() );
+  REQUIRE( vector.begin() == vector.end() );
+}
+
+TEST_CASE("offset_vector::build( image_builder&, image_offset<offset_vector>, const Range& )", "[building]")
+{
+  const auto source = std::vector<int>{1,2,3,4,5};
+
+  auto builder = bit::stl::image_builder{};
+  const auto self = builder.emplace<bit::stl::offset_vector<int>>();
+  bit::stl::offset_vector<int>::build( builder, self, source );
+  builder.set_root( self );
+
+  SECTION("Contains the source elements")
+  {
+    const auto& vector = *builder.get(self);
+
+    REQUIRE( vector.size() == 5 );
+    REQUIRE( std::equal(vector.begin(),vector.end(),source.begin(),source.end()) );
+  }
+
+  SECTION("Contents survive relocation of the image")
+  {
+    auto storage = std::vector<std::max_align_t>( builder.size() / sizeof(std::max_align_t) + 1 );
+    std::memcpy( storage.data(), builder.data(), builder.size() );
+
+    const auto* vector = bit::stl::image_root<bit::stl::offset_vector<int>>( storage.data(), builder.size() );
+
+    REQUIRE( vector->front() == 1 );
+    REQUIRE( vector->back() == 5 );
+    REQUIRE( std::equal(vector->begin(),vector->end(),source.begin(),source.end()) );
+  }
+}
+
+TEST_CASE("offset_vector<offset_vector<T>>", "[building]")
+{
+  const auto source = std::vector<std::vector<int>>{ {1}, {}, {2,3} };
+
+  auto builder = bit::stl::image_builder{};
+  const auto self = builder.emplace<bit::stl::offset_vector<bit::stl::offset_vector<int>>>();
+  bit::stl::offset_vector<bit::stl::offset_vector<int>>::build( builder, self, source );
+
+  const auto& vector = *builder.get(self);
+
+  REQUIRE( vector.size() == 3 );
+  REQUIRE( vector[0].size() == 1 );
+  REQUIRE( vector[1].empty() );
+  REQUIRE( vector[2][1] == 3 );
+}
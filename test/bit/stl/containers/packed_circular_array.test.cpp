@@ -0,0 +1,275 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the packed_circular_array
+ *****************************************************************************/
+
+#include <bit/stl/containers/packed_circular_array.hpp>
+
+#include <algorithm> // std::equal
+#include <cstdint>   // std::uint8_t
+#include <cstring>   // std::memcpy
+#include <iterator>  // std::begin, std::end
+#include <memory>    // std::shared_ptr
+#include <string>    // std::string
+#include <type_traits>
+
+#include <catch.hpp>
+
+namespace {
+
+  constexpr bit::stl::packed_circular_array<int,4> make_rotated_array()
+  {
+    auto array = bit::stl::packed_circular_array<int,4>{0,1,2,3};
+    array.push_back(4);
+    array.push_back(5);
+    array.pop_front();
+    return array;
+  }
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Layout
+//-----------------------------------------------------------------------------
+
+TEST_CASE("packed_circular_array<T,N>", "[layout]")
+{
+  SECTION("Uses smallest index type for N")
+  {
+    using small_type = bit::stl::packed_circular_array<char,16>;
+    using large_type = bit::stl::packed_circular_array<char,300>;
+
+    STATIC_REQUIRE( sizeof(small_type::index_type) == 1 );
+    STATIC_REQUIRE( sizeof(large_type::index_type) == 2 );
+    STATIC_REQUIRE( sizeof(small_type) == 16 + 2 );
+  }
+
+  SECTION("Is trivially copyable when T is trivially copyable")
+  {
+    using type = bit::stl::packed_circular_array<int,8>;
+
+    STATIC_REQUIRE( std::is_trivially_copyable<type>::value );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    constexpr auto array = make_rotated_array();
+
+    STATIC_REQUIRE( array.size() == 3 );
+    STATIC_REQUIRE( array.front() == 3 );
+    STATIC_REQUIRE( array.back() == 5 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("packed_circular_array::packed_circular_array()", "[ctor]")
+{
+  bit::stl::packed_circular_array<int,4> array;
+
+  SECTION("Array is empty")
+  {
+    REQUIRE( array.empty() );
+  }
+
+  SECTION("Capacity is N")
+  {
+    REQUIRE( array.capacity() == 4 );
+  }
+}
+
+TEST_CASE("packed_circular_array::packed_circular_array( std::initializer_list<T> )", "[ctor]")
+{
+  SECTION("List is smaller than N")
+  {
+    bit::stl::packed_circular_array<int,4> array = {1,2};
+    const int expected[] = {1,2};
+
+    REQUIRE( std::equal(array.begin(),array.end(),std::begin(expected),std::end(expected)) );
+  }
+
+  SECTION("List is larger than N")
+  {
+    bit::stl::packed_circular_array<int,4> array = {1,2,3,4,5,6};
+    const int expected[] = {3,4,5,6};
+
+    SECTION("Array is full")
+    {
+      REQUIRE( array.full() );
+    }
+
+    SECTION("Retains last N entries")
+    {
+      REQUIRE( std::equal(array.begin(),array.end(),std::begin(expected),std::end(expected)) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("packed_circular_array::push_back( const T& )", "[modifier]")
+{
+  bit::stl::packed_circular_array<int,3> array = {0,1};
+
+  SECTION("Array is not full")
+  {
+    array.push_back(2);
+
+    SECTION("Increases size")
+    {
+      REQUIRE( array.size() == 3 );
+    }
+
+    SECTION("Becomes the back value")
+    {
+      REQUIRE( array.back() == 2 );
+    }
+  }
+
+  SECTION("Array is full")
+  {
+    array.push_back(2);
+    array.push_back(3);
+
+    SECTION("Size doesn't change")
+    {
+      REQUIRE( array.size() == 3 );
+    }
+
+    SECTION("Overwrites the front value")
+    {
+      REQUIRE( array.front() == 1 );
+    }
+
+    SECTION("Becomes the back value")
+    {
+      REQUIRE( array.back() == 3 );
+    }
+  }
+}
+
+TEST_CASE("packed_circular_array::push_front( const T& )", "[modifier]")
+{
+  bit::stl::packed_circular_array<int,3> array = {0,1};
+
+  SECTION("Array is not full")
+  {
+    array.push_front(2);
+
+    SECTION("Increases size")
+    {
+      REQUIRE( array.size() == 3 );
+    }
+
+    SECTION("Becomes the front value")
+    {
+      REQUIRE( array.front() == 2 );
+    }
+  }
+
+  SECTION("Array is full")
+  {
+    array.push_front(2);
+    array.push_front(3);
+    const int expected[] = {3,2,0};
+
+    SECTION("Size doesn't change")
+    {
+      REQUIRE( array.size() == 3 );
+    }
+
+    SECTION("Overwrites the back value")
+    {
+      REQUIRE( std::equal(array.begin(),array.end(),std::begin(expected),std::end(expected)) );
+    }
+  }
+}
+
+TEST_CASE("packed_circular_array::pop_back()", "[modifier]")
+{
+  bit::stl::packed_circular_array<std::shared_ptr<int>,3> array;
+  auto value = std::make_shared<int>(42);
+
+  array.push_back( value );
+  array.push_back( value );
+
+  array.pop_back();
+
+  SECTION("Reduces size by 1")
+  {
+    REQUIRE( array.size() == 1 );
+  }
+
+  SECTION("Releases the removed entry")
+  {
+    REQUIRE( value.use_count() == 2 );
+  }
+}
+
+TEST_CASE("packed_circular_array::pop_front()", "[modifier]")
+{
+  bit::stl::packed_circular_array<std::string,3> array = {"a","b","c"};
+
+  array.pop_front();
+
+  SECTION("Reduces size by 1")
+  {
+    REQUIRE( array.size() == 2 );
+  }
+
+  SECTION("Removes the front entry")
+  {
+    REQUIRE( array.front() == "b" );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("packed_circular_array::swap( packed_circular_array& )", "[modifier]")
+{
+  bit::stl::packed_circular_array<int,3> left  = {1,2,3,4};
+  bit::stl::packed_circular_array<int,3> right = {5};
+
+  const auto copy_left  = left;
+  const auto copy_right = right;
+
+  left.swap(right);
+
+  SECTION("Left contains Right's old state")
+  {
+    REQUIRE( left == copy_right );
+  }
+
+  SECTION("Right contains Left's old state")
+  {
+    REQUIRE( right == copy_left );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Copying
+//-----------------------------------------------------------------------------
+
+TEST_CASE("packed_circular_array copied by bytes", "[copy]")
+{
+  bit::stl::packed_circular_array<std::uint8_t,4> original = {1,2,3,4,5};
+  bit::stl::packed_circular_array<std::uint8_t,4> copy;
+
+  std::memcpy( &copy, &original, sizeof(original) );
+
+  SECTION("Copy compares equal")
+  {
+    REQUIRE( copy == original );
+  }
+
+  SECTION("Copy is independent of the original")
+  {
+    original.push_back(6);
+
+    REQUIRE( copy.front() == 2 );
+  }
+}
@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for tribool_vector
+ *****************************************************************************/
+
+#include <bit/stl/containers/tribool_vector.hpp>
+
+#include <cstddef> // std::size_t
+
+#include <catch.hpp>
+
+namespace {
+
+  const auto values = {
+    bit::stl::tribool{false},
+    bit::stl::tribool{true},
+    bit::stl::tribool{bit::stl::indeterminate}
+  };
+
+  // The strong Kleene connectives, for checking the packed operations
+  bit::stl::tribool kleene_and( bit::stl::tribool lhs, bit::stl::tribool rhs )
+  {
+    if( lhs == false || rhs == false ) return false;
+    if( lhs == true && rhs == true ) return true;
+    return bit::stl::indeterminate;
+  }
+
+  bit::stl::tribool kleene_or( bit::stl::tribool lhs, bit::stl::tribool rhs )
+  {
+    if( lhs == true || rhs == true ) return true;
+    if( lhs == false && rhs == false ) return false;
+    return bit::stl::indeterminate;
+  }
+
+  // Builds a vector that cycles through every state, spanning several words
+  bit::stl::tribool_vector make_cycle( std::size_t size, std::size_t stride )
+  {
+    auto result = bit::stl::tribool_vector{};
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      result.push_back( *(values.begin() + (i / stride) % 3) );
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("tribool_vector::tribool_vector( size_type, tribool )", "[ctor]")
+{
+  SECTION("Entries default to indeterminate")
+  {
+    auto v = bit::stl::tribool_vector(100);
+
+    REQUIRE( v.size() == 100 );
+    REQUIRE( v.count_indeterminate() == 100 );
+    REQUIRE( (v[99] == bit::stl::indeterminate) );
+  }
+
+  SECTION("Entries are initialized to the value")
+  {
+    auto v = bit::stl::tribool_vector(100, true);
+
+    REQUIRE( v.count_true() == 100 );
+    REQUIRE( v.count_false() == 0 );
+  }
+}
+
+TEST_CASE("tribool_vector::tribool_vector( std::initializer_list<tribool> )", "[ctor]")
+{
+  auto v = bit::stl::tribool_vector{ true, false, bit::stl::indeterminate };
+
+  REQUIRE( v.size() == 3 );
+  REQUIRE( v[0] == true );
+  REQUIRE( v[1] == false );
+  REQUIRE( (v[2] == bit::stl::indeterminate) );
+}
+
+//----------------------------------------------------------------------------
+// Element Access
+//----------------------------------------------------------------------------
+
+TEST_CASE("tribool_vector::operator[]( size_type )", "[element access]")
+{
+  auto v = bit::stl::tribool_vector(130);
+
+  SECTION("Assigning through the proxy sets only that entry")
+  {
+    v[64] = true;
+    v[65] = false;
+
+    REQUIRE( v[63] == bit::stl::indeterminate );
+    REQUIRE( v[64] == true );
+    REQUIRE( v[65] == false );
+    REQUIRE( v.count_true() == 1 );
+    REQUIRE( v.count_false() == 1 );
+  }
+
+  SECTION("Reassigning replaces the state")
+  {
+    v[3] = true;
+    v[3] = false;
+    v[3] = bit::stl::indeterminate;
+
+    REQUIRE( v.count_indeterminate() == 130 );
+  }
+
+  SECTION("Proxies interoperate with tribool")
+  {
+    v[0] = true;
+    v[1] = v[0];
+
+    const bit::stl::tribool t = v[1];
+
+    REQUIRE( t == true );
+    REQUIRE( (v[0] && bit::stl::tribool{true}) == true );
+    REQUIRE( !v[0] == false );
+    REQUIRE( bit::stl::indeterminate(v[2]) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("tribool_vector::resize( size_type, tribool )", "[modifiers]")
+{
+  auto v = bit::stl::tribool_vector(70, true);
+
+  SECTION("Shrinking discards the entries past the end")
+  {
+    v.resize(10);
+
+    REQUIRE( v.count_true() == 10 );
+  }
+
+  SECTION("Growing after shrinking does not resurrect old entries")
+  {
+    v.resize(10);
+    v.resize(70);
+
+    REQUIRE( v.count_true() == 10 );
+    REQUIRE( v.count_indeterminate() == 60 );
+  }
+
+  SECTION("Growing fills with the value")
+  {
+    v.resize(200, false);
+
+    REQUIRE( v.count_true() == 70 );
+    REQUIRE( v.count_false() == 130 );
+  }
+}
+
+TEST_CASE("tribool_vector::pop_back()", "[modifiers]")
+{
+  auto v = bit::stl::tribool_vector{ true, false };
+  v.pop_back();
+
+  REQUIRE( v.size() == 1 );
+  REQUIRE( v.count_false() == 0 );
+}
+
+TEST_CASE("tribool_vector::fill( tribool )", "[modifiers]")
+{
+  auto v = make_cycle(200, 7);
+  v.fill(false);
+
+  REQUIRE( v.count_false() == 200 );
+  REQUIRE( v == bit::stl::tribool_vector(200, false) );
+}
+
+//----------------------------------------------------------------------------
+// Kleene Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("tribool_vector Kleene operations", "[operations]")
+{
+  // Strides of 1 and 3 pair every state of lhs with every state of rhs
+  const auto lhs = make_cycle(300, 1);
+  const auto rhs = make_cycle(300, 3);
+
+  SECTION("operator&& matches the scalar Kleene conjunction")
+  {
+    const auto result = lhs && rhs;
+
+    for( auto i = std::size_t{0}; i < result.size(); ++i ) {
+      REQUIRE( result[i] == kleene_and( lhs[i], rhs[i] ) );
+    }
+  }
+
+  SECTION("operator|| matches the scalar Kleene disjunction")
+  {
+    const auto result = lhs || rhs;
+
+    for( auto i = std::size_t{0}; i < result.size(); ++i ) {
+      REQUIRE( result[i] == kleene_or( lhs[i], rhs[i] ) );
+    }
+  }
+
+  SECTION("operator! matches the scalar negation")
+  {
+    const auto result = !lhs;
+
+    for( auto i = std::size_t{0}; i < result.size(); ++i ) {
+      REQUIRE( result[i] == !lhs[i] );
+    }
+    REQUIRE( result.count_true() == lhs.count_false() );
+    REQUIRE( result.count_indeterminate() == lhs.count_indeterminate() );
+  }
+
+  SECTION("false && indeterminate is false")
+  {
+    const auto result = bit::stl::tribool_vector{false} &&
+                        bit::stl::tribool_vector{bit::stl::indeterminate};
+
+    REQUIRE( result[0] == false );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("tribool_vector counts", "[observers]")
+{
+  const auto v = make_cycle(300, 1);
+
+  REQUIRE( v.count_false() == 100 );
+  REQUIRE( v.count_true() == 100 );
+  REQUIRE( v.count_indeterminate() == 100 );
+}
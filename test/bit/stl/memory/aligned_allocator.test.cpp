@@ -0,0 +1,141 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the alignment utilities and aligned_allocator
+ *****************************************************************************/
+
+#include <bit/stl/memory/aligned_allocator.hpp>
+#include <bit/stl/memory/memory.hpp>
+
+#include <cstdint> // std::uint8_t
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+//=============================================================================
+// Pointer Alignment
+//=============================================================================
+
+TEST_CASE("bit::stl::align_up( std::size_t, std::size_t )", "[alignment]")
+{
+  SECTION("Rounds up to the next multiple")
+  {
+    STATIC_REQUIRE( bit::stl::align_up(65,64) == 128 );
+  }
+
+  SECTION("Aligned value is unchanged")
+  {
+    STATIC_REQUIRE( bit::stl::align_up(128,64) == 128 );
+  }
+
+  SECTION("Aligns pointers forward")
+  {
+    auto* ptr = static_cast<char*>(bit::stl::from_address(0x1001));
+
+    REQUIRE( bit::stl::align_up(ptr,16) == bit::stl::from_address(0x1010) );
+  }
+}
+
+TEST_CASE("bit::stl::align_down( std::size_t, std::size_t )", "[alignment]")
+{
+  SECTION("Rounds down to the previous multiple")
+  {
+    STATIC_REQUIRE( bit::stl::align_down(127,64) == 64 );
+  }
+
+  SECTION("Aligned value is unchanged")
+  {
+    STATIC_REQUIRE( bit::stl::align_down(128,64) == 128 );
+  }
+
+  SECTION("Aligns pointers backward")
+  {
+    auto* ptr = static_cast<char*>(bit::stl::from_address(0x101f));
+
+    REQUIRE( bit::stl::align_down(ptr,16) == bit::stl::from_address(0x1010) );
+  }
+}
+
+TEST_CASE("bit::stl::is_aligned( const void*, std::size_t )", "[alignment]")
+{
+  SECTION("Returns true if aligned")
+  {
+    auto ptr = bit::stl::from_address(0xdeadb8);
+
+    REQUIRE( bit::stl::is_aligned(ptr,4) );
+  }
+
+  SECTION("Returns false if not aligned")
+  {
+    auto ptr = bit::stl::from_address(0xdeadb7);
+
+    REQUIRE_FALSE( bit::stl::is_aligned(ptr,4) );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( bit::stl::is_aligned(192,64) );
+  }
+}
+
+//=============================================================================
+// aligned_allocator
+//=============================================================================
+
+TEST_CASE("aligned_allocator<T,Align>", "[layout]")
+{
+  SECTION("Alignment is at least Align")
+  {
+    STATIC_REQUIRE( bit::stl::aligned_allocator<char,64>::alignment == 64 );
+  }
+
+  SECTION("Alignment is at least alignof(T)")
+  {
+    STATIC_REQUIRE( bit::stl::aligned_allocator<double,1>::alignment == alignof(double) );
+  }
+}
+
+TEST_CASE("aligned_allocator::allocate( size_type )", "[allocation]")
+{
+  SECTION("Allocations are aligned")
+  {
+    auto allocator = bit::stl::aligned_allocator<std::uint8_t,128>{};
+
+    for( auto n : {1, 3, 100, 4096} ) {
+      auto* p = allocator.allocate(n);
+
+      REQUIRE( bit::stl::is_aligned(p,128) );
+      allocator.deallocate(p,n);
+    }
+  }
+
+  SECTION("Throws on overflow")
+  {
+    auto allocator = bit::stl::aligned_allocator<int>{};
+
+    REQUIRE_THROWS_AS( allocator.allocate(static_cast<std::size_t>(-1)), std::bad_alloc );
+  }
+
+  SECTION("Is usable by standard containers")
+  {
+    auto vector = std::vector<float,bit::stl::aligned_allocator<float,32>>(1000, 1.0f);
+
+    REQUIRE( bit::stl::is_aligned(vector.data(),32) );
+    REQUIRE( vector.back() == 1.0f );
+  }
+}
+
+TEST_CASE("aligned_allocator rebinding", "[allocation]")
+{
+  using allocator_type = bit::stl::aligned_allocator<int,256>;
+  using rebound_type   = std::allocator_traits<allocator_type>::rebind_alloc<char>;
+
+  SECTION("Preserves the alignment")
+  {
+    STATIC_REQUIRE( rebound_type::alignment == 256 );
+  }
+
+  SECTION("Compares equal to the original")
+  {
+    REQUIRE( rebound_type{allocator_type{}} == allocator_type{} );
+  }
+}
@@ -0,0 +1,200 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the cow_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/cow_ptr.hpp>
+
+#include <string>  // std::string
+#include <thread>  // std::thread
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  struct base
+  {
+    virtual ~base() = default;
+    virtual std::string name() const = 0;
+
+    std::string value;
+  };
+
+  struct derived : base
+  {
+    derived() { value = "derived"; }
+
+    std::string name() const override { return "derived"; }
+  };
+
+  template<typename T>
+  const T& as_const( T& value ) noexcept { return value; }
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("cow_ptr::cow_ptr()", "[ctor]")
+{
+  bit::stl::cow_ptr<int> ptr;
+
+  SECTION("Manages no object")
+  {
+    REQUIRE( ptr == nullptr );
+    REQUIRE( ptr.use_count() == 0 );
+  }
+}
+
+TEST_CASE("cow_ptr::cow_ptr( U* )", "[ctor]")
+{
+  bit::stl::cow_ptr<base> ptr( new derived{} );
+
+  SECTION("Manages the pointer")
+  {
+    REQUIRE( ptr.cget()->name() == "derived" );
+    REQUIRE( ptr.unique() );
+  }
+
+  SECTION("Clones preserve the derived type")
+  {
+    auto copy = ptr;
+    copy->value = "changed";
+
+    REQUIRE( copy.cget()->name() == "derived" );
+    REQUIRE( ptr.cget()->value == "derived" );
+  }
+}
+
+TEST_CASE("cow_ptr::cow_ptr( const cow_ptr& )", "[ctor]")
+{
+  auto original = bit::stl::make_cow<std::string>("hello");
+  auto copy     = original;
+
+  SECTION("Shares the object")
+  {
+    REQUIRE( copy.cget() == original.cget() );
+  }
+
+  SECTION("Increments the use count")
+  {
+    REQUIRE( original.use_count() == 2 );
+  }
+}
+
+TEST_CASE("cow_ptr::cow_ptr( cow_ptr&& )", "[ctor]")
+{
+  auto original = bit::stl::make_cow<std::string>("hello");
+  const auto* object = original.cget();
+  auto moved    = std::move(original);
+
+  SECTION("Source is empty")
+  {
+    REQUIRE( original == nullptr );
+  }
+
+  SECTION("Transfers the object")
+  {
+    REQUIRE( moved.cget() == object );
+    REQUIRE( moved.unique() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("cow_ptr::operator->()", "[observers]")
+{
+  auto original = bit::stl::make_cow<std::string>("hello");
+
+  SECTION("Const access does not clone")
+  {
+    auto copy = original;
+
+    REQUIRE( as_const(copy)->size() == 5 );
+    REQUIRE( copy.cget() == original.cget() );
+  }
+
+  SECTION("Non-const access to a shared object clones it")
+  {
+    auto copy = original;
+    copy->append(" world");
+
+    SECTION("Copy is modified")
+    {
+      REQUIRE( *copy.cget() == "hello world" );
+    }
+
+    SECTION("Original is untouched")
+    {
+      REQUIRE( *original.cget() == "hello" );
+    }
+
+    SECTION("Neither is shared afterwards")
+    {
+      REQUIRE( original.unique() );
+      REQUIRE( copy.unique() );
+    }
+  }
+
+  SECTION("Non-const access to a unique object does not clone")
+  {
+    const auto* object = original.cget();
+    original->append("!");
+
+    REQUIRE( original.cget() == object );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Allocators
+//-----------------------------------------------------------------------------
+
+TEST_CASE("allocate_cow( const Allocator&, Args&&... )", "[utility]")
+{
+  auto ptr  = bit::stl::allocate_cow<std::string>( std::allocator<std::string>{}, 3, 'x' );
+  auto copy = ptr;
+
+  *copy = "yyy";
+
+  REQUIRE( *ptr.cget() == "xxx" );
+  REQUIRE( *copy.cget() == "yyy" );
+}
+
+//-----------------------------------------------------------------------------
+// Threading
+//-----------------------------------------------------------------------------
+
+TEST_CASE("cow_ptr copies shared between threads", "[threading]")
+{
+  const auto original = bit::stl::make_cow<std::vector<int>>( 100, 1 );
+
+  auto threads = std::vector<std::thread>{};
+  for( auto t = 0; t < 4; ++t ) {
+    threads.emplace_back([&original, t]{
+      for( auto i = 0; i < 1000; ++i ) {
+        auto copy = original;
+        if( i % 10 == 0 ) {
+          copy->front() = t;
+        }
+      }
+    });
+  }
+  for( auto& thread : threads ) {
+    thread.join();
+  }
+
+  SECTION("Original is never modified")
+  {
+    REQUIRE( original.cget()->front() == 1 );
+  }
+
+  SECTION("All copies are released")
+  {
+    REQUIRE( original.unique() );
+  }
+}
@@ -0,0 +1,319 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the epoch_domain
+ *****************************************************************************/
+
+#include <bit/stl/memory/epoch_domain.hpp>
+#include <bit/stl/memory/allocator_deleter.hpp>
+
+#include <atomic>  // std::atomic
+#include <memory>  // std::allocator
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  std::atomic<int> g_live{0};
+
+  struct node
+  {
+    explicit node( int value = 0 ) : value(value){ ++g_live; }
+    ~node(){ --g_live; }
+
+    int value;
+  };
+
+  // Collects until the participant has nothing pending
+  void drain( bit::stl::epoch_domain::participant& p )
+  {
+    for( auto i = 0; i < 8 && p.pending() != 0; ++i ) {
+      p.collect();
+    }
+  }
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Critical Sections
+//-----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain::participant::pin()", "[pin]")
+{
+  bit::stl::epoch_domain domain;
+  bit::stl::epoch_domain::participant participant{domain};
+
+  SECTION("Is not pinned by default")
+  {
+    REQUIRE_FALSE( participant.is_pinned() );
+  }
+
+  SECTION("Pinned while the guard is alive")
+  {
+    {
+      auto guard = participant.pin();
+
+      REQUIRE( participant.is_pinned() );
+    }
+    REQUIRE_FALSE( participant.is_pinned() );
+  }
+
+  SECTION("Nested pins unpin with the outermost guard")
+  {
+    auto outer = participant.pin();
+    {
+      auto inner = participant.pin();
+    }
+    REQUIRE( participant.is_pinned() );
+  }
+
+  SECTION("Moved-from guard does not unpin")
+  {
+    auto guard = participant.pin();
+    {
+      auto moved = std::move(guard);
+    }
+    REQUIRE_FALSE( participant.is_pinned() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Reclamation
+//-----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain::participant::retire( T* )", "[reclamation]")
+{
+  g_live = 0;
+
+  bit::stl::epoch_domain domain;
+  bit::stl::epoch_domain::participant writer{domain};
+
+  SECTION("Object is not destroyed immediately")
+  {
+    writer.retire( new node{} );
+
+    REQUIRE( writer.pending() == 1 );
+    REQUIRE( g_live == 1 );
+
+    drain( writer );
+  }
+
+  SECTION("Object is destroyed after collection")
+  {
+    writer.retire( new node{} );
+    drain( writer );
+
+    REQUIRE( writer.pending() == 0 );
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Object is kept while another participant is pinned")
+  {
+    bit::stl::epoch_domain::participant reader{domain};
+    {
+      auto guard = reader.pin();
+
+      writer.retire( new node{} );
+      drain( writer );
+
+      REQUIRE( g_live == 1 );
+    }
+    drain( writer );
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Null pointer is ignored")
+  {
+    writer.retire( static_cast<node*>(nullptr) );
+
+    REQUIRE( writer.pending() == 0 );
+  }
+}
+
+TEST_CASE("epoch_domain::participant::retire( T*, Deleter )", "[reclamation]")
+{
+  g_live = 0;
+
+  bit::stl::epoch_domain domain;
+  bit::stl::epoch_domain::participant writer{domain};
+
+  SECTION("Uses allocator_deleter")
+  {
+    using alloc_traits = std::allocator_traits<std::allocator<node>>;
+
+    auto allocator = std::allocator<node>{};
+    auto* p = alloc_traits::allocate( allocator, 1 );
+    alloc_traits::construct( allocator, p, 5 );
+
+    writer.retire( p, bit::stl::allocator_deleter<std::allocator<node>>{allocator,1} );
+    drain( writer );
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Uses deleters that do not fit inline")
+  {
+    auto calls   = 0;
+    auto deleter = [&calls, padding = std::vector<int>(4)]( node* p ) {
+      ++calls;
+      delete p;
+    };
+
+    writer.retire( new node{}, deleter );
+    drain( writer );
+
+    REQUIRE( calls == 1 );
+    REQUIRE( g_live == 0 );
+  }
+}
+
+TEST_CASE("epoch_domain::participant::collect()", "[reclamation]")
+{
+  g_live = 0;
+
+  SECTION("Runs automatically every batch")
+  {
+    bit::stl::epoch_domain domain{4};
+    bit::stl::epoch_domain::participant writer{domain};
+
+    for( auto i = 0; i < 64; ++i ) {
+      writer.retire( new node{} );
+    }
+
+    REQUIRE( writer.pending() < 64 );
+
+    drain( writer );
+  }
+
+  SECTION("Advances the epoch")
+  {
+    bit::stl::epoch_domain domain;
+    bit::stl::epoch_domain::participant writer{domain};
+
+    const auto epoch = domain.epoch();
+    writer.collect();
+
+    REQUIRE( domain.epoch() == epoch + 1 );
+  }
+
+  SECTION("Does not advance past a stale pinned participant")
+  {
+    bit::stl::epoch_domain domain;
+    bit::stl::epoch_domain::participant writer{domain};
+    bit::stl::epoch_domain::participant reader{domain};
+
+    auto guard = reader.pin();
+    writer.collect();
+    writer.collect();
+
+    REQUIRE( domain.epoch() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Lifetime
+//-----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain::participant::~participant()", "[lifetime]")
+{
+  g_live = 0;
+
+  SECTION("Hands pending objects to the domain")
+  {
+    {
+      bit::stl::epoch_domain domain;
+      {
+        bit::stl::epoch_domain::participant writer{domain};
+
+        writer.retire( new node{} );
+      }
+      REQUIRE( g_live == 1 );
+    }
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Orphaned objects are freed by other participants")
+  {
+    bit::stl::epoch_domain domain;
+    {
+      bit::stl::epoch_domain::participant writer{domain};
+
+      writer.retire( new node{} );
+    }
+
+    bit::stl::epoch_domain::participant other{domain};
+    for( auto i = 0; i < 4; ++i ) {
+      other.collect();
+    }
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Records are reused by later participants")
+  {
+    bit::stl::epoch_domain domain;
+    {
+      bit::stl::epoch_domain::participant first{domain};
+    }
+    bit::stl::epoch_domain::participant second{domain};
+
+    REQUIRE( second.pending() == 0 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Threading
+//-----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain with concurrent readers", "[threading]")
+{
+  g_live = 0;
+
+  const auto readers    = 3;
+  const auto iterations = 2000;
+
+  {
+    bit::stl::epoch_domain domain{16};
+    std::atomic<node*> head{new node{0}};
+    std::atomic<bool>  done{false};
+    std::atomic<bool>  corrupt{false};
+
+    auto threads = std::vector<std::thread>{};
+    for( auto i = 0; i < readers; ++i ) {
+      threads.emplace_back([&]{
+        bit::stl::epoch_domain::participant reader{domain};
+
+        while( !done.load() ) {
+          auto guard = reader.pin();
+          auto* p = head.load( std::memory_order_acquire );
+
+          if( p->value < 0 ) {
+            corrupt = true;
+          }
+          std::this_thread::yield();
+        }
+      });
+    }
+
+    {
+      bit::stl::epoch_domain::participant writer{domain};
+
+      for( auto i = 1; i <= iterations; ++i ) {
+        auto* old = head.exchange( new node{i}, std::memory_order_acq_rel );
+        writer.retire( old );
+      }
+      done = true;
+      for( auto& thread : threads ) {
+        thread.join();
+      }
+      drain( writer );
+    }
+
+    REQUIRE_FALSE( corrupt );
+    delete head.load();
+  }
+
+  REQUIRE( g_live == 0 );
+}
@@ -16,6 +16,20 @@ namespace
   };
 
   class derived : public base{};
+
+  // Types without a virtual destructor, counting destructions
+  struct counted_base
+  {
+    int value = 0;
+  };
+
+  struct counted_derived : counted_base
+  {
+    explicit counted_derived( int& count ) : count(&count){}
+    ~counted_derived(){ ++(*count); }
+
+    int* count;
+  };
 }
 
 //=============================================================================
@@ -78,6 +92,58 @@ TEST_CASE("exclusive_ptr<T>::exclusive_ptr( exclusive_ptr<U>&& )")
   }
 }
 
+TEST_CASE("exclusive_ptr<T>::exclusive_ptr( Y* )")
+{
+  auto count = 0;
+
+  SECTION("Deletes the pointer on destruction")
+  {
+    {
+      auto ptr = bit::stl::exclusive_ptr<::counted_derived>( new ::counted_derived(count) );
+    }
+
+    REQUIRE( count == 1 );
+  }
+
+  SECTION("Deletes the original type when held as a non-virtual base")
+  {
+    {
+      auto ptr = bit::stl::exclusive_ptr<::counted_base>( new ::counted_derived(count) );
+    }
+
+    REQUIRE( count == 1 );
+  }
+}
+
+TEST_CASE("exclusive_ptr<T>::exclusive_ptr( Y*, Deleter )")
+{
+  auto count = 0;
+  auto deleter = [&count]( int* p ){ ++count; delete p; };
+
+  {
+    auto ptr = bit::stl::exclusive_ptr<int>( new int(42), deleter );
+  }
+
+  SECTION("Invokes the deleter on destruction")
+  {
+    REQUIRE( count == 1 );
+  }
+}
+
+TEST_CASE("exclusive_ptr<T>::exclusive_ptr( exclusive_ptr<U>&& ) with a non-virtual base")
+{
+  auto count = 0;
+  {
+    auto p1 = bit::stl::make_exclusive<::counted_derived>(count);
+    auto p2 = bit::stl::exclusive_ptr<::counted_base>(std::move(p1));
+  }
+
+  SECTION("Destroys the derived type once")
+  {
+    REQUIRE( count == 1 );
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 TEST_CASE("exclusive_ptr<T>::operator=( exclusive_ptr&& )")
@@ -177,3 +243,33 @@ TEST_CASE("casts::reinterpret_pointer_cast<T>( exclusive_ptr<U>&& )")
 }
 
 //-----------------------------------------------------------------------------
+
+//=============================================================================
+// utilities
+//=============================================================================
+
+TEST_CASE("get_deleter<Deleter>( const exclusive_ptr<T>& )")
+{
+  SECTION("Null pointer has no deleter")
+  {
+    auto ptr = bit::stl::exclusive_ptr<int>{};
+
+    REQUIRE( bit::stl::get_deleter<std::default_delete<int>>(ptr) == nullptr );
+  }
+
+  SECTION("Made pointer uses the default deleter")
+  {
+    auto ptr = bit::stl::make_exclusive<int>(42);
+
+    REQUIRE( bit::stl::get_deleter<std::default_delete<int>>(ptr) != nullptr );
+  }
+
+  SECTION("Returns a custom deleter")
+  {
+    struct custom_deleter{ void operator()( int* p ) const { delete p; } };
+    auto ptr = bit::stl::exclusive_ptr<int>( new int(42), custom_deleter{} );
+
+    REQUIRE( bit::stl::get_deleter<custom_deleter>(ptr) != nullptr );
+    REQUIRE( bit::stl::get_deleter<std::default_delete<int>>(ptr) == nullptr );
+  }
+}
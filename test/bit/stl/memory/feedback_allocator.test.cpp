@@ -0,0 +1,232 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the size-feedback allocators
+ *****************************************************************************/
+
+#include <bit/stl/memory/feedback_allocator.hpp>
+#include <bit/stl/memory/memory.hpp>
+#include <bit/stl/containers/circular_deque.hpp>
+#include <bit/stl/containers/circular_queue.hpp>
+
+#include <cstddef> // std::size_t
+#include <cstdlib> // std::malloc, std::free
+#include <memory>  // std::allocator
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  /// A SizeFeedbackAllocator that rounds every request up to 64 bytes, and
+  /// records the size it is handed back
+  class block_allocator
+  {
+  public:
+
+    bit::stl::fat_ptr<void> allocate( std::size_t size, std::size_t )
+    {
+      ++allocations;
+
+      const auto usable = bit::stl::align_up( (size == 0) ? 1 : size, 64 );
+      return bit::stl::fat_ptr<void>{ std::malloc(usable), usable };
+    }
+
+    void deallocate( bit::stl::fat_ptr<void> p ) noexcept
+    {
+      last_deallocated_size = p.size();
+      std::free( p.get() );
+    }
+
+    static std::size_t allocations;
+    static std::size_t last_deallocated_size;
+  };
+
+  std::size_t block_allocator::allocations = 0;
+  std::size_t block_allocator::last_deallocated_size = 0;
+
+  struct not_an_allocator{};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Concept
+//-----------------------------------------------------------------------------
+
+TEST_CASE("is_size_feedback_allocator<T>", "[traits]")
+{
+  STATIC_REQUIRE( bit::stl::is_size_feedback_allocator_v<bit::stl::malloc_allocator> );
+  STATIC_REQUIRE( bit::stl::is_size_feedback_allocator_v<bit::stl::new_delete_allocator> );
+  STATIC_REQUIRE( bit::stl::is_size_feedback_allocator_v<block_allocator> );
+  STATIC_REQUIRE_FALSE( bit::stl::is_size_feedback_allocator_v<std::allocator<int>> );
+  STATIC_REQUIRE_FALSE( bit::stl::is_size_feedback_allocator_v<not_an_allocator> );
+}
+
+//-----------------------------------------------------------------------------
+// malloc_allocator
+//-----------------------------------------------------------------------------
+
+TEST_CASE("malloc_allocator::allocate( std::size_t, std::size_t )", "[allocation]")
+{
+  auto allocator = bit::stl::malloc_allocator{};
+
+  SECTION("Reports at least the requested size")
+  {
+    auto p = allocator.allocate(100);
+
+    REQUIRE( p.size() >= 100 );
+    allocator.deallocate(p);
+  }
+
+  SECTION("Reported size is usable throughout")
+  {
+    auto p = allocator.allocate(100);
+    auto* bytes = static_cast<unsigned char*>(p.get());
+
+    for( auto i = std::size_t{0}; i < p.size(); ++i ) {
+      bytes[i] = static_cast<unsigned char>(i);
+    }
+    REQUIRE( bytes[p.size() - 1] == static_cast<unsigned char>(p.size() - 1) );
+    allocator.deallocate(p);
+  }
+
+  SECTION("Over-aligned allocations are aligned")
+  {
+    auto p = allocator.allocate(100, 256);
+
+    REQUIRE( bit::stl::is_aligned(p.get(), 256) );
+    REQUIRE( p.size() >= 100 );
+    allocator.deallocate(p);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// new_delete_allocator
+//-----------------------------------------------------------------------------
+
+TEST_CASE("new_delete_allocator::allocate( std::size_t, std::size_t )", "[allocation]")
+{
+  auto allocator = bit::stl::new_delete_allocator{};
+
+  auto p = allocator.allocate(100);
+
+  SECTION("Reports the requested size")
+  {
+    REQUIRE( p.size() == 100 );
+  }
+
+  allocator.deallocate(p);
+}
+
+//-----------------------------------------------------------------------------
+// allocate_at_least
+//-----------------------------------------------------------------------------
+
+TEST_CASE("allocate_at_least( Allocator&, std::size_t )", "[allocation]")
+{
+  SECTION("Allocator without allocate_at_least returns exactly n")
+  {
+    auto allocator = std::allocator<int>{};
+    auto result = bit::stl::allocate_at_least(allocator, 10);
+
+    REQUIRE( result.count == 10 );
+    allocator.deallocate(result.ptr, result.count);
+  }
+
+  SECTION("feedback_allocator returns the usable capacity")
+  {
+    auto allocator = bit::stl::feedback_allocator<int,block_allocator>{};
+    auto result = bit::stl::allocate_at_least(allocator, 10);
+
+    REQUIRE( result.count == 64 / sizeof(int) );
+    allocator.deallocate(result.ptr, result.count);
+
+    SECTION("Deallocation hands back the full size")
+    {
+      REQUIRE( block_allocator::last_deallocated_size == 64 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// feedback_allocator
+//-----------------------------------------------------------------------------
+
+TEST_CASE("feedback_allocator<T>", "[allocation]")
+{
+  SECTION("Is usable by standard containers")
+  {
+    auto vector = std::vector<int,bit::stl::feedback_allocator<int>>{};
+
+    for( auto i = 0; i < 100; ++i ) {
+      vector.push_back(i);
+    }
+
+    REQUIRE( vector.size() == 100 );
+    REQUIRE( vector.back() == 99 );
+  }
+
+  SECTION("Rebound allocators compare equal")
+  {
+    auto lhs = bit::stl::feedback_allocator<int>{};
+    auto rhs = bit::stl::feedback_allocator<double>{lhs};
+
+    REQUIRE( lhs == rhs );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Growable containers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("circular_deque with feedback_allocator", "[allocation]")
+{
+  using allocator_type = bit::stl::feedback_allocator<int,block_allocator>;
+  using deque_type = bit::stl::circular_deque<int,allocator_type,bit::stl::circular_growth_policy>;
+
+  auto deque = deque_type{};
+  block_allocator::allocations = 0;
+
+  deque.push_back(0);
+
+  SECTION("Growth adopts the usable capacity")
+  {
+    REQUIRE( deque.capacity() == 64 / sizeof(int) );
+  }
+
+  SECTION("Extra capacity avoids reallocation")
+  {
+    for( auto i = 1; i < 16; ++i ) {
+      deque.push_front(i);
+    }
+
+    REQUIRE( block_allocator::allocations == 1 );
+    REQUIRE( deque.size() == 16 );
+    REQUIRE( deque.back() == 0 );
+    REQUIRE( deque.front() == 15 );
+  }
+}
+
+TEST_CASE("circular_queue with feedback_allocator", "[allocation]")
+{
+  using allocator_type = bit::stl::feedback_allocator<int,block_allocator>;
+
+  SECTION("Growth policy adopts the usable capacity")
+  {
+    auto queue = bit::stl::circular_queue<int,allocator_type,bit::stl::circular_growth_policy>{};
+
+    for( auto i = 0; i < 17; ++i ) {
+      queue.push(i);
+    }
+
+    REQUIRE( queue.capacity() == 128 / sizeof(int) );
+    REQUIRE( queue.front() == 0 );
+    REQUIRE( queue.back() == 16 );
+  }
+
+  SECTION("Overwrite policy keeps the requested capacity")
+  {
+    bit::stl::circular_queue<int,allocator_type> queue(4);
+
+    REQUIRE( queue.capacity() == 4 );
+  }
+}
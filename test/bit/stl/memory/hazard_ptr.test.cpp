@@ -0,0 +1,296 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the hazard_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/hazard_ptr.hpp>
+#include <bit/stl/memory/allocator_deleter.hpp>
+
+#include <atomic>  // std::atomic
+#include <memory>  // std::allocator
+#include <thread>  // std::thread
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  std::atomic<int> g_live{0};
+
+  struct node
+  {
+    explicit node( int value = 0 ) : value(value){ ++g_live; }
+    ~node(){ --g_live; }
+
+    int value;
+  };
+
+  struct prefix{ long tag = 0; };
+
+  /// A node that is not the primary base, so that a node* does not have
+  /// the address of the derived object
+  struct derived_node : prefix, node
+  {
+    explicit derived_node( int value = 0 ) : node(value){}
+  };
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("hazard_ptr::hazard_ptr( hazard_domain& )", "[ctor]")
+{
+  bit::stl::hazard_domain domain;
+  bit::stl::hazard_ptr<node> hazard{domain};
+
+  SECTION("Protects nothing")
+  {
+    REQUIRE( hazard == nullptr );
+    REQUIRE( hazard.get() == nullptr );
+  }
+}
+
+TEST_CASE("hazard_ptr::hazard_ptr( hazard_ptr&& )", "[ctor]")
+{
+  g_live = 0;
+
+  bit::stl::hazard_domain domain;
+  std::atomic<node*> source{new node{}};
+
+  auto* const p = source.load();
+
+  bit::stl::hazard_ptr<node> original{domain};
+  original.protect( source );
+
+  auto moved = std::move(original);
+
+  SECTION("Takes over the protected pointer")
+  {
+    REQUIRE( moved.get() == p );
+    REQUIRE( original == nullptr );
+  }
+
+  SECTION("Keeps the object protected")
+  {
+    domain.retire( source.exchange(nullptr) );
+    domain.reclaim();
+
+    REQUIRE( g_live == 1 );
+  }
+
+  delete source.load();
+}
+
+//-----------------------------------------------------------------------------
+// Protection
+//-----------------------------------------------------------------------------
+
+TEST_CASE("hazard_ptr::protect( const std::atomic<U*>& )", "[protection]")
+{
+  g_live = 0;
+
+  bit::stl::hazard_domain domain;
+  bit::stl::hazard_ptr<node> hazard{domain};
+  std::atomic<node*> source{new node{42}};
+
+  auto* const p = hazard.protect( source );
+
+  SECTION("Returns the current pointer")
+  {
+    REQUIRE( p == source.load() );
+    REQUIRE( hazard->value == 42 );
+  }
+
+  SECTION("Protected object is not reclaimed")
+  {
+    domain.retire( source.exchange(nullptr) );
+
+    REQUIRE( domain.reclaim() == 0 );
+    REQUIRE( g_live == 1 );
+  }
+
+  SECTION("Object is reclaimed after reset")
+  {
+    domain.retire( source.exchange(nullptr) );
+    hazard.reset();
+
+    REQUIRE( domain.reclaim() == 1 );
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Observes the protected pointer")
+  {
+    REQUIRE( hazard.observe().get() == p );
+  }
+
+  delete source.load();
+}
+
+TEST_CASE("hazard_ptr::try_protect( U*&, const std::atomic<U*>& )", "[protection]")
+{
+  bit::stl::hazard_domain domain;
+  bit::stl::hazard_ptr<node> hazard{domain};
+
+  node first{1};
+  node second{2};
+  std::atomic<node*> source{&first};
+
+  SECTION("Succeeds when the source is unchanged")
+  {
+    auto* p = source.load();
+
+    REQUIRE( hazard.try_protect( p, source ) );
+    REQUIRE( hazard.get() == &first );
+  }
+
+  SECTION("Fails and reloads when the source changed")
+  {
+    auto* p = source.load();
+    source = &second;
+
+    REQUIRE_FALSE( hazard.try_protect( p, source ) );
+    REQUIRE( p == &second );
+    REQUIRE( hazard == nullptr );
+  }
+}
+
+TEST_CASE("hazard_ptr::protect( const std::atomic<U*>& ) with a non-primary base", "[protection]")
+{
+  g_live = 0;
+
+  bit::stl::hazard_domain domain;
+  bit::stl::hazard_ptr<node> hazard{domain};
+  std::atomic<derived_node*> source{new derived_node{7}};
+
+  auto* const p = hazard.protect( source );
+
+  REQUIRE( static_cast<void*>(p) != static_cast<void*>(source.load()) );
+
+  SECTION("Protected object is not reclaimed when retired as derived")
+  {
+    domain.retire( source.exchange(nullptr) );
+
+    REQUIRE( domain.reclaim() == 0 );
+    REQUIRE( g_live == 1 );
+    REQUIRE( hazard->value == 7 );
+
+    hazard.reset();
+    REQUIRE( domain.reclaim() == 1 );
+    REQUIRE( g_live == 0 );
+  }
+
+  delete source.load();
+}
+
+//-----------------------------------------------------------------------------
+// Reclamation
+//-----------------------------------------------------------------------------
+
+TEST_CASE("hazard_domain::retire( T*, Deleter )", "[reclamation]")
+{
+  g_live = 0;
+
+  SECTION("Scans once the threshold is reached")
+  {
+    bit::stl::hazard_domain domain{8};
+
+    for( auto i = 0; i < 8; ++i ) {
+      domain.retire( new node{} );
+    }
+
+    REQUIRE( domain.pending() == 0 );
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Uses allocator_deleter")
+  {
+    using alloc_traits = std::allocator_traits<std::allocator<node>>;
+
+    bit::stl::hazard_domain domain;
+    auto allocator = std::allocator<node>{};
+    auto* p = alloc_traits::allocate( allocator, 1 );
+    alloc_traits::construct( allocator, p, 5 );
+
+    domain.retire( p, bit::stl::allocator_deleter<std::allocator<node>>{allocator,1} );
+    domain.reclaim();
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Destroys pending objects with the domain")
+  {
+    {
+      bit::stl::hazard_domain domain;
+      domain.retire( new node{} );
+
+      REQUIRE( g_live == 1 );
+    }
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Leaves at most the protected objects after a scan")
+  {
+    bit::stl::hazard_domain domain;
+    bit::stl::hazard_ptr<node> hazard{domain};
+    std::atomic<node*> source{new node{}};
+
+    hazard.protect( source );
+    domain.retire( source.exchange(nullptr) );
+    for( auto i = 0; i < 16; ++i ) {
+      domain.retire( new node{} );
+    }
+    domain.reclaim();
+
+    REQUIRE( domain.pending() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Threading
+//-----------------------------------------------------------------------------
+
+TEST_CASE("hazard_domain with concurrent readers", "[threading]")
+{
+  g_live = 0;
+
+  const auto readers    = 3;
+  const auto iterations = 2000;
+
+  {
+    bit::stl::hazard_domain domain{16};
+    std::atomic<node*> head{new node{0}};
+    std::atomic<bool>  done{false};
+    std::atomic<bool>  corrupt{false};
+
+    auto threads = std::vector<std::thread>{};
+    for( auto i = 0; i < readers; ++i ) {
+      threads.emplace_back([&]{
+        bit::stl::hazard_ptr<node> hazard{domain};
+
+        while( !done.load() ) {
+          if( hazard.protect( head )->value < 0 ) {
+            corrupt = true;
+          }
+          hazard.reset();
+          std::this_thread::yield();
+        }
+      });
+    }
+
+    for( auto i = 1; i <= iterations; ++i ) {
+      domain.retire( head.exchange( new node{i} ) );
+    }
+    done = true;
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+
+    REQUIRE_FALSE( corrupt );
+    delete head.load();
+  }
+
+  REQUIRE( g_live == 0 );
+}
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the huge_page_allocator
+ *****************************************************************************/
+
+#include <bit/stl/memory/huge_page_allocator.hpp>
+#include <bit/stl/memory/memory.hpp>
+
+#include <cstdint> // std::uint64_t
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+TEST_CASE("huge_page_allocator::allocate( size_type )", "[allocation]")
+{
+  using allocator_type = bit::stl::huge_page_allocator<std::uint64_t>;
+
+  constexpr auto page_size = allocator_type::huge_page_size;
+
+  auto allocator = allocator_type{};
+
+  SECTION("Small allocations are usable")
+  {
+    auto* p = allocator.allocate(16);
+    p[15] = 42;
+
+    REQUIRE( p[15] == 42 );
+    allocator.deallocate(p,16);
+  }
+
+  SECTION("Large allocations are usable throughout")
+  {
+    const auto n = page_size / sizeof(std::uint64_t) * 3 + 5;
+    auto* p = allocator.allocate(n);
+
+    p[0]     = 1;
+    p[n - 1] = 2;
+
+    REQUIRE( p[0] == 1 );
+    REQUIRE( p[n - 1] == 2 );
+    allocator.deallocate(p,n);
+  }
+
+#if defined(__linux__)
+  SECTION("Large allocations are aligned to a huge page")
+  {
+    const auto n = page_size / sizeof(std::uint64_t);
+    auto* p = allocator.allocate(n);
+
+    REQUIRE( bit::stl::is_aligned(p,page_size) );
+    allocator.deallocate(p,n);
+  }
+#endif
+
+  SECTION("Is usable by standard containers")
+  {
+    auto vector = std::vector<std::uint64_t,allocator_type>(1 << 20, 7);
+
+    REQUIRE( vector.back() == 7 );
+  }
+}
@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the image_builder
+ *****************************************************************************/
+
+#include <bit/stl/memory/image_builder.hpp>
+#include <bit/stl/memory/offset_ptr.hpp>
+
+#include <cstddef> // offsetof, std::max_align_t
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  struct node
+  {
+    std::uint64_t value = 0;
+    bit::stl::offset_ptr<const node> next;
+  };
+
+  /// Copies an image into new, suitably aligned storage at a different
+  /// address
+  std::vector<std::max_align_t> relocate( const bit::stl::image_builder& builder )
+  {
+    auto storage = std::vector<std::max_align_t>( builder.size() / sizeof(std::max_align_t) + 1 );
+    std::memcpy( storage.data(), builder.data(), builder.size() );
+    return storage;
+  }
+
+} // anonymous namespace
+
+TEST_CASE("image_builder::emplace( Args&&... )", "[allocation]")
+{
+  auto builder = bit::stl::image_builder{};
+
+  const auto first = builder.emplace<node>();
+
+  SECTION("Objects are constructed in the image")
+  {
+    REQUIRE( builder.get(first)->value == 0 );
+  }
+
+  SECTION("Offsets remain valid as the image grows")
+  {
+    builder.get(first)->value = 42;
+    builder.allocate<std::uint64_t>( 4096 );
+
+    REQUIRE( builder.get(first)->value == 42 );
+  }
+
+  SECTION("Objects are aligned")
+  {
+    builder.emplace<char>('a');
+    const auto second = builder.emplace<std::uint64_t>(1u);
+
+    REQUIRE( second.offset() % alignof(std::uint64_t) == 0 );
+  }
+}
+
+TEST_CASE("image_builder::offset_of( const T* )", "[observers]")
+{
+  auto builder = bit::stl::image_builder{};
+  const auto object = builder.emplace<node>();
+
+  const auto member = builder.offset_of( &builder.get(object)->next );
+
+  REQUIRE( member.offset() == object.offset() + offsetof(node,next) );
+}
+
+TEST_CASE("image_root( const void*, std::size_t )", "[utilities]")
+{
+  auto builder = bit::stl::image_builder{};
+
+  const auto head = builder.emplace<node>();
+  const auto tail = builder.emplace<node>();
+  builder.get(tail)->value = 2;
+  builder.get(head)->value = 1;
+  builder.get(head)->next  = builder.get(tail);
+
+  SECTION("Image without a root has no root")
+  {
+    REQUIRE( bit::stl::image_root<node>( builder.data(), builder.size() ) == nullptr );
+  }
+
+  builder.set_root( head );
+
+  SECTION("Root is found in a relocated image")
+  {
+    const auto storage = relocate( builder );
+    const auto* root = bit::stl::image_root<node>( storage.data(), builder.size() );
+
+    REQUIRE( root != nullptr );
+    REQUIRE( root->value == 1 );
+    REQUIRE( root->next->value == 2 );
+  }
+
+  SECTION("Truncated image is rejected")
+  {
+    REQUIRE( bit::stl::image_root<node>( builder.data(), builder.size() - 1 ) == nullptr );
+  }
+
+  SECTION("Bytes that are not an image are rejected")
+  {
+    const std::max_align_t garbage[4] = {};
+
+    REQUIRE( bit::stl::image_root<node>( garbage, sizeof(garbage) ) == nullptr );
+  }
+}
@@ -0,0 +1,301 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the instrumented_allocator and allocation_tracker
+ *****************************************************************************/
+
+#include <bit/stl/memory/instrumented_allocator.hpp>
+
+#include <bit/stl/containers/circular_queue.hpp>
+#include <bit/stl/containers/hashed_string.hpp>
+#include <bit/stl/memory/exclusive_ptr.hpp>
+
+#include <algorithm> // std::find_if
+#include <cstring>   // std::strcmp
+#include <memory>    // std::allocator
+#include <string>    // std::char_traits
+#include <thread>    // std::thread
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  template<typename T>
+  using test_allocator = bit::stl::instrumented_allocator<std::allocator<T>>;
+
+} // anonymous namespace
+
+//=============================================================================
+// allocation_tracker
+//=============================================================================
+
+TEST_CASE("allocation_tracker::histogram_bucket( std::size_t )", "[statistics]")
+{
+  SECTION("Small sizes are counted in the first bucket")
+  {
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(1) == 0 );
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(16) == 0 );
+  }
+
+  SECTION("Each bucket doubles the limit")
+  {
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(17) == 1 );
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(64) == 2 );
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(65) == 3 );
+  }
+
+  SECTION("Huge sizes are counted in the last bucket")
+  {
+    const auto last = bit::stl::allocation_statistics::histogram_size - 1;
+
+    REQUIRE( bit::stl::allocation_tracker::histogram_bucket(std::size_t{1} << 40) == last );
+  }
+}
+
+TEST_CASE("allocation_tracker::snapshot()", "[statistics]")
+{
+  bit::stl::allocation_tracker tracker{"test"};
+
+  tracker.record_allocation(100);
+  tracker.record_allocation(50);
+  tracker.record_deallocation(100);
+
+  const auto stats = tracker.snapshot();
+
+  SECTION("Reports the name")
+  {
+    REQUIRE( std::strcmp(stats.name,"test") == 0 );
+  }
+
+  SECTION("Counts allocations and deallocations")
+  {
+    REQUIRE( stats.allocations == 2 );
+    REQUIRE( stats.deallocations == 1 );
+    REQUIRE( stats.live_allocations == 1 );
+  }
+
+  SECTION("Counts bytes")
+  {
+    REQUIRE( stats.bytes_allocated == 150 );
+    REQUIRE( stats.bytes_deallocated == 100 );
+    REQUIRE( stats.live_bytes == 50 );
+  }
+
+  SECTION("Records the peak")
+  {
+    REQUIRE( stats.peak_bytes == 150 );
+  }
+
+  SECTION("Records sizes in the histogram")
+  {
+    REQUIRE( stats.histogram[bit::stl::allocation_tracker::histogram_bucket(100)] == 1 );
+    REQUIRE( stats.histogram[bit::stl::allocation_tracker::histogram_bucket(50)] == 1 );
+  }
+}
+
+TEST_CASE("allocation_tracker::snapshot_all()", "[statistics]")
+{
+  bit::stl::allocation_tracker tracker{"snapshot_all"};
+  tracker.record_allocation(8);
+
+  const auto all = bit::stl::allocation_tracker::snapshot_all();
+  const auto it  = std::find_if(all.begin(), all.end(), []( const bit::stl::allocation_statistics& s ){
+    return std::strcmp(s.name,"snapshot_all") == 0;
+  });
+
+  SECTION("Includes every live tracker")
+  {
+    REQUIRE( it != all.end() );
+    REQUIRE( it->allocations == 1 );
+  }
+}
+
+TEST_CASE("allocation_tracker with concurrent threads", "[statistics]")
+{
+  bit::stl::allocation_tracker tracker{"threads"};
+
+  auto threads = std::vector<std::thread>{};
+  for( auto i = 0; i < 4; ++i ) {
+    threads.emplace_back([&]{
+      for( auto j = 0; j < 1000; ++j ) {
+        tracker.record_allocation(32);
+        tracker.record_deallocation(32);
+      }
+    });
+  }
+  for( auto& thread : threads ) {
+    thread.join();
+  }
+
+  const auto stats = tracker.snapshot();
+
+  REQUIRE( stats.allocations == 4000 );
+  REQUIRE( stats.live_bytes == 0 );
+}
+
+//=============================================================================
+// allocation_scope
+//=============================================================================
+
+TEST_CASE("allocation_scope::allocation_scope( allocation_tracker& )", "[scope]")
+{
+  bit::stl::allocation_tracker outer{"outer"};
+  bit::stl::allocation_tracker inner{"inner"};
+
+  SECTION("Sets the current tracker")
+  {
+    bit::stl::allocation_scope scope{outer};
+
+    REQUIRE( &bit::stl::allocation_tracker::current() == &outer );
+  }
+
+  SECTION("Nested scopes restore the outer tracker")
+  {
+    bit::stl::allocation_scope scope{outer};
+    {
+      bit::stl::allocation_scope nested{inner};
+
+      REQUIRE( &bit::stl::allocation_tracker::current() == &inner );
+    }
+    REQUIRE( &bit::stl::allocation_tracker::current() == &outer );
+  }
+
+  SECTION("Defaults to the global tracker")
+  {
+    REQUIRE( &bit::stl::allocation_tracker::current() == &bit::stl::allocation_tracker::global() );
+  }
+
+  SECTION("Default-constructed allocators use the current tracker")
+  {
+    bit::stl::allocation_scope scope{outer};
+
+    auto vector = std::vector<int,test_allocator<int>>{};
+    vector.reserve(10);
+
+    REQUIRE( outer.snapshot().bytes_allocated == 10 * sizeof(int) );
+  }
+}
+
+TEST_CASE("allocation_tracker::record_deallocation( std::size_t )", "[recording]")
+{
+  bit::stl::allocation_tracker tracker{"saturate"};
+
+  tracker.record_allocation(10);
+  tracker.record_deallocation(20);
+  tracker.record_allocation(5);
+
+  SECTION("Live bytes saturate at zero")
+  {
+    REQUIRE( tracker.snapshot().peak_bytes == 10 );
+  }
+}
+
+//=============================================================================
+// instrumented_allocator
+//=============================================================================
+
+TEST_CASE("instrumented_allocator with standard containers", "[allocation]")
+{
+  bit::stl::allocation_tracker tracker{"vector"};
+  {
+    auto vector = std::vector<int,test_allocator<int>>(test_allocator<int>{tracker});
+    vector.reserve(100);
+
+    SECTION("Records allocations")
+    {
+      REQUIRE( tracker.snapshot().live_bytes == 100 * sizeof(int) );
+    }
+  }
+
+  SECTION("Records deallocations")
+  {
+    REQUIRE( tracker.snapshot().live_bytes == 0 );
+  }
+}
+
+TEST_CASE("instrumented_allocator with circular_queue", "[allocation]")
+{
+  bit::stl::allocation_tracker tracker{"circular_queue"};
+  {
+    auto queue = bit::stl::circular_queue<int,test_allocator<int>>(16, test_allocator<int>{tracker});
+    queue.push(1);
+
+    REQUIRE( tracker.snapshot().allocations == 1 );
+  }
+  REQUIRE( tracker.snapshot().live_allocations == 0 );
+}
+
+TEST_CASE("instrumented_allocator with allocate_exclusive", "[allocation]")
+{
+  bit::stl::allocation_tracker tracker{"exclusive_ptr"};
+  {
+    auto p = bit::stl::allocate_exclusive<int>( test_allocator<int>{tracker}, 42 );
+
+    REQUIRE( *p == 42 );
+    REQUIRE( tracker.snapshot().live_allocations == 1 );
+  }
+  REQUIRE( tracker.snapshot().live_allocations == 0 );
+}
+
+TEST_CASE("instrumented_allocator with basic_hashed_string", "[allocation]")
+{
+  using string_type = bit::stl::basic_hashed_string<char,std::char_traits<char>,test_allocator<char>>;
+
+  bit::stl::allocation_tracker tracker{"hashed_string"};
+  {
+    // Long enough to defeat the small string optimization
+    auto string = string_type{"a string too long to be stored inline", test_allocator<char>{tracker}};
+
+    REQUIRE( tracker.snapshot().live_allocations == 1 );
+  }
+  REQUIRE( tracker.snapshot().live_allocations == 0 );
+}
+
+TEST_CASE("instrumented_allocator with distinct trackers", "[allocation]")
+{
+  using vector_type = std::vector<int,test_allocator<int>>;
+
+  bit::stl::allocation_tracker first{"first"};
+  bit::stl::allocation_tracker second{"second"};
+
+  SECTION("Allocators compare equal only with the same tracker")
+  {
+    REQUIRE( test_allocator<int>{first} == test_allocator<int>{first} );
+    REQUIRE( test_allocator<int>{first} != test_allocator<int>{second} );
+  }
+
+  SECTION("Swapped containers keep memory with its tracker")
+  {
+    {
+      auto lhs = vector_type(test_allocator<int>{first});
+      auto rhs = vector_type(test_allocator<int>{second});
+      lhs.reserve(100);
+      rhs.reserve(10);
+
+      lhs.swap(rhs);
+      lhs.resize(11); // reallocates the storage that came from 'second'
+    }
+
+    REQUIRE( first.snapshot().live_bytes == 0 );
+    REQUIRE( first.snapshot().peak_bytes == 100 * sizeof(int) );
+    REQUIRE( second.snapshot().live_bytes == 0 );
+    REQUIRE( second.snapshot().deallocations == 2 );
+  }
+
+  SECTION("Move-assigned containers keep memory with its tracker")
+  {
+    {
+      auto lhs = vector_type(test_allocator<int>{first});
+      auto rhs = vector_type(test_allocator<int>{second});
+      rhs.reserve(10);
+
+      lhs = std::move(rhs);
+      lhs.push_back(1);
+    }
+
+    REQUIRE( first.snapshot().allocations == 0 );
+    REQUIRE( second.snapshot().live_bytes == 0 );
+    REQUIRE( second.snapshot().deallocations == 1 );
+  }
+}
@@ -0,0 +1,237 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the intrusive_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/intrusive_ptr.hpp>
+#include <bit/stl/memory/memory.hpp>
+
+#include <atomic>  // std::atomic
+#include <thread>  // std::thread
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  std::atomic<int> g_live{0};
+
+  template<typename CountPolicy>
+  struct widget : bit::stl::intrusive_ref_counter<widget<CountPolicy>,CountPolicy>
+  {
+    explicit widget( int value = 0 ) : value(value){ ++g_live; }
+    ~widget(){ --g_live; }
+
+    bool operator==( const widget& other ) const { return value == other.value; }
+
+    int value;
+  };
+
+  struct animal : bit::stl::intrusive_ref_counter<animal>
+  {
+    virtual ~animal() = default;
+  };
+
+  struct dog : animal{};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("intrusive_ptr::intrusive_ptr()", "[ctor]")
+{
+  bit::stl::intrusive_ptr<widget<bit::stl::atomic_count_policy>> ptr;
+
+  SECTION("Manages no object")
+  {
+    REQUIRE( ptr == nullptr );
+    REQUIRE( ptr.use_count() == 0 );
+  }
+}
+
+TEMPLATE_TEST_CASE("intrusive_ptr::intrusive_ptr( T* )", "[ctor]",
+                   bit::stl::nonatomic_count_policy,
+                   bit::stl::atomic_count_policy,
+                   bit::stl::biased_count_policy)
+{
+  using ptr_type = bit::stl::intrusive_ptr<widget<TestType>,TestType>;
+
+  g_live = 0;
+  {
+    auto* raw = new widget<TestType>(5);
+    auto ptr  = ptr_type( raw );
+
+    SECTION("Takes a reference")
+    {
+      REQUIRE( ptr.use_count() == 1 );
+    }
+
+    SECTION("Copies share the object")
+    {
+      auto copy = ptr;
+
+      REQUIRE( copy == ptr );
+      REQUIRE( ptr.use_count() == 2 );
+    }
+
+    SECTION("Raw pointer can be re-adopted")
+    {
+      auto other = ptr_type( raw );
+
+      REQUIRE( other.use_count() == 2 );
+    }
+  }
+
+  SECTION("Last reference disposes the object")
+  {
+    REQUIRE( g_live == 0 );
+  }
+}
+
+TEST_CASE("intrusive_ptr::intrusive_ptr( intrusive_ptr<U>&& )", "[ctor]")
+{
+  auto derived = bit::stl::make_intrusive<dog>();
+  animal* raw  = derived.get();
+
+  bit::stl::intrusive_ptr<animal> base = std::move(derived);
+
+  SECTION("Source is empty")
+  {
+    REQUIRE( derived == nullptr );
+  }
+
+  SECTION("Transfers the reference")
+  {
+    REQUIRE( base == raw );
+    REQUIRE( base.use_count() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("intrusive_ptr::detach()", "[modifiers]")
+{
+  g_live = 0;
+
+  using ptr_type = bit::stl::intrusive_ptr<widget<bit::stl::nonatomic_count_policy>,
+                                           bit::stl::nonatomic_count_policy>;
+
+  auto ptr  = ptr_type( new widget<bit::stl::nonatomic_count_policy>() );
+  auto* raw = ptr.detach();
+
+  SECTION("Does not release the reference")
+  {
+    REQUIRE( ptr == nullptr );
+    REQUIRE( g_live == 1 );
+  }
+
+  ptr_type( raw, false );
+
+  SECTION("Reference can be re-adopted without incrementing")
+  {
+    REQUIRE( g_live == 0 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+TEST_CASE("hash_value( const intrusive_ptr<T>& )", "[utility]")
+{
+  auto ptr = bit::stl::make_intrusive<dog>();
+
+  REQUIRE( bit::stl::hash_value(ptr) ==
+           static_cast<bit::stl::hash_t>(reinterpret_cast<std::uintptr_t>(ptr.get())) );
+}
+
+TEST_CASE("deep_compare( const intrusive_ptr<T>&, const intrusive_ptr<T>& )", "[utility]")
+{
+  using policy = bit::stl::nonatomic_count_policy;
+
+  auto lhs = bit::stl::make_intrusive<widget<policy>>(3);
+  auto rhs = bit::stl::make_intrusive<widget<policy>>(3);
+
+  SECTION("Pointers to distinct objects are not equal")
+  {
+    REQUIRE( lhs != rhs );
+  }
+
+  SECTION("Pointers to equal objects deep compare equal")
+  {
+    REQUIRE( bit::stl::deep_compare( lhs, rhs ) );
+  }
+
+  SECTION("Null pointer deep compares equal to nullptr")
+  {
+    lhs.reset();
+
+    REQUIRE( bit::stl::deep_compare( lhs, nullptr ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Biased counting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("biased_count_policy", "[policy]")
+{
+  using policy   = bit::stl::biased_count_policy;
+  using ptr_type = bit::stl::intrusive_ptr<widget<policy>,policy>;
+
+  g_live = 0;
+
+  SECTION("Object released by another thread is collected by its owner")
+  {
+    auto ptr = ptr_type( new widget<policy>() );
+
+    std::thread([p = std::move(ptr)]() mutable { p.reset(); }).join();
+
+    REQUIRE( g_live == 1 );
+
+    policy::collect();
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Shared copies are released by every thread")
+  {
+    auto ptr = ptr_type( new widget<policy>() );
+
+    auto threads = std::vector<std::thread>{};
+    for( auto t = 0; t < 4; ++t ) {
+      threads.emplace_back([ptr]() mutable {
+        for( auto i = 0; i < 1000; ++i ) {
+          auto copy = ptr;
+        }
+      });
+    }
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+    REQUIRE( ptr.use_count() == 1 );
+
+    ptr.reset();
+    policy::collect();
+
+    REQUIRE( g_live == 0 );
+  }
+
+  SECTION("Object owned by an exited thread is merged by the releasing thread")
+  {
+    auto ptr = ptr_type{};
+
+    std::thread([&ptr]{ ptr = ptr_type( new widget<policy>() ); }).join();
+
+    REQUIRE( g_live == 1 );
+
+    ptr.reset();
+
+    REQUIRE( g_live == 0 );
+  }
+}
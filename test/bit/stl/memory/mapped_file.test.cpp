@@ -0,0 +1,203 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the mapped_file
+ *****************************************************************************/
+
+#include <bit/stl/memory/mapped_file.hpp>
+
+#include <cstdio>       // std::fopen, std::fwrite, std::remove
+#include <cstdlib>      // mkstemp
+#include <string>       // std::string
+#include <system_error> // std::system_error
+#include <utility>      // std::move
+
+#include <unistd.h> // ::write, ::close
+
+#include <catch.hpp>
+
+namespace {
+
+  /// A temporary file that is removed when destroyed
+  class temporary_file
+  {
+  public:
+
+    explicit temporary_file( const std::string& contents )
+      : m_path("/tmp/bit_stl_mapped_file_XXXXXX")
+    {
+      const auto fd = ::mkstemp( &m_path[0] );
+      if( !contents.empty() ) {
+        (void) ::write( fd, contents.data(), contents.size() );
+      }
+      ::close( fd );
+    }
+
+    ~temporary_file()
+    {
+      std::remove( m_path.c_str() );
+    }
+
+    const std::string& path() const noexcept
+    {
+      return m_path;
+    }
+
+    std::string read() const
+    {
+      auto* file = std::fopen( m_path.c_str(), "rb" );
+      auto result = std::string{};
+      char buffer[64];
+      for( auto n = std::fread(buffer,1,sizeof(buffer),file); n != 0;
+           n = std::fread(buffer,1,sizeof(buffer),file) ) {
+        result.append( buffer, n );
+      }
+      std::fclose( file );
+      return result;
+    }
+
+  private:
+
+    std::string m_path;
+  };
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mapped_file::mapped_file()", "[ctor]")
+{
+  const auto file = bit::stl::mapped_file{};
+
+  REQUIRE_FALSE( file.is_open() );
+  REQUIRE( file.empty() );
+  REQUIRE( file.data() == nullptr );
+}
+
+TEST_CASE("mapped_file::mapped_file( const std::string&, map_mode, bool )", "[ctor]")
+{
+  SECTION("Maps the contents of the file")
+  {
+    const auto temporary = temporary_file{"hello mapped world"};
+    const auto file = bit::stl::mapped_file{ temporary.path() };
+
+    REQUIRE( file.is_open() );
+    REQUIRE( file.size() == 18 );
+    REQUIRE( file.chars() == "hello mapped world" );
+  }
+
+  SECTION("Populated mappings contain the same contents")
+  {
+    const auto temporary = temporary_file{"populated"};
+    const auto file = bit::stl::mapped_file{ temporary.path(), bit::stl::map_mode::read_only, true };
+
+    REQUIRE( file.chars() == "populated" );
+  }
+
+  SECTION("Empty files are open, but map nothing")
+  {
+    const auto temporary = temporary_file{""};
+    const auto file = bit::stl::mapped_file{ temporary.path() };
+
+    REQUIRE( file.is_open() );
+    REQUIRE( file.empty() );
+    REQUIRE( file.bytes().empty() );
+  }
+
+  SECTION("Missing files throw")
+  {
+    REQUIRE_THROWS_AS( bit::stl::mapped_file{"/nonexistent/bit_stl_mapped_file"}, std::system_error );
+  }
+}
+
+TEST_CASE("mapped_file::mapped_file( const char*, map_mode, bool, std::error_code& )", "[ctor]")
+{
+  auto ec = std::error_code{};
+  const auto file = bit::stl::mapped_file{ "/nonexistent/bit_stl_mapped_file",
+                                           bit::stl::map_mode::read_only,
+                                           false,
+                                           ec };
+
+  REQUIRE( ec == std::errc::no_such_file_or_directory );
+  REQUIRE_FALSE( file.is_open() );
+}
+
+TEST_CASE("mapped_file::mapped_file( mapped_file&& )", "[ctor]")
+{
+  const auto temporary = temporary_file{"moved"};
+  auto original = bit::stl::mapped_file{ temporary.path() };
+  const auto* data = original.data();
+
+  const auto moved = std::move(original);
+
+  REQUIRE( moved.data() == data );
+  REQUIRE( moved.chars() == "moved" );
+  REQUIRE_FALSE( original.is_open() );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mapped_file views", "[observers]")
+{
+  const auto temporary = temporary_file{"abc"};
+  const auto file = bit::stl::mapped_file{ temporary.path() };
+
+  SECTION("bytes() views the mapping")
+  {
+    const auto bytes = file.bytes();
+
+    REQUIRE( bytes.size() == 3 );
+    REQUIRE( bytes[1] == static_cast<bit::stl::byte>('b') );
+  }
+
+  SECTION("region() views the mapping")
+  {
+    const auto region = file.region();
+
+    REQUIRE( region.get() == file.data() );
+    REQUIRE( region.size() == 3 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mapped_file::advise( map_advice, size_type, size_type )", "[operations]")
+{
+  const auto temporary = temporary_file{ std::string(10000,'x') };
+  const auto file = bit::stl::mapped_file{ temporary.path() };
+
+  SECTION("Accepts advice for the whole file")
+  {
+    REQUIRE( file.advise( bit::stl::map_advice::sequential ) );
+  }
+
+  SECTION("Accepts advice for an unaligned range")
+  {
+    REQUIRE( file.advise( bit::stl::map_advice::will_need, 5000, 100 ) );
+  }
+
+  SECTION("Rejects ranges past the end")
+  {
+    REQUIRE_FALSE( file.advise( bit::stl::map_advice::random, 20000 ) );
+  }
+}
+
+TEST_CASE("mapped_file::sync( bool )", "[operations]")
+{
+  const auto temporary = temporary_file{"before"};
+
+  {
+    auto file = bit::stl::mapped_file{ temporary.path(), bit::stl::map_mode::read_write };
+    auto bytes = file.mutable_bytes();
+
+    bytes[0] = static_cast<bit::stl::byte>('B');
+    file.sync();
+  }
+
+  REQUIRE( temporary.read() == "Before" );
+}
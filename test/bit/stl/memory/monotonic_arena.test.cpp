@@ -0,0 +1,168 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the monotonic_arena and arena_allocator
+ *****************************************************************************/
+
+#include <bit/stl/memory/monotonic_arena.hpp>
+
+#include <bit/stl/containers/circular_deque.hpp>
+#include <bit/stl/memory/exclusive_ptr.hpp>
+
+#include <cstdint> // std::uintptr_t
+#include <string>  // std::basic_string
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  bool is_within( const void* p, const void* first, std::size_t size )
+  {
+    const auto* byte = static_cast<const char*>(p);
+    const auto* begin = static_cast<const char*>(first);
+    return byte >= begin && byte < begin + size;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// monotonic_arena
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Allocation
+//-----------------------------------------------------------------------------
+
+TEST_CASE("monotonic_arena::allocate( size_type, size_type )", "[allocation]")
+{
+  SECTION("Allocates from the initial buffer first")
+  {
+    alignas(16) char buffer[128];
+    bit::stl::monotonic_arena arena(buffer, sizeof(buffer));
+
+    auto* p = arena.allocate( 32 );
+
+    REQUIRE( is_within( p, buffer, sizeof(buffer) ) );
+  }
+
+  SECTION("Consecutive allocations are contiguous")
+  {
+    alignas(16) char buffer[128];
+    bit::stl::monotonic_arena arena(buffer, sizeof(buffer));
+
+    auto* first  = static_cast<char*>(arena.allocate( 16, 1 ));
+    auto* second = static_cast<char*>(arena.allocate( 16, 1 ));
+
+    REQUIRE( second == first + 16 );
+  }
+
+  SECTION("Respects the requested alignment")
+  {
+    bit::stl::monotonic_arena arena;
+
+    arena.allocate( 1, 1 );
+    auto* p = arena.allocate( 8, 64 );
+
+    REQUIRE( reinterpret_cast<std::uintptr_t>(p) % 64 == 0 );
+  }
+
+  SECTION("Exhausting the buffer falls back to a heap block")
+  {
+    alignas(16) char buffer[32];
+    bit::stl::monotonic_arena arena(buffer, sizeof(buffer), 64);
+
+    arena.allocate( 32, 1 );
+    auto* p = arena.allocate( 16, 1 );
+
+    REQUIRE_FALSE( is_within( p, buffer, sizeof(buffer) ) );
+  }
+
+  SECTION("Allocations larger than the block size succeed")
+  {
+    bit::stl::monotonic_arena arena(64);
+
+    auto* p = static_cast<char*>(arena.allocate( 1000 ));
+    p[999] = 'x';
+
+    REQUIRE( p != nullptr );
+  }
+}
+
+TEST_CASE("monotonic_arena::release()", "[allocation]")
+{
+  alignas(16) char buffer[64];
+  bit::stl::monotonic_arena arena(buffer, sizeof(buffer), 64);
+
+  auto* first = arena.allocate( 16, 1 );
+  arena.allocate( 128, 1 );
+  arena.release();
+
+  SECTION("Allocation restarts from the initial buffer")
+  {
+    REQUIRE( arena.allocate( 16, 1 ) == first );
+  }
+
+  SECTION("Whole buffer is available again")
+  {
+    REQUIRE( arena.remaining() == sizeof(buffer) );
+  }
+}
+
+//=============================================================================
+// arena_allocator
+//=============================================================================
+
+TEST_CASE("arena_allocator<T>", "[allocator]")
+{
+  bit::stl::monotonic_arena arena;
+
+  SECTION("Allocators from the same arena compare equal")
+  {
+    const auto a = bit::stl::arena_allocator<int>(arena);
+    const auto b = bit::stl::arena_allocator<double>(arena);
+
+    REQUIRE( a == b );
+  }
+
+  SECTION("Allocators from different arenas compare unequal")
+  {
+    bit::stl::monotonic_arena other;
+    const auto a = bit::stl::arena_allocator<int>(arena);
+    const auto b = bit::stl::arena_allocator<int>(other);
+
+    REQUIRE( a != b );
+  }
+
+  SECTION("Usable with standard containers")
+  {
+    using allocator_type = bit::stl::arena_allocator<char>;
+    using string_type = std::basic_string<char,std::char_traits<char>,allocator_type>;
+
+    auto vec = std::vector<string_type,bit::stl::arena_allocator<string_type>>(arena);
+    for( auto i = 0; i < 100; ++i ) {
+      vec.emplace_back( "a string long enough to avoid small buffers", arena );
+    }
+
+    REQUIRE( vec.size() == 100 );
+    REQUIRE( vec.back() == "a string long enough to avoid small buffers" );
+  }
+
+  SECTION("Usable with circular_deque")
+  {
+    using allocator_type = bit::stl::arena_allocator<int>;
+    auto deque = bit::stl::circular_deque<int,allocator_type>(4, allocator_type(arena));
+
+    deque.push_back(1);
+    deque.push_front(0);
+
+    REQUIRE( deque.front() == 0 );
+    REQUIRE( deque.back() == 1 );
+  }
+
+  SECTION("Usable with allocate_exclusive")
+  {
+    auto ptr = bit::stl::allocate_exclusive<int>( bit::stl::arena_allocator<int>(arena), 42 );
+
+    REQUIRE( *ptr == 42 );
+  }
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the offset_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/offset_ptr.hpp>
+
+#include <catch.hpp>
+
+namespace {
+
+  struct node
+  {
+    int                        value;
+    bit::stl::offset_ptr<int> pointer;
+  };
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("offset_ptr::offset_ptr()", "[ctor]")
+{
+  bit::stl::offset_ptr<int> ptr;
+
+  SECTION("Is null")
+  {
+    REQUIRE( ptr.get() == nullptr );
+    REQUIRE_FALSE( static_cast<bool>(ptr) );
+  }
+}
+
+TEST_CASE("offset_ptr::offset_ptr( pointer )", "[ctor]")
+{
+  int value = 42;
+  bit::stl::offset_ptr<int> ptr = &value;
+
+  SECTION("Points to the value")
+  {
+    REQUIRE( ptr.get() == &value );
+  }
+
+  SECTION("Dereferences to the value")
+  {
+    REQUIRE( *ptr == 42 );
+  }
+}
+
+TEST_CASE("offset_ptr::offset_ptr( const offset_ptr& )", "[ctor]")
+{
+  int value = 42;
+  const bit::stl::offset_ptr<int> original = &value;
+
+  SECTION("Copy points to the same value")
+  {
+    const bit::stl::offset_ptr<int> copy = original;
+
+    REQUIRE( copy.get() == &value );
+  }
+
+  SECTION("Copy of null is null")
+  {
+    const bit::stl::offset_ptr<int> null;
+    const bit::stl::offset_ptr<int> copy = null;
+
+    REQUIRE( copy == nullptr );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("offset_ptr::swap( offset_ptr& )", "[modifiers]")
+{
+  int a = 1;
+  int b = 2;
+  bit::stl::offset_ptr<int> left  = &a;
+  bit::stl::offset_ptr<int> right = &b;
+
+  left.swap(right);
+
+  SECTION("Left points to Right's old value")
+  {
+    REQUIRE( left.get() == &b );
+  }
+
+  SECTION("Right points to Left's old value")
+  {
+    REQUIRE( right.get() == &a );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Position Independence
+//-----------------------------------------------------------------------------
+
+TEST_CASE("offset_ptr copied with its pointee", "[position]")
+{
+  node nodes[2] = {};
+  nodes[0].value   = 42;
+  nodes[0].pointer = &nodes[0].value;
+
+  nodes[1] = nodes[0];
+  nodes[1].value = 24;
+
+  SECTION("Copied assignment points to the same address")
+  {
+    REQUIRE( nodes[1].pointer.get() == &nodes[0].value );
+  }
+
+  SECTION("Original points to the original value")
+  {
+    REQUIRE( *nodes[0].pointer == 42 );
+  }
+}
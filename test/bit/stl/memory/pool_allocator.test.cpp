@@ -0,0 +1,255 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the fixed_size_pool and pool_allocator
+ *****************************************************************************/
+
+#include <bit/stl/memory/pool_allocator.hpp>
+
+#include <bit/stl/memory/allocator_deleter.hpp>
+#include <bit/stl/memory/exclusive_ptr.hpp>
+
+#include <algorithm> // std::sort, std::includes, std::adjacent_find
+#include <atomic>    // std::atomic
+#include <cstdint>   // std::uintptr_t
+#include <list>      // std::list
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+#include <catch.hpp>
+
+//=============================================================================
+// fixed_size_pool
+//=============================================================================
+
+TEST_CASE("fixed_size_pool<Size,Align>", "[layout]")
+{
+  SECTION("Blocks hold at least the free-list links")
+  {
+    STATIC_REQUIRE( bit::stl::fixed_size_pool<1,1>::block_size >= sizeof(void*) * 2 );
+  }
+
+  SECTION("Blocks are a multiple of the alignment")
+  {
+    STATIC_REQUIRE( bit::stl::fixed_size_pool<40,16>::block_size == 48 );
+  }
+}
+
+TEST_CASE("fixed_size_pool::allocate()", "[allocation]")
+{
+  using pool_type = bit::stl::fixed_size_pool<24,8>;
+
+  SECTION("Blocks are aligned")
+  {
+    auto* p = pool_type::allocate();
+
+    REQUIRE( reinterpret_cast<std::uintptr_t>(p) % 8 == 0 );
+    pool_type::deallocate(p);
+  }
+
+  SECTION("Reuses the most recently freed block")
+  {
+    auto* first = pool_type::allocate();
+    pool_type::deallocate(first);
+
+    REQUIRE( pool_type::allocate() == first );
+    pool_type::deallocate(first);
+  }
+
+  SECTION("Blocks are distinct")
+  {
+    auto* first  = pool_type::allocate();
+    auto* second = pool_type::allocate();
+
+    REQUIRE( first != second );
+    pool_type::deallocate(second);
+    pool_type::deallocate(first);
+  }
+}
+
+TEST_CASE("fixed_size_pool::deallocate( void* )", "[allocation]")
+{
+  // A size used by no other test, so the depot starts empty
+  using pool_type = bit::stl::fixed_size_pool<200,8>;
+  static constexpr auto count = 1000;
+
+  SECTION("Blocks freed by another thread are reused")
+  {
+    auto blocks = std::vector<void*>{};
+    auto reused = std::vector<void*>{};
+
+    std::thread([&]{
+      for( auto i = 0; i < count; ++i ) {
+        blocks.push_back( pool_type::allocate() );
+      }
+    }).join();
+
+    // The exiting thread returns the freed blocks to the depot
+    std::thread([&]{
+      for( auto* p : blocks ) {
+        pool_type::deallocate(p);
+      }
+    }).join();
+
+    std::thread([&]{
+      for( auto i = 0; i < count; ++i ) {
+        reused.push_back( pool_type::allocate() );
+      }
+      for( auto* p : reused ) {
+        pool_type::deallocate(p);
+      }
+    }).join();
+
+    std::sort( blocks.begin(), blocks.end() );
+    std::sort( reused.begin(), reused.end() );
+
+    REQUIRE( reused == blocks );
+  }
+}
+
+namespace {
+
+  // A size used by no other test, so the depot starts empty
+  using exit_pool_type = bit::stl::fixed_size_pool<152,8>;
+
+  void* g_freed_on_exit     = nullptr;
+  void* g_allocated_on_exit = nullptr;
+
+  /// Allocates and frees blocks from its destructor, which runs after the
+  /// magazine of its thread has been destroyed
+  struct exit_releaser
+  {
+    ~exit_releaser()
+    {
+      g_allocated_on_exit = exit_pool_type::allocate();
+      exit_pool_type::deallocate( g_allocated_on_exit );
+      exit_pool_type::deallocate( g_freed_on_exit );
+    }
+  };
+
+} // anonymous namespace
+
+TEST_CASE("fixed_size_pool after the magazine is destroyed", "[allocation]")
+{
+  std::thread([]{
+    // Constructed before the magazine, and so destroyed after it
+    static thread_local exit_releaser releaser;
+    (void) releaser;
+
+    g_freed_on_exit = exit_pool_type::allocate();
+  }).join();
+
+  // The blocks went straight to the depot, each as a batch of its own
+  auto* const first  = exit_pool_type::allocate();
+  auto* const second = exit_pool_type::allocate();
+
+  REQUIRE( first == g_freed_on_exit );
+  REQUIRE( second == g_allocated_on_exit );
+
+  exit_pool_type::deallocate( second );
+  exit_pool_type::deallocate( first );
+}
+
+TEST_CASE("fixed_size_pool with concurrent refills", "[allocation]")
+{
+  // A size used by no other test, so the depot starts empty
+  using pool_type = bit::stl::fixed_size_pool<104,8>;
+  static constexpr auto threads = 8;
+  static constexpr auto count   = 256;
+
+  auto seeded = std::vector<void*>{};
+
+  // Whole slabs leave no remainder, so the exiting thread returns exactly
+  // the seeded blocks to the depot
+  std::thread([&]{
+    for( auto i = std::size_t{0}; i < threads * pool_type::blocks_per_slab; ++i ) {
+      seeded.push_back( pool_type::allocate() );
+    }
+    for( auto* p : seeded ) {
+      pool_type::deallocate(p);
+    }
+  }).join();
+
+  auto reused  = std::vector<std::vector<void*>>(threads);
+  auto workers = std::vector<std::thread>{};
+  std::atomic<bool> started{false};
+  for( auto& blocks : reused ) {
+    workers.emplace_back([&blocks,&started]{
+      while( !started.load() ) {
+        std::this_thread::yield();
+      }
+      for( auto i = 0; i < count; ++i ) {
+        blocks.push_back( pool_type::allocate() );
+      }
+    });
+  }
+  started = true;
+  for( auto& worker : workers ) {
+    worker.join();
+  }
+
+  auto all = std::vector<void*>{};
+  for( auto& blocks : reused ) {
+    all.insert( all.end(), blocks.begin(), blocks.end() );
+  }
+  std::sort( all.begin(), all.end() );
+  std::sort( seeded.begin(), seeded.end() );
+
+  // Each block is handed out once, and refills never fall back to new
+  // slabs while the depot holds batches
+  REQUIRE( std::adjacent_find( all.begin(), all.end() ) == all.end() );
+  REQUIRE( std::includes( seeded.begin(), seeded.end(), all.begin(), all.end() ) );
+
+  for( auto* p : all ) {
+    pool_type::deallocate(p);
+  }
+}
+
+//=============================================================================
+// pool_allocator
+//=============================================================================
+
+TEST_CASE("pool_allocator<T>", "[allocator]")
+{
+  SECTION("All allocators compare equal")
+  {
+    REQUIRE( bit::stl::pool_allocator<int>{} == bit::stl::pool_allocator<double>{} );
+  }
+
+  SECTION("Usable with standard node containers")
+  {
+    auto list = std::list<int,bit::stl::pool_allocator<int>>{};
+    for( auto i = 0; i < 1000; ++i ) {
+      list.push_back(i);
+    }
+
+    REQUIRE( list.size() == 1000 );
+    REQUIRE( list.back() == 999 );
+  }
+
+  SECTION("Usable with array allocations")
+  {
+    auto vec = std::vector<int,bit::stl::pool_allocator<int>>(1000, 42);
+
+    REQUIRE( vec[999] == 42 );
+  }
+
+  SECTION("Usable with allocate_exclusive")
+  {
+    auto ptr = bit::stl::allocate_exclusive<int>( bit::stl::pool_allocator<int>{}, 42 );
+
+    REQUIRE( *ptr == 42 );
+  }
+
+  SECTION("Usable with allocator_deleter")
+  {
+    using traits_type = std::allocator_traits<bit::stl::pool_allocator<int>>;
+    auto allocator = bit::stl::pool_allocator<int>{};
+
+    auto* p = traits_type::allocate( allocator, 1 );
+    traits_type::construct( allocator, p, 42 );
+    auto deleter = bit::stl::allocator_deleter<bit::stl::pool_allocator<int>>( allocator, 1 );
+
+    REQUIRE( *p == 42 );
+    deleter(p);
+  }
+}
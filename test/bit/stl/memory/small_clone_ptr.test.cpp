@@ -0,0 +1,293 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the small_clone_ptr
+ *****************************************************************************/
+
+#include <bit/stl/memory/small_clone_ptr.hpp>
+
+#include <utility> // std::move
+
+#include <catch.hpp>
+
+namespace {
+
+  struct shape
+  {
+    virtual ~shape() = default;
+    virtual int area() const = 0;
+
+    static int instances;
+  };
+
+  int shape::instances = 0;
+
+  struct square : shape
+  {
+    explicit square( int side ) : side(side){ ++instances; }
+    square( const square& other ) : shape(), side(other.side){ ++instances; }
+    square( square&& other ) noexcept : shape(), side(other.side){ ++instances; }
+    ~square(){ --instances; }
+
+    int area() const override { return side * side; }
+
+    int side;
+  };
+
+  struct big_rectangle : shape
+  {
+    big_rectangle( int width, int height ) : width(width), height(height){ ++instances; }
+    big_rectangle( const big_rectangle& other ) : shape(), width(other.width), height(other.height){ ++instances; }
+    ~big_rectangle(){ --instances; }
+
+    int area() const override { return width * height; }
+
+    int  width;
+    int  height;
+    char padding[64];
+  };
+
+  using shape_ptr = bit::stl::small_clone_ptr<shape>;
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("small_clone_ptr::small_clone_ptr()", "[ctor]")
+{
+  shape_ptr ptr;
+
+  SECTION("Manages no object")
+  {
+    REQUIRE( ptr == nullptr );
+  }
+
+  SECTION("Is not inline")
+  {
+    REQUIRE_FALSE( ptr.is_inline() );
+  }
+}
+
+TEST_CASE("small_clone_ptr::small_clone_ptr( in_place_type_t<U>, Args&&... )", "[ctor]")
+{
+  SECTION("Type fits in the buffer")
+  {
+    shape_ptr ptr( bit::stl::in_place_type<square>, 3 );
+
+    SECTION("Object is stored inline")
+    {
+      REQUIRE( ptr.is_inline() );
+    }
+
+    SECTION("Object lives inside the small_clone_ptr")
+    {
+      auto* begin = reinterpret_cast<const char*>(&ptr);
+      auto* p     = reinterpret_cast<const char*>(ptr.get());
+
+      REQUIRE( (p >= begin && p < begin + sizeof(ptr)) );
+    }
+
+    SECTION("Dispatches to the derived type")
+    {
+      REQUIRE( ptr->area() == 9 );
+    }
+  }
+
+  SECTION("Type exceeds the buffer")
+  {
+    shape_ptr ptr( bit::stl::in_place_type<big_rectangle>, 2, 5 );
+
+    SECTION("Object is stored on the heap")
+    {
+      REQUIRE_FALSE( ptr.is_inline() );
+    }
+
+    SECTION("Dispatches to the derived type")
+    {
+      REQUIRE( ptr->area() == 10 );
+    }
+  }
+}
+
+TEST_CASE("small_clone_ptr::small_clone_ptr( const small_clone_ptr& )", "[ctor]")
+{
+  SECTION("Object is stored inline")
+  {
+    shape_ptr original = square{4};
+    shape_ptr copy     = original;
+
+    SECTION("Creates a distinct object")
+    {
+      REQUIRE( copy.get() != original.get() );
+    }
+
+    SECTION("Copies the derived type")
+    {
+      REQUIRE( copy->area() == 16 );
+    }
+
+    SECTION("Copy is inline")
+    {
+      REQUIRE( copy.is_inline() );
+    }
+  }
+
+  SECTION("Object is stored on the heap")
+  {
+    shape_ptr original = big_rectangle{3,4};
+    shape_ptr copy     = original;
+
+    SECTION("Creates a distinct object")
+    {
+      REQUIRE( copy.get() != original.get() );
+    }
+
+    SECTION("Copies the derived type")
+    {
+      REQUIRE( copy->area() == 12 );
+    }
+  }
+}
+
+TEST_CASE("small_clone_ptr::small_clone_ptr( small_clone_ptr&& )", "[ctor]")
+{
+  SECTION("Object is stored inline")
+  {
+    shape_ptr original = square{5};
+    shape_ptr moved    = std::move(original);
+
+    SECTION("Source is empty")
+    {
+      REQUIRE( original == nullptr );
+    }
+
+    SECTION("Object is relocated into the destination")
+    {
+      REQUIRE( moved.is_inline() );
+      REQUIRE( moved->area() == 25 );
+    }
+  }
+
+  SECTION("Object is stored on the heap")
+  {
+    shape_ptr original = big_rectangle{2,3};
+    const auto* object = original.get();
+    shape_ptr moved    = std::move(original);
+
+    SECTION("Source is empty")
+    {
+      REQUIRE( original == nullptr );
+    }
+
+    SECTION("Transfers the same object")
+    {
+      REQUIRE( moved.get() == object );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+TEST_CASE("small_clone_ptr::~small_clone_ptr()", "[dtor]")
+{
+  shape::instances = 0;
+  {
+    shape_ptr a = square{1};
+    shape_ptr b = big_rectangle{1,2};
+    shape_ptr c = a;
+    shape_ptr d = b;
+
+    REQUIRE( shape::instances == 4 );
+  }
+
+  SECTION("Destroys every managed object")
+  {
+    REQUIRE( shape::instances == 0 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("small_clone_ptr::operator=( const small_clone_ptr& )", "[assignment]")
+{
+  shape::instances = 0;
+  {
+    shape_ptr inline_ptr = square{2};
+    shape_ptr heap_ptr   = big_rectangle{2,7};
+
+    inline_ptr = heap_ptr;
+
+    SECTION("Copies the new object")
+    {
+      REQUIRE( inline_ptr->area() == 14 );
+      REQUIRE( inline_ptr.get() != heap_ptr.get() );
+    }
+
+    SECTION("Destroys the old object")
+    {
+      REQUIRE( shape::instances == 2 );
+    }
+  }
+  REQUIRE( shape::instances == 0 );
+}
+
+TEST_CASE("small_clone_ptr::emplace( Args&&... )", "[modifier]")
+{
+  shape_ptr ptr = big_rectangle{1,1};
+
+  auto& result = ptr.emplace<square>(6);
+
+  SECTION("Returns the new object")
+  {
+    REQUIRE( &result == ptr.get() );
+  }
+
+  SECTION("Replaces the managed object")
+  {
+    REQUIRE( ptr->area() == 36 );
+    REQUIRE( ptr.is_inline() );
+  }
+}
+
+TEST_CASE("small_clone_ptr::swap( small_clone_ptr& )", "[modifier]")
+{
+  shape_ptr left  = square{3};
+  shape_ptr right = big_rectangle{2,4};
+
+  left.swap(right);
+
+  SECTION("Left contains Right's old object")
+  {
+    REQUIRE( left->area() == 8 );
+    REQUIRE_FALSE( left.is_inline() );
+  }
+
+  SECTION("Right contains Left's old object")
+  {
+    REQUIRE( right->area() == 9 );
+    REQUIRE( right.is_inline() );
+  }
+}
+
+TEST_CASE("small_clone_ptr::reset()", "[modifier]")
+{
+  shape::instances = 0;
+
+  shape_ptr ptr = square{2};
+  ptr.reset();
+
+  SECTION("Manages no object")
+  {
+    REQUIRE( ptr == nullptr );
+  }
+
+  SECTION("Destroys the old object")
+  {
+    REQUIRE( shape::instances == 0 );
+  }
+}
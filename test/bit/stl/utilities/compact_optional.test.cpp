@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for compact_optional
+ *****************************************************************************/
+
+#include <bit/stl/utilities/compact_optional.hpp>
+#include <bit/stl/containers/hashed_string_view.hpp>
+
+#include <cstdint> // std::uint32_t
+#include <limits>  // std::numeric_limits
+
+#include <catch.hpp>
+
+namespace {
+
+  using index_type = bit::stl::compact_optional<
+    std::uint32_t,
+    bit::stl::compact_optional_sentinel<std::uint32_t,0xffffffff>
+  >;
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Size
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional<T,Traits> size", "[size]")
+{
+  STATIC_REQUIRE( sizeof(index_type) == sizeof(std::uint32_t) );
+  STATIC_REQUIRE( sizeof(bit::stl::compact_optional<int*>) == sizeof(int*) );
+  STATIC_REQUIRE( sizeof(bit::stl::compact_optional<double>) == sizeof(double) );
+  STATIC_REQUIRE( sizeof(bit::stl::compact_optional<bit::stl::hashed_string_view>) ==
+                  sizeof(bit::stl::hashed_string_view) );
+}
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional<T,Traits>::compact_optional()", "[ctor]")
+{
+  SECTION("Default construction is empty")
+  {
+    auto opt = index_type{};
+
+    REQUIRE_FALSE( opt.has_value() );
+    REQUIRE( opt == bit::stl::nullopt );
+  }
+
+  SECTION("Null pointers are empty")
+  {
+    constexpr auto opt = bit::stl::compact_optional<const int*>{};
+
+    STATIC_REQUIRE_FALSE( opt.has_value() );
+  }
+}
+
+TEST_CASE("compact_optional<T,Traits>::compact_optional( const value_type& )", "[ctor]")
+{
+  SECTION("Contains the value")
+  {
+    auto opt = index_type{42u};
+
+    REQUIRE( opt.has_value() );
+    REQUIRE( *opt == 42u );
+    REQUIRE( opt == 42u );
+  }
+
+  SECTION("Zero is a value when it is not the sentinel")
+  {
+    auto opt = index_type{0u};
+
+    REQUIRE( opt.has_value() );
+  }
+}
+
+TEST_CASE("compact_optional<T,Traits>::compact_optional( const optional<T>& )", "[ctor]")
+{
+  SECTION("Empty optional constructs empty compact_optional")
+  {
+    auto opt = index_type{ bit::stl::optional<std::uint32_t>{} };
+
+    REQUIRE_FALSE( opt.has_value() );
+  }
+
+  SECTION("Engaged optional copies the value")
+  {
+    auto opt = index_type{ bit::stl::optional<std::uint32_t>{7u} };
+
+    REQUIRE( opt.value() == 7u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional<T,Traits>::value()", "[observers]")
+{
+  SECTION("Empty compact_optional throws")
+  {
+    auto opt = index_type{};
+
+    REQUIRE_THROWS_AS( opt.value(), bit::stl::bad_optional_access );
+  }
+
+  SECTION("Engaged compact_optional returns the value")
+  {
+    auto opt = index_type{5u};
+
+    REQUIRE( opt.value() == 5u );
+  }
+}
+
+TEST_CASE("compact_optional<T,Traits>::value_or( U&& )", "[observers]")
+{
+  REQUIRE( index_type{}.value_or(3u) == 3u );
+  REQUIRE( index_type{5u}.value_or(3u) == 5u );
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional<T,Traits>::reset()", "[modifiers]")
+{
+  auto opt = index_type{5u};
+  opt.reset();
+
+  REQUIRE_FALSE( opt.has_value() );
+}
+
+TEST_CASE("compact_optional<T,Traits>::emplace( Args&&... )", "[modifiers]")
+{
+  auto opt = index_type{};
+  auto& value = opt.emplace(9u);
+
+  REQUIRE( opt.has_value() );
+  REQUIRE( &value == &*opt );
+  REQUIRE( value == 9u );
+}
+
+TEST_CASE("compact_optional<T,Traits>::operator=", "[modifiers]")
+{
+  auto opt = index_type{};
+
+  SECTION("Assigning a value engages")
+  {
+    opt = 4u;
+
+    REQUIRE( opt == 4u );
+  }
+
+  SECTION("Assigning nullopt disengages")
+  {
+    opt = 4u;
+    opt = bit::stl::nullopt;
+
+    REQUIRE( opt == bit::stl::nullopt );
+  }
+}
+
+TEST_CASE("swap( compact_optional<T,Traits>&, compact_optional<T,Traits>& )", "[modifiers]")
+{
+  auto lhs = index_type{1u};
+  auto rhs = index_type{};
+
+  swap( lhs, rhs );
+
+  REQUIRE_FALSE( lhs.has_value() );
+  REQUIRE( rhs == 1u );
+}
+
+//----------------------------------------------------------------------------
+// Sentinels
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional_traits<double>", "[sentinels]")
+{
+  using optional_type = bit::stl::compact_optional<double>;
+
+  SECTION("Default construction is empty")
+  {
+    REQUIRE_FALSE( optional_type{}.has_value() );
+  }
+
+  SECTION("Ordinary NaNs are values")
+  {
+    auto opt = optional_type{ std::numeric_limits<double>::quiet_NaN() };
+
+    REQUIRE( opt.has_value() );
+  }
+
+  SECTION("NaNs from arithmetic are values")
+  {
+    volatile auto zero = 0.0;
+    auto opt = optional_type{ zero / zero };
+
+    REQUIRE( opt.has_value() );
+  }
+}
+
+TEST_CASE("compact_optional_traits<float>", "[sentinels]")
+{
+  using optional_type = bit::stl::compact_optional<float>;
+
+  REQUIRE_FALSE( optional_type{}.has_value() );
+  REQUIRE( optional_type{ std::numeric_limits<float>::quiet_NaN() }.has_value() );
+  REQUIRE( optional_type{ 1.5f } == 1.5f );
+}
+
+TEST_CASE("compact_optional_traits<basic_hashed_string_view>", "[sentinels]")
+{
+  using optional_type = bit::stl::compact_optional<bit::stl::hashed_string_view>;
+
+  SECTION("Default construction is empty")
+  {
+    REQUIRE_FALSE( optional_type{}.has_value() );
+  }
+
+  SECTION("Empty strings are values")
+  {
+    auto opt = optional_type{ bit::stl::hashed_string_view{""} };
+
+    REQUIRE( opt.has_value() );
+  }
+
+  SECTION("Hashes like the contained value")
+  {
+    const auto str = bit::stl::hashed_string_view{"hello"};
+    auto opt = optional_type{ str };
+
+    REQUIRE( hash_value(opt) == hash_value(str) );
+    REQUIRE( hash_value(optional_type{}) == hash_value(bit::stl::optional<int>{}) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Comparisons
+//----------------------------------------------------------------------------
+
+TEST_CASE("compact_optional<T,Traits> comparisons", "[comparison]")
+{
+  const auto empty = index_type{};
+  const auto one   = index_type{1u};
+  const auto two   = index_type{2u};
+
+  SECTION("Empty compares less than any value")
+  {
+    REQUIRE( empty < one );
+    REQUIRE( empty < 0u );
+    REQUIRE( empty != one );
+    REQUIRE( empty == index_type{} );
+  }
+
+  SECTION("Values compare as their contents")
+  {
+    REQUIRE( one < two );
+    REQUIRE( two >= one );
+    REQUIRE( one == 1u );
+    REQUIRE( 2u > one );
+  }
+
+  SECTION("Comparisons with nullopt")
+  {
+    REQUIRE( bit::stl::nullopt < one );
+    REQUIRE( one > bit::stl::nullopt );
+    REQUIRE( empty <= bit::stl::nullopt );
+    REQUIRE( bit::stl::nullopt >= empty );
+  }
+}
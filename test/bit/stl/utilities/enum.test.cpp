@@ -0,0 +1,151 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for enum registration with BIT_REGISTER_ENUM
+ *****************************************************************************/
+
+#include <bit/stl/utilities/enum.hpp>
+
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include <catch.hpp>
+
+namespace {
+
+  enum class color{ red, green, blue };
+
+  enum status : int{ failure = -1, pending = 0, success = 1 };
+
+  enum class sparse : unsigned{ low = 3, high = 0x8000, middle = 70, alias = 3 };
+
+  enum class opcode
+  {
+    nop, load, store, add, sub, mul, div, mod, neg, and_, or_, xor_, not_,
+    shl, shr, jmp, jz, jnz, call, ret, push, pop, dup, swap, over, rot,
+    eq, ne, lt, le, gt, ge, in, out, halt, trap, yield, spawn, join, sleep,
+    alloc, free, load8, load16, load32, load64, store8, store16, store32,
+    store64, fadd, fsub, fmul, fdiv, fneg, fsqrt, fabs, fmin, fmax, fcmp,
+    itof, ftoi, debug, last
+  };
+
+} // anonymous namespace
+
+BIT_REGISTER_ENUM(color, red, green, blue);
+BIT_REGISTER_ENUM(status, failure, pending, success);
+BIT_REGISTER_ENUM(sparse, low, high, middle, alias);
+BIT_REGISTER_ENUM(opcode,
+  nop, load, store, add, sub, mul, div, mod, neg, and_, or_, xor_, not_,
+  shl, shr, jmp, jz, jnz, call, ret, push, pop, dup, swap, over, rot,
+  eq, ne, lt, le, gt, ge, in, out, halt, trap, yield, spawn, join, sleep,
+  alloc, free, load8, load16, load32, load64, store8, store16, store32,
+  store64, fadd, fsub, fmul, fdiv, fneg, fsqrt, fabs, fmin, fmax, fcmp,
+  itof, ftoi, debug, last
+);
+
+//-----------------------------------------------------------------------------
+// Iteration
+//-----------------------------------------------------------------------------
+
+TEST_CASE("BIT_REGISTER_ENUM: begin and end", "[enum]")
+{
+  SECTION("Are usable in constant expressions")
+  {
+    STATIC_REQUIRE( bit::stl::enum_traits<color>::end() -
+                    bit::stl::enum_traits<color>::begin() == 3 );
+    STATIC_REQUIRE( bit::stl::enum_traits<opcode>::end() -
+                    bit::stl::enum_traits<opcode>::begin() == 64 );
+  }
+
+  SECTION("Iterate the enumerators in registration order")
+  {
+    auto values = std::vector<sparse>{};
+    for( auto e : bit::stl::make_enum_range<sparse>() ) {
+      values.push_back(e);
+    }
+
+    REQUIRE( values == (std::vector<sparse>{
+      sparse::low, sparse::high, sparse::middle, sparse::alias
+    }) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// to_string
+//-----------------------------------------------------------------------------
+
+TEST_CASE("BIT_REGISTER_ENUM: to_string", "[enum]")
+{
+  SECTION("Sequential enumerators convert to their names")
+  {
+    REQUIRE( bit::stl::enum_cast<std::string>( color::red ) == "red" );
+    REQUIRE( bit::stl::enum_cast<std::string>( color::green ) == "green" );
+    REQUIRE( bit::stl::enum_cast<std::string>( color::blue ) == "blue" );
+  }
+
+  SECTION("Negative enumerators convert to their names")
+  {
+    REQUIRE( bit::stl::enum_cast<std::string>( failure ) == "failure" );
+    REQUIRE( bit::stl::enum_cast<std::string>( success ) == "success" );
+  }
+
+  SECTION("Sparse enumerators convert to their names")
+  {
+    REQUIRE( bit::stl::enum_cast<std::string>( sparse::high ) == "high" );
+    REQUIRE( bit::stl::enum_cast<std::string>( sparse::middle ) == "middle" );
+  }
+
+  SECTION("Aliases convert to the first registered name")
+  {
+    REQUIRE( bit::stl::enum_cast<std::string>( sparse::alias ) == "low" );
+  }
+
+  SECTION("Unregistered values throw bad_enum_cast")
+  {
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<std::string>( static_cast<color>(3) ),
+                       bit::stl::bad_enum_cast );
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<std::string>( static_cast<sparse>(4) ),
+                       bit::stl::bad_enum_cast );
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<std::string>( static_cast<status>(-2) ),
+                       bit::stl::bad_enum_cast );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// from_string
+//-----------------------------------------------------------------------------
+
+TEST_CASE("BIT_REGISTER_ENUM: from_string", "[enum]")
+{
+  SECTION("Names convert to their enumerators")
+  {
+    REQUIRE( bit::stl::enum_cast<color>( "red" ) == color::red );
+    REQUIRE( bit::stl::enum_cast<color>( std::string{"blue"} ) == color::blue );
+    REQUIRE( bit::stl::enum_cast<status>( "failure" ) == failure );
+    REQUIRE( bit::stl::enum_cast<sparse>( "middle" ) == sparse::middle );
+    REQUIRE( bit::stl::enum_cast<sparse>( "alias" ) == sparse::alias );
+  }
+
+  SECTION("Every name of a large enum round-trips")
+  {
+    for( auto e : bit::stl::make_enum_range<opcode>() ) {
+      const auto name = bit::stl::enum_cast<std::string>( e );
+
+      REQUIRE( bit::stl::enum_cast<opcode>( name ) == e );
+    }
+  }
+
+  SECTION("Names are compared by length and contents")
+  {
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<color>( "re" ), bit::stl::bad_enum_cast );
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<color>( "redd" ), bit::stl::bad_enum_cast );
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<color>( "Red" ), bit::stl::bad_enum_cast );
+    REQUIRE_THROWS_AS( bit::stl::enum_cast<color>( "" ), bit::stl::bad_enum_cast );
+  }
+
+  SECTION("Unregistered names throw bad_enum_cast")
+  {
+    for( auto name : { "purple", "load128", "last_" } ) {
+      REQUIRE_THROWS_AS( bit::stl::enum_cast<opcode>( name ), bit::stl::bad_enum_cast );
+    }
+  }
+}
@@ -6,8 +6,59 @@
 
 #include <catch.hpp>
 
+#include <memory>
+#include <string>
 #include <system_error>
 
+namespace {
+
+  /// A type that counts how many times it is copied and moved
+  struct counted
+  {
+    explicit counted( int value ) : value(value){}
+    counted( const counted& other ) : value(other.value){ ++copies; }
+    counted( counted&& other ) : value(other.value){ ++moves; }
+
+    int value;
+
+    static int copies;
+    static int moves;
+
+    static void reset(){ copies = 0; moves = 0; }
+  };
+
+  int counted::copies = 0;
+  int counted::moves  = 0;
+
+  using error_type = std::error_condition;
+
+  bit::stl::expected<int> parse_digit( char c )
+  {
+    if( c < '0' || c > '9' ) {
+      return bit::stl::make_unexpected<error_type>( std::errc::invalid_argument );
+    }
+    return c - '0';
+  }
+
+  bit::stl::expected<void> check_even( int value )
+  {
+    if( value % 2 != 0 ) {
+      return bit::stl::make_unexpected<error_type>( std::errc::result_out_of_range );
+    }
+    return {};
+  }
+
+  bit::stl::expected<int> parse_pair( char tens, char ones )
+  {
+    BIT_EXPECTED_TRY( t, parse_digit( tens ) );
+    BIT_EXPECTED_TRY( o, parse_digit( ones ) );
+    BIT_EXPECTED_TRY_VOID( check_even( o ) );
+
+    return t * 10 + o;
+  }
+
+} // anonymous namespace
+
 //=============================================================================
 // expected<T,E>
 //=============================================================================
@@ -127,5 +178,306 @@ TEST_CASE("expected::expected( expected&& )")
 }
 
 //-----------------------------------------------------------------------------
-//
+// Monadic Functions
 //-----------------------------------------------------------------------------
+
+TEST_CASE("expected::and_then( Fn&& )")
+{
+  auto half = []( int x ) -> bit::stl::expected<int> {
+    if( x % 2 != 0 ) {
+      return bit::stl::make_unexpected<error_type>( std::errc::invalid_argument );
+    }
+    return x / 2;
+  };
+
+  SECTION("Contains Value")
+  {
+    auto result = bit::stl::expected<int>(8).and_then( half ).and_then( half );
+
+    SECTION("Result contains the value of the chain")
+    {
+      REQUIRE( *result == 2 );
+    }
+  }
+
+  SECTION("Function returns an error")
+  {
+    auto result = bit::stl::expected<int>(6).and_then( half ).and_then( half );
+
+    SECTION("Result contains the error")
+    {
+      REQUIRE( result.error() == std::errc::invalid_argument );
+    }
+  }
+
+  SECTION("Contains Error")
+  {
+    auto calls = 0;
+    auto expect = bit::stl::expected<int>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+    auto result = expect.and_then( [&]( int x ){ ++calls; return half(x); } );
+
+    SECTION("Function is not invoked")
+    {
+      REQUIRE( calls == 0 );
+    }
+    SECTION("Result contains the error")
+    {
+      REQUIRE( result.error() == std::errc::io_error );
+    }
+  }
+
+  SECTION("Chained on a temporary")
+  {
+    counted::reset();
+    auto result = bit::stl::expected<counted>( bit::stl::in_place, 1 )
+      .and_then( []( counted&& c ){ return bit::stl::expected<counted>( bit::stl::in_place, c.value + 1 ); } )
+      .and_then( []( counted&& c ){ return bit::stl::expected<counted>( bit::stl::in_place, c.value + 1 ); } );
+
+    SECTION("Value is forwarded as an rvalue")
+    {
+      REQUIRE( result->value == 3 );
+    }
+    SECTION("No intermediate copies or moves are made")
+    {
+      REQUIRE( counted::copies == 0 );
+      REQUIRE( counted::moves == 0 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("expected::transform( Fn&& )")
+{
+  SECTION("Contains Value")
+  {
+    counted::reset();
+    auto result = bit::stl::expected<int>(4)
+      .transform( []( int x ){ return counted(x * 2); } )
+      .transform( []( const counted& c ){ return counted(c.value + 1); } );
+
+    SECTION("Result contains the transformed value")
+    {
+      REQUIRE( result->value == 9 );
+    }
+    SECTION("Result is constructed in place")
+    {
+      REQUIRE( counted::copies == 0 );
+      REQUIRE( counted::moves == 0 );
+    }
+  }
+
+  SECTION("Function returns void")
+  {
+    auto calls = 0;
+    auto result = bit::stl::expected<int>(4).transform( [&]( int ){ ++calls; } );
+
+    SECTION("Result is an expected<void>")
+    {
+      STATIC_REQUIRE( std::is_same<decltype(result),bit::stl::expected<void>>::value );
+    }
+    SECTION("Result contains a value")
+    {
+      REQUIRE( result.has_value() );
+      REQUIRE( calls == 1 );
+    }
+  }
+
+  SECTION("Contains Error")
+  {
+    auto expect = bit::stl::expected<int>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+    auto result = expect.transform( []( int x ){ return std::to_string(x); } );
+
+    SECTION("Result contains the error")
+    {
+      REQUIRE( result.error() == std::errc::io_error );
+    }
+  }
+
+  SECTION("Move-only value")
+  {
+    auto result = bit::stl::expected<std::unique_ptr<int>>( std::make_unique<int>(5) )
+      .transform( []( std::unique_ptr<int>&& p ){ return std::move(p); } );
+
+    SECTION("Value is moved through the chain")
+    {
+      REQUIRE( **result == 5 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("expected::or_else( Fn&& )")
+{
+  auto recover = []( const error_type& ){ return bit::stl::expected<int>(0); };
+
+  SECTION("Contains Value")
+  {
+    auto result = bit::stl::expected<int>(4).or_else( recover );
+
+    SECTION("Result contains the value")
+    {
+      REQUIRE( *result == 4 );
+    }
+  }
+
+  SECTION("Contains Error")
+  {
+    auto expect = bit::stl::expected<int>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+    auto result = expect.or_else( recover );
+
+    SECTION("Result contains the recovered value")
+    {
+      REQUIRE( *result == 0 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("expected::transform_error( Fn&& )")
+{
+  auto to_code = []( const error_type& e ){ return e.value(); };
+
+  SECTION("Contains Value")
+  {
+    auto result = bit::stl::expected<int>(4).transform_error( to_code );
+
+    SECTION("Result contains the value")
+    {
+      STATIC_REQUIRE( std::is_same<decltype(result),bit::stl::expected<int,int>>::value );
+      REQUIRE( *result == 4 );
+    }
+  }
+
+  SECTION("Contains Error")
+  {
+    auto expect = bit::stl::expected<int>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+    auto result = expect.transform_error( to_code );
+
+    SECTION("Result contains the transformed error")
+    {
+      REQUIRE( result.error() == static_cast<int>(std::errc::io_error) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("expected::flat_map( Fn&& )")
+{
+  auto result = bit::stl::expected<int>(4).flat_map( []( int x ){ return bit::stl::expected<int>(x + 1); } );
+
+  SECTION("Function is invoked with the value")
+  {
+    REQUIRE( *result == 5 );
+  }
+}
+
+TEST_CASE("expected::map( Fn&& )")
+{
+  auto result = bit::stl::expected<int>(4).map( []( int x ){ return x + 1; } );
+
+  SECTION("Function result is wrapped in an expected")
+  {
+    REQUIRE( *result == 5 );
+  }
+}
+
+//=============================================================================
+// expected<void,E>
+//=============================================================================
+
+TEST_CASE("expected<void>::expected( const expected& )")
+{
+  auto expect = bit::stl::expected<void>();
+  auto copy = expect;
+
+  SECTION("Copy contains a value")
+  {
+    REQUIRE( copy.has_value() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Monadic Functions
+//-----------------------------------------------------------------------------
+
+TEST_CASE("expected<void>::and_then( Fn&& )")
+{
+  SECTION("Contains Value")
+  {
+    auto result = bit::stl::expected<void>().and_then( []{ return bit::stl::expected<int>(3); } );
+
+    SECTION("Result contains the function's value")
+    {
+      REQUIRE( *result == 3 );
+    }
+  }
+
+  SECTION("Contains Error")
+  {
+    auto expect = bit::stl::expected<void>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+    auto result = expect.and_then( []{ return bit::stl::expected<int>(3); } );
+
+    SECTION("Result contains the error")
+    {
+      REQUIRE( result.error() == std::errc::io_error );
+    }
+  }
+}
+
+TEST_CASE("expected<void>::transform( Fn&& )")
+{
+  auto result = bit::stl::expected<void>().transform( []{ return counted(3); } );
+
+  SECTION("Result contains the function's value")
+  {
+    REQUIRE( result->value == 3 );
+  }
+}
+
+TEST_CASE("expected<void>::or_else( Fn&& )")
+{
+  auto expect = bit::stl::expected<void>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+  auto result = expect.or_else( []( const error_type& ){ return bit::stl::expected<void>(); } );
+
+  SECTION("Result is recovered")
+  {
+    REQUIRE( result.has_value() );
+  }
+}
+
+TEST_CASE("expected<void>::transform_error( Fn&& )")
+{
+  auto expect = bit::stl::expected<void>( bit::stl::make_unexpected<error_type>( std::errc::io_error ) );
+  auto result = expect.transform_error( []( const error_type& e ){ return e.value(); } );
+
+  SECTION("Result contains the transformed error")
+  {
+    REQUIRE( result.error() == static_cast<int>(std::errc::io_error) );
+  }
+}
+
+//=============================================================================
+// Early-return helpers
+//=============================================================================
+
+TEST_CASE("BIT_EXPECTED_TRY( name, expression )")
+{
+  SECTION("All expressions contain values")
+  {
+    REQUIRE( *parse_pair('4','2') == 42 );
+  }
+
+  SECTION("Expression contains an error")
+  {
+    REQUIRE( parse_pair('x','2').error() == std::errc::invalid_argument );
+  }
+
+  SECTION("Void expression contains an error")
+  {
+    REQUIRE( parse_pair('4','3').error() == std::errc::result_out_of_range );
+  }
+}
@@ -0,0 +1,166 @@
+/*****************************************************************************
+ * \file
+ * \brief Test cases for bit::stl::inplace_lazy
+ *****************************************************************************/
+
+#include <bit/stl/utilities/inplace_lazy.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <catch.hpp>
+
+namespace {
+
+  /// A type whose constructor throws while 'failures' is non-zero
+  struct fragile
+  {
+    explicit fragile( std::string value )
+      : value(std::move(value))
+    {
+      if( failures > 0 ) {
+        --failures;
+        throw std::runtime_error("fragile");
+      }
+    }
+
+    std::string value;
+
+    static int failures;
+  };
+
+  int fragile::failures = 0;
+
+  struct empty{};
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Layout
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy<T,Args...> layout", "[layout]")
+{
+  SECTION("Empty arguments take no space")
+  {
+    STATIC_REQUIRE( sizeof(bit::stl::inplace_lazy<int>) == 2 * sizeof(int) );
+    STATIC_REQUIRE( sizeof(bit::stl::inplace_lazy<int,empty>) == 2 * sizeof(int) );
+  }
+
+  SECTION("Arguments share storage with the value")
+  {
+    using lazy_type = bit::stl::inplace_lazy<std::string,const char*,std::size_t>;
+
+    STATIC_REQUIRE( sizeof(lazy_type) == sizeof(std::string) + alignof(std::string) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy()", "[ctor]")
+{
+  bit::stl::inplace_lazy<std::string> lazy;
+
+  SECTION("Is uninitialized")
+  {
+    REQUIRE_FALSE( lazy.has_value() );
+  }
+
+  SECTION("Default constructs on initialization")
+  {
+    REQUIRE( lazy.value() == std::string() );
+    REQUIRE( lazy.has_value() );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy( in_place_t, Args&&... )", "[ctor]")
+{
+  bit::stl::inplace_lazy<std::string,const char*,std::size_t> lazy( bit::stl::in_place, "Hello World", 5 );
+
+  SECTION("Is uninitialized")
+  {
+    REQUIRE_FALSE( lazy.has_value() );
+  }
+
+  SECTION("Constructs from the arguments on initialization")
+  {
+    REQUIRE( lazy.value() == "Hello" );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy( const inplace_lazy& )", "[ctor]")
+{
+  auto lazy = bit::stl::make_inplace_lazy<std::string>( std::string("Hello World") );
+
+  SECTION("Copy constructs an uninitialized lazy")
+  {
+    auto copy = lazy;
+
+    REQUIRE_FALSE( copy.has_value() );
+    REQUIRE( copy.value() == "Hello World" );
+    REQUIRE_FALSE( lazy.has_value() );
+  }
+
+  SECTION("Copy constructs an initialized lazy")
+  {
+    lazy.initialize();
+    auto copy = lazy;
+
+    REQUIRE( copy.has_value() );
+    REQUIRE( *copy == "Hello World" );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy( inplace_lazy&& )", "[ctor]")
+{
+  auto lazy = bit::stl::make_inplace_lazy<std::string>( std::string("Hello World") );
+
+  SECTION("Move constructs an uninitialized lazy")
+  {
+    auto copy = std::move(lazy);
+
+    REQUIRE_FALSE( copy.has_value() );
+    REQUIRE( copy.value() == "Hello World" );
+  }
+
+  SECTION("Move constructs an initialized lazy")
+  {
+    lazy.initialize();
+    auto copy = std::move(lazy);
+
+    REQUIRE( copy.has_value() );
+    REQUIRE( *copy == "Hello World" );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::inplace_lazy::value()", "[observers]")
+{
+  auto lazy = bit::stl::make_inplace_lazy<fragile>( std::string("Hello World") );
+
+  SECTION("Failed construction restores the arguments")
+  {
+    fragile::failures = 1;
+
+    REQUIRE_THROWS_AS( lazy.value(), std::runtime_error );
+    REQUIRE_FALSE( lazy.has_value() );
+    REQUIRE( lazy.value().value == "Hello World" );
+  }
+
+  SECTION("Returns the same instance on every access")
+  {
+    REQUIRE( &lazy.value() == &lazy.value() );
+    REQUIRE( lazy->value == "Hello World" );
+  }
+}
@@ -5,10 +5,62 @@
 
 #include <bit/stl/utilities/lazy.hpp>
 
+#include <atomic>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <catch.hpp>
 
+namespace {
+
+  /// A type that counts its constructions, and throws from its constructor
+  /// while 'failures' is non-zero
+  struct counted
+  {
+    explicit counted( int value )
+      : value(value)
+    {
+      if( failures.load() > 0 && failures.fetch_sub(1) > 0 ) {
+        throw std::runtime_error("counted");
+      }
+      std::this_thread::yield();
+      ++constructions;
+    }
+
+    int value;
+
+    static std::atomic<int> constructions;
+    static std::atomic<int> failures;
+  };
+
+  /// A type that consumes a string, and throws from its constructor while
+  /// 'failures' is non-zero
+  struct named
+  {
+    explicit named( std::string name )
+      : name(std::move(name))
+    {
+      if( failures > 0 ) {
+        --failures;
+        throw std::runtime_error("named");
+      }
+    }
+
+    std::string name;
+
+    static int failures;
+  };
+
+  int named::failures = 0;
+
+  std::atomic<int> counted::constructions{0};
+  std::atomic<int> counted::failures{0};
+
+} // anonymous namespace
+
 //----------------------------------------------------------------------------
 // Constructor / Destructor
 //----------------------------------------------------------------------------
@@ -1203,3 +1255,90 @@ TEST_CASE("bit::stl::make_lazy_generator<T>( Ctor&& )", "[utility]")
     REQUIRE( lazy.value() == 42 );
   }
 }
+
+//----------------------------------------------------------------------------
+// Concurrent Policy
+//----------------------------------------------------------------------------
+
+TEST_CASE("bit::stl::concurrent_lazy<T>", "[concurrency]")
+{
+  counted::constructions = 0;
+  counted::failures = 0;
+
+  SECTION("Behaves as a lazy")
+  {
+    bit::stl::concurrent_lazy<std::string> lazy( bit::stl::in_place, "Hello World" );
+    auto copy = lazy;
+
+    REQUIRE_FALSE( lazy.has_value() );
+    REQUIRE( lazy.value() == "Hello World" );
+    REQUIRE( lazy.has_value() );
+    REQUIRE_FALSE( copy.has_value() );
+
+    lazy.reset();
+    REQUIRE_FALSE( lazy.has_value() );
+  }
+
+  SECTION("Constructs exactly once when raced")
+  {
+    const bit::stl::concurrent_lazy<counted> lazy( bit::stl::in_place, 42 );
+    auto threads = std::vector<std::thread>{};
+    std::atomic<int> sum{0};
+
+    for( auto i = 0; i < 8; ++i ) {
+      threads.emplace_back([&]{ sum += lazy.value().value; });
+    }
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+
+    REQUIRE( counted::constructions == 1 );
+    REQUIRE( sum == 8 * 42 );
+  }
+
+  SECTION("Failed construction is retried")
+  {
+    const bit::stl::concurrent_lazy<counted> lazy( bit::stl::in_place, 42 );
+    counted::failures = 1;
+
+    REQUIRE_THROWS_AS( lazy.value(), std::runtime_error );
+    REQUIRE_FALSE( lazy.has_value() );
+    REQUIRE( lazy.value().value == 42 );
+    REQUIRE( counted::constructions == 1 );
+  }
+
+  SECTION("Failed construction retries with the original arguments")
+  {
+    const bit::stl::concurrent_lazy<named> lazy( bit::stl::in_place, std::string(32,'x') );
+    named::failures = 1;
+
+    REQUIRE_THROWS_AS( lazy.value(), std::runtime_error );
+    REQUIRE( lazy.value().name == std::string(32,'x') );
+  }
+
+  SECTION("Waiting threads retry after a failed construction")
+  {
+    const bit::stl::concurrent_lazy<counted> lazy( bit::stl::in_place, 42 );
+    auto threads = std::vector<std::thread>{};
+    std::atomic<int> errors{0};
+    std::atomic<int> sum{0};
+    counted::failures = 3;
+
+    for( auto i = 0; i < 8; ++i ) {
+      threads.emplace_back([&]{
+        try {
+          sum += lazy.value().value;
+        } catch( const std::runtime_error& ) {
+          ++errors;
+        }
+      });
+    }
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+
+    REQUIRE( counted::constructions == 1 );
+    REQUIRE( errors == 3 );
+    REQUIRE( sum == 5 * 42 );
+  }
+}
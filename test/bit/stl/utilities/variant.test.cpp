@@ -8,8 +8,9 @@
 
 #include <bit/stl/utilities/variant.hpp>
 
-#include <string> // std::string
-#include <memory> // std::unique_ptr
+#include <cstdint> // std::int8_t
+#include <string>  // std::string
+#include <memory>  // std::unique_ptr
 
 #include <catch.hpp>
 
@@ -17,6 +18,8 @@ static_assert( std::is_trivially_destructible<bit::stl::variant<int,bool>>::valu
                "Variant containing trivially destructible types must be trivially destructible" );
 static_assert( !std::is_trivially_destructible<bit::stl::variant<std::string,bool>>::value,
                "Variant containing non-trivially destructible types must not be trivially destructible" );
+static_assert( sizeof(bit::stl::variant<std::int8_t,bool>) == 2,
+               "Variant index must use the smallest type that fits the alternatives" );
 
 namespace {
   struct throw_on_move
@@ -663,3 +666,84 @@ TEST_CASE("variant::swap( variant& )", "[modifiers]")
     }
   }
 }
+
+//-----------------------------------------------------------------------------
+// Visitation
+//-----------------------------------------------------------------------------
+
+namespace {
+
+  struct type_name_visitor
+  {
+    std::string operator()( int ) const { return "int"; }
+    std::string operator()( bool ) const { return "bool"; }
+    std::string operator()( const std::string& ) const { return "string"; }
+  };
+
+  struct pair_visitor
+  {
+    template<typename T, typename U>
+    std::string operator()( const T& lhs, const U& rhs ) const
+    {
+      return type_name_visitor{}(lhs) + "," + type_name_visitor{}(rhs);
+    }
+  };
+
+} // anonymous namespace
+
+TEST_CASE("visit( Visitor&&, Variants&&... )", "[visitation]")
+{
+  using namespace std::string_literals;
+  using variant_type = bit::stl::variant<int,bool,std::string>;
+
+  SECTION("Visits the active alternative")
+  {
+    REQUIRE( bit::stl::visit( type_name_visitor{}, variant_type{42} ) == "int" );
+    REQUIRE( bit::stl::visit( type_name_visitor{}, variant_type{true} ) == "bool" );
+    REQUIRE( bit::stl::visit( type_name_visitor{}, variant_type{"hello"s} ) == "string" );
+  }
+
+  SECTION("Forwards the value category of the variant")
+  {
+    auto v = variant_type{"hello world"s};
+
+    bit::stl::visit( []( auto& x ){ x = std::decay_t<decltype(x)>{}; }, v );
+    REQUIRE( bit::stl::get<2>(v).empty() );
+
+    auto moved = bit::stl::visit( []( auto&& x ){
+      return std::is_rvalue_reference<decltype(x)>::value;
+    }, std::move(v) );
+    REQUIRE( moved );
+  }
+
+  SECTION("Visits every combination of multiple variants")
+  {
+    const auto lhs = variant_type{true};
+    const auto rhs = variant_type{"hello"s};
+
+    REQUIRE( bit::stl::visit( pair_visitor{}, lhs, rhs ) == "bool,string" );
+    REQUIRE( bit::stl::visit( pair_visitor{}, rhs, lhs ) == "string,bool" );
+    REQUIRE( bit::stl::visit( pair_visitor{}, rhs, variant_type{5} ) == "string,int" );
+  }
+
+  SECTION("Visits variants of different sizes")
+  {
+    const auto lhs = bit::stl::variant<int,std::string>{"a"s};
+    const auto rhs = variant_type{false};
+
+    REQUIRE( bit::stl::visit( pair_visitor{}, lhs, rhs ) == "string,bool" );
+    REQUIRE( bit::stl::visit( pair_visitor{}, rhs, lhs ) == "bool,string" );
+  }
+
+  SECTION("Throws when visiting a valueless variant")
+  {
+    auto v = bit::stl::variant<int,::throw_on_move>{};
+    try {
+      v = ::throw_on_move{};
+    } catch (...) {}
+
+    REQUIRE( v.valueless_by_exception() );
+    REQUIRE( v.index() == bit::stl::variant_npos );
+    REQUIRE_THROWS_AS( bit::stl::visit( []( auto&& ){}, v ), bit::stl::bad_variant_access );
+  }
+}